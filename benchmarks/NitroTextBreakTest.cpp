@@ -0,0 +1,163 @@
+//
+// NitroTextBreakTest.cpp
+// Conformance of the native line breaker and grapheme segmenter with the
+// Unicode test data
+//
+// Runs every case of LineBreakTest.txt through `findLineBreaks` with the
+// default rules (`LineBreakStrategyIOS::NONE`), or every case of
+// GraphemeBreakTest.txt through the grapheme boundaries walked forwards,
+// backwards and tested one offset at a time, and prints the ones that
+// differ. Without a file it runs the reduced sets in benchmarks/fixtures
+// (see their headers); break-tests.test.ts runs both. The full files are in
+// the Unicode Character Database next to the tables both are generated from:
+//   https://www.unicode.org/Public/15.0.0/ucd/auxiliary/LineBreakTest.txt
+//   https://www.unicode.org/Public/15.0.0/ucd/auxiliary/GraphemeBreakTest.txt
+// Built with the benchmarks (see benchmarks/CMakeLists.txt). From the
+// repository root:
+//   build/benchmarks/NitroTextBreakTest line [LineBreakTest.txt]
+//   build/benchmarks/NitroTextBreakTest grapheme [GraphemeBreakTest.txt]
+//
+
+#include "NitroTextGrapheme.hpp"
+#include "NitroTextLineBreak.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+constexpr std::string_view kBreak = "\xC3\xB7"; // ÷
+constexpr std::string_view kNoBreak = "\xC3\x97"; // ×
+
+struct TestCase {
+  std::string text;
+  // Byte offsets of the expected breaks, the end of the text included.
+  std::vector<size_t> breaks;
+};
+
+void appendUtf8(std::string& out, char32_t codepoint)
+{
+  if (codepoint < 0x80) {
+    out += static_cast<char>(codepoint);
+  } else if (codepoint < 0x800) {
+    out += static_cast<char>(0xC0 | (codepoint >> 6));
+    out += static_cast<char>(0x80 | (codepoint & 0x3F));
+  } else if (codepoint < 0x10000) {
+    out += static_cast<char>(0xE0 | (codepoint >> 12));
+    out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (codepoint & 0x3F));
+  } else {
+    out += static_cast<char>(0xF0 | (codepoint >> 18));
+    out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+    out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (codepoint & 0x3F));
+  }
+}
+
+// `× 0023 × 0308 ÷ 0020 ÷  # comment`: a mark before and after every
+// codepoint. Returns false on comments and blank lines.
+bool parseTestCase(const std::string& line, TestCase& test)
+{
+  std::istringstream fields(line.substr(0, line.find('#')));
+  std::string field;
+  test = TestCase{};
+  bool any = false;
+  while (fields >> field) {
+    if (field == kBreak) {
+      if (!test.text.empty()) test.breaks.push_back(test.text.size());
+    } else if (field != kNoBreak) {
+      appendUtf8(test.text, static_cast<char32_t>(std::strtoul(field.c_str(), nullptr, 16)));
+      any = true;
+    }
+  }
+  return any;
+}
+
+std::vector<size_t> lineBreakOffsets(const std::string& text)
+{
+  std::vector<size_t> offsets;
+  for (const LineBreak& lineBreak : findLineBreaks(text, LineBreakStrategyIOS::NONE)) {
+    offsets.push_back(lineBreak.offset);
+  }
+  return offsets;
+}
+
+// The boundaries after the start walked forwards, or empty if walking
+// backwards, counting or testing each offset disagrees with them.
+std::vector<size_t> graphemeBoundaries(const std::string& text)
+{
+  std::vector<size_t> forwards;
+  for (size_t at = 0; at < text.size();) {
+    at = nextGraphemeBoundary(text, at);
+    forwards.push_back(at);
+  }
+  std::vector<size_t> backwards;
+  for (size_t at = text.size(); at > 0; at = previousGraphemeBoundary(text, at)) {
+    backwards.insert(backwards.begin(), at);
+  }
+  if (backwards != forwards || countGraphemes(text) != forwards.size()) return {};
+  for (size_t offset = 1; offset < text.size(); offset++) {
+    const bool boundary = std::find(forwards.begin(), forwards.end(), offset) != forwards.end();
+    if (isGraphemeBoundary(text, offset) != boundary) return {};
+  }
+  return forwards;
+}
+
+std::string describe(const std::vector<size_t>& offsets)
+{
+  std::string out;
+  for (const size_t offset : offsets) {
+    if (!out.empty()) out += ' ';
+    out += std::to_string(offset);
+  }
+  return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const std::string_view mode = argc > 1 ? argv[1] : "";
+  if (mode != "line" && mode != "grapheme") {
+    std::fprintf(stderr, "usage: %s line [LineBreakTest.txt]\n       %s grapheme [GraphemeBreakTest.txt]\n",
+                 argv[0], argv[0]);
+    return 2;
+  }
+  const std::string path = argc > 2 ? argv[2]
+                           : mode == "line" ? "benchmarks/fixtures/LineBreakTest-reduced.txt"
+                                            : "benchmarks/fixtures/GraphemeBreakTest-reduced.txt";
+  std::ifstream file(path);
+  if (!file) {
+    std::fprintf(stderr, "cannot read %s\n", path.c_str());
+    return 2;
+  }
+
+  size_t total = 0;
+  size_t failed = 0;
+  size_t lineNumber = 0;
+  std::string line;
+  TestCase test;
+  while (std::getline(file, line)) {
+    lineNumber++;
+    if (!parseTestCase(line, test)) continue;
+    total++;
+    const std::vector<size_t> actual =
+        mode == "line" ? lineBreakOffsets(test.text) : graphemeBoundaries(test.text);
+    if (actual != test.breaks) {
+      if (failed++ < 20) {
+        std::printf("line %zu: expected [%s], got [%s]\n  %s\n", lineNumber, describe(test.breaks).c_str(),
+                    describe(actual).c_str(), line.c_str());
+      }
+    }
+  }
+  std::printf("%zu of %zu cases pass\n", total - failed, total);
+  return failed == 0 ? 0 : 1;
+}
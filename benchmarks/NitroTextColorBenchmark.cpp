@@ -0,0 +1,82 @@
+//
+// NitroTextColorBenchmark.cpp
+// Parse throughput of `parseColor` over a corpus of CSS colors
+//
+// Built with the benchmarks (see benchmarks/CMakeLists.txt). From the
+// repository root:
+//   build/benchmarks/NitroTextColorBenchmark [iterations]
+//
+
+#include "NitroTextAtom.hpp"
+#include "NitroTextColor.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+struct Corpus {
+  const char* name;
+  std::vector<std::string> colors;
+};
+
+std::vector<Corpus> makeCorpora()
+{
+  return {
+      {"named", {"red", "black", "white", "rebeccapurple", "lightgoldenrodyellow",
+                 "Gray", "cornflowerblue", "transparent", "darkslategrey", "tomato"}},
+      {"hex", {"#fff", "#000", "#1e90ff", "#FF000080", "#0f08", "0xff00ff",
+               "#333333", "#abcdef", "#12345678", "#ccc"}},
+      {"rgb", {"rgb(255, 0, 0)", "rgba(0,0,255,0.5)", "rgb(50%, 100%, 0%)",
+               "rgba(10, 20, 30, 1e-1)", "RGB(1,2,3)", "rgba(255,255,255,.25)",
+               "rgb( 12 , 34 , 56 )", "rgba(0, 0, 0, 100%)"}},
+      {"decimal", {"4278190080", "4294901760", "4278255360", "4278190335",
+                   "2147483647", "16777215", "4294967295", "255"}},
+      {"invalid", {"", "nope", "#12345", "rgb(1,2)", "hsl(0, 100%, 50%)",
+                   "   ", "0xzz", "rgba(a,b,c,d)"}},
+  };
+}
+
+template <typename Fn>
+double nanosPerCall(const std::vector<std::string>& colors, int iterations, Fn&& fn)
+{
+  uint32_t sink = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    for (const auto& color : colors) {
+      sink ^= fn(color).value_or(0);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  // Keep the loop observable so it is not optimized away.
+  if (sink == 0xdeadbeef) std::puts("");
+  const double nanos = std::chrono::duration<double, std::nano>(end - start).count();
+  return nanos / (static_cast<double>(iterations) * colors.size());
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+  const auto corpora = makeCorpora();
+
+  std::printf("%-10s %14s %14s\n", "corpus", "parse ns/op", "atom ns/op");
+  for (const auto& corpus : corpora) {
+    const double parse = nanosPerCall(corpus.colors, iterations, [](const std::string& s) {
+      return parseColor(s);
+    });
+    const double atom = nanosPerCall(corpus.colors, iterations, [](const std::string& s) {
+      return Atom::intern(std::string_view(s)).color();
+    });
+    std::printf("%-10s %14.1f %14.1f\n", corpus.name, parse, atom);
+  }
+  return 0;
+}
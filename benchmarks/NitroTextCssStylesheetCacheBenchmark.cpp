@@ -0,0 +1,69 @@
+//
+// NitroTextCssStylesheetCacheBenchmark.cpp
+// Rendering an inbox whose rows share one template stylesheet
+//
+// Renders the same list of rows twice: once clearing CssStylesheetCache
+// before every row, so each row compiles its `<style>` block like it did
+// before the cache, and once with the cache warm. From the repository
+// root (see benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextCssStylesheetCacheBenchmark [rows]
+//
+
+#include "NitroTextCssStylesheetCache.hpp"
+#include "NitroTextHtmlEmail.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::benchmarks::makeHtmlEmail;
+
+namespace {
+
+template <typename BeforeRow>
+double renderInbox(const std::vector<std::string>& rows, const Fragment& base, BeforeRow&& beforeRow)
+{
+  size_t fragments = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& row : rows) {
+    beforeRow();
+    fragments += HtmlRenderer::render(row, base).fragments.size();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  if (fragments == 0) std::printf("(nothing rendered)\n");
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int rowCount = argc > 1 ? std::atoi(argv[1]) : 500;
+
+  // Every row is a one-article email with the newsletter's <style> block.
+  std::vector<std::string> rows;
+  for (int i = 0; i < rowCount; i++) {
+    rows.push_back(makeHtmlEmail(1));
+  }
+
+  Fragment base;
+  base.fontSize = 14;
+  base.fontColor = "#222";
+
+  const double cold = renderInbox(rows, base, [] { CssStylesheetCache::clear(); });
+  CssStylesheetCache::clear();
+  const double warm = renderInbox(rows, base, [] {});
+  const auto stats = CssStylesheetCache::stats();
+
+  std::printf("%-8s %6s %12s %12s\n", "cache", "rows", "ms/inbox", "us/row");
+  std::printf("%-8s %6d %12.3f %12.2f\n", "cold", rowCount, cold, cold * 1000.0 / rowCount);
+  std::printf("%-8s %6d %12.3f %12.2f\n", "warm", rowCount, warm, warm * 1000.0 / rowCount);
+  std::printf("\nhits %llu, misses %llu, entries %zu, compiling %.3f ms\n",
+              static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses),
+              stats.entries, stats.compileMilliseconds);
+  return 0;
+}
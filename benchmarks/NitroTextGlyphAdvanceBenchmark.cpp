@@ -0,0 +1,138 @@
+//
+// NitroTextGlyphAdvanceBenchmark.cpp
+// Run widths from cached glyph advances vs reading the font for every glyph
+//
+// Sums the width of Latin, CJK and mixed text a line at a time, the inner
+// loop of measuring off the platform text stack, and reports characters per
+// second. The shipped fonts have no CJK glyphs, so those read as `.notdef`;
+// the lookups cost the same. Pass a font with a `kern` table (DejaVuSans on
+// most Linux hosts) to include kerning. From the repository root
+// (see benchmarks/CMakeLists.txt), configured with
+// CMAKE_CXX_FLAGS=-DNITRO_TEXT_SIMD_SCALAR for the scalar kernels:
+//   build/benchmarks/NitroTextGlyphAdvanceBenchmark [font.ttf] [iterations]
+//
+
+#include "NitroTextGlyphAdvances.hpp"
+#include "NitroTextUtf8.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+constexpr std::string_view kLatin =
+    "The quick brown fox jumps over the lazy dog while the newsletter renders "
+    "its third section, with links, lists and a few Inline Styles. ";
+constexpr std::string_view kCjk =
+    "的一是在不了有和人这中大为上个国我以要他时来用们生到作地于出就分对成会可主发年动同工也能下过子说产种面而方后多定行学法所民得经"
+    "十三之进着等部度家电力里如水化高自二理起小物现实加量都两体制机当使点从业本去把性好应开它合还因由其些然前外天政四日那社义事平形相";
+constexpr std::string_view kMixed =
+    "Meeting notes: 会议纪要 — café, naïve, Zürich; 東京 and 서울 😀 👍🏽 "
+    "prices in € and ¥, then plain ASCII again for a while. ";
+
+// About `bytes` of `source`, in lines of `lineBytes`.
+std::vector<std::string> makeLines(std::string_view source, size_t bytes, size_t lineBytes)
+{
+  std::vector<std::string> lines;
+  std::string line;
+  size_t total = 0;
+  size_t at = 0;
+  while (total < bytes) {
+    // Whole codepoints only.
+    const size_t start = at;
+    decodeUtf8(source, at);
+    line.append(source.substr(start, at - start));
+    if (at == source.size()) at = 0;
+    if (line.size() >= lineBytes) {
+      total += line.size();
+      lines.push_back(std::move(line));
+      line.clear();
+    }
+  }
+  return lines;
+}
+
+size_t countCharacters(const std::vector<std::string>& lines)
+{
+  size_t count = 0;
+  for (const auto& line : lines) {
+    for (size_t i = 0; i < line.size();) {
+      decodeUtf8(line, i);
+      count++;
+    }
+  }
+  return count;
+}
+
+// The width without a cache: a cmap and hmtx lookup per character.
+float uncachedWidth(const FontFile& font, float scale, std::string_view text, float letterSpacing)
+{
+  float width = 0;
+  bool hasPrevious = false;
+  uint16_t previous = 0;
+  for (size_t i = 0; i < text.size();) {
+    const uint16_t glyph = font.glyphIndex(decodeUtf8(text, i));
+    width += font.advance(glyph) * scale + letterSpacing;
+    if (hasPrevious) width += font.kerning(previous, glyph) * scale;
+    previous = glyph;
+    hasPrevious = true;
+  }
+  return width;
+}
+
+template <typename Measure>
+double charactersPerSecond(const std::vector<std::string>& lines, size_t characters, int iterations,
+                           Measure measure)
+{
+  volatile float sink = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    for (const auto& line : lines) sink = sink + measure(line);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return characters * static_cast<double>(iterations) / std::chrono::duration<double>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const std::string path = argc > 1 ? argv[1] : "example/assets/fonts/ChivoMono.ttf";
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 20;
+  const auto font = FontFile::open(path);
+  if (!font) {
+    std::fprintf(stderr, "cannot read %s\n", path.c_str());
+    return 1;
+  }
+  const auto cache = GlyphAdvanceCache::shared(font, 15);
+
+  std::printf("%s, kern %s, %s kernels\n", path.c_str(), font->hasKerning() ? "yes" : "no",
+              GlyphAdvanceCache::backend());
+  std::printf("%-8s %8s %14s %14s %14s\n", "corpus", "line B", "uncached M/s", "cache M/s", "+spacing M/s");
+  const struct {
+    const char* name;
+    std::string_view source;
+  } corpora[] = {{"latin", kLatin}, {"cjk", kCjk}, {"mixed", kMixed}};
+  for (const auto& corpus : corpora) {
+    for (const size_t lineBytes : {24, 200}) {
+      const auto lines = makeLines(corpus.source, 1 << 20, lineBytes);
+      const size_t characters = countCharacters(lines);
+      const double uncached = charactersPerSecond(lines, characters, iterations, [&](std::string_view line) {
+        return uncachedWidth(*font, cache->scale(), line, 0);
+      });
+      const double cached = charactersPerSecond(lines, characters, iterations,
+                                                [&](std::string_view line) { return cache->width(line); });
+      const double spaced = charactersPerSecond(lines, characters, iterations,
+                                                [&](std::string_view line) { return cache->width(line, 0.5f); });
+      std::printf("%-8s %8zu %14.1f %14.1f %14.1f\n", corpus.name, lineBytes, uncached / 1e6, cached / 1e6,
+                  spaced / 1e6);
+    }
+  }
+  return 0;
+}
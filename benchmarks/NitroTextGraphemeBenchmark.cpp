@@ -0,0 +1,119 @@
+//
+// NitroTextGraphemeBenchmark.cpp
+// Grapheme cluster boundaries per megabyte, and ellipsizing long lines
+//
+// Walks the grapheme clusters of about 1 MiB of text per script forwards and
+// backwards one at a time, counts them, and reports MB/s and clusters per
+// KiB. Then cuts the same text to a 300 pt line with every ellipsize mode
+// and reports microseconds per cut, which should not grow with the text.
+// From the repository root (see benchmarks/CMakeLists.txt), configured with
+// CMAKE_CXX_FLAGS=-DNITRO_TEXT_SIMD_SCALAR for the scalar skip:
+//   build/benchmarks/NitroTextGraphemeBenchmark [font.ttf] [iterations]
+//
+
+#include "NitroTextEllipsize.hpp"
+#include "NitroTextGrapheme.hpp"
+#include "NitroTextSimdScan.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+constexpr struct {
+  const char* name;
+  std::string_view sample;
+} kCorpora[] = {
+    {"english",
+     "The quarterly report (attached) shows revenue up 12.5% to $4,210,000; see section 3-B for details. "
+     "Please reply by Friday, 10/14, if anything looks off!\r\n"},
+    // Decomposed: every accent is a combining mark of its own.
+    {"nfd-latin",
+     "Le cafe\xCC\x81 pre\xCC\x81" "fe\xCC\x81re\xCC\x81 de Zu\xCC\x88rich ouvre a\xCC\x80 8 h, "
+     "me\xCC\x82me le dimanche, avec des cre\xCC\x80mes bru\xCC\x82le\xCC\x81" "es.\n"},
+    {"russian",
+     "Съешь же ещё этих мягких французских булок, да выпей чаю. Заседание перенесено на 15:30, "
+     "повестка дня «Бюджет на 2025 год» остаётся без изменений.\n"},
+    {"hindi",
+     "नमस्ते! आज की बैठक दोपहर तीन बजे होगी। कृपया अपनी रिपोर्ट समय पर जमा करें, "
+     "और किसी भी प्रश्न के लिए टीम से संपर्क करें।\n"},
+    {"chinese",
+     "今天下午三点在会议室召开项目进度会议，请各位准时参加。会议内容包括：第一季度总结、"
+     "第二季度计划以及预算调整（详见附件）。\n"},
+    // Conjoining jamo: three codepoints per syllable.
+    {"hangul-jamo",
+     "\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB\xE1\x84\x80\xE1\x85\xB3\xE1\x86\xAF "
+     "\xE1\x84\x8B\xE1\x85\xA1\xE1\x86\xAB\xE1\x84\x82\xE1\x85\xA7\xE1\x86\xBC\n"},
+    {"emoji",
+     "Great job team 🎉🎉 👍🏽 see you at the offsite 🏖️ — bring the 🇺🇸🇯🇵🇩🇪 flags and "
+     "👨‍👩‍👧‍👦 photos! 🏳️‍🌈 ❤️‍🔥 🧑🏿‍💻\n"},
+};
+
+std::string repeatToSize(std::string_view sample, size_t bytes)
+{
+  std::string text;
+  text.reserve(bytes + sample.size());
+  while (text.size() < bytes) text.append(sample);
+  return text;
+}
+
+template <typename Run>
+double megabytesPerSecond(const std::string& text, int iterations, Run run)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) run();
+  const auto end = std::chrono::steady_clock::now();
+  return text.size() * static_cast<double>(iterations) / std::chrono::duration<double>(end - start).count() / 1e6;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const std::string path = argc > 1 ? argv[1] : "example/assets/fonts/ChivoMono.ttf";
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 10;
+  const auto font = FontFile::open(path);
+  if (!font) {
+    std::fprintf(stderr, "cannot read %s\n", path.c_str());
+    return 1;
+  }
+  const auto advances = GlyphAdvanceCache::shared(font, 15);
+
+  std::printf("%s skip\n", simd::kBackend);
+  std::printf("%-12s %12s %12s %12s %12s %10s %10s %10s\n", "corpus", "next MB/s", "prev MB/s", "count MB/s",
+              "clusters/KiB", "tail us", "head us", "middle us");
+  for (const auto& corpus : kCorpora) {
+    const std::string text = repeatToSize(corpus.sample, 1 << 20);
+    volatile size_t sink = 0;
+    size_t clusters = 0;
+
+    const double forwards = megabytesPerSecond(text, iterations, [&] {
+      clusters = 0;
+      for (size_t at = 0; at < text.size(); at = nextGraphemeBoundary(text, at)) clusters++;
+    });
+    const double backwards = megabytesPerSecond(text, iterations, [&] {
+      size_t count = 0;
+      for (size_t at = text.size(); at > 0; at = previousGraphemeBoundary(text, at)) count++;
+      sink = sink + count;
+    });
+    const double counting =
+        megabytesPerSecond(text, iterations, [&] { sink = sink + countGraphemes(text); });
+
+    std::printf("%-12s %12.1f %12.1f %12.1f %12.1f", corpus.name, forwards, backwards, counting,
+                clusters * 1024.0 / text.size());
+    for (const auto mode : {EllipsizeMode::TAIL, EllipsizeMode::HEAD, EllipsizeMode::MIDDLE}) {
+      constexpr int kCuts = 1000;
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < kCuts; i++) sink = sink + ellipsize(text, 300, mode, *advances).size();
+      const auto end = std::chrono::steady_clock::now();
+      std::printf(" %10.2f", std::chrono::duration<double, std::micro>(end - start).count() / kCuts);
+    }
+    std::printf("\n");
+  }
+  return 0;
+}
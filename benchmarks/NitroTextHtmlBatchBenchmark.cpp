@@ -0,0 +1,77 @@
+//
+// NitroTextHtmlBatchBenchmark.cpp
+// Scaling of batch rendering over WorkStealingPool from 1 to N threads
+//
+// Renders the bodies of a mail sync (emails of mixed sizes) on pools of
+// 1, 2, 4, ... up to the core count, the way renderHtmlBatch fans them out,
+// and prints the speedup over a single thread. From the repository
+// root (see benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextHtmlBatchBenchmark [documents] [max threads]
+//
+
+#include "NitroTextHtmlEmail.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+#include "NitroTextWorkPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::benchmarks::makeHtmlEmail;
+
+namespace {
+
+double renderBatch(WorkStealingPool& pool, const std::vector<std::string>& htmls, const Fragment& base)
+{
+  std::vector<HtmlRenderResult> results(htmls.size());
+  const auto start = std::chrono::steady_clock::now();
+  pool.forEach(htmls.size(), [&](size_t i) { results[i] = HtmlRenderer::render(htmls[i], base); });
+  const auto end = std::chrono::steady_clock::now();
+  for (const auto& result : results) {
+    if (result.fragments.empty()) std::printf("(nothing rendered)\n");
+  }
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int documents = argc > 1 ? std::atoi(argv[1]) : 400;
+  const size_t maxThreads =
+      argc > 2 ? std::strtoul(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+  // Mostly short messages with the odd long newsletter.
+  std::vector<std::string> htmls;
+  size_t bytes = 0;
+  for (int i = 0; i < documents; i++) {
+    htmls.push_back(makeHtmlEmail(i % 10 == 0 ? 40 : 1 + i % 4));
+    bytes += htmls.back().size();
+  }
+
+  Fragment base;
+  base.fontSize = 14;
+  base.fontColor = "#222";
+
+  std::printf("%d documents, %zu KiB\n\n", documents, bytes / 1024);
+  std::printf("%-8s %12s %10s\n", "threads", "ms/batch", "speedup");
+  std::vector<size_t> threadCounts;
+  for (size_t threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+  threadCounts.push_back(maxThreads);
+
+  double single = 0;
+  for (const size_t threads : threadCounts) {
+    WorkStealingPool pool(threads);
+    renderBatch(pool, htmls, base);
+    double best = 1e300;
+    for (int run = 0; run < 5; run++) best = std::min(best, renderBatch(pool, htmls, base));
+    if (threads == 1) single = best;
+    std::printf("%-8zu %12.3f %9.2fx\n", threads, best, single / best);
+  }
+  return 0;
+}
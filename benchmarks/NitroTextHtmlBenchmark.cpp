@@ -0,0 +1,76 @@
+//
+// NitroTextHtmlBenchmark.cpp
+// Throughput of the native HTML renderer on large HTML emails
+//
+// From the repository root (see benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextHtmlBenchmark [iterations] [file.html ...]
+//
+// Without files it renders the synthetic newsletter from
+// example/src/utils/htmlEmail.ts (`makeHtmlEmail`) at three sizes, the same
+// input the example app's "HTML Email Benchmark" mounts.
+//
+
+#include "NitroTextHtmlEmail.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::benchmarks::makeHtmlEmail;
+
+namespace {
+
+struct Email {
+  std::string name;
+  std::string html;
+};
+
+std::vector<Email> loadEmails(int argc, char** argv)
+{
+  std::vector<Email> emails;
+  for (int i = 2; i < argc; i++) {
+    std::ifstream file(argv[i], std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    emails.push_back({argv[i], contents.str()});
+  }
+  if (emails.empty()) {
+    emails.push_back({"email x8", makeHtmlEmail(8)});
+    emails.push_back({"email x80", makeHtmlEmail(80)});
+    emails.push_back({"email x800", makeHtmlEmail(800)});
+  }
+  return emails;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 20;
+  const auto emails = loadEmails(argc, argv);
+
+  Fragment base;
+  base.fontSize = 14;
+  base.fontColor = "#222";
+
+  std::printf("%-12s %10s %10s %12s %10s\n", "input", "KiB", "fragments", "ms/render", "MiB/s");
+  for (const auto& email : emails) {
+    size_t fragments = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+      fragments = HtmlRenderer::render(email.html, base).fragments.size();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const double ms = std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+    const double mib = email.html.size() / (1024.0 * 1024.0);
+    std::printf("%-12s %10.1f %10zu %12.3f %10.1f\n", email.name.c_str(),
+                email.html.size() / 1024.0, fragments, ms, mib / (ms / 1000.0));
+  }
+  return 0;
+}
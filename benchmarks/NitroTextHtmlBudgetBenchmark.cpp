@@ -0,0 +1,90 @@
+//
+// NitroTextHtmlBudgetBenchmark.cpp
+// Worst-case latency of the native HTML renderer on hostile markup
+//
+// Renders pathological documents (deep nesting, thousands of unclosed tags,
+// attribute storms, unterminated comments) with the default HtmlRenderBudget
+// and without one, and prints the time and the limit that tripped. From the
+// repository root (see benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextHtmlBudgetBenchmark [repetitions]
+//
+
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+struct Case {
+  const char* name;
+  std::string html;
+};
+
+std::string repeat(std::string_view piece, int count)
+{
+  std::string out;
+  out.reserve(piece.size() * count);
+  for (int i = 0; i < count; i++) out += piece;
+  return out;
+}
+
+const char* limitName(HtmlRenderLimit limit)
+{
+  switch (limit) {
+  case HtmlRenderLimit::None:
+    return "-";
+  case HtmlRenderLimit::Nodes:
+    return "nodes";
+  case HtmlRenderLimit::Depth:
+    return "depth";
+  case HtmlRenderLimit::Output:
+    return "output";
+  case HtmlRenderLimit::Time:
+    return "time";
+  }
+  return "?";
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int n = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+  // Deep nesting under a descendant selector makes every element look at
+  // all of its ancestors.
+  const std::string nested = "<style>div span b { color: red }</style>" + repeat("<div><span>x", n);
+  std::string attributes = "<p";
+  for (int i = 0; i < n; i++) attributes += " data-a" + std::to_string(i) + "=\"v\"";
+  attributes += ">text</p>";
+
+  const std::vector<Case> cases = {
+      {"nesting", nested},
+      {"unclosed", repeat("<li><font><b>item ", n)},
+      {"attributes", attributes},
+      {"comments", repeat("<!-- x > text ", n)},
+      {"elements", repeat("<span>a</span>", n * 4)},
+  };
+
+  std::printf("%-12s %10s %12s %8s %12s\n", "case", "KiB", "default ms", "limit", "unlimited ms");
+  for (const auto& c : cases) {
+    auto time = [&](const HtmlRenderBudget& budget, HtmlRenderLimit& exceeded) {
+      const auto start = std::chrono::steady_clock::now();
+      exceeded = HtmlRenderer::render(c.html, Fragment(), budget).exceeded;
+      const auto end = std::chrono::steady_clock::now();
+      return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+    HtmlRenderLimit limited = HtmlRenderLimit::None;
+    HtmlRenderLimit unlimited = HtmlRenderLimit::None;
+    const double budgeted = time(HtmlRenderBudget(), limited);
+    const double free = time(HtmlRenderBudget::unlimited(), unlimited);
+    std::printf("%-12s %10zu %12.3f %8s %12.3f\n", c.name, c.html.size() / 1024, budgeted, limitName(limited), free);
+  }
+  return 0;
+}
@@ -0,0 +1,228 @@
+//
+// NitroTextHtmlEngineDriver.cpp
+// Native side of the TS vs C++ HTML renderer harness (html-engines.test.ts)
+//
+// Reads documents from stdin, renders each with HtmlRenderer::render a
+// number of times and writes one JSON line per document: the fragments and
+// text of the first render, the nanoseconds of every render, and the heap
+// allocations the first one made. Every document is
+//   <repeat> <base field count> <markup bytes>\n
+//   <field>\n<value>\n   (once per base field)
+//   <markup>\n
+// Built with the benchmarks (see benchmarks/CMakeLists.txt).
+//
+
+#include "NitroTextHtmlRenderer.hpp"
+#include "NitroTextStyleFlattener.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+bool gCounting = false;
+size_t gAllocations = 0;
+size_t gAllocatedBytes = 0;
+
+// The union members, in enum order.
+constexpr const char* kFontWeights[] = {"normal", "bold",  "ultralight",    "thin",      "light", "medium",
+                                        "regular", "semibold", "condensedBold", "condensed", "heavy", "black"};
+constexpr const char* kFontStyles[] = {"normal", "italic", "oblique"};
+constexpr const char* kTextAligns[] = {"auto", "left", "right", "center", "justify"};
+constexpr const char* kTextTransforms[] = {"none", "uppercase", "lowercase", "capitalize"};
+constexpr const char* kTextDecorationLines[] = {"none", "underline", "line-through", "underline line-through"};
+constexpr const char* kTextDecorationStyles[] = {"solid", "double", "dotted", "dashed"};
+
+template <typename Enum, size_t N>
+const char* nameOf(Enum value, const char* const (&names)[N])
+{
+  const auto index = static_cast<size_t>(value);
+  return index < N ? names[index] : "?";
+}
+
+void appendJsonString(std::string& out, std::string_view s)
+{
+  out.push_back('"');
+  for (const char c : s) {
+    if (c == '"' || c == '\\') {
+      out.push_back('\\');
+      out.push_back(c);
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      out.append(escaped);
+    } else {
+      out.push_back(c);
+    }
+  }
+  out.push_back('"');
+}
+
+void appendJsonNumber(std::string& out, double value)
+{
+  char number[32];
+  std::snprintf(number, sizeof(number), "%.17g", value);
+  out.append(number);
+}
+
+// Mirrors `Partial<Fragment>` as JSON, leaving out unset fields.
+void appendFragment(std::string& out, const Fragment& f)
+{
+  bool first = true;
+  auto key = [&](const char* name) {
+    out.append(first ? "{\"" : ",\"");
+    out.append(name);
+    out.append("\":");
+    first = false;
+  };
+  auto string = [&](const char* name, const std::optional<std::string>& value) {
+    if (!value) return;
+    key(name);
+    appendJsonString(out, *value);
+  };
+  auto number = [&](const char* name, const std::optional<double>& value) {
+    if (!value) return;
+    key(name);
+    appendJsonNumber(out, *value);
+  };
+  auto member = [&](const char* name, const auto& value, const auto& names) {
+    if (!value) return;
+    key(name);
+    appendJsonString(out, nameOf(*value, names));
+  };
+  string("text", f.text);
+  string("selectionColor", f.selectionColor);
+  number("fontSize", f.fontSize);
+  member("fontWeight", f.fontWeight, kFontWeights);
+  string("fontColor", f.fontColor);
+  string("fragmentBackgroundColor", f.fragmentBackgroundColor);
+  member("fontStyle", f.fontStyle, kFontStyles);
+  string("fontFamily", f.fontFamily);
+  number("lineHeight", f.lineHeight);
+  number("letterSpacing", f.letterSpacing);
+  member("textAlign", f.textAlign, kTextAligns);
+  member("textTransform", f.textTransform, kTextTransforms);
+  member("textDecorationLine", f.textDecorationLine, kTextDecorationLines);
+  string("textDecorationColor", f.textDecorationColor);
+  member("textDecorationStyle", f.textDecorationStyle, kTextDecorationStyles);
+  string("linkUrl", f.linkUrl);
+  out.append(first ? "{}" : "}");
+}
+
+void setBaseField(Fragment& base, const std::string& field, const std::string& value)
+{
+  if (field == "selectionColor") base.selectionColor = value;
+  else if (field == "fontSize") base.fontSize = std::strtod(value.c_str(), nullptr);
+  else if (field == "fontWeight") base.fontWeight = fontWeightFromString(value);
+  else if (field == "fontColor") base.fontColor = value;
+  else if (field == "fragmentBackgroundColor") base.fragmentBackgroundColor = value;
+  else if (field == "fontStyle") base.fontStyle = fontStyleFromString(value);
+  else if (field == "fontFamily") base.fontFamily = value;
+  else if (field == "lineHeight") base.lineHeight = std::strtod(value.c_str(), nullptr);
+  else if (field == "letterSpacing") base.letterSpacing = std::strtod(value.c_str(), nullptr);
+  else if (field == "textAlign") base.textAlign = textAlignFromString(value);
+  else if (field == "textTransform") base.textTransform = textTransformFromString(value);
+  else if (field == "textDecorationLine") base.textDecorationLine = textDecorationLineFromString(value);
+  else if (field == "textDecorationColor") base.textDecorationColor = value;
+  else if (field == "textDecorationStyle") base.textDecorationStyle = textDecorationStyleFromString(value);
+  else if (field == "linkUrl") base.linkUrl = value;
+  else std::fprintf(stderr, "ignoring unknown base field %s\n", field.c_str());
+}
+
+} // namespace
+
+void* operator new(size_t size)
+{
+  if (gCounting) {
+    gAllocations++;
+    gAllocatedBytes += size;
+  }
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+  std::free(pointer);
+}
+
+int main()
+{
+  const std::string input((std::istreambuf_iterator<char>(std::cin)), std::istreambuf_iterator<char>());
+  size_t pos = 0;
+  auto readLine = [&] {
+    size_t end = input.find('\n', pos);
+    if (end == std::string::npos) end = input.size();
+    std::string line = input.substr(pos, end - pos);
+    pos = end + 1;
+    return line;
+  };
+
+  std::string out;
+  while (pos < input.size()) {
+    int repeat = 0;
+    size_t fields = 0;
+    size_t bytes = 0;
+    if (std::sscanf(readLine().c_str(), "%d %zu %zu", &repeat, &fields, &bytes) != 3 || repeat < 1) {
+      std::fprintf(stderr, "malformed document header\n");
+      return 1;
+    }
+    Fragment base;
+    for (size_t i = 0; i < fields; i++) {
+      const std::string field = readLine();
+      setBaseField(base, field, readLine());
+    }
+    const std::string_view html = std::string_view(input).substr(pos, bytes);
+    pos += bytes + 1;
+
+    std::vector<long long> nanoseconds;
+    HtmlRenderResult first;
+    gAllocations = 0;
+    gAllocatedBytes = 0;
+    for (int i = 0; i < repeat; i++) {
+      gCounting = i == 0;
+      const auto start = std::chrono::steady_clock::now();
+      HtmlRenderResult result = HtmlRenderer::render(html, base);
+      const auto end = std::chrono::steady_clock::now();
+      gCounting = false;
+      nanoseconds.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+      if (i == 0) first = std::move(result);
+    }
+
+    out.clear();
+    out.append("{\"text\":");
+    appendJsonString(out, first.text);
+    out.append(",\"fragments\":[");
+    for (size_t i = 0; i < first.fragments.size(); i++) {
+      if (i > 0) out.push_back(',');
+      appendFragment(out, first.fragments[i]);
+    }
+    out.append("],\"nanoseconds\":[");
+    for (size_t i = 0; i < nanoseconds.size(); i++) {
+      if (i > 0) out.push_back(',');
+      out.append(std::to_string(nanoseconds[i]));
+    }
+    out.append("],\"allocations\":");
+    out.append(std::to_string(gAllocations));
+    out.append(",\"allocatedBytes\":");
+    out.append(std::to_string(gAllocatedBytes));
+    out.append("}\n");
+    std::fwrite(out.data(), 1, out.size(), stdout);
+  }
+  return 0;
+}
@@ -0,0 +1,75 @@
+//
+// NitroTextHtmlListBenchmark.cpp
+// Scaling of block and whitespace handling with the size of the document
+//
+// Renders documents of growing size and prints the time per item, which
+// stays flat when every element costs the same however much output came
+// before it. Two shapes: a list of `<li>` items, each starting a new line,
+// and a row of inline spacer elements holding only whitespace, as in
+// table-based email layouts. From the repository root (see
+// benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextHtmlListBenchmark [items] [iterations]
+//
+
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+std::string makeList(int items)
+{
+  std::string html = "<h2>Changes</h2>\n<ul>\n";
+  for (int i = 0; i < items; i++) {
+    html += "  <li>Item <b>" + std::to_string(i) + "</b> was <em>updated</em></li>\n";
+  }
+  html += "</ul>\n<p>End of list.</p>";
+  return html;
+}
+
+std::string makeSpacers(int items)
+{
+  std::string html = "<p>Columns:";
+  for (int i = 0; i < items; i++) html += "<span> </span>";
+  html += "<b>end</b></p>";
+  return html;
+}
+
+double bestMilliseconds(const std::string& html, int iterations)
+{
+  double best = 1e300;
+  size_t fragments = 0;
+  for (int i = 0; i < iterations; i++) {
+    const auto start = std::chrono::steady_clock::now();
+    fragments += HtmlRenderer::render(html, Fragment()).fragments.size();
+    const auto end = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+  }
+  if (fragments == 0) std::printf("(nothing rendered)\n");
+  return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int maxItems = argc > 1 ? std::atoi(argv[1]) : 5000;
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 5;
+
+  std::printf("%-8s %8s %12s %12s\n", "shape", "items", "ms", "us/item");
+  for (int items = std::max(1, maxItems / 8); items <= maxItems; items *= 2) {
+    const double list = bestMilliseconds(makeList(items), iterations);
+    std::printf("%-8s %8d %12.3f %12.3f\n", "list", items, list, list * 1000.0 / items);
+  }
+  for (int items = std::max(1, maxItems / 8); items <= maxItems; items *= 2) {
+    const double spacers = bestMilliseconds(makeSpacers(items), iterations);
+    std::printf("%-8s %8d %12.3f %12.3f\n", "spacers", items, spacers, spacers * 1000.0 / items);
+  }
+  return 0;
+}
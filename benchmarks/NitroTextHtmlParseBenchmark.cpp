@@ -0,0 +1,121 @@
+//
+// NitroTextHtmlParseBenchmark.cpp
+// Heap traffic and speed of building the HTML tree
+//
+// Counts every `operator new` made while `HtmlRenderer::parseHtmlTree`
+// runs, so the numbers cover the arena, the name table and the parser's
+// scratch vectors. From the repository root (see
+// benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextHtmlParseBenchmark [iterations] [file.html ...]
+//
+
+#include "NitroTextHtmlEmail.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::benchmarks::makeHtmlEmail;
+
+namespace {
+
+bool gCounting = false;
+size_t gAllocations = 0;
+size_t gAllocatedBytes = 0;
+
+struct Input {
+  std::string name;
+  std::string html;
+};
+
+std::vector<Input> loadInputs(int argc, char** argv)
+{
+  std::vector<Input> inputs;
+  for (int i = 2; i < argc; i++) {
+    std::ifstream file(argv[i], std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    inputs.push_back({argv[i], contents.str()});
+  }
+  if (inputs.empty()) {
+    inputs.push_back({"email x8", makeHtmlEmail(8)});
+    inputs.push_back({"email x80", makeHtmlEmail(80)});
+    inputs.push_back({"email x550", makeHtmlEmail(550)});
+    inputs.push_back({"email x800", makeHtmlEmail(800)});
+  }
+  return inputs;
+}
+
+size_t countNodes(const HtmlNode& node)
+{
+  size_t count = 1;
+  for (const HtmlNode* child = node.firstChild; child != nullptr; child = child->nextSibling) {
+    count += countNodes(*child);
+  }
+  return count;
+}
+
+} // namespace
+
+void* operator new(size_t size)
+{
+  if (gCounting) {
+    gAllocations++;
+    gAllocatedBytes += size;
+  }
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+  std::free(pointer);
+}
+
+int main(int argc, char** argv)
+{
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 20;
+  const auto inputs = loadInputs(argc, argv);
+
+  std::printf("%-12s %9s %8s %7s %7s %11s %11s %10s %8s\n", "input", "KiB", "nodes", "allocs", "chunks",
+              "heap bytes", "bytes/KiB", "ms/parse", "MiB/s");
+  for (const auto& input : inputs) {
+    gAllocations = 0;
+    gAllocatedBytes = 0;
+    gCounting = true;
+    size_t nodes = 0;
+    size_t chunks = 0;
+    {
+      const HtmlDocument document = HtmlRenderer::parseHtmlTree(input.html);
+      gCounting = false;
+      nodes = countNodes(*document.root);
+      chunks = document.arena.chunkCount();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+      const HtmlDocument document = HtmlRenderer::parseHtmlTree(input.html);
+      if (document.root == nullptr) return 1;
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double kib = input.html.size() / 1024.0;
+    const double ms = std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+    std::printf("%-12s %9.1f %8zu %7zu %7zu %11zu %11.0f %10.3f %8.1f\n", input.name.c_str(), kib, nodes,
+                gAllocations, chunks, gAllocatedBytes, gAllocatedBytes / kib, ms,
+                (kib / 1024.0) / (ms / 1000.0));
+  }
+  return 0;
+}
@@ -0,0 +1,76 @@
+//
+// NitroTextHtmlRenderCacheBenchmark.cpp
+// Scrolling a list of HTML rows back and forth, with and without the cache
+//
+// Renders the same rows several passes in a row, the way a list re-renders
+// rows that scroll back into view: once with HtmlRenderer::render for every
+// row, like before the cache, and once through HtmlRenderCache. From the
+// repository root (see benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextHtmlRenderCacheBenchmark [rows] [passes]
+//
+
+#include "NitroTextHtmlEmail.hpp"
+#include "NitroTextHtmlRenderCache.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::benchmarks::makeHtmlEmail;
+
+namespace {
+
+template <typename Render>
+double scroll(const std::vector<std::string>& rows, int passes, Render&& render)
+{
+  size_t fragments = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++) {
+    for (const auto& row : rows) fragments += render(row);
+  }
+  const auto end = std::chrono::steady_clock::now();
+  if (fragments == 0) std::printf("(nothing rendered)\n");
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int rowCount = argc > 1 ? std::atoi(argv[1]) : 200;
+  const int passes = argc > 2 ? std::atoi(argv[2]) : 10;
+
+  // Rows of a few templates with per-row text, so most rows differ.
+  std::vector<std::string> rows;
+  for (int i = 0; i < rowCount; i++) {
+    rows.push_back(makeHtmlEmail(1 + i % 3) + "<p>Row " + std::to_string(i) + "</p>");
+  }
+
+  Fragment base;
+  base.fontSize = 14;
+  base.fontColor = "#222";
+
+  const double uncached = scroll(rows, passes, [&](const std::string& row) {
+    return HtmlRenderer::render(row, base).fragments.size();
+  });
+  HtmlRenderCache::clear();
+  const double cached = scroll(rows, passes, [&](const std::string& row) {
+    // Copied out, like the component does into its props.
+    const std::vector<Fragment> fragments = *HtmlRenderCache::render(row, base);
+    return fragments.size();
+  });
+  const auto stats = HtmlRenderCache::stats();
+
+  const int renders = rowCount * passes;
+  std::printf("%-10s %8s %12s %12s\n", "mode", "renders", "ms/scroll", "us/row");
+  std::printf("%-10s %8d %12.3f %12.2f\n", "render", renders, uncached, uncached * 1000.0 / renders);
+  std::printf("%-10s %8d %12.3f %12.2f\n", "cached", renders, cached, cached * 1000.0 / renders);
+  std::printf("\nhits %llu, misses %llu, entries %zu, %zu KiB, rendering %.3f ms\n",
+              static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses),
+              stats.entries, stats.bytes / 1024, stats.renderMilliseconds);
+  return 0;
+}
@@ -0,0 +1,76 @@
+//
+// NitroTextHtmlSessionBenchmark.cpp
+// Streaming an email in chunks: re-rendering everything vs an HtmlSession
+//
+// Feeds the same email chunk by chunk, the way a streamed answer arrives:
+// once re-rendering the whole markup so far on every chunk, like the
+// component did before sessions, and once appending each chunk to an
+// HtmlSession. From the repository root (see
+// benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextHtmlSessionBenchmark [articles] [chunk bytes]
+//
+
+#include "NitroTextHtmlEmail.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::benchmarks::makeHtmlEmail;
+
+namespace {
+
+// Calls `onChunk(prefix, chunk)` for every chunk and returns the milliseconds taken.
+template <typename OnChunk>
+double stream(std::string_view html, size_t chunkSize, OnChunk&& onChunk)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t pos = 0; pos < html.size(); pos += chunkSize) {
+    const size_t end = std::min(html.size(), pos + chunkSize);
+    onChunk(html.substr(0, end), html.substr(pos, end - pos));
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int articles = argc > 1 ? std::atoi(argv[1]) : 80;
+  const size_t chunkSize = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 64;
+  const std::string html = makeHtmlEmail(articles);
+  const size_t chunks = (html.size() + chunkSize - 1) / chunkSize;
+
+  Fragment base;
+  base.fontSize = 14;
+  base.fontColor = "#222";
+
+  size_t rendered = 0;
+  const double whole = stream(html, chunkSize, [&](std::string_view prefix, std::string_view) {
+    rendered += HtmlRenderer::render(prefix, base).fragments.size();
+  });
+
+  HtmlSession session(base);
+  size_t stable = 0;
+  size_t tail = 0;
+  const double incremental = stream(html, chunkSize, [&](std::string_view, std::string_view chunk) {
+    const HtmlSessionUpdate update = session.append(chunk);
+    stable += update.stableCount;
+    tail += update.tail.size();
+  });
+  if (rendered == 0) std::printf("(nothing rendered)\n");
+
+  std::printf("%zu bytes in %zu chunks of %zu bytes\n\n", html.size(), chunks, chunkSize);
+  std::printf("%-12s %12s %12s\n", "mode", "ms/stream", "us/chunk");
+  std::printf("%-12s %12.3f %12.2f\n", "re-render", whole, whole * 1000.0 / chunks);
+  std::printf("%-12s %12.3f %12.2f\n", "session", incremental, incremental * 1000.0 / chunks);
+  std::printf("\nfragments kept per update %.1f, re-sent %.1f\n", static_cast<double>(stable) / chunks,
+              static_cast<double>(tail) / chunks);
+  return 0;
+}
@@ -0,0 +1,116 @@
+//
+// NitroTextHtmlStreamBenchmark.cpp
+// Markup without a stylesheet: rendering in one pass vs through a tree
+//
+// Renders emails that only use inline styles, the way most of our markup
+// comes, once as is (one pass from the tokens) and once behind an empty
+// `<style>`, which takes the tree path with the same output. Tracks the
+// peak of live heap bytes during each render, and how much of it is the
+// result itself. From the repository root (see
+// benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextHtmlStreamBenchmark [iterations]
+//
+
+#include "NitroTextHtmlEmail.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::benchmarks::makeHtmlEmail;
+
+namespace {
+
+// Every allocation is prefixed with its size, so frees can be counted.
+constexpr size_t kHeader = alignof(std::max_align_t);
+size_t gLive = 0;
+size_t gPeak = 0;
+
+// The email without its `<style>` block.
+std::string makeInlineEmail(int sections)
+{
+  std::string html = makeHtmlEmail(sections);
+  const size_t open = html.find("<style>");
+  const size_t close = html.find("</style>");
+  return html.erase(open, close + 8 - open);
+}
+
+struct Measurement {
+  double ms = 0;
+  size_t peakBytes = 0;
+  size_t resultBytes = 0;
+  size_t fragments = 0;
+};
+
+Measurement measure(const std::string& html, int iterations)
+{
+  Fragment base;
+  base.fontSize = 14;
+  Measurement result;
+  const size_t before = gLive;
+  gPeak = gLive;
+  {
+    const HtmlRenderResult rendered = HtmlRenderer::render(html, base);
+    result.peakBytes = gPeak - before;
+    result.resultBytes = gLive - before;
+    result.fragments = rendered.fragments.size();
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    if (HtmlRenderer::render(html, base).fragments.size() != result.fragments) std::abort();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  result.ms = std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+  return result;
+}
+
+} // namespace
+
+void* operator new(size_t size)
+{
+  auto* block = static_cast<char*>(std::malloc(size + kHeader));
+  if (block == nullptr) throw std::bad_alloc();
+  *reinterpret_cast<size_t*>(block) = size;
+  gLive += size;
+  gPeak = std::max(gPeak, gLive);
+  return block + kHeader;
+}
+
+void operator delete(void* pointer) noexcept
+{
+  if (pointer == nullptr) return;
+  char* block = static_cast<char*>(pointer) - kHeader;
+  gLive -= *reinterpret_cast<size_t*>(block);
+  std::free(block);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+  operator delete(pointer);
+}
+
+int main(int argc, char** argv)
+{
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 20;
+
+  std::printf("%-12s %8s %-9s %10s %10s %12s %10s\n", "input", "KiB", "mode", "ms/render", "peak KiB",
+              "result KiB", "fragments");
+  for (const int sections : {8, 80, 800}) {
+    const std::string html = makeInlineEmail(sections);
+    const std::string name = "email x" + std::to_string(sections);
+    const Measurement onePass = measure(html, iterations);
+    const Measurement tree = measure("<style> </style>" + html, iterations);
+    const double kib = html.size() / 1024.0;
+    std::printf("%-12s %8.1f %-9s %10.3f %10.1f %12.1f %10zu\n", name.c_str(), kib, "one pass", onePass.ms,
+                onePass.peakBytes / 1024.0, onePass.resultBytes / 1024.0, onePass.fragments);
+    std::printf("%-12s %8.1f %-9s %10.3f %10.1f %12.1f %10zu\n", name.c_str(), kib, "tree", tree.ms,
+                tree.peakBytes / 1024.0, tree.resultBytes / 1024.0, tree.fragments);
+  }
+  return 0;
+}
@@ -0,0 +1,146 @@
+//
+// NitroTextHtmlTokenizerBenchmark.cpp
+// Throughput of the HTML tokenizer's byte scanning, vector vs scalar
+//
+// Runs the two scans the tokenizer is built on over each input with both
+// the scalar loop and the compiled vector backend:
+//   markup  `<` then `>`, over and over, like finding every tag
+//   text    stops at `&`, whitespace runs and non-ASCII, like decoding text
+// and then the whole `parseHtmlTree` with the backend this build selected.
+//
+// From the repository root (see benchmarks/CMakeLists.txt); configure with
+// CMAKE_CXX_FLAGS=-mavx2 for the AVX2 backend on x86, or
+// CMAKE_CXX_FLAGS=-DNITRO_TEXT_SIMD_SCALAR to parse with the scalar fallback:
+//   build/benchmarks/NitroTextHtmlTokenizerBenchmark [iterations] [file.html ...]
+//
+
+#include "NitroTextHtmlEmail.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+#include "NitroTextSimdScan.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::benchmarks::makeHtmlEmail;
+
+namespace {
+
+struct Input {
+  std::string name;
+  std::string html;
+};
+
+// Long paragraphs with little markup: where wide strides pay off most.
+std::string makeArticle(int paragraphs)
+{
+  std::string html = "<article><h1>Release notes</h1>\n";
+  for (int i = 0; i < paragraphs; i++) {
+    html += "<p>";
+    for (int sentence = 0; sentence < 12; sentence++) {
+      html += "The renderer now lays out long paragraphs without splitting them into runs, "
+              "which keeps scrolling smooth even on older devices and large documents. ";
+    }
+    html += "</p>\n";
+  }
+  return html + "</article>\n";
+}
+
+std::vector<Input> loadInputs(int argc, char** argv)
+{
+  std::vector<Input> inputs;
+  for (int i = 2; i < argc; i++) {
+    std::ifstream file(argv[i], std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    inputs.push_back({argv[i], contents.str()});
+  }
+  if (inputs.empty()) {
+    inputs.push_back({"email x800", makeHtmlEmail(800)});
+    inputs.push_back({"article x400", makeArticle(400)});
+  }
+  return inputs;
+}
+
+template <typename FindByte>
+size_t scanMarkup(std::string_view s, FindByte findByte)
+{
+  size_t tags = 0;
+  size_t i = findByte(s, 0, '<');
+  while (i != std::string_view::npos) {
+    const size_t close = findByte(s, i + 1, '>');
+    if (close == std::string_view::npos) break;
+    tags++;
+    i = findByte(s, close + 1, '<');
+  }
+  return tags;
+}
+
+template <typename FindTextSpecial>
+size_t scanText(std::string_view s, FindTextSpecial findTextSpecial)
+{
+  size_t stops = 0;
+  for (size_t i = findTextSpecial(s, 0); i != std::string_view::npos; i = findTextSpecial(s, i + 1)) {
+    stops++;
+  }
+  return stops;
+}
+
+template <typename Fn>
+double gibPerSecond(const std::string& html, int iterations, Fn&& fn)
+{
+  size_t sink = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++) {
+    sink += fn();
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  if (sink == 0) std::printf("(nothing found)\n");
+  return (static_cast<double>(html.size()) * iterations) / (1024.0 * 1024.0 * 1024.0) / seconds;
+}
+
+void report(const char* input, const char* scan, const char* backend, double gib)
+{
+  std::printf("%-14s %-8s %-8s %10.2f\n", input, scan, backend, gib);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 50;
+  const auto inputs = loadInputs(argc, argv);
+
+  std::printf("%-14s %-8s %-8s %10s\n", "input", "scan", "backend", "GiB/s");
+  for (const auto& input : inputs) {
+    const std::string_view html = input.html;
+    const char* name = input.name.c_str();
+
+    report(name, "markup", "scalar", gibPerSecond(input.html, iterations, [&] {
+             return scanMarkup(html, simd::scalar::findByte);
+           }));
+#if defined(NITRO_TEXT_SIMD_VECTOR)
+    report(name, "markup", simd::vector::kBackend, gibPerSecond(input.html, iterations, [&] {
+             return scanMarkup(html, simd::vector::findByte);
+           }));
+#endif
+    report(name, "text", "scalar", gibPerSecond(input.html, iterations, [&] {
+             return scanText(html, simd::scalar::findTextSpecial);
+           }));
+#if defined(NITRO_TEXT_SIMD_VECTOR)
+    report(name, "text", simd::vector::kBackend, gibPerSecond(input.html, iterations, [&] {
+             return scanText(html, simd::vector::findTextSpecial);
+           }));
+#endif
+    report(name, "parse", simd::kBackend, gibPerSecond(input.html, iterations, [&] {
+             return HtmlRenderer::parseHtmlTree(html).arena.chunkCount();
+           }));
+  }
+  return 0;
+}
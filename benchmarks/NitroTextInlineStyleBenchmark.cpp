@@ -0,0 +1,97 @@
+//
+// NitroTextInlineStyleBenchmark.cpp
+// Per-element cost of `style` attributes in inlined-CSS email markup
+//
+// Email clients inline every rule into `style` attributes, so every element
+// carries a handful of declarations. Times parsing those attributes alone,
+// into a fragment and in place the way the renderer reads them, and
+// rendering a whole email built from them. From the repository
+// root (see benchmarks/CMakeLists.txt):
+//   build/benchmarks/NitroTextInlineStyleBenchmark [rows] [iterations]
+//
+
+#include "NitroTextCssProcessor.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+// Declarations the way inliners write them.
+const std::vector<std::string> kStyles = {
+    "font-family: 'Helvetica Neue', Helvetica, Arial, sans-serif; font-size: 14px; line-height: 20px; color: #333333;",
+    "margin: 0; padding: 0 0 12px 0; font-weight: bold; color: #1a73e8; text-decoration: none;",
+    "font: italic bold 12px/18px Georgia, serif; color: rgb(90, 90, 90); text-align: left;",
+    "background-color: #F4F4F4; border-collapse: collapse; mso-table-lspace: 0pt; mso-table-rspace: 0pt;",
+    "Font-Size: 13PX; LETTER-SPACING: 0.5px; text-transform: uppercase; color: #999999 !important;",
+    "display: block; text-decoration: underline line-through; text-decoration-color: red; font-style: normal;",
+};
+
+std::string makeInlinedEmail(int rows)
+{
+  std::string html = "<table style=\"" + kStyles[3] + "\">";
+  for (int i = 0; i < rows; i++) {
+    const std::string& a = kStyles[i % kStyles.size()];
+    const std::string& b = kStyles[(i + 1) % kStyles.size()];
+    const std::string& c = kStyles[(i + 2) % kStyles.size()];
+    html += "<tr><td style=\"" + a + "\"><p style=\"" + b + "\">Row " + std::to_string(i) +
+            " <a href=\"https://example.com\" style=\"" + c + "\">link</a> <span style=\"" + a +
+            "\">details</span></p></td></tr>";
+  }
+  return html + "</table>";
+}
+
+template <typename Fn>
+double bestMilliseconds(int iterations, Fn&& fn)
+{
+  double best = 1e300;
+  for (int i = 0; i < iterations; i++) {
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const auto end = std::chrono::steady_clock::now();
+    best = std::min(best, std::chrono::duration<double, std::milli>(end - start).count());
+  }
+  return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int rows = argc > 1 ? std::atoi(argv[1]) : 2000;
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 10;
+
+  const int attributes = 100000;
+  size_t sink = 0;
+  const double parse = bestMilliseconds(iterations, [&] {
+    for (int i = 0; i < attributes; i++) {
+      const CssAppliedStyle applied = CssProcessor::applyInlineStyles(kStyles[i % kStyles.size()]);
+      sink += applied.fragment.has_value() + applied.hidden;
+    }
+  });
+  const double parseInPlace = bestMilliseconds(iterations, [&] {
+    for (int i = 0; i < attributes; i++) {
+      const CssInlineStyle style = CssProcessor::parseInlineStyle(kStyles[i % kStyles.size()]);
+      sink += style.declared + style.hidden;
+    }
+  });
+
+  const std::string html = makeInlinedEmail(rows);
+  const int elements = rows * 5 + 1;
+  const double render = bestMilliseconds(iterations, [&] { sink += HtmlRenderer::render(html).fragments.size(); });
+  if (sink == 0) std::printf("(nothing parsed)\n");
+
+  std::printf("%-22s %10s %12s\n", "", "ms", "ns/element");
+  std::printf("%-22s %10.3f %12.1f\n", "style attributes", parse, parse * 1e6 / attributes);
+  std::printf("%-22s %10.3f %12.1f\n", "  in place", parseInPlace, parseInPlace * 1e6 / attributes);
+  std::printf("%-22s %10.3f %12.1f\n", "inlined email render", render, render * 1e6 / elements);
+  std::printf("\n%zu KiB of markup, %d styled elements\n", html.size() / 1024, elements);
+  return 0;
+}
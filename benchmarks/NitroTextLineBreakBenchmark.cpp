@@ -0,0 +1,98 @@
+//
+// NitroTextLineBreakBenchmark.cpp
+// Line break opportunities of multilingual text, per megabyte
+//
+// Finds every break opportunity of about 1 MiB of text per script, with the
+// default rules and with Hangul word priority, and reports MB/s and breaks
+// per KiB. Latin prose goes through the alphanumeric skip; CJK and Thai
+// through the tables alone. From the repository root (see
+// benchmarks/CMakeLists.txt), configured with
+// CMAKE_CXX_FLAGS=-DNITRO_TEXT_SIMD_SCALAR for the scalar skip:
+//   build/benchmarks/NitroTextLineBreakBenchmark [iterations]
+//
+
+#include "NitroTextLineBreak.hpp"
+#include "NitroTextSimdScan.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+constexpr struct {
+  const char* name;
+  std::string_view sample;
+} kCorpora[] = {
+    {"english",
+     "The quarterly report (attached) shows revenue up 12.5% to $4,210,000; see section 3-B for details. "
+     "Please reply by Friday, 10/14, if anything looks off!\n"},
+    {"german",
+     "Die Straßenbahnhaltestelle am Königsplatz wird ab 1. März für drei Wochen gesperrt. "
+     "Fahrgäste weichen bitte auf die Buslinie 62 aus – Entschuldigung für die Unannehmlichkeiten.\n"},
+    {"russian",
+     "Съешь же ещё этих мягких французских булок, да выпей чаю. Заседание перенесено на 15:30, "
+     "повестка дня «Бюджет на 2025 год» остаётся без изменений.\n"},
+    {"arabic",
+     "يسعدنا أن نعلن عن إطلاق الإصدار الجديد من التطبيق، والذي يتضمن تحسينات كبيرة في الأداء "
+     "ودعماً كاملاً للغة العربية (الإصدار ٢٫٥).\n"},
+    {"hindi",
+     "नमस्ते! आज की बैठक दोपहर तीन बजे होगी। कृपया अपनी रिपोर्ट समय पर जमा करें, "
+     "और किसी भी प्रश्न के लिए टीम से संपर्क करें।\n"},
+    {"chinese",
+     "今天下午三点在会议室召开项目进度会议，请各位准时参加。会议内容包括：第一季度总结、"
+     "第二季度计划以及预算调整（详见附件）。\n"},
+    {"japanese",
+     "本日は、お忙しいところご来場いただき、誠にありがとうございます。ただいまより、"
+     "第３回「ユーザー会」を開催いたします。ぜひ最後までお楽しみください！\n"},
+    {"korean",
+     "안녕하세요. 오늘 오후 세 시에 회의실에서 프로젝트 진행 상황 회의가 있습니다. "
+     "모두 시간에 맞춰 참석해 주시기 바랍니다. 감사합니다!\n"},
+    {"thai",
+     "ขอต้อนรับสู่การประชุมประจำไตรมาส วันนี้เราจะพูดถึงแผนงานและงบประมาณของปีหน้า "
+     "กรุณาส่งรายงานภายในวันศุกร์นี้\n"},
+    {"emoji",
+     "Great job team 🎉🎉 👍🏽 see you at the offsite 🏖️ — bring the 🇺🇸🇯🇵 flags and "
+     "👨‍👩‍👧‍👦 photos! ❤️\n"},
+};
+
+std::string repeatToSize(std::string_view sample, size_t bytes)
+{
+  std::string text;
+  text.reserve(bytes + sample.size());
+  while (text.size() < bytes) text.append(sample);
+  return text;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 10;
+  std::printf("%s skip\n", simd::kBackend);
+  std::printf("%-10s %14s %14s %14s %14s\n", "corpus", "default MB/s", "breaks/KiB", "hangul MB/s",
+              "breaks/KiB");
+  for (const auto& corpus : kCorpora) {
+    const std::string text = repeatToSize(corpus.sample, 1 << 20);
+    std::printf("%-10s", corpus.name);
+    for (const auto strategy : {LineBreakStrategyIOS::NONE, LineBreakStrategyIOS::HANGUL_WORD}) {
+      size_t breaks = 0;
+      const auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; i++) {
+        LineBreaker breaker(text, strategy);
+        breaks = 0;
+        while (breaker.next()) breaks++;
+      }
+      const auto end = std::chrono::steady_clock::now();
+      const double seconds = std::chrono::duration<double>(end - start).count();
+      std::printf(" %14.1f %14.1f", text.size() * static_cast<double>(iterations) / seconds / 1e6,
+                  breaks * 1024.0 / text.size());
+    }
+    std::printf("\n");
+  }
+  return 0;
+}
@@ -0,0 +1,165 @@
+//
+// NitroTextMeasureBenchmark.cpp
+// Measuring a chat list through TextMeasurer implementations
+//
+// Lays out a list of chat messages, one attributed string each, at a phone
+// width through the deterministic `FixedAdvanceTextMeasurer`, then through a
+// `CachingTextMeasurer` in front of it, cold and warm, and reports
+// microseconds per measure and per baseline (`measureLines`). The fake needs
+// no platform text stack, so this runs on any host; its layout is a stand-in
+// for the engine's, which is what the cache saves. Then does the same with
+// `FontFileTextMeasurer`, which lays the messages out from a font file
+// (senders in Tourney, the rest in the given font), cold and behind a warm
+// cache.
+//
+// TextMeasurer speaks React Native's renderer types, so this one only builds
+// against an app's React-Fabric and React-graphics (see
+// benchmarks/CMakeLists.txt). From the repository root:
+//   build/benchmarks/NitroTextMeasureBenchmark [messages] [iterations] [font.ttf]
+//
+
+#include "NitroTextMeasurer.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+using namespace margelo::nitro::nitrotext::views;
+
+namespace {
+
+constexpr const char* kMessages[] = {
+    "ok",
+    "See you at 10!",
+    "Can you send me the quarterly report before the meeting? I want to go over section 3-B.",
+    "Sure, attaching it now. Revenue is up 12.5% but the costs in the second half need a closer look.",
+    "Meeting notes: café, naïve, Zürich — 会议纪要 and 東京 😀 👍🏽",
+    "lol",
+    "Here's the link: https://example.com/a/very/long/path/that/does/not/wrap/nicely/at/all",
+    "Line one\nLine two\nLine three",
+};
+
+// `count` messages, every third with a bold sender prefix of its own
+// fragment, cycling through the samples so the list repeats like a chat.
+std::vector<react::AttributedString> makeMessages(size_t count)
+{
+  std::vector<react::AttributedString> messages;
+  messages.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    react::AttributedString message;
+    auto attributes = react::TextAttributes::defaultTextAttributes();
+    attributes.fontSize = 15;
+    if (i % 3 == 0) {
+      auto sender = attributes;
+      sender.fontWeight = react::FontWeight::Bold;
+      message.appendFragment(react::AttributedString::Fragment{
+          .string = "Alex: ", .textAttributes = sender, .parentShadowView = {}});
+    }
+    message.appendFragment(react::AttributedString::Fragment{
+        .string = kMessages[i % std::size(kMessages)],
+        .textAttributes = attributes,
+        .parentShadowView = {}});
+    messages.push_back(std::move(message));
+  }
+  return messages;
+}
+
+template <typename Run>
+double microsecondsPerCall(size_t calls, Run run)
+{
+  const auto start = std::chrono::steady_clock::now();
+  run();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / calls;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  const size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 10;
+  const std::string path = argc > 3 ? argv[3] : "example/assets/fonts/ChivoMono.ttf";
+  const auto regular = FontFile::open(path);
+  const auto bold = FontFile::open("example/assets/fonts/Tourney.ttf");
+  if (!regular || !bold) {
+    std::fprintf(stderr, "cannot read %s or Tourney.ttf\n", path.c_str());
+    return 1;
+  }
+  const auto messages = makeMessages(count);
+  std::vector<react::AttributedStringBox> boxes;
+  boxes.reserve(messages.size());
+  for (const auto& message : messages) {
+    boxes.emplace_back(message);
+  }
+
+  react::ParagraphAttributes paragraphAttributes;
+  react::TextLayoutContext layoutContext{.pointScaleFactor = 3};
+  react::LayoutConstraints layoutConstraints{
+      .minimumSize = {.width = 0, .height = 0},
+      .maximumSize = {.width = 320, .height = 10000},
+      .layoutDirection = react::LayoutDirection::LeftToRight};
+
+  auto fake = std::make_shared<const FixedAdvanceTextMeasurer>(8, 20);
+  volatile float sink = 0;
+  auto measureAll = [&](const TextMeasurer& measurer) {
+    for (const auto& box : boxes) {
+      sink = sink + measurer.measure(box, paragraphAttributes, layoutContext, layoutConstraints).size.height;
+    }
+  };
+
+  const size_t calls = boxes.size() * iterations;
+  const double direct = microsecondsPerCall(calls, [&] {
+    for (int i = 0; i < iterations; i++) measureAll(*fake);
+  });
+  double cold = 0;
+  double warm = 0;
+  for (int i = 0; i < iterations; i++) {
+    // A fresh cache per pass: every distinct message misses once.
+    const CachingTextMeasurer caching(fake);
+    cold += microsecondsPerCall(boxes.size(), [&] { measureAll(caching); }) / iterations;
+    warm += microsecondsPerCall(boxes.size(), [&] { measureAll(caching); }) / iterations;
+  }
+  auto measureAllLines = [&](const TextMeasurer& measurer) {
+    for (const auto& box : boxes) {
+      const auto measured = measurer.measureLines(box, paragraphAttributes, {.width = 320, .height = 10000});
+      sink = sink + react::LineMeasurement::baseline(measured);
+    }
+  };
+  const double lines = microsecondsPerCall(calls, [&] {
+    for (int i = 0; i < iterations; i++) measureAllLines(*fake);
+  });
+
+  auto fonts = std::make_shared<const FontFileTextMeasurer>(
+      [&](const react::TextAttributes& attributes) {
+        return attributes.fontWeight == react::FontWeight::Bold ? bold : regular;
+      },
+      fake);
+  const double fontFiles = microsecondsPerCall(calls, [&] {
+    for (int i = 0; i < iterations; i++) measureAll(*fonts);
+  });
+  const CachingTextMeasurer cachedFonts(fonts);
+  measureAll(cachedFonts);
+  const double fontFilesWarm = microsecondsPerCall(calls, [&] {
+    for (int i = 0; i < iterations; i++) measureAll(cachedFonts);
+  });
+  const double fontFileLines = microsecondsPerCall(calls, [&] {
+    for (int i = 0; i < iterations; i++) measureAllLines(*fonts);
+  });
+
+  std::printf("%zu messages, %zu distinct, at 320 pt\n", boxes.size(), std::lcm(std::size(kMessages), size_t{3}));
+  std::printf("%-28s %12s\n", "measurer", "us/measure");
+  std::printf("%-28s %12.3f\n", "fixed advance", direct);
+  std::printf("%-28s %12.3f\n", "caching, cold", cold);
+  std::printf("%-28s %12.3f\n", "caching, warm", warm);
+  std::printf("%-28s %12.3f\n", "fixed advance, lines", lines);
+  std::printf("%-28s %12.3f\n", "font files", fontFiles);
+  std::printf("%-28s %12.3f\n", "font files, caching, warm", fontFilesWarm);
+  std::printf("%-28s %12.3f\n", "font files, lines", fontFileLines);
+  return 0;
+}
@@ -0,0 +1,37 @@
+/**
+ * Runs the native line breaker and grapheme segmenter over the Unicode
+ * conformance data, and fails on any case that breaks differently: the
+ * reduced sets in benchmarks/fixtures, and the official LineBreakTest.txt
+ * and GraphemeBreakTest.txt the CMake build downloads.
+ *
+ * Needs the native build (see benchmarks/CMakeLists.txt), which CI makes
+ * before running jest. Runs the build in build/ unless NITROTEXT_BREAK_TEST
+ * points at another NitroTextBreakTest, and skips without one:
+ *   cmake -S . -B build && cmake --build build -j && bun run test benchmarks/break-tests
+ */
+import { spawnSync } from 'child_process'
+import { existsSync } from 'fs'
+import { join } from 'path'
+
+const build = join(__dirname, '..', 'build')
+const runner =
+   process.env.NITROTEXT_BREAK_TEST ??
+   join(build, 'benchmarks', 'NitroTextBreakTest')
+const describeWithRunner = existsSync(runner) ? describe : describe.skip
+
+const unicode = process.env.NITROTEXT_UNICODE_TEST_DIR ?? join(build, 'unicode')
+
+const fixtures = [
+   ['line', join(__dirname, 'fixtures', 'LineBreakTest-reduced.txt')],
+   ['grapheme', join(__dirname, 'fixtures', 'GraphemeBreakTest-reduced.txt')],
+   ['line', join(unicode, 'LineBreakTest.txt')],
+   ['grapheme', join(unicode, 'GraphemeBreakTest.txt')],
+].filter(([, fixture]) => existsSync(fixture!))
+
+describeWithRunner('Unicode break conformance', () => {
+   it.each(fixtures)('%s breaks match %s', (mode, fixture) => {
+      const result = spawnSync(runner, [mode!, fixture!], { encoding: 'utf8' })
+      expect(result.stdout).toMatch(/^(\d+) of \1 cases pass$/m)
+      expect(result.status).toBe(0)
+   })
+})
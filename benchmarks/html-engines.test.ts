@@ -0,0 +1,342 @@
+/**
+ * Runs the TS `HTMLRenderer` and the native `HtmlRenderer` over one corpus,
+ * fails if any document renders to different fragments, and prints
+ * throughput, heap use and p50/p99 latency per document size.
+ *
+ * The corpus is every input of the renderer and CSS processor tests (see
+ * src/renderers/test-fixtures.ts), plus synthetic emails and articles of up
+ * to 800 KiB.
+ *
+ * Needs the native build (see benchmarks/CMakeLists.txt), which CI makes
+ * before running jest. Runs the driver in build/ unless NITROTEXT_HTML_DRIVER
+ * points at another NitroTextHtmlEngineDriver, and skips without one:
+ *   cmake -S . -B build && cmake --build build -j && bun run test benchmarks/html-engines
+ */
+import { execFileSync } from 'child_process'
+import { existsSync } from 'fs'
+import { join } from 'path'
+import { makeHtmlEmail } from '../example/src/utils/htmlEmail'
+import { HTMLRenderer } from '../src/renderers/html'
+import {
+   CSS_FIXTURES,
+   HTML_FIXTURES,
+   type HtmlFixture,
+} from '../src/renderers/test-fixtures'
+import type { ElementNode, Node, RenderResult } from '../src/renderers/types'
+import type { Fragment } from '../src/types'
+
+type Document = {
+   name: string
+   html: string
+   base: Partial<Fragment>
+}
+
+type NativeResult = RenderResult & {
+   nanoseconds: number[]
+   allocations: number
+   allocatedBytes: number
+}
+
+type Timing = {
+   bytes: number
+   latencies: number[]
+   heapBytes: number
+   allocations?: number
+}
+
+const SIZE_BUCKETS = [
+   { label: '< 1 KiB', below: 1024 },
+   { label: '1-16 KiB', below: 16 * 1024 },
+   { label: '16-256 KiB', below: 256 * 1024 },
+   { label: '>= 256 KiB', below: Infinity },
+]
+
+/**
+ * Every input of the renderer and CSS processor tests as a document: markup
+ * as is, every stylesheet over every element, and every declaration list
+ * as an inline style.
+ */
+function fixtureDocuments(): Document[] {
+   const documents: Document[] = []
+   for (const [group, fixtures] of Object.entries(HTML_FIXTURES)) {
+      for (const [name, fixture] of Object.entries(
+         fixtures as Record<string, HtmlFixture>
+      )) {
+         const { html, base } =
+            typeof fixture === 'string' ? { html: fixture, base: {} } : fixture
+         documents.push({ name: `html ${group}.${name}`, html, base })
+      }
+   }
+   for (const [sheetName, blocks] of Object.entries(
+      CSS_FIXTURES.stylesheets
+   )) {
+      for (const [elementName, element] of Object.entries(
+         CSS_FIXTURES.elements
+      )) {
+         documents.push({
+            name: `css stylesheets.${sheetName} on ${elementName}`,
+            html: `<style>${blocks.join('\n')}</style>${serialize(element)}`,
+            base: {},
+         })
+      }
+   }
+   const styled = (name: string, style: string) =>
+      documents.push({
+         name,
+         html: `<p>before <span style=${quote(style)}>styled</span> after</p>`,
+         base: {},
+      })
+   for (const [name, style] of Object.entries(CSS_FIXTURES.declarations)) {
+      styled(`css declarations.${name}`, style)
+   }
+   for (const [name, declarations] of Object.entries(
+      CSS_FIXTURES.declarationMaps
+   )) {
+      styled(
+         `css declarationMaps.${name}`,
+         Object.entries(declarations as Record<string, string>)
+            .map(([property, value]) => `${property}: ${value}`)
+            .join('; ')
+      )
+   }
+   return documents
+}
+
+function quote(value: string): string {
+   return value.includes('"') ? `'${value}'` : `"${value}"`
+}
+
+function serialize(node: Node): string {
+   if (node.type === 'text') return node.content
+   const element: ElementNode = node
+   const attributes = Object.entries(element.attrs)
+      .map(([name, value]) => ` ${name}=${quote(value)}`)
+      .join('')
+   const children = element.children.length
+      ? element.children.map(serialize).join('')
+      : 'text'
+   return `<${element.tag}${attributes}>${children}</${element.tag}>`
+}
+
+/**
+ * A long-form article: headings, paragraphs with links and entities,
+ * quotes, lists, code and the `font` shorthand, styled inline only.
+ */
+function makeArticle(sections: number): string {
+   let html = '<article><h1>Release notes</h1>\n'
+   for (let n = 1; n <= sections; n++) {
+      html +=
+         `<h2 style="color: #333; margin-bottom: 0">Section ${n}</h2>\n` +
+         `<p>This release changes <a href="https://example.com/${n}">section ${n}</a>, ` +
+         `adds <code>inline  code</code> and &ldquo;quotes&rdquo; &amp; more.</p>\n` +
+         `<blockquote style="font-style: italic; letter-spacing: 0.2px">Quoted ${n}</blockquote>\n` +
+         '<ol><li>First</li><li>Second <s>old</s> <mark>new</mark></li></ol>\n' +
+         `<pre>  const x = ${n}\n  return x * 2</pre>\n` +
+         '<p style="font: bold 15px/22px Georgia, serif; text-align: justify">' +
+         'A longer paragraph of body text. '.repeat(12) +
+         '</p>\n'
+   }
+   return html + '</article>'
+}
+
+function syntheticDocuments(): Document[] {
+   const documents: Document[] = []
+   const base = { fontSize: 14, fontColor: '#222' }
+   for (const sections of [1, 8, 80, 800]) {
+      const email = makeHtmlEmail(sections)
+      documents.push({ name: `email x${sections}`, html: email, base })
+      documents.push({
+         name: `inline email x${sections}`,
+         html: email.replace(/<style>[\s\S]*?<\/style>/, ''),
+         base,
+      })
+   }
+   for (const sections of [2, 20, 200]) {
+      documents.push({
+         name: `article x${sections}`,
+         html: makeArticle(sections),
+         base,
+      })
+   }
+   return documents
+}
+
+// Fewer runs for larger documents; the TS renderer takes seconds per MiB.
+function repeatFor(bytes: number): number {
+   return Math.max(3, Math.min(200, Math.floor(4_000_000 / (bytes + 2_000))))
+}
+
+function renderNative(driver: string, documents: Document[]): NativeResult[] {
+   let input = ''
+   for (const document of documents) {
+      const bytes = Buffer.byteLength(document.html)
+      const fields = Object.entries(document.base).filter(
+         ([, value]) => value !== undefined
+      )
+      input += `${repeatFor(bytes)} ${fields.length} ${bytes}\n`
+      for (const [field, value] of fields) {
+         input += `${field}\n${String(value)}\n`
+      }
+      input += `${document.html}\n`
+   }
+   const output = execFileSync(driver, { input, maxBuffer: 1 << 30 })
+   return output
+      .toString('utf8')
+      .trim()
+      .split('\n')
+      .map((line) => JSON.parse(line) as NativeResult)
+}
+
+function renderTs(document: Document): {
+   result: RenderResult
+   timing: Timing
+} {
+   const bytes = Buffer.byteLength(document.html)
+   const heapBefore = process.memoryUsage().heapUsed
+   const result = HTMLRenderer.render(document.html, { ...document.base })
+   // Heap growth, not allocations: a collection may run during the render.
+   const heapBytes = Math.max(0, process.memoryUsage().heapUsed - heapBefore)
+   const latencies: number[] = []
+   for (let i = 0; i < repeatFor(bytes); i++) {
+      const start = process.hrtime.bigint()
+      HTMLRenderer.render(document.html, { ...document.base })
+      latencies.push(Number(process.hrtime.bigint() - start))
+   }
+   return { result, timing: { bytes, latencies, heapBytes } }
+}
+
+// UTF-8 has no lone surrogates; the native renderer writes U+FFFD for them.
+function wellFormed(text: string): string {
+   return text.replace(
+      /[\uD800-\uDBFF](?![\uDC00-\uDFFF])|(?<![\uD800-\uDBFF])[\uDC00-\uDFFF]/g,
+      '\uFFFD'
+   )
+}
+
+function canonical(result: RenderResult): string {
+   const fragments = result.fragments.map((fragment) => {
+      const entries = Object.entries(fragment)
+         .filter(([, value]) => value !== undefined)
+         .sort(([a], [b]) => (a < b ? -1 : 1))
+         .map(([key, value]) => [
+            key,
+            typeof value === 'string' ? wellFormed(value) : value,
+         ])
+      return Object.fromEntries(entries)
+   })
+   return JSON.stringify({ text: wellFormed(result.text), fragments })
+}
+
+function percentile(sorted: number[], p: number): number {
+   const index = Math.floor((sorted.length * p) / 100)
+   return sorted[Math.min(sorted.length - 1, index)] ?? 0
+}
+
+function sum(timings: Timing[], value: (timing: Timing) => number) {
+   return timings.reduce((total, timing) => total + value(timing), 0)
+}
+
+function report(ts: Timing[], native: Timing[]): string {
+   const columns = [
+      'size',
+      'engine',
+      'docs',
+      'renders',
+      'MiB/s',
+      'p50 us',
+      'p99 us',
+      'heap KiB',
+      'allocs',
+   ]
+   const widths = [11, 7, 5, 8, 9, 10, 10, 10, 8]
+   const row = (cells: string[]) =>
+      cells
+         .map((cell, i) =>
+            i < 2 ? cell.padEnd(widths[i]!) : cell.padStart(widths[i]!)
+         )
+         .join(' ')
+   const engines = [
+      ['ts', ts],
+      ['native', native],
+   ] as const
+   const lines = [row(columns)]
+   let lower = 0
+   for (const bucket of SIZE_BUCKETS) {
+      for (const [engine, timings] of engines) {
+         const selected = timings.filter(
+            (timing) => timing.bytes >= lower && timing.bytes < bucket.below
+         )
+         if (selected.length === 0) continue
+         const latencies = selected
+            .flatMap((timing) => timing.latencies)
+            .sort((a, b) => a - b)
+         const seconds = latencies.reduce((total, ns) => total + ns, 0) / 1e9
+         const average = (value: (timing: Timing) => number) =>
+            sum(selected, value) / selected.length
+         const mib =
+            sum(selected, (t) => t.bytes * t.latencies.length) / 2 ** 20
+         lines.push(
+            row([
+               bucket.label,
+               engine,
+               String(selected.length),
+               String(latencies.length),
+               (mib / seconds).toFixed(1),
+               (percentile(latencies, 50) / 1000).toFixed(1),
+               (percentile(latencies, 99) / 1000).toFixed(1),
+               (average((t) => t.heapBytes) / 1024).toFixed(1),
+               engine === 'native'
+                  ? average((t) => t.allocations!).toFixed(0)
+                  : '-',
+            ])
+         )
+      }
+      lower = bucket.below
+   }
+   return lines.join('\n')
+}
+
+const driver =
+   process.env.NITROTEXT_HTML_DRIVER ??
+   join(__dirname, '..', 'build', 'benchmarks', 'NitroTextHtmlEngineDriver')
+const describeWithDriver = existsSync(driver) ? describe : describe.skip
+
+describeWithDriver('HTML engines', () => {
+   it('render the corpus identically', () => {
+      const documents = [...fixtureDocuments(), ...syntheticDocuments()]
+      const nativeResults = renderNative(driver, documents)
+      expect(nativeResults).toHaveLength(documents.length)
+
+      const tsTimings: Timing[] = []
+      const nativeTimings: Timing[] = []
+      const mismatches: Array<Record<string, string>> = []
+      documents.forEach((document, i) => {
+         const native = nativeResults[i]!
+         const { result, timing } = renderTs(document)
+         tsTimings.push(timing)
+         nativeTimings.push({
+            bytes: timing.bytes,
+            latencies: native.nanoseconds,
+            heapBytes: native.allocatedBytes,
+            allocations: native.allocations,
+         })
+         const expected = canonical(result)
+         const actual = canonical(native)
+         if (expected !== actual) {
+            mismatches.push({
+               name: document.name,
+               html: document.html.slice(0, 200),
+               ts: expected.slice(0, 400),
+               native: actual.slice(0, 400),
+            })
+         }
+      })
+
+      const identical = documents.length - mismatches.length
+      process.stdout.write(
+         `\n${documents.length} documents, ${identical} identical\n\n` +
+            `${report(tsTimings, nativeTimings)}\n\n`
+      )
+      expect(mismatches.slice(0, 5)).toEqual([])
+   }, 10 * 60 * 1000)
+})
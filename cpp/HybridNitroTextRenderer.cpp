@@ -0,0 +1,60 @@
+//
+// HybridNitroTextRenderer.cpp
+// Renders `renderer="html"` markup off the JS thread
+//
+
+#include "HybridNitroTextRenderer.hpp"
+#include "NitroTextHtmlRenderCache.hpp"
+#include "NitroTextWorkPool.hpp"
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+// Only the text style reaches the component's base fragment, so anything
+// else would split the cache key without changing the result.
+Fragment textStyleOf(const std::optional<Fragment>& baseStyle)
+{
+  Fragment base = baseStyle.value_or(Fragment());
+  base.text = std::nullopt;
+  base.selectionColor = std::nullopt;
+  base.linkUrl = std::nullopt;
+  return base;
+}
+
+RenderResult renderCached(const std::string& html, const Fragment& base)
+{
+  const auto fragments = HtmlRenderCache::render(html, base);
+  RenderResult result;
+  result.fragments = *fragments;
+  for (const auto& fragment : result.fragments) {
+    if (fragment.text) result.text += *fragment.text;
+  }
+  return result;
+}
+
+} // namespace
+
+std::shared_ptr<Promise<RenderResult>> HybridNitroTextRenderer::renderHtml(const std::string& html,
+                                                                           const std::optional<Fragment>& baseStyle)
+{
+  return Promise<RenderResult>::async(
+      [html, base = textStyleOf(baseStyle)]() -> RenderResult { return renderCached(html, base); });
+}
+
+std::shared_ptr<Promise<std::vector<RenderResult>>>
+HybridNitroTextRenderer::renderHtmlBatch(const std::vector<std::string>& htmls,
+                                         const std::optional<Fragment>& baseStyle)
+{
+  return Promise<std::vector<RenderResult>>::async(
+      [htmls, base = textStyleOf(baseStyle)]() -> std::vector<RenderResult> {
+        // Every document parses into its own arena; the stylesheet and
+        // render caches are shared.
+        std::vector<RenderResult> results(htmls.size());
+        WorkStealingPool::shared().forEach(htmls.size(),
+                                           [&](size_t i) { results[i] = renderCached(htmls[i], base); });
+        return results;
+      });
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,35 @@
+//
+// HybridNitroTextRenderer.hpp
+// Renders `renderer="html"` markup off the JS thread
+//
+
+#pragma once
+
+#include "HybridNitroTextRendererSpec.hpp"
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * Renders markup on Nitro's background thread pool, through the same
+ * `HtmlRenderCache` the component reads in `cloneProps`.
+ *
+ * A list can render the rows it is about to show ahead of time; when such a
+ * row mounts with the same markup and text style, the component copies the
+ * cached fragments instead of parsing on the JS or commit thread.
+ */
+class HybridNitroTextRenderer : public HybridNitroTextRendererSpec {
+public:
+  HybridNitroTextRenderer() : HybridObject(TAG) {}
+
+  std::shared_ptr<Promise<RenderResult>> renderHtml(const std::string& html,
+                                                    const std::optional<Fragment>& baseStyle) override;
+
+  /**
+   * @brief Renders every document on the shared `WorkStealingPool`, keeping
+   * the results in input order.
+   */
+  std::shared_ptr<Promise<std::vector<RenderResult>>> renderHtmlBatch(const std::vector<std::string>& htmls,
+                                                                      const std::optional<Fragment>& baseStyle) override;
+};
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,154 @@
+//
+// NitroTextArena.hpp
+// Bump allocator for per-document data of the native HTML parser
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * A bump allocator that frees everything at once when it is destroyed.
+ *
+ * Memory comes from fixed-size chunks: allocating moves a cursor forward,
+ * and a new chunk is only taken when the current one is full (a request
+ * larger than a chunk gets a chunk of its own). Sizing chunks after the input
+ * bounds the number of heap allocations per document by a constant.
+ *
+ * Only trivially destructible types may live in an arena; no destructor runs.
+ * Not thread-safe.
+ */
+class Arena final {
+public:
+  explicit Arena(size_t chunkSize = 4096) noexcept : chunkSize_(std::max<size_t>(chunkSize, 256)) {}
+
+  Arena(const Arena&) = delete;
+  Arena& operator=(const Arena&) = delete;
+
+  Arena(Arena&& other) noexcept
+      : head_(std::exchange(other.head_, nullptr)),
+        cursor_(std::exchange(other.cursor_, nullptr)),
+        end_(std::exchange(other.end_, nullptr)),
+        chunkSize_(other.chunkSize_),
+        bytesReserved_(std::exchange(other.bytesReserved_, 0)),
+        chunkCount_(std::exchange(other.chunkCount_, 0)) {}
+
+  Arena& operator=(Arena&& other) noexcept
+  {
+    if (this != &other) {
+      release();
+      head_ = std::exchange(other.head_, nullptr);
+      cursor_ = std::exchange(other.cursor_, nullptr);
+      end_ = std::exchange(other.end_, nullptr);
+      chunkSize_ = other.chunkSize_;
+      bytesReserved_ = std::exchange(other.bytesReserved_, 0);
+      chunkCount_ = std::exchange(other.chunkCount_, 0);
+    }
+    return *this;
+  }
+
+  ~Arena() { release(); }
+
+  void* allocate(size_t size, size_t alignment)
+  {
+    char* aligned = alignUp(cursor_, alignment);
+    if (cursor_ == nullptr || aligned > end_ || size > static_cast<size_t>(end_ - aligned)) {
+      grow(size + alignment);
+      aligned = alignUp(cursor_, alignment);
+    }
+    cursor_ = aligned + size;
+    return aligned;
+  }
+
+  /**
+   * @brief Constructs a `T` in the arena.
+   */
+  template <typename T, typename... Args>
+  T* make(Args&&... args)
+  {
+    static_assert(std::is_trivially_destructible_v<T>, "Arena never runs destructors");
+    return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Copies `count` values into the arena.
+   */
+  template <typename T>
+  T* copyArray(const T* values, size_t count)
+  {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "Arena arrays must be trivially copyable");
+    if (count == 0) return nullptr;
+    void* out = allocate(sizeof(T) * count, alignof(T));
+    std::memcpy(out, values, sizeof(T) * count);
+    return static_cast<T*>(out);
+  }
+
+  std::string_view copyString(std::string_view value)
+  {
+    if (value.empty()) return std::string_view();
+    char* out = static_cast<char*>(allocate(value.size(), 1));
+    std::memcpy(out, value.data(), value.size());
+    return std::string_view(out, value.size());
+  }
+
+  /**
+   * @brief Bytes taken from the heap so far, including chunk headers.
+   */
+  size_t bytesReserved() const noexcept { return bytesReserved_; }
+
+  /**
+   * @brief Number of heap allocations made so far.
+   */
+  size_t chunkCount() const noexcept { return chunkCount_; }
+
+private:
+  struct Chunk {
+    Chunk* previous;
+  };
+
+  static char* alignUp(char* pointer, size_t alignment) noexcept
+  {
+    const auto address = reinterpret_cast<uintptr_t>(pointer);
+    return reinterpret_cast<char*>((address + alignment - 1) & ~(uintptr_t(alignment) - 1));
+  }
+
+  void grow(size_t minimum)
+  {
+    const size_t size = std::max(chunkSize_, minimum + sizeof(Chunk));
+    auto* chunk = static_cast<Chunk*>(::operator new(size));
+    chunk->previous = head_;
+    head_ = chunk;
+    cursor_ = reinterpret_cast<char*>(chunk + 1);
+    end_ = reinterpret_cast<char*>(chunk) + size;
+    bytesReserved_ += size;
+    chunkCount_++;
+  }
+
+  void release() noexcept
+  {
+    while (head_ != nullptr) {
+      Chunk* previous = head_->previous;
+      ::operator delete(head_);
+      head_ = previous;
+    }
+  }
+
+  Chunk* head_ = nullptr;
+  char* cursor_ = nullptr;
+  char* end_ = nullptr;
+  size_t chunkSize_;
+  size_t bytesReserved_ = 0;
+  size_t chunkCount_ = 0;
+};
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,110 @@
+//
+// NitroTextAtom.cpp
+// Process-wide interned strings for font families and colors
+//
+
+#include "NitroTextAtom.hpp"
+#include "NitroTextColor.hpp"
+
+#include <mutex>
+#include <unordered_set>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+struct EntryHash {
+  using is_transparent = void;
+  size_t operator()(const Atom::Entry* entry) const noexcept { return entry->hash; }
+  size_t operator()(std::string_view value) const noexcept {
+    return std::hash<std::string_view>{}(value);
+  }
+};
+
+struct EntryEqual {
+  using is_transparent = void;
+  bool operator()(const Atom::Entry* a, const Atom::Entry* b) const noexcept {
+    return a == b;
+  }
+  bool operator()(const Atom::Entry* a, std::string_view b) const noexcept {
+    return a->value == b;
+  }
+  bool operator()(std::string_view a, const Atom::Entry* b) const noexcept {
+    return a == b->value;
+  }
+};
+
+struct AtomTable {
+  std::mutex mutex;
+  std::unordered_set<const Atom::Entry*, EntryHash, EntryEqual> entries;
+};
+
+AtomTable& table()
+{
+  // Intentionally leaked: atoms must stay valid until process exit, including
+  // from static destructors of other translation units. Bounded by
+  // `Atom::kCapacity`.
+  static auto* instance = new AtomTable();
+  return *instance;
+}
+
+const std::string kEmpty;
+
+} // namespace
+
+Atom Atom::intern(std::string_view value)
+{
+  auto& t = table();
+  const size_t hash = EntryHash{}(value);
+
+  std::unique_lock<std::mutex> lock(t.mutex);
+  auto it = t.entries.find(value);
+  if (it != t.entries.end()) {
+    return Atom(std::shared_ptr<const Entry>(std::shared_ptr<void>(), *it));
+  }
+  if (t.entries.size() >= kCapacity) {
+    lock.unlock();
+    auto owned = std::make_shared<Entry>();
+    owned->value.assign(value);
+    owned->hash = hash;
+    owned->interned = false;
+    return Atom(std::move(owned));
+  }
+
+  const auto* entry = new Entry{std::string(value), hash, true};
+  t.entries.insert(entry);
+  return Atom(std::shared_ptr<const Entry>(std::shared_ptr<void>(), entry));
+}
+
+Atom Atom::intern(const std::optional<std::string>& value)
+{
+  return value.has_value() ? intern(std::string_view(*value)) : Atom();
+}
+
+size_t Atom::count()
+{
+  auto& t = table();
+  std::lock_guard<std::mutex> lock(t.mutex);
+  return t.entries.size();
+}
+
+std::optional<uint32_t> Atom::color() const noexcept
+{
+  if (entry_ == nullptr) return std::nullopt;
+  uint64_t state = entry_->color.load(std::memory_order_relaxed);
+  if (state == Entry::kUnparsed) {
+    // Racing callers parse the same value to the same result.
+    const auto parsed = parseColor(entry_->value);
+    state = parsed ? Entry::kIsColor | *parsed : Entry::kNotColor;
+    entry_->color.store(state, std::memory_order_relaxed);
+  }
+  if (state == Entry::kNotColor) return std::nullopt;
+  return static_cast<uint32_t>(state);
+}
+
+const std::string& Atom::str() const noexcept
+{
+  return entry_ != nullptr ? entry_->value : kEmpty;
+}
+
+} // namespace margelo::nitro::nitrotext
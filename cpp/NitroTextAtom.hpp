@@ -0,0 +1,116 @@
+//
+// NitroTextAtom.hpp
+// Process-wide interned strings for font families and colors
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * An interned, immutable string.
+ *
+ * Style strings such as `fontFamily` and the color fields repeat heavily
+ * across fragments ("Inter", "#333", ...). Interning them once when props are
+ * converted keeps a single stored copy per distinct value and turns equality
+ * and hashing into a pointer compare.
+ *
+ * The table holds at most `kCapacity` values and its atoms are never freed.
+ * Values past that (an app generating colors, say) get an atom of their own
+ * that is freed with its last copy and compares by contents, so the table
+ * stays bounded whatever the input. A default-constructed Atom is the
+ * "unset" atom standing in for `std::nullopt`; an empty string is a regular
+ * atom.
+ */
+class Atom final {
+public:
+  static constexpr size_t kCapacity = 4096;
+
+  struct Entry {
+    std::string value;
+    size_t hash;
+    // Whether `value` lives in the table, where it is the only entry.
+    bool interned;
+    // `value` parsed as a color on first use: `kUnparsed` until then, the
+    // packed color with `kIsColor` set, or `kNotColor`.
+    mutable std::atomic<uint64_t> color{kUnparsed};
+
+    static constexpr uint64_t kUnparsed = 0;
+    static constexpr uint64_t kNotColor = 1;
+    static constexpr uint64_t kIsColor = uint64_t(1) << 32;
+  };
+
+  Atom() = default;
+
+  /**
+   * @brief Returns the atom for `value`, creating it on first use.
+   * Thread-safe.
+   */
+  static Atom intern(std::string_view value);
+
+  /**
+   * @brief Interns an optional prop value; `std::nullopt` maps to the unset atom.
+   */
+  static Atom intern(const std::optional<std::string>& value);
+
+  /**
+   * @brief Number of values in the table, at most `kCapacity`.
+   */
+  static size_t count();
+
+  bool empty() const noexcept { return entry_ == nullptr; }
+  explicit operator bool() const noexcept { return entry_ != nullptr; }
+
+  const std::string& str() const noexcept;
+  std::string_view view() const noexcept {
+    return entry_ != nullptr ? std::string_view(entry_->value) : std::string_view();
+  }
+
+  /**
+   * @brief Whether the atom is in the table, so that equality is a pointer
+   * compare.
+   */
+  bool interned() const noexcept { return entry_ == nullptr || entry_->interned; }
+  size_t hash() const noexcept { return entry_ != nullptr ? entry_->hash : 0; }
+
+  /**
+   * @brief The atom parsed as a packed `0xAARRGGBB` color (see `parseColor`).
+   * Parsed on the first call and remembered, so font families and link URLs
+   * are never parsed at all.
+   */
+  std::optional<uint32_t> color() const noexcept;
+
+  friend bool operator==(const Atom& a, const Atom& b) noexcept {
+    if (a.entry_ == b.entry_) return true;
+    // Two table atoms are equal only if they are the same entry.
+    if (a.interned() && b.interned()) return false;
+    return a.entry_ != nullptr && b.entry_ != nullptr && a.entry_->hash == b.entry_->hash &&
+           a.entry_->value == b.entry_->value;
+  }
+  friend bool operator!=(const Atom& a, const Atom& b) noexcept { return !(a == b); }
+
+private:
+  explicit Atom(std::shared_ptr<const Entry> entry) noexcept : entry_(std::move(entry)) {}
+
+  // Table entries are held without a control block, so copying their atoms
+  // never touches a reference count.
+  std::shared_ptr<const Entry> entry_;
+};
+
+} // namespace margelo::nitro::nitrotext
+
+template <>
+struct std::hash<margelo::nitro::nitrotext::Atom> {
+  size_t operator()(const margelo::nitro::nitrotext::Atom& atom) const noexcept {
+    return atom.hash();
+  }
+};
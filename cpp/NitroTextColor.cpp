@@ -0,0 +1,505 @@
+//
+// NitroTextColor.cpp
+// Allocation-free color string parsing into packed ARGB
+//
+
+#include "NitroTextColor.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+struct NamedColor {
+  std::string_view name;
+  uint32_t argb;
+};
+
+// CSS named colors. Green, gray, lightgray, darkgray, orange, purple, brown
+// and clear keep the values of the UIKit system colors they used to map to.
+// ios/ColorParser.swift carries a copy of this table.
+constexpr NamedColor kNamedColors[] = {
+    {"aliceblue", 0xFFF0F8FF},
+    {"antiquewhite", 0xFFFAEBD7},
+    {"aqua", 0xFF00FFFF},
+    {"aquamarine", 0xFF7FFFD4},
+    {"azure", 0xFFF0FFFF},
+    {"beige", 0xFFF5F5DC},
+    {"bisque", 0xFFFFE4C4},
+    {"black", 0xFF000000},
+    {"blanchedalmond", 0xFFFFEBCD},
+    {"blue", 0xFF0000FF},
+    {"blueviolet", 0xFF8A2BE2},
+    {"brown", 0xFF996633},
+    {"burlywood", 0xFFDEB887},
+    {"cadetblue", 0xFF5F9EA0},
+    {"chartreuse", 0xFF7FFF00},
+    {"chocolate", 0xFFD2691E},
+    {"clear", 0x00000000},
+    {"coral", 0xFFFF7F50},
+    {"cornflowerblue", 0xFF6495ED},
+    {"cornsilk", 0xFFFFF8DC},
+    {"crimson", 0xFFDC143C},
+    {"cyan", 0xFF00FFFF},
+    {"darkblue", 0xFF00008B},
+    {"darkcyan", 0xFF008B8B},
+    {"darkgoldenrod", 0xFFB8860B},
+    {"darkgray", 0xFF555555},
+    {"darkgreen", 0xFF006400},
+    {"darkgrey", 0xFF555555},
+    {"darkkhaki", 0xFFBDB76B},
+    {"darkmagenta", 0xFF8B008B},
+    {"darkolivegreen", 0xFF556B2F},
+    {"darkorange", 0xFFFF8C00},
+    {"darkorchid", 0xFF9932CC},
+    {"darkred", 0xFF8B0000},
+    {"darksalmon", 0xFFE9967A},
+    {"darkseagreen", 0xFF8FBC8F},
+    {"darkslateblue", 0xFF483D8B},
+    {"darkslategray", 0xFF2F4F4F},
+    {"darkslategrey", 0xFF2F4F4F},
+    {"darkturquoise", 0xFF00CED1},
+    {"darkviolet", 0xFF9400D3},
+    {"deeppink", 0xFFFF1493},
+    {"deepskyblue", 0xFF00BFFF},
+    {"dimgray", 0xFF696969},
+    {"dimgrey", 0xFF696969},
+    {"dodgerblue", 0xFF1E90FF},
+    {"firebrick", 0xFFB22222},
+    {"floralwhite", 0xFFFFFAF0},
+    {"forestgreen", 0xFF228B22},
+    {"fuchsia", 0xFFFF00FF},
+    {"gainsboro", 0xFFDCDCDC},
+    {"ghostwhite", 0xFFF8F8FF},
+    {"gold", 0xFFFFD700},
+    {"goldenrod", 0xFFDAA520},
+    {"gray", 0xFF808080},
+    {"green", 0xFF00FF00},
+    {"greenyellow", 0xFFADFF2F},
+    {"grey", 0xFF808080},
+    {"honeydew", 0xFFF0FFF0},
+    {"hotpink", 0xFFFF69B4},
+    {"indianred", 0xFFCD5C5C},
+    {"indigo", 0xFF4B0082},
+    {"ivory", 0xFFFFFFF0},
+    {"khaki", 0xFFF0E68C},
+    {"lavender", 0xFFE6E6FA},
+    {"lavenderblush", 0xFFFFF0F5},
+    {"lawngreen", 0xFF7CFC00},
+    {"lemonchiffon", 0xFFFFFACD},
+    {"lightblue", 0xFFADD8E6},
+    {"lightcoral", 0xFFF08080},
+    {"lightcyan", 0xFFE0FFFF},
+    {"lightgoldenrodyellow", 0xFFFAFAD2},
+    {"lightgray", 0xFFAAAAAA},
+    {"lightgreen", 0xFF90EE90},
+    {"lightgrey", 0xFFAAAAAA},
+    {"lightpink", 0xFFFFB6C1},
+    {"lightsalmon", 0xFFFFA07A},
+    {"lightseagreen", 0xFF20B2AA},
+    {"lightskyblue", 0xFF87CEFA},
+    {"lightslategray", 0xFF778899},
+    {"lightslategrey", 0xFF778899},
+    {"lightsteelblue", 0xFFB0C4DE},
+    {"lightyellow", 0xFFFFFFE0},
+    {"lime", 0xFF00FF00},
+    {"limegreen", 0xFF32CD32},
+    {"linen", 0xFFFAF0E6},
+    {"magenta", 0xFFFF00FF},
+    {"maroon", 0xFF800000},
+    {"mediumaquamarine", 0xFF66CDAA},
+    {"mediumblue", 0xFF0000CD},
+    {"mediumorchid", 0xFFBA55D3},
+    {"mediumpurple", 0xFF9370DB},
+    {"mediumseagreen", 0xFF3CB371},
+    {"mediumslateblue", 0xFF7B68EE},
+    {"mediumspringgreen", 0xFF00FA9A},
+    {"mediumturquoise", 0xFF48D1CC},
+    {"mediumvioletred", 0xFFC71585},
+    {"midnightblue", 0xFF191970},
+    {"mintcream", 0xFFF5FFFA},
+    {"mistyrose", 0xFFFFE4E1},
+    {"moccasin", 0xFFFFE4B5},
+    {"navajowhite", 0xFFFFDEAD},
+    {"navy", 0xFF000080},
+    {"oldlace", 0xFFFDF5E6},
+    {"olive", 0xFF808000},
+    {"olivedrab", 0xFF6B8E23},
+    {"orange", 0xFFFF8000},
+    {"orangered", 0xFFFF4500},
+    {"orchid", 0xFFDA70D6},
+    {"palegoldenrod", 0xFFEEE8AA},
+    {"palegreen", 0xFF98FB98},
+    {"paleturquoise", 0xFFAFEEEE},
+    {"palevioletred", 0xFFDB7093},
+    {"papayawhip", 0xFFFFEFD5},
+    {"peachpuff", 0xFFFFDAB9},
+    {"peru", 0xFFCD853F},
+    {"pink", 0xFFFFC0CB},
+    {"plum", 0xFFDDA0DD},
+    {"powderblue", 0xFFB0E0E6},
+    {"purple", 0xFF800080},
+    {"rebeccapurple", 0xFF663399},
+    {"red", 0xFFFF0000},
+    {"rosybrown", 0xFFBC8F8F},
+    {"royalblue", 0xFF4169E1},
+    {"saddlebrown", 0xFF8B4513},
+    {"salmon", 0xFFFA8072},
+    {"sandybrown", 0xFFF4A460},
+    {"seagreen", 0xFF2E8B57},
+    {"seashell", 0xFFFFF5EE},
+    {"sienna", 0xFFA0522D},
+    {"silver", 0xFFC0C0C0},
+    {"skyblue", 0xFF87CEEB},
+    {"slateblue", 0xFF6A5ACD},
+    {"slategray", 0xFF708090},
+    {"slategrey", 0xFF708090},
+    {"snow", 0xFFFFFAFA},
+    {"springgreen", 0xFF00FF7F},
+    {"steelblue", 0xFF4682B4},
+    {"tan", 0xFFD2B48C},
+    {"teal", 0xFF008080},
+    {"thistle", 0xFFD8BFD8},
+    {"tomato", 0xFFFF6347},
+    {"transparent", 0x00000000},
+    {"turquoise", 0xFF40E0D0},
+    {"violet", 0xFFEE82EE},
+    {"wheat", 0xFFF5DEB3},
+    {"white", 0xFFFFFFFF},
+    {"whitesmoke", 0xFFF5F5F5},
+    {"yellow", 0xFFFFFF00},
+    {"yellowgreen", 0xFF9ACD32},
+};
+
+constexpr size_t kNamedColorCount = sizeof(kNamedColors) / sizeof(kNamedColors[0]);
+constexpr size_t kBucketCount = 64;
+constexpr size_t kSlotCount = 256;
+
+constexpr uint32_t fnv1a(std::string_view s, uint32_t seed)
+{
+  uint32_t h = 2166136261u ^ seed;
+  for (char c : s) {
+    h ^= static_cast<uint8_t>(c);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+/**
+ * Two-level perfect hash ("hash and displace"): a name first picks a bucket,
+ * and each bucket stores the seed that places all of its names into distinct
+ * slots. The seeds are searched at compile time.
+ */
+struct NamedColorIndex {
+  std::array<uint8_t, kBucketCount> seeds{};
+  std::array<uint8_t, kSlotCount> slots{}; // entry index + 1, 0 = empty
+};
+
+constexpr NamedColorIndex buildNamedColorIndex()
+{
+  NamedColorIndex index;
+  std::array<std::array<uint8_t, kNamedColorCount>, kBucketCount> buckets{};
+  std::array<size_t, kBucketCount> sizes{};
+  for (size_t i = 0; i < kNamedColorCount; i++) {
+    size_t b = fnv1a(kNamedColors[i].name, 0) % kBucketCount;
+    buckets[b][sizes[b]++] = static_cast<uint8_t>(i);
+  }
+
+  // Place the largest buckets first while most slots are still free.
+  std::array<bool, kBucketCount> placed{};
+  for (size_t round = 0; round < kBucketCount; round++) {
+    size_t b = kBucketCount;
+    for (size_t candidate = 0; candidate < kBucketCount; candidate++) {
+      if (!placed[candidate] && (b == kBucketCount || sizes[candidate] > sizes[b])) {
+        b = candidate;
+      }
+    }
+    placed[b] = true;
+    if (sizes[b] == 0) {
+      continue;
+    }
+
+    for (uint32_t seed = 1; seed < 256; seed++) {
+      std::array<size_t, kNamedColorCount> targets{};
+      bool fits = true;
+      for (size_t k = 0; k < sizes[b] && fits; k++) {
+        targets[k] = fnv1a(kNamedColors[buckets[b][k]].name, seed) % kSlotCount;
+        fits = index.slots[targets[k]] == 0;
+        for (size_t j = 0; j < k && fits; j++) {
+          fits = targets[j] != targets[k];
+        }
+      }
+      if (fits) {
+        index.seeds[b] = static_cast<uint8_t>(seed);
+        for (size_t k = 0; k < sizes[b]; k++) {
+          index.slots[targets[k]] = static_cast<uint8_t>(buckets[b][k] + 1);
+        }
+        break;
+      }
+    }
+    if (index.seeds[b] == 0) {
+      throw "NitroTextColor: no perfect hash seed for a bucket";
+    }
+  }
+  return index;
+}
+
+constexpr NamedColorIndex kNamedColorIndex = buildNamedColorIndex();
+
+constexpr std::optional<uint32_t> lookupNamedColor(std::string_view name)
+{
+  size_t b = fnv1a(name, 0) % kBucketCount;
+  size_t slot = fnv1a(name, kNamedColorIndex.seeds[b]) % kSlotCount;
+  uint8_t entry = kNamedColorIndex.slots[slot];
+  if (entry == 0 || kNamedColors[entry - 1].name != name) {
+    return std::nullopt;
+  }
+  return kNamedColors[entry - 1].argb;
+}
+
+constexpr bool namedColorIndexIsPerfect()
+{
+  for (const auto& color : kNamedColors) {
+    auto found = lookupNamedColor(color.name);
+    if (!found.has_value() || *found != color.argb) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static_assert(namedColorIndexIsPerfect(), "every named color must resolve to itself");
+
+constexpr bool isSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+}
+
+constexpr std::string_view trim(std::string_view s)
+{
+  while (!s.empty() && isSpace(s.front())) s.remove_prefix(1);
+  while (!s.empty() && isSpace(s.back())) s.remove_suffix(1);
+  return s;
+}
+
+constexpr int hexValue(char c)
+{
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+uint8_t toChannel(double unit)
+{
+  return static_cast<uint8_t>(unit * 255.0 + 0.5);
+}
+
+// Decimal ARGB as produced by `processColor`. A zero alpha byte reads as
+// opaque, as it always has on iOS.
+std::optional<uint32_t> parseDecimalARGB(std::string_view s)
+{
+  uint64_t value = 0;
+  for (char c : s) {
+    if (c < '0' || c > '9') return std::nullopt;
+    value = value * 10 + static_cast<uint64_t>(c - '0');
+    if (value > 0xFFFFFFFFull) return std::nullopt;
+  }
+  auto argb = static_cast<uint32_t>(value);
+  if ((argb >> 24) == 0) {
+    argb |= 0xFF000000u;
+  }
+  return argb;
+}
+
+std::optional<uint32_t> parseHex(std::string_view s)
+{
+  if (!s.empty() && s.front() == '#') {
+    s.remove_prefix(1);
+  } else if (s.size() >= 2 && s[0] == '0' && s[1] == 'x') {
+    s.remove_prefix(2);
+  }
+
+  const size_t length = s.size();
+  if (length != 3 && length != 4 && length != 6 && length != 8) {
+    return std::nullopt;
+  }
+
+  uint32_t value = 0;
+  for (char c : s) {
+    int digit = hexValue(c);
+    if (digit < 0) return std::nullopt;
+    value = (value << 4) | static_cast<uint32_t>(digit);
+    if (length <= 4) {
+      // #rgb / #rgba: every digit is doubled
+      value = (value << 4) | static_cast<uint32_t>(digit);
+    }
+  }
+
+  if (length == 3 || length == 6) {
+    return 0xFF000000u | value;
+  }
+
+  // rrggbbaa (CSS) unless that reads as fully transparent while the
+  // aarrggbb reading does not.
+  const uint32_t rrggbbaa = (value << 24) | (value >> 8);
+  if ((value & 0xFF) == 0 && (value >> 24) != 0) {
+    return value;
+  }
+  return rrggbbaa;
+}
+
+std::optional<double> parseNumber(std::string_view s)
+{
+  size_t i = 0;
+  bool negative = false;
+  if (i < s.size() && (s[i] == '+' || s[i] == '-')) {
+    negative = s[i] == '-';
+    i++;
+  }
+
+  double value = 0;
+  bool sawDigit = false;
+  while (i < s.size() && s[i] >= '0' && s[i] <= '9') {
+    value = value * 10 + (s[i] - '0');
+    sawDigit = true;
+    i++;
+  }
+  if (i < s.size() && s[i] == '.') {
+    i++;
+    double scale = 0.1;
+    while (i < s.size() && s[i] >= '0' && s[i] <= '9') {
+      value += (s[i] - '0') * scale;
+      scale *= 0.1;
+      sawDigit = true;
+      i++;
+    }
+  }
+  if (!sawDigit) return std::nullopt;
+
+  if (i < s.size() && s[i] == 'e') {
+    i++;
+    bool negativeExponent = false;
+    if (i < s.size() && (s[i] == '+' || s[i] == '-')) {
+      negativeExponent = s[i] == '-';
+      i++;
+    }
+    int exponent = 0;
+    bool sawExponentDigit = false;
+    while (i < s.size() && s[i] >= '0' && s[i] <= '9') {
+      exponent = exponent < 1000 ? exponent * 10 + (s[i] - '0') : exponent;
+      sawExponentDigit = true;
+      i++;
+    }
+    if (!sawExponentDigit) return std::nullopt;
+    for (int e = 0; e < exponent; e++) {
+      value = negativeExponent ? value / 10 : value * 10;
+    }
+  }
+
+  if (i != s.size()) return std::nullopt;
+  return negative ? -value : value;
+}
+
+std::optional<double> parseComponent(std::string_view s, double max)
+{
+  s = trim(s);
+  if (!s.empty() && s.back() == '%') {
+    auto percent = parseNumber(s.substr(0, s.size() - 1));
+    if (!percent) return std::nullopt;
+    return std::clamp(*percent, 0.0, 100.0) / 100.0;
+  }
+  auto value = parseNumber(s);
+  if (!value) return std::nullopt;
+  return std::clamp(*value, 0.0, max) / max;
+}
+
+std::optional<uint32_t> parseRGBFunction(std::string_view s)
+{
+  if (s.substr(0, 3) != "rgb") return std::nullopt;
+
+  const size_t open = s.find('(');
+  const size_t close = s.rfind(')');
+  if (open == std::string_view::npos || close == std::string_view::npos || open >= close) {
+    return std::nullopt;
+  }
+
+  std::array<std::string_view, 4> parts{};
+  size_t count = 0;
+  std::string_view inside = s.substr(open + 1, close - open - 1);
+  while (true) {
+    const size_t comma = inside.find(',');
+    std::string_view part = inside.substr(0, comma);
+    // Empty parts are skipped, matching Swift's `split(separator:)`.
+    if (!part.empty()) {
+      if (count == parts.size()) return std::nullopt;
+      parts[count++] = part;
+    }
+    if (comma == std::string_view::npos) break;
+    inside.remove_prefix(comma + 1);
+  }
+  if (count != 3 && count != 4) return std::nullopt;
+
+  auto r = parseComponent(parts[0], 255.0);
+  auto g = parseComponent(parts[1], 255.0);
+  auto b = parseComponent(parts[2], 255.0);
+  if (!r || !g || !b) return std::nullopt;
+
+  double a = 1.0;
+  if (count == 4) {
+    auto alpha = parseComponent(parts[3], 1.0);
+    if (!alpha) return std::nullopt;
+    a = *alpha;
+  }
+
+  return (static_cast<uint32_t>(toChannel(a)) << 24) |
+         (static_cast<uint32_t>(toChannel(*r)) << 16) |
+         (static_cast<uint32_t>(toChannel(*g)) << 8) |
+         static_cast<uint32_t>(toChannel(*b));
+}
+
+} // namespace
+
+std::optional<uint32_t> parseColor(std::string_view input) noexcept
+{
+  std::string_view trimmed = trim(input);
+  if (trimmed.empty()) {
+    return std::nullopt;
+  }
+
+  char buffer[128];
+  if (trimmed.size() > sizeof(buffer)) {
+    return std::nullopt;
+  }
+  for (size_t i = 0; i < trimmed.size(); i++) {
+    char c = trimmed[i];
+    buffer[i] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+  }
+  const std::string_view s(buffer, trimmed.size());
+
+  if (auto color = parseDecimalARGB(s)) {
+    return color;
+  }
+  if (auto color = lookupNamedColor(s)) {
+    return color;
+  }
+  if (auto color = parseHex(s)) {
+    return color;
+  }
+  return parseRGBFunction(s);
+}
+
+void resolveColor(std::optional<std::string>& value)
+{
+  if (!value) return;
+  // A transparent color has no decimal form: it would read back as opaque.
+  if (auto argb = parseColor(*value); argb && (*argb >> 24) != 0) {
+    value = std::to_string(*argb);
+  }
+}
+
+} // namespace margelo::nitro::nitrotext
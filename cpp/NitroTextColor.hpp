@@ -0,0 +1,41 @@
+//
+// NitroTextColor.hpp
+// Allocation-free color string parsing into packed ARGB
+//
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * @brief Parses a NitroText color string into a packed `0xAARRGGBB` value.
+ *
+ * Accepts, in this order: decimal ARGB (as produced by `processColor`), CSS
+ * named colors, hex (`#rgb`, `#rgba`, `#rrggbb`, `#rrggbbaa`/`#aarrggbb`,
+ * optional `#` or `0x`) and `rgb()`/`rgba()` with numeric or percentage
+ * components.
+ *
+ * Input is trimmed and matched case-insensitively. Never allocates; inputs
+ * longer than 128 bytes are rejected.
+ *
+ * @return The packed color, or `std::nullopt` if `input` is not a color.
+ */
+std::optional<uint32_t> parseColor(std::string_view input) noexcept;
+
+/**
+ * @brief Rewrites a color prop to the decimal ARGB form of `parseColor`.
+ *
+ * The component descriptor resolves every color prop with it, so the view
+ * decodes plain numbers on the main thread. Values that are not colors, and
+ * transparent ones (whose decimal form reads back as opaque), are left as
+ * they are for the iOS `ColorParser`, which reads every form this parser
+ * does. Resolving twice changes nothing.
+ */
+void resolveColor(std::optional<std::string>& value);
+
+} // namespace margelo::nitro::nitrotext
@@ -4,14 +4,221 @@
 //
 
 #include "NitroTextComponentDescriptor.hpp"
-#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include "NitroTextColor.hpp"
+#include "NitroTextHtmlRenderCache.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+#include "NitroTextSpanTree.hpp"
+#include "NitroTextStyleFlattener.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <optional>
 
 using namespace facebook;
 using namespace margelo::nitro::nitrotext::views;
 
+namespace {
+
+  template <typename T>
+  void assignStyleProp(margelo::nitro::CachedProp<std::optional<T>>& prop, std::optional<T>&& value) {
+    if (prop.value != value) {
+      prop.value = std::move(value);
+      prop.isDirty = true;
+    }
+  }
+
+  /**
+   * Resolves the raw `textStyle` (the component's `style` prop, unflattened)
+   * into the top-level text style props. Only props whose value changed are
+   * marked dirty, so the view sees exactly what JS used to send.
+   */
+  void applyTextStyle(HybridNitroTextProps& props) {
+    auto flat = margelo::nitro::nitrotext::flattenTextStyle(props.textStyle.value.value_or(nullptr));
+    // Resolved before the compare, so an unchanged color stays clean.
+    margelo::nitro::nitrotext::resolveColor(flat.fontColor);
+    margelo::nitro::nitrotext::resolveColor(flat.fragmentBackgroundColor);
+    margelo::nitro::nitrotext::resolveColor(flat.textDecorationColor);
+    assignStyleProp(props.fontColor, std::move(flat.fontColor));
+    assignStyleProp(props.fragmentBackgroundColor, std::move(flat.fragmentBackgroundColor));
+    assignStyleProp(props.fontSize, std::move(flat.fontSize));
+    assignStyleProp(props.fontWeight, std::move(flat.fontWeight));
+    assignStyleProp(props.fontStyle, std::move(flat.fontStyle));
+    assignStyleProp(props.fontFamily, std::move(flat.fontFamily));
+    assignStyleProp(props.lineHeight, std::move(flat.lineHeight));
+    assignStyleProp(props.letterSpacing, std::move(flat.letterSpacing));
+    assignStyleProp(props.textAlign, std::move(flat.textAlign));
+    assignStyleProp(props.textTransform, std::move(flat.textTransform));
+    assignStyleProp(props.textDecorationLine, std::move(flat.textDecorationLine));
+    assignStyleProp(props.textDecorationColor, std::move(flat.textDecorationColor));
+    assignStyleProp(props.textDecorationStyle, std::move(flat.textDecorationStyle));
+    // The raw style is consumed here; the view never needs it.
+    props.textStyle.isDirty = false;
+  }
+
+  /**
+   * Resolves the span tree sent for nested `<NitroText>` children into the
+   * leaf `fragments` the view renders. JS never sends `fragments` alongside
+   * `spans`, so a present span tree always wins. When the tree goes away
+   * (the children became a plain string), so do its fragments: JS sends no
+   * `fragments` to clear them with, and the prop copy would keep them.
+   */
+  void applySpanTree(HybridNitroTextProps& props) {
+    if (props.spans.value.has_value()) {
+      props.fragments.value = margelo::nitro::nitrotext::resolveSpanTree(
+          *props.spans.value, props.spanParents.value.value_or(std::vector<double>{}));
+      props.fragments.isDirty = true;
+    } else if (props.spans.isDirty) {
+      props.fragments.value = std::nullopt;
+      props.fragments.isDirty = true;
+    }
+    // The tree is consumed here; the view never needs it.
+    props.spans.isDirty = false;
+    props.spanParents.isDirty = false;
+  }
+
+  bool hasDirtyTextStyle(const HybridNitroTextProps& props) {
+    return props.fontColor.isDirty || props.fragmentBackgroundColor.isDirty || props.fontSize.isDirty ||
+           props.fontWeight.isDirty || props.fontStyle.isDirty || props.fontFamily.isDirty ||
+           props.lineHeight.isDirty || props.letterSpacing.isDirty || props.textAlign.isDirty ||
+           props.textTransform.isDirty || props.textDecorationLine.isDirty ||
+           props.textDecorationColor.isDirty || props.textDecorationStyle.isDirty;
+  }
+
+  struct HtmlSessionEntry {
+    std::weak_ptr<const react::Props> props;
+    margelo::nitro::nitrotext::HtmlSession session;
+  };
+
+  /**
+   * Streaming sessions of `renderer="html"` views, keyed by the props that
+   * last rendered them. A view gets one once its markup grows by appending,
+   * like a streamed answer, and it moves along from props to props.
+   */
+  struct HtmlSessionTable {
+    static constexpr size_t kCapacity = 8;
+
+    std::mutex mutex;
+    // Least recently rendered first.
+    std::vector<HtmlSessionEntry> entries;
+  };
+
+  HtmlSessionTable& htmlSessions() {
+    // Intentionally leaked, like the stylesheet cache.
+    static auto* instance = new HtmlSessionTable();
+    return *instance;
+  }
+
+  std::optional<margelo::nitro::nitrotext::HtmlSession> takeHtmlSession(const react::Props* props) {
+    auto& table = htmlSessions();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    for (auto it = table.entries.begin(); it != table.entries.end(); ++it) {
+      const auto owner = it->props.lock();
+      if (owner.get() == props) {
+        auto session = std::move(it->session);
+        table.entries.erase(it);
+        return session;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void putHtmlSession(const std::shared_ptr<const react::Props>& props,
+                      margelo::nitro::nitrotext::HtmlSession&& session) {
+    auto& table = htmlSessions();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    std::erase_if(table.entries, [](const HtmlSessionEntry& entry) { return entry.props.expired(); });
+    if (table.entries.size() >= HtmlSessionTable::kCapacity) {
+      table.entries.erase(table.entries.begin());
+    }
+    table.entries.push_back(HtmlSessionEntry{props, std::move(session)});
+  }
+
+  /**
+   * Renders `renderer="html"` markup, sent as `text`, into `fragments`. The
+   * top-level text style is the base of the cascade, like `topStyles` in JS.
+   * The markup stays in `text` for the next render but never reaches the view.
+   * Results are shared through `HtmlRenderCache`, so markup any view rendered
+   * before is not parsed again.
+   *
+   * When only `text` changed and the new markup extends the previous one,
+   * the view is streaming: an `HtmlSession` renders just the new tail and
+   * the leading fragments are kept.
+   */
+  void applyHtmlRenderer(HybridNitroTextProps& props, const std::shared_ptr<const react::Props>& owner,
+                         const react::Props* previousProps) {
+    margelo::nitro::nitrotext::Fragment base;
+    base.fontColor = props.fontColor.value;
+    base.fragmentBackgroundColor = props.fragmentBackgroundColor.value;
+    base.fontSize = props.fontSize.value;
+    base.fontWeight = props.fontWeight.value;
+    base.fontStyle = props.fontStyle.value;
+    base.fontFamily = props.fontFamily.value;
+    base.lineHeight = props.lineHeight.value;
+    base.letterSpacing = props.letterSpacing.value;
+    base.textAlign = props.textAlign.value;
+    base.textTransform = props.textTransform.value;
+    base.textDecorationLine = props.textDecorationLine.value;
+    base.textDecorationColor = props.textDecorationColor.value;
+    base.textDecorationStyle = props.textDecorationStyle.value;
+
+    const std::string_view html = props.text.value ? std::string_view(*props.text.value) : std::string_view();
+    props.fragments.isDirty = true;
+    props.text.isDirty = false;
+
+    const auto* previous = dynamic_cast<const HybridNitroTextProps*>(previousProps);
+    const bool onlyTextChanged = previous != nullptr && !props.renderer.isDirty && !hasDirtyTextStyle(props) &&
+                                 props.fragments.value.has_value();
+    std::optional<margelo::nitro::nitrotext::HtmlSession> session;
+    if (onlyTextChanged) {
+      session = takeHtmlSession(previous);
+      const std::string_view previousHtml =
+          previous->text.value ? std::string_view(*previous->text.value) : std::string_view();
+      if (!session && !previousHtml.empty() && html.size() > previousHtml.size() &&
+          html.compare(0, previousHtml.size(), previousHtml) == 0) {
+        session.emplace(base);
+      }
+    }
+    if (!session) {
+      props.fragments.value = *margelo::nitro::nitrotext::HtmlRenderCache::render(html, base);
+      return;
+    }
+
+    auto update = session->update(html);
+    auto& fragments = *props.fragments.value;
+    fragments.resize(std::min(update.stableCount, fragments.size()));
+    fragments.insert(fragments.end(), std::make_move_iterator(update.tail.begin()),
+                     std::make_move_iterator(update.tail.end()));
+    putHtmlSession(owner, std::move(*session));
+  }
+
+  /**
+   * Resolves every color the view reads to decimal ARGB (see
+   * `resolveColor`), so names, hex and `rgb()` are parsed here, once per
+   * change, by the same parser the shadow node measures with.
+   */
+  void applyColors(HybridNitroTextProps& props) {
+    using margelo::nitro::nitrotext::resolveColor;
+    for (auto* prop : {&props.fontColor, &props.fragmentBackgroundColor, &props.textDecorationColor,
+                       &props.selectionColor}) {
+      if (prop->isDirty) resolveColor(prop->value);
+    }
+    if (props.fragments.isDirty && props.fragments.value.has_value()) {
+      for (auto& fragment : *props.fragments.value) {
+        resolveColor(fragment.fontColor);
+        resolveColor(fragment.fragmentBackgroundColor);
+        resolveColor(fragment.textDecorationColor);
+        resolveColor(fragment.selectionColor);
+      }
+    }
+  }
+
+} // namespace
+
 NitroTextComponentDescriptor::NitroTextComponentDescriptor(const react::ComponentDescriptorParameters& parameters)
     : ConcreteComponentDescriptor(parameters,
-                                  react::RawPropsParser(/* enableJsiParser */ true)) {}
+                                  react::RawPropsParser(/* enableJsiParser */ true)),
+      textMeasurer_(TextMeasurer::fromContextContainer(parameters.contextContainer)) {}
 
   std::shared_ptr<const react::Props> NitroTextComponentDescriptor::cloneProps(const react::PropsParserContext& context,
                                                                                      const std::shared_ptr<const react::Props>& props,
@@ -19,7 +226,38 @@ NitroTextComponentDescriptor::NitroTextComponentDescriptor(const react::Componen
     // 1. Prepare raw props parser
     rawProps.parse(rawPropsParser_);
     // 2. Copy props with Nitro's cached copy constructor
-    return NitroTextShadowNode::Props(context, /* & */ rawProps, props);
+    auto newProps = NitroTextShadowNode::Props(context, /* & */ rawProps, props);
+    // 3. Flatten the raw style natively instead of in JS on every render
+    auto& mutableProps = const_cast<HybridNitroTextProps&>(*newProps);
+    if (mutableProps.textStyle.isDirty) {
+      applyTextStyle(mutableProps);
+    }
+    // 4. Resolve the nested span cascade natively
+    const bool spansChanged = mutableProps.spans.isDirty || mutableProps.spanParents.isDirty;
+    if (spansChanged) {
+      applySpanTree(mutableProps);
+    }
+    // 5. Render `renderer="html"` markup natively instead of in JS. Element
+    // children arrive as a span tree, not as markup in `text`; the fragments
+    // resolved from it above are left alone.
+    const bool html = mutableProps.renderer.value == margelo::nitro::nitrotext::Renderer::HTML;
+    const bool hasSpans = mutableProps.spans.value.has_value();
+    if (html && !hasSpans && mutableProps.text.value.has_value()) {
+      if (mutableProps.renderer.isDirty || mutableProps.text.isDirty || spansChanged ||
+          hasDirtyTextStyle(mutableProps)) {
+        applyHtmlRenderer(mutableProps, newProps, props.get());
+      }
+    } else if (!hasSpans && !mutableProps.fragments.isDirty &&
+               (html ? mutableProps.text.isDirty : mutableProps.renderer.isDirty)) {
+      // Leaving the HTML renderer, or its markup went away: drop the
+      // rendered fragments and let the view see `text` again.
+      mutableProps.fragments.value = std::nullopt;
+      mutableProps.fragments.isDirty = true;
+      mutableProps.text.isDirty = true;
+    }
+    // 6. Resolve colors for the view
+    applyColors(mutableProps);
+    return newProps;
   }
 
   void NitroTextComponentDescriptor::adopt(react::ShadowNode& shadowNode) const {
@@ -31,18 +269,12 @@ NitroTextComponentDescriptor::NitroTextComponentDescriptor(const react::Componen
 #ifdef ANDROID
     // On Android, wrap props into state for JNI roundtrip.
     const HybridNitroTextProps& props = concreteShadowNode.getConcreteProps();
-    HybridNitroTextState state;
+    NitroTextState state = concreteShadowNode.getStateData();
     state.setProps(props);
     concreteShadowNode.setStateData(std::move(state));
 #endif
 
-    // Inject TextLayoutManager so measurement works on Fabric (iOS/macOS/etc.).
-    // Construct directly with the descriptor's ContextContainer.
-    if (auto contextContainer = this->getContextContainer()) {
-      auto textLayoutManager = std::make_shared<const react::TextLayoutManager>(contextContainer);
-      concreteShadowNode.setTextLayoutManager(textLayoutManager);
-    } else {
-      auto textLayoutManager = std::make_shared<const react::TextLayoutManager>(nullptr);
-      concreteShadowNode.setTextLayoutManager(textLayoutManager);
-    }
+    // Inject the measurer so measurement works on Fabric (iOS/macOS/etc.).
+    // Every node of this descriptor shares one.
+    concreteShadowNode.setTextMeasurer(textMeasurer_);
 }
@@ -26,6 +26,13 @@ namespace margelo::nitro::nitrotext::views {
                                                    react::RawProps rawProps) const override;
 
     void adopt(react::ShadowNode& shadowNode) const override;
+
+  private:
+    /**
+     * The `TextMeasurer` registered in the `ContextContainer`, or one over
+     * `TextLayoutManager`.
+     */
+    std::shared_ptr<const TextMeasurer> textMeasurer_;
   };
 
 } // namespace margelo::nitro::nitrotext::views
@@ -0,0 +1,607 @@
+//
+// NitroTextCssProcessor.cpp
+// Native port of the HTML renderer's CSS processor
+//
+
+#include "NitroTextCssProcessor.hpp"
+#include "NitroTextHtmlUtil.hpp"
+#include "NitroTextStyleFlattener.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+template <typename T>
+void overrideWith(std::optional<T>& target, const std::optional<T>& value)
+{
+  if (value.has_value()) target = value;
+}
+
+bool isDisplayNone(std::string_view value)
+{
+  return html::equalsIgnoringCase(html::trim(value), "none");
+}
+
+// Indexed by CssProperty.
+constexpr std::string_view kPropertyNames[] = {
+    "",
+    "color",
+    "background",
+    "background-color",
+    "font-size",
+    "line-height",
+    "letter-spacing",
+    "font-weight",
+    "font-style",
+    "font-family",
+    "text-align",
+    "text-transform",
+    "text-decoration",
+    "text-decoration-line",
+    "text-decoration-color",
+    "text-decoration-style",
+    "font",
+    "display",
+    "margin",
+    "margin-top",
+    "margin-bottom",
+};
+constexpr size_t kPropertyCount = std::size(kPropertyNames);
+constexpr size_t kMaxPropertyName = std::string_view("text-decoration-color").size();
+
+// A perfect hash of the names above: their length, last and middle
+// characters pick a distinct slot for each.
+constexpr size_t propertySlot(std::string_view name) noexcept
+{
+  return (name.size() * 3 + static_cast<unsigned char>(name.back()) * 6 +
+          static_cast<unsigned char>(name[name.size() / 2])) &
+         63;
+}
+
+struct PropertyTable {
+  CssProperty slots[64] = {};
+  bool collides = false;
+};
+
+constexpr PropertyTable makePropertyTable()
+{
+  PropertyTable table;
+  for (size_t id = 1; id < kPropertyCount; id++) {
+    auto& slot = table.slots[propertySlot(kPropertyNames[id])];
+    table.collides = table.collides || slot != CssProperty::Other;
+    slot = static_cast<CssProperty>(id);
+  }
+  return table;
+}
+
+constexpr PropertyTable kPropertyTable = makePropertyTable();
+static_assert(!kPropertyTable.collides, "property names need a collision-free slot each");
+
+/**
+ * Merges one declaration over the fragment built so far. A later
+ * `text-decoration` replaces an earlier one, including with "unset".
+ */
+void mergeDeclaration(CssFragment& out, const CssFragment& parsed)
+{
+  parsed.applyTo(out.style);
+  if (parsed.style.textDecorationLine.has_value()) {
+    out.unsetsTextDecorationLine = false;
+  } else if (parsed.unsetsTextDecorationLine) {
+    out.unsetsTextDecorationLine = true;
+  }
+}
+
+void addRule(CssStylesheet& sheet, CssSelector selector, uint32_t declarations, uint32_t order)
+{
+  const CssCompoundSelector& subject = selector.compounds.front();
+  const size_t parts = (subject.tag.empty() ? 0 : 1) + (subject.id.empty() ? 0 : 1) + subject.classes.size();
+  CssRule rule{std::move(selector), declarations, order, false};
+  rule.matchedByKey = !rule.selector.hasCombinators() && parts <= 1;
+  sheet.hasCombinators = sheet.hasCombinators || rule.selector.hasCombinators();
+
+  auto addTo = [&](CssStylesheet::Bucket& bucket, std::string_view key) {
+    auto it = bucket.find(key);
+    if (it == bucket.end()) {
+      it = bucket.emplace(std::string(key), std::vector<CssRule>()).first;
+    }
+    it->second.push_back(std::move(rule));
+  };
+  if (!subject.id.empty()) {
+    addTo(sheet.id, subject.id);
+  } else if (!subject.classes.empty()) {
+    addTo(sheet.className, subject.classes.front());
+  } else if (!subject.tag.empty()) {
+    addTo(sheet.tag, subject.tag);
+  } else {
+    sheet.universal.push_back(std::move(rule));
+  }
+}
+
+const std::vector<CssRule>* findRules(const CssStylesheet::Bucket& bucket, std::string_view key)
+{
+  auto it = bucket.find(key);
+  return it != bucket.end() ? &it->second : nullptr;
+}
+
+/**
+ * Splits `css` into `selector { body }` rules, matching nested braces so an
+ * at-rule's block is skipped as a whole.
+ */
+template <typename Fn>
+void parseCssRules(std::string_view css, Fn&& onRule)
+{
+  size_t index = 0;
+  while (index < css.size()) {
+    const size_t brace = css.find('{', index);
+    if (brace == std::string_view::npos) break;
+    const std::string_view selector = html::trim(css.substr(index, brace - index));
+    int depth = 1;
+    size_t cursor = brace + 1;
+    while (cursor < css.size() && depth > 0) {
+      if (css[cursor] == '{') depth++;
+      else if (css[cursor] == '}') depth--;
+      cursor++;
+    }
+    // Like the JS `slice(brace + 1, cursor - 1)`, an unterminated body loses
+    // its last character.
+    const size_t bodyEnd = cursor - 1;
+    onRule(selector, css.substr(brace + 1, bodyEnd > brace ? bodyEnd - brace - 1 : 0));
+    index = cursor;
+  }
+}
+
+std::string stripComments(std::string_view css)
+{
+  std::string out;
+  out.reserve(css.size());
+  size_t copied = 0;
+  size_t open = css.find("/*");
+  while (open != std::string_view::npos) {
+    const size_t close = css.find("*/", open + 2);
+    if (close == std::string_view::npos) break;
+    out.append(css, copied, open - copied);
+    copied = close + 2;
+    open = css.find("/*", copied);
+  }
+  out.append(css, copied, std::string_view::npos);
+  return out;
+}
+
+} // namespace
+
+CssProperty CssProcessor::propertyId(std::string_view name) noexcept
+{
+  if (name.empty() || name.size() > kMaxPropertyName) return CssProperty::Other;
+  char lower[kMaxPropertyName];
+  for (size_t i = 0; i < name.size(); i++) {
+    const char c = name[i];
+    lower[i] = c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
+  }
+  const std::string_view lowered(lower, name.size());
+  const CssProperty id = kPropertyTable.slots[propertySlot(lowered)];
+  return kPropertyNames[static_cast<size_t>(id)] == lowered ? id : CssProperty::Other;
+}
+
+void CssDeclarations::set(CssDeclaration declaration)
+{
+  for (auto& existing : entries_) {
+    if (existing.sameProperty(declaration)) {
+      existing = std::move(declaration);
+      return;
+    }
+  }
+  entries_.push_back(std::move(declaration));
+}
+
+void CssFragment::applyTo(Fragment& base) const
+{
+  overrideWith(base.selectionColor, style.selectionColor);
+  overrideWith(base.fontSize, style.fontSize);
+  overrideWith(base.fontWeight, style.fontWeight);
+  overrideWith(base.fontColor, style.fontColor);
+  overrideWith(base.fragmentBackgroundColor, style.fragmentBackgroundColor);
+  overrideWith(base.fontStyle, style.fontStyle);
+  overrideWith(base.fontFamily, style.fontFamily);
+  overrideWith(base.lineHeight, style.lineHeight);
+  overrideWith(base.letterSpacing, style.letterSpacing);
+  overrideWith(base.textAlign, style.textAlign);
+  overrideWith(base.textTransform, style.textTransform);
+  overrideWith(base.textDecorationLine, style.textDecorationLine);
+  overrideWith(base.textDecorationColor, style.textDecorationColor);
+  overrideWith(base.textDecorationStyle, style.textDecorationStyle);
+  overrideWith(base.linkUrl, style.linkUrl);
+  if (unsetsTextDecorationLine) {
+    base.textDecorationLine = std::nullopt;
+  }
+}
+
+void CssInlineStyle::applyTo(Fragment& base) const
+{
+  if (fontColor) base.fontColor = std::string(*fontColor);
+  if (backgroundColor) base.fragmentBackgroundColor = std::string(*backgroundColor);
+  if (textDecorationColor) base.textDecorationColor = std::string(*textDecorationColor);
+  if (fontFamily) {
+    if (fontFamilyFromShorthand) {
+      std::string family;
+      html::forEachToken(*fontFamily, [&](std::string_view token) {
+        if (!family.empty()) family.push_back(' ');
+        family.append(token);
+      });
+      base.fontFamily = html::stripQuotes(family);
+    } else {
+      base.fontFamily = html::stripQuotes(*fontFamily);
+    }
+  }
+  overrideWith(base.fontSize, fontSize);
+  overrideWith(base.lineHeight, lineHeight);
+  overrideWith(base.letterSpacing, letterSpacing);
+  overrideWith(base.fontWeight, fontWeight);
+  overrideWith(base.fontStyle, fontStyle);
+  overrideWith(base.textAlign, textAlign);
+  overrideWith(base.textTransform, textTransform);
+  overrideWith(base.textDecorationLine, textDecorationLine);
+  overrideWith(base.textDecorationStyle, textDecorationStyle);
+  if (unsetsTextDecorationLine) {
+    base.textDecorationLine = std::nullopt;
+  }
+}
+
+CssStylesheet CssProcessor::buildStylesheet(const std::vector<std::string_view>& blocks)
+{
+  CssStylesheet sheet;
+  uint32_t order = 0;
+  for (const auto& block : blocks) {
+    const std::string cleaned = stripComments(block);
+    parseCssRules(cleaned, [&](std::string_view selector, std::string_view body) {
+      if (selector.empty() || selector.front() == '@') {
+        return;
+      }
+      CssDeclarations declarations = parseCssDeclarations(body);
+      if (declarations.empty()) {
+        return;
+      }
+      const auto declarationsIndex = static_cast<uint32_t>(sheet.declarations.size());
+      sheet.declarations.push_back(std::move(declarations));
+      // Comma separated selectors share one declaration block; an invalid
+      // one drops only itself.
+      size_t begin = 0;
+      while (begin <= selector.size()) {
+        size_t comma = selector.find(',', begin);
+        if (comma == std::string_view::npos) comma = selector.size();
+        const std::string_view target = html::trim(selector.substr(begin, comma - begin));
+        begin = comma + 1;
+        if (auto parsed = CssSelector::parse(target)) {
+          addRule(sheet, std::move(*parsed), declarationsIndex, order++);
+        }
+      }
+    });
+  }
+  return sheet;
+}
+
+CssAppliedStyle CssProcessor::applyStylesFromSheet(const HtmlNode& node, const CssAncestorFilter& ancestors,
+                                                   const CssStylesheet& sheet)
+{
+  std::vector<const CssRule*> matched;
+  auto collect = [&](const std::vector<CssRule>* rules) {
+    if (rules == nullptr) return;
+    for (const auto& rule : *rules) {
+      if (rule.matchedByKey || ancestors.matches(rule.selector, node)) {
+        matched.push_back(&rule);
+      }
+    }
+  };
+
+  collect(&sheet.universal);
+  collect(findRules(sheet.tag, node.tagName));
+  auto classAttr = node.nonEmptyAttribute(HtmlName::Class);
+  if (!classAttr) classAttr = node.nonEmptyAttribute(HtmlName::ClassName);
+  if (classAttr) {
+    html::forEachToken(*classAttr, [&](std::string_view className) {
+      collect(findRules(sheet.className, className));
+    });
+  }
+  if (auto idAttr = node.nonEmptyAttribute(HtmlName::Id)) {
+    collect(findRules(sheet.id, *idAttr));
+  }
+
+  CssAppliedStyle result;
+  if (matched.empty()) {
+    return result;
+  }
+  std::sort(matched.begin(), matched.end(), [](const CssRule* a, const CssRule* b) {
+    return a->selector.specificity != b->selector.specificity ? a->selector.specificity < b->selector.specificity
+                                                              : a->order < b->order;
+  });
+  // A class listed twice finds its rules twice.
+  matched.erase(std::unique(matched.begin(), matched.end()), matched.end());
+
+  // Same semantics as CssDeclarations::set, without copying declarations
+  // out of the (shared) stylesheet.
+  std::vector<const CssDeclaration*> merged;
+  for (const CssRule* rule : matched) {
+    for (const auto& declaration : sheet.declarations[rule->declarations]) {
+      if (declaration.hides) {
+        result.hidden = true;
+        continue;
+      }
+      if (declaration.zeroMargin) {
+        // A zero margin suppresses the extra newline around blocks.
+        result.suppressNewlines = true;
+      }
+      auto existing = std::find_if(merged.begin(), merged.end(), [&](const CssDeclaration* other) {
+        return other->sameProperty(declaration);
+      });
+      if (existing != merged.end()) {
+        *existing = &declaration;
+      } else {
+        merged.push_back(&declaration);
+      }
+    }
+  }
+
+  if (!merged.empty()) {
+    CssFragment fragment;
+    for (const CssDeclaration* declaration : merged) {
+      mergeDeclaration(fragment, declaration->parsed);
+    }
+    result.fragment = std::move(fragment);
+  }
+  return result;
+}
+
+CssAppliedStyle CssProcessor::applyInlineStyles(std::optional<std::string_view> styleAttr)
+{
+  CssAppliedStyle applied;
+  if (!styleAttr || styleAttr->empty()) {
+    return applied;
+  }
+  const CssInlineStyle style = parseInlineStyle(*styleAttr);
+  if (style.hidden) {
+    applied.hidden = true;
+    return applied;
+  }
+  applied.suppressNewlines = style.suppressNewlines;
+  if (style.declared) {
+    CssFragment fragment;
+    style.applyTo(fragment.style);
+    fragment.unsetsTextDecorationLine = style.unsetsTextDecorationLine;
+    applied.fragment = std::move(fragment);
+  }
+  return applied;
+}
+
+CssInlineStyle CssProcessor::parseInlineStyle(std::string_view styleAttr)
+{
+  // The last value of each property, applied in the order the properties
+  // first appear: what CssDeclarations::set and cssDeclarationsToFragment
+  // give, without copying a name or a value.
+  std::optional<std::string_view> values[kPropertyCount];
+  CssProperty order[kPropertyCount];
+  size_t count = 0;
+
+  CssInlineStyle style;
+  size_t begin = 0;
+  while (begin <= styleAttr.size()) {
+    size_t semicolon = styleAttr.find(';', begin);
+    if (semicolon == std::string_view::npos) semicolon = styleAttr.size();
+    const std::string_view part = html::trim(styleAttr.substr(begin, semicolon - begin));
+    begin = semicolon + 1;
+
+    const size_t colon = part.find(':');
+    if (part.empty() || colon == std::string_view::npos) continue;
+    const std::string_view property = html::trim(part.substr(0, colon));
+    if (property.empty()) continue;
+    style.declared = true;
+    const CssProperty id = propertyId(property);
+    if (id == CssProperty::Other) continue;
+    auto& value = values[static_cast<size_t>(id)];
+    if (!value) order[count++] = id;
+    value = html::trim(part.substr(colon + 1));
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    applyDeclaration(order[i], *values[static_cast<size_t>(order[i])], style);
+  }
+  if (style.hidden) {
+    // `display: none` hides the element whatever else it declares.
+    CssInlineStyle hidden;
+    hidden.hidden = true;
+    return hidden;
+  }
+  return style;
+}
+
+CssDeclarations CssProcessor::parseCssDeclarations(std::string_view input)
+{
+  CssDeclarations declarations;
+  size_t begin = 0;
+  while (begin <= input.size()) {
+    size_t semicolon = input.find(';', begin);
+    if (semicolon == std::string_view::npos) semicolon = input.size();
+    const std::string_view part = html::trim(input.substr(begin, semicolon - begin));
+    begin = semicolon + 1;
+
+    const size_t colon = part.find(':');
+    if (part.empty() || colon == std::string_view::npos) continue;
+    std::string property = html::toLowerAscii(html::trim(part.substr(0, colon)));
+    if (!property.empty()) {
+      declarations.set(compileDeclaration(std::move(property), std::string(html::trim(part.substr(colon + 1)))));
+    }
+  }
+  return declarations;
+}
+
+CssFragment CssProcessor::cssDeclarationsToFragment(const CssDeclarations& declarations)
+{
+  CssFragment out;
+  for (const auto& declaration : declarations) {
+    mergeDeclaration(out, declaration.parsed);
+  }
+  return out;
+}
+
+CssDeclaration CssProcessor::compileDeclaration(std::string property, std::string value)
+{
+  CssDeclaration declaration;
+  declaration.id = propertyId(property);
+  declaration.property = std::move(property);
+  declaration.value = std::move(value);
+
+  CssInlineStyle style;
+  applyDeclaration(declaration.id, declaration.value, style);
+  declaration.hides = style.hidden;
+  declaration.zeroMargin = style.suppressNewlines;
+  style.applyTo(declaration.parsed.style);
+  declaration.parsed.unsetsTextDecorationLine = style.unsetsTextDecorationLine;
+  return declaration;
+}
+
+void CssProcessor::applyDeclaration(CssProperty id, std::string_view value, CssInlineStyle& out)
+{
+  switch (id) {
+  case CssProperty::Display:
+    out.hidden = out.hidden || isDisplayNone(value);
+    break;
+  case CssProperty::Margin:
+  case CssProperty::MarginTop:
+  case CssProperty::MarginBottom:
+    out.suppressNewlines = out.suppressNewlines || html::isZeroMargin(value);
+    break;
+  default:
+    break;
+  }
+  if (value.empty()) {
+    return;
+  }
+
+  switch (id) {
+  case CssProperty::Color:
+    out.fontColor = value;
+    break;
+  case CssProperty::Background:
+  case CssProperty::BackgroundColor:
+    out.backgroundColor = value;
+    break;
+  case CssProperty::FontSize:
+    overrideWith(out.fontSize, html::parseNumeric(value));
+    break;
+  case CssProperty::LineHeight:
+    overrideWith(out.lineHeight, html::parseNumeric(value));
+    break;
+  case CssProperty::LetterSpacing:
+    overrideWith(out.letterSpacing, html::parseNumeric(value));
+    break;
+  case CssProperty::FontWeight:
+    overrideWith(out.fontWeight, normalizeCssFontWeight(value));
+    break;
+  case CssProperty::FontStyle:
+    overrideWith(out.fontStyle, fontStyleFromString(value));
+    break;
+  case CssProperty::FontFamily:
+    out.fontFamily = value;
+    out.fontFamilyFromShorthand = false;
+    break;
+  case CssProperty::TextAlign:
+    overrideWith(out.textAlign, textAlignFromString(value));
+    break;
+  case CssProperty::TextTransform:
+    overrideWith(out.textTransform, textTransformFromString(value));
+    break;
+  case CssProperty::TextDecoration:
+  case CssProperty::TextDecorationLine:
+    // A later `text-decoration` replaces an earlier one, including with "unset".
+    out.textDecorationLine = normalizeDecoration(value);
+    out.unsetsTextDecorationLine = !out.textDecorationLine.has_value();
+    break;
+  case CssProperty::TextDecorationColor:
+    out.textDecorationColor = value;
+    break;
+  case CssProperty::TextDecorationStyle:
+    overrideWith(out.textDecorationStyle, textDecorationStyleFromString(value));
+    break;
+  case CssProperty::Font:
+    parseFontShorthand(value, out);
+    break;
+  default:
+    break;
+  }
+}
+
+void CssProcessor::parseFontShorthand(std::string_view value, CssInlineStyle& out)
+{
+  // The first token with a digit or a `/` is the size (and line height).
+  size_t sizeIndex = SIZE_MAX;
+  size_t index = 0;
+  html::forEachToken(value, [&](std::string_view token) {
+    const size_t i = index++;
+    if (sizeIndex != SIZE_MAX) return;
+    const size_t slash = token.find('/');
+    if (slash != std::string_view::npos) {
+      const std::string_view rest = token.substr(slash + 1);
+      overrideWith(out.fontSize, html::parseNumeric(token.substr(0, slash)));
+      overrideWith(out.lineHeight, html::parseNumeric(rest.substr(0, rest.find('/'))));
+      sizeIndex = i;
+    } else if (token.find_first_of("0123456789") != std::string_view::npos) {
+      overrideWith(out.fontSize, html::parseNumeric(token));
+      sizeIndex = i;
+    }
+  });
+
+  // Style and weight come before the size, the family after it.
+  const char* familyBegin = nullptr;
+  const char* familyEnd = nullptr;
+  index = 0;
+  html::forEachToken(value, [&](std::string_view token) {
+    const size_t i = index++;
+    if (i < sizeIndex) {
+      if (token == "italic" || token == "oblique") {
+        out.fontStyle = fontStyleFromString(token);
+      } else {
+        overrideWith(out.fontWeight, normalizeCssFontWeight(token));
+      }
+    } else if (i > sizeIndex) {
+      if (familyBegin == nullptr) familyBegin = token.data();
+      familyEnd = token.data() + token.size();
+    }
+  });
+  if (familyBegin != nullptr) {
+    out.fontFamily = std::string_view(familyBegin, static_cast<size_t>(familyEnd - familyBegin));
+    out.fontFamilyFromShorthand = true;
+  }
+}
+
+std::optional<FontWeight> CssProcessor::normalizeCssFontWeight(std::string_view value)
+{
+  return fontWeightFromString(html::trim(value));
+}
+
+std::optional<TextDecorationLine> CssProcessor::normalizeDecoration(std::string_view value)
+{
+  bool underline = false;
+  bool lineThrough = false;
+  std::optional<TextDecorationLine> first;
+  size_t supported = 0;
+  html::forEachToken(value, [&](std::string_view token) {
+    if (html::equalsIgnoringCase(token, "underline")) {
+      underline = true;
+    } else if (html::equalsIgnoringCase(token, "line-through")) {
+      lineThrough = true;
+    } else {
+      return;
+    }
+    if (supported++ == 0) {
+      first = underline ? TextDecorationLine::UNDERLINE : TextDecorationLine::LINE_THROUGH;
+    }
+  });
+  if (supported == 2) {
+    return TextDecorationLine::UNDERLINE_LINE_THROUGH;
+  }
+  return first;
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,237 @@
+//
+// NitroTextCssProcessor.hpp
+// Native port of the HTML renderer's CSS processor
+//
+
+#pragma once
+
+#include "Fragment.hpp"
+#include "NitroTextCssSelector.hpp"
+#include "NitroTextHtmlNode.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * A fragment style produced from CSS. Mirrors the partial object built in
+ * JS, where `text-decoration: none` assigns `undefined` and so removes an
+ * inherited decoration on merge instead of leaving it alone.
+ */
+struct CssFragment {
+  Fragment style;
+  bool unsetsTextDecorationLine = false;
+
+  /**
+   * @brief Merges this over `base`, like `mergeStyles(base, fragment)`.
+   */
+  void applyTo(Fragment& base) const;
+};
+
+/**
+ * Properties the CSS subset reads. Anything else is `Other` and only kept so
+ * declarations merge by name like they do in JS. Names map to these through
+ * a perfect hash (see `CssProcessor::propertyId`).
+ */
+enum class CssProperty : uint8_t {
+  Other,
+  Color,
+  Background,
+  BackgroundColor,
+  FontSize,
+  LineHeight,
+  LetterSpacing,
+  FontWeight,
+  FontStyle,
+  FontFamily,
+  TextAlign,
+  TextTransform,
+  TextDecoration,
+  TextDecorationLine,
+  TextDecorationColor,
+  TextDecorationStyle,
+  Font,
+  Display,
+  Margin,
+  MarginTop,
+  MarginBottom,
+};
+
+/**
+ * What a set of declarations contributes to a fragment, without owning any
+ * text: colors and families are views into the CSS, copied only when the
+ * style is applied to a fragment. Parsing a `style` attribute into one
+ * allocates nothing.
+ */
+struct CssInlineStyle {
+  std::optional<std::string_view> fontColor;
+  std::optional<std::string_view> backgroundColor;
+  std::optional<std::string_view> textDecorationColor;
+  // Applied with its quotes removed; from the `font` shorthand, its
+  // whitespace is collapsed too.
+  std::optional<std::string_view> fontFamily;
+  bool fontFamilyFromShorthand = false;
+  std::optional<double> fontSize;
+  std::optional<double> lineHeight;
+  std::optional<double> letterSpacing;
+  std::optional<FontWeight> fontWeight;
+  std::optional<FontStyle> fontStyle;
+  std::optional<TextAlign> textAlign;
+  std::optional<TextTransform> textTransform;
+  std::optional<TextDecorationLine> textDecorationLine;
+  std::optional<TextDecorationStyle> textDecorationStyle;
+  // `text-decoration: none`, see CssFragment.
+  bool unsetsTextDecorationLine = false;
+  // Any declaration at all, even of a property the subset ignores.
+  bool declared = false;
+  // `display: none`.
+  bool hidden = false;
+  // A zero `margin`, `margin-top` or `margin-bottom`.
+  bool suppressNewlines = false;
+
+  /**
+   * @brief Merges this over `base`, like `CssFragment::applyTo`.
+   */
+  void applyTo(Fragment& base) const;
+};
+
+/**
+ * One `property: value` pair, with the value already parsed for the property
+ * so cascading never looks at the text again.
+ */
+struct CssDeclaration {
+  std::string property;
+  std::string value;
+  CssProperty id = CssProperty::Other;
+  // What this declaration alone contributes to a fragment.
+  CssFragment parsed;
+  // `display: none`.
+  bool hides = false;
+  // A zero `margin`, `margin-top` or `margin-bottom`.
+  bool zeroMargin = false;
+
+  bool sameProperty(const CssDeclaration& other) const noexcept
+  {
+    return id == other.id && (id != CssProperty::Other || property == other.property);
+  }
+};
+
+/**
+ * Declarations of one rule or `style` attribute in source order. Assigning a
+ * property again replaces its value but keeps its position, like a JS object.
+ */
+class CssDeclarations final {
+public:
+  void set(CssDeclaration declaration);
+  bool empty() const noexcept { return entries_.empty(); }
+
+  auto begin() const noexcept { return entries_.begin(); }
+  auto end() const noexcept { return entries_.end(); }
+
+private:
+  std::vector<CssDeclaration> entries_;
+};
+
+struct CssAppliedStyle {
+  std::optional<CssFragment> fragment;
+  bool hidden = false;
+  bool suppressNewlines = false;
+};
+
+/**
+ * A selector and the declarations it applies. Rules from one comma separated
+ * list share their declarations.
+ */
+struct CssRule {
+  CssSelector selector;
+  uint32_t declarations;
+  // Position in the stylesheet; breaks specificity ties.
+  uint32_t order;
+  // `selector` is exactly the key of its bucket (`p`, `.a`, `#b`, `*`), so
+  // finding it in the bucket already proves the match.
+  bool matchedByKey;
+};
+
+/**
+ * Rules from `<style>` blocks, bucketed by the rightmost compound selector:
+ * under its id if it has one, else its first class, else its type. Rules
+ * whose rightmost compound has none of those (`*`, `ul > *`) are universal.
+ *
+ * Immutable once built, so one sheet can be shared by every render that
+ * embeds the same `<style>` blocks (see CssStylesheetCache).
+ */
+struct CssStylesheet {
+  struct KeyHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view key) const noexcept {
+      return std::hash<std::string_view>{}(key);
+    }
+  };
+  using Bucket = std::unordered_map<std::string, std::vector<CssRule>, KeyHash, std::equal_to<>>;
+
+  std::vector<CssDeclarations> declarations;
+  std::vector<CssRule> universal;
+  Bucket tag;
+  Bucket className;
+  Bucket id;
+  // Whether any rule has a combinator, i.e. whether matching needs ancestors.
+  bool hasCombinators = false;
+};
+
+/**
+ * The CSS subset of the HTML renderer; a port of `CSSProcessor` in
+ * src/renderers/css-processor.ts.
+ *
+ * Selector matching goes further than the JS version, which only knows bare
+ * `*`, tag, `.class` and `#id` selectors applied in that order: descendant
+ * and child combinators match too, and rules apply in specificity, then
+ * source order, as in browsers.
+ */
+class CssProcessor final {
+public:
+  static CssStylesheet buildStylesheet(const std::vector<std::string_view>& blocks);
+
+  /**
+   * @brief Cascades every rule matching `node` by specificity, then source
+   * order. `ancestors` holds the elements above `node`; it is only consulted
+   * when the sheet has combinators.
+   */
+  static CssAppliedStyle applyStylesFromSheet(const HtmlNode& node, const CssAncestorFilter& ancestors,
+                                              const CssStylesheet& sheet);
+
+  /**
+   * @brief Applies a `style` attribute; a missing or empty one applies nothing.
+   */
+  static CssAppliedStyle applyInlineStyles(std::optional<std::string_view> styleAttr);
+
+  /**
+   * @brief Parses a `style` attribute in place, with the same result as
+   * `applyInlineStyles`. The style refers into `styleAttr`.
+   */
+  static CssInlineStyle parseInlineStyle(std::string_view styleAttr);
+
+  /**
+   * @brief The property `name` (any case, no surrounding whitespace) names.
+   */
+  static CssProperty propertyId(std::string_view name) noexcept;
+
+  static CssDeclarations parseCssDeclarations(std::string_view input);
+
+  static CssFragment cssDeclarationsToFragment(const CssDeclarations& declarations);
+
+private:
+  static CssDeclaration compileDeclaration(std::string property, std::string value);
+  static void applyDeclaration(CssProperty id, std::string_view value, CssInlineStyle& out);
+  static void parseFontShorthand(std::string_view value, CssInlineStyle& out);
+  static std::optional<FontWeight> normalizeCssFontWeight(std::string_view value);
+  static std::optional<TextDecorationLine> normalizeDecoration(std::string_view value);
+};
+
+} // namespace margelo::nitro::nitrotext
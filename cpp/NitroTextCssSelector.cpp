@@ -0,0 +1,252 @@
+//
+// NitroTextCssSelector.cpp
+// Selector parsing and matching for the native CSS processor
+//
+
+#include "NitroTextCssSelector.hpp"
+#include "NitroTextHtmlUtil.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+bool isIdentChar(char c)
+{
+  const auto byte = static_cast<unsigned char>(c);
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' ||
+         c == '_' || byte >= 0x80;
+}
+
+bool isSelectorSpace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
+
+std::string_view readIdent(std::string_view text, size_t& i)
+{
+  const size_t begin = i;
+  while (i < text.size() && isIdentChar(text[i])) i++;
+  return text.substr(begin, i - begin);
+}
+
+// `class`, or `classname` when that is missing, like the JS renderer.
+std::optional<std::string_view> classAttribute(const HtmlNode& element)
+{
+  auto value = element.nonEmptyAttribute(HtmlName::Class);
+  return value ? value : element.nonEmptyAttribute(HtmlName::ClassName);
+}
+
+bool hasClass(std::string_view classAttr, std::string_view className)
+{
+  bool found = false;
+  html::forEachToken(classAttr, [&](std::string_view token) { found = found || token == className; });
+  return found;
+}
+
+} // namespace
+
+bool CssCompoundSelector::matches(const HtmlNode& element) const
+{
+  if (!tag.empty() && element.tagName != tag) return false;
+  if (!id.empty()) {
+    const auto idAttr = element.nonEmptyAttribute(HtmlName::Id);
+    if (!idAttr || *idAttr != id) return false;
+  }
+  if (!classes.empty()) {
+    const auto classAttr = classAttribute(element);
+    if (!classAttr) return false;
+    for (const auto& className : classes) {
+      if (!hasClass(*classAttr, className)) return false;
+    }
+  }
+  return true;
+}
+
+std::optional<CssSelector> CssSelector::parse(std::string_view text)
+{
+  // Parsed left to right, reversed at the end.
+  std::vector<CssCompoundSelector> compounds;
+  std::vector<CssCombinator> combinators;
+  uint32_t ids = 0;
+  uint32_t classes = 0;
+  uint32_t types = 0;
+
+  CssCompoundSelector current;
+  bool inCompound = false;
+  std::optional<CssCombinator> pending;
+
+  auto finishCompound = [&] {
+    if (!inCompound) return;
+    if (!compounds.empty()) combinators.push_back(pending.value_or(CssCombinator::Descendant));
+    compounds.push_back(std::move(current));
+    current = CssCompoundSelector();
+    inCompound = false;
+    pending.reset();
+  };
+
+  size_t i = 0;
+  while (i < text.size()) {
+    const char c = text[i];
+    if (isSelectorSpace(c)) {
+      finishCompound();
+      i++;
+      continue;
+    }
+    if (c == '>') {
+      finishCompound();
+      if (compounds.empty() || pending.has_value()) return std::nullopt;
+      pending = CssCombinator::Child;
+      i++;
+      continue;
+    }
+    if (c == '*') {
+      // Only valid at the start of a compound.
+      if (inCompound) return std::nullopt;
+      inCompound = true;
+      i++;
+      continue;
+    }
+    if (c == '.' || c == '#') {
+      i++;
+      const std::string_view name = readIdent(text, i);
+      if (name.empty()) return std::nullopt;
+      if (c == '.') {
+        current.classes.emplace_back(name);
+        classes++;
+      } else {
+        // `#a#b` can never match; treat it like any unsupported selector.
+        if (!current.id.empty()) return std::nullopt;
+        current.id = std::string(name);
+        ids++;
+      }
+      inCompound = true;
+      continue;
+    }
+    if (isIdentChar(c) && !inCompound) {
+      current.tag = html::toLowerAscii(readIdent(text, i));
+      types++;
+      inCompound = true;
+      continue;
+    }
+    // Attribute selectors, pseudo-classes, sibling combinators, escapes...
+    return std::nullopt;
+  }
+  finishCompound();
+  if (compounds.empty() || pending.has_value()) return std::nullopt;
+
+  CssSelector selector;
+  constexpr uint32_t kField = 0x3ff;
+  selector.specificity = (std::min(ids, kField) << 20) | (std::min(classes, kField) << 10) | std::min(types, kField);
+
+  // Ids and classes are more selective than tags, so they go in first.
+  auto addHash = [&](CssAncestorFilter::HashKind kind, std::string_view name) {
+    if (selector.ancestorHashCount < kMaxAncestorHashes) {
+      selector.ancestorHashes[selector.ancestorHashCount++] = CssAncestorFilter::hash(kind, name);
+    }
+  };
+  for (size_t k = 0; k + 1 < compounds.size(); k++) {
+    if (!compounds[k].id.empty()) addHash(CssAncestorFilter::HashKind::Id, compounds[k].id);
+  }
+  for (size_t k = 0; k + 1 < compounds.size(); k++) {
+    for (const auto& className : compounds[k].classes) addHash(CssAncestorFilter::HashKind::Class, className);
+  }
+  for (size_t k = 0; k + 1 < compounds.size(); k++) {
+    if (!compounds[k].tag.empty()) addHash(CssAncestorFilter::HashKind::Tag, compounds[k].tag);
+  }
+
+  std::reverse(compounds.begin(), compounds.end());
+  std::reverse(combinators.begin(), combinators.end());
+  selector.compounds = std::move(compounds);
+  selector.combinators = std::move(combinators);
+  return selector;
+}
+
+uint32_t CssAncestorFilter::hash(HashKind kind, std::string_view name) noexcept
+{
+  // FNV-1a seeded per kind, so `.a`, `#a` and `a` hash apart.
+  uint32_t hash = 2166136261u ^ static_cast<uint32_t>(kind);
+  for (const char c : name) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+void CssAncestorFilter::push(const HtmlNode& element)
+{
+  const size_t before = hashes_.size();
+  hashes_.push_back(hash(HashKind::Tag, element.tagName));
+  if (auto idAttr = element.nonEmptyAttribute(HtmlName::Id)) {
+    hashes_.push_back(hash(HashKind::Id, *idAttr));
+  }
+  if (auto classAttr = classAttribute(element)) {
+    html::forEachToken(*classAttr, [&](std::string_view className) {
+      hashes_.push_back(hash(HashKind::Class, className));
+    });
+  }
+  for (size_t i = before; i < hashes_.size(); i++) add(hashes_[i]);
+  hashCounts_.push_back(hashes_.size() - before);
+  ancestors_.push_back(&element);
+}
+
+void CssAncestorFilter::pop()
+{
+  const size_t count = hashCounts_.back();
+  hashCounts_.pop_back();
+  for (size_t i = hashes_.size() - count; i < hashes_.size(); i++) remove(hashes_[i]);
+  hashes_.resize(hashes_.size() - count);
+  ancestors_.pop_back();
+}
+
+bool CssAncestorFilter::mightContainAll(const CssSelector& selector) const noexcept
+{
+  for (uint8_t i = 0; i < selector.ancestorHashCount; i++) {
+    const uint32_t hash = selector.ancestorHashes[i];
+    if (counters_[hash & kMask] == 0 || counters_[(hash >> kBits) & kMask] == 0) return false;
+  }
+  return true;
+}
+
+bool CssAncestorFilter::matches(const CssSelector& selector, const HtmlNode& element) const
+{
+  if (!selector.compounds.front().matches(element)) return false;
+  if (!selector.hasCombinators()) return true;
+  if (!mightContainAll(selector)) return false;
+  return matchesAncestors(selector, 1, ancestors_.size());
+}
+
+bool CssAncestorFilter::matchesAncestors(const CssSelector& selector, size_t compound,
+                                         size_t ancestorCount) const
+{
+  if (compound == selector.compounds.size()) return true;
+  const CssCompoundSelector& wanted = selector.compounds[compound];
+  if (selector.combinators[compound - 1] == CssCombinator::Child) {
+    return ancestorCount > 0 && wanted.matches(*ancestors_[ancestorCount - 1]) &&
+           matchesAncestors(selector, compound + 1, ancestorCount - 1);
+  }
+  for (size_t k = ancestorCount; k > 0; k--) {
+    if (wanted.matches(*ancestors_[k - 1]) && matchesAncestors(selector, compound + 1, k - 1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void CssAncestorFilter::add(uint32_t hash) noexcept
+{
+  for (const uint32_t slot : {hash & kMask, (hash >> kBits) & kMask}) {
+    if (counters_[slot] != std::numeric_limits<uint8_t>::max()) counters_[slot]++;
+  }
+}
+
+void CssAncestorFilter::remove(uint32_t hash) noexcept
+{
+  for (const uint32_t slot : {hash & kMask, (hash >> kBits) & kMask}) {
+    if (counters_[slot] != std::numeric_limits<uint8_t>::max()) counters_[slot]--;
+  }
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,106 @@
+//
+// NitroTextCssSelector.hpp
+// Selector parsing and matching for the native CSS processor
+//
+
+#pragma once
+
+#include "NitroTextHtmlNode.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * A compound selector such as `a`, `.footer`, `li.item#first` or `*`.
+ */
+struct CssCompoundSelector {
+  // Lowercased type selector; empty for `*` or no type.
+  std::string tag;
+  std::string id;
+  std::vector<std::string> classes;
+
+  bool matches(const HtmlNode& element) const;
+};
+
+enum class CssCombinator : uint8_t {
+  // `a b`: any ancestor.
+  Descendant,
+  // `a > b`: the parent.
+  Child,
+};
+
+/**
+ * A complex selector, stored right to left: `compounds[0]` is the element
+ * being matched and `combinators[i]` joins `compounds[i]` to the compound on
+ * its left, `compounds[i + 1]`.
+ *
+ * Supports type, `*`, `.class` and `#id` compounds joined by descendant and
+ * child combinators. Anything else (attribute selectors, pseudo-classes,
+ * sibling combinators, escapes) fails to parse, and the rule is dropped.
+ */
+struct CssSelector {
+  static constexpr size_t kMaxAncestorHashes = 4;
+
+  std::vector<CssCompoundSelector> compounds;
+  std::vector<CssCombinator> combinators;
+  // (ids, classes, types) packed so comparing integers compares specificity.
+  uint32_t specificity = 0;
+  // Names some ancestor must carry, hashed for CssAncestorFilter; a subset
+  // is enough to reject most non-matching rules without walking ancestors.
+  std::array<uint32_t, kMaxAncestorHashes> ancestorHashes{};
+  uint8_t ancestorHashCount = 0;
+
+  static std::optional<CssSelector> parse(std::string_view text);
+
+  bool hasCombinators() const noexcept { return !combinators.empty(); }
+};
+
+/**
+ * The open elements above the element being styled, plus a counting Bloom
+ * filter of their tag names, ids and classes.
+ *
+ * The renderer pushes an element before walking its children and pops it
+ * afterwards. A descendant or child selector whose ancestor names are not
+ * all in the filter cannot match and is rejected without looking at the
+ * ancestors, which keeps matching close to linear in document size.
+ */
+class CssAncestorFilter final {
+public:
+  void push(const HtmlNode& element);
+  void pop();
+
+  /**
+   * @brief Whether `selector` matches `element`, whose ancestors are the
+   * pushed elements.
+   */
+  bool matches(const CssSelector& selector, const HtmlNode& element) const;
+
+  bool mightContainAll(const CssSelector& selector) const noexcept;
+
+  enum class HashKind : uint32_t { Tag = 0x9e3779b9, Id = 0x85ebca6b, Class = 0xc2b2ae35 };
+  static uint32_t hash(HashKind kind, std::string_view name) noexcept;
+
+private:
+  static constexpr size_t kBits = 12;
+  static constexpr uint32_t kMask = (1u << kBits) - 1;
+
+  bool matchesAncestors(const CssSelector& selector, size_t compound, size_t ancestorCount) const;
+  void add(uint32_t hash) noexcept;
+  void remove(uint32_t hash) noexcept;
+
+  std::vector<const HtmlNode*> ancestors_;
+  // Hashes added per element, so `pop` can take them back out.
+  std::vector<uint32_t> hashes_;
+  std::vector<size_t> hashCounts_;
+  // Saturating counters; one that reached the maximum is never decremented.
+  std::array<uint8_t, size_t(1) << kBits> counters_{};
+};
+
+} // namespace margelo::nitro::nitrotext
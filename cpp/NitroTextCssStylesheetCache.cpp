@@ -0,0 +1,120 @@
+//
+// NitroTextCssStylesheetCache.cpp
+// Process-wide cache of compiled `<style>` blocks
+//
+
+#include "NitroTextCssStylesheetCache.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+struct CacheEntry {
+  std::shared_ptr<const CssStylesheet> sheet;
+  uint64_t lastUsed = 0;
+};
+
+struct StylesheetTable {
+  std::mutex mutex;
+  std::unordered_map<std::string, CacheEntry> entries;
+  uint64_t clock = 0;
+  CssStylesheetCache::Stats stats;
+};
+
+StylesheetTable& table()
+{
+  // Intentionally leaked, like the atom table: renders may still run from
+  // static destructors of other translation units.
+  static auto* instance = new StylesheetTable();
+  return *instance;
+}
+
+// Length-prefixes every block so ["ab", "c"] and ["a", "bc"] differ.
+std::string makeKey(const std::vector<std::string_view>& blocks)
+{
+  size_t size = 0;
+  for (const auto& block : blocks) size += block.size() + 12;
+  std::string key;
+  key.reserve(size);
+  for (const auto& block : blocks) {
+    key += std::to_string(block.size());
+    key.push_back(':');
+    key.append(block);
+  }
+  return key;
+}
+
+void evictLeastRecentlyUsed(StylesheetTable& t)
+{
+  auto oldest = t.entries.begin();
+  for (auto it = t.entries.begin(); it != t.entries.end(); ++it) {
+    if (it->second.lastUsed < oldest->second.lastUsed) oldest = it;
+  }
+  if (oldest != t.entries.end()) t.entries.erase(oldest);
+}
+
+} // namespace
+
+std::shared_ptr<const CssStylesheet> CssStylesheetCache::get(const std::vector<std::string_view>& blocks)
+{
+  static const auto empty = std::make_shared<const CssStylesheet>();
+  if (blocks.empty()) {
+    return empty;
+  }
+
+  auto& t = table();
+  std::string key = makeKey(blocks);
+  {
+    std::lock_guard<std::mutex> lock(t.mutex);
+    auto it = t.entries.find(key);
+    if (it != t.entries.end()) {
+      it->second.lastUsed = ++t.clock;
+      t.stats.hits++;
+      return it->second.sheet;
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  auto sheet = std::make_shared<const CssStylesheet>(CssProcessor::buildStylesheet(blocks));
+  const auto end = std::chrono::steady_clock::now();
+
+  std::lock_guard<std::mutex> lock(t.mutex);
+  t.stats.misses++;
+  t.stats.compileMilliseconds += std::chrono::duration<double, std::milli>(end - start).count();
+  // Another thread may have compiled the same sheet meanwhile; keep the
+  // stored one so every caller shares a single copy.
+  auto it = t.entries.find(key);
+  if (it != t.entries.end()) {
+    it->second.lastUsed = ++t.clock;
+    return it->second.sheet;
+  }
+  if (t.entries.size() >= kCapacity) {
+    evictLeastRecentlyUsed(t);
+  }
+  t.entries.emplace(std::move(key), CacheEntry{sheet, ++t.clock});
+  return sheet;
+}
+
+CssStylesheetCache::Stats CssStylesheetCache::stats()
+{
+  auto& t = table();
+  std::lock_guard<std::mutex> lock(t.mutex);
+  Stats stats = t.stats;
+  stats.entries = t.entries.size();
+  return stats;
+}
+
+void CssStylesheetCache::clear()
+{
+  auto& t = table();
+  std::lock_guard<std::mutex> lock(t.mutex);
+  t.entries.clear();
+  t.stats = Stats();
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,56 @@
+//
+// NitroTextCssStylesheetCache.hpp
+// Process-wide cache of compiled `<style>` blocks
+//
+
+#pragma once
+
+#include "NitroTextCssProcessor.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * Compiled stylesheets keyed by the text of a document's `<style>` blocks.
+ *
+ * Lists of similar rows (an inbox, a feed) tend to embed the same template
+ * stylesheet in every item. The first render compiles it; every later render
+ * with byte-identical blocks reuses the immutable result and skips CSS
+ * parsing entirely.
+ *
+ * Holds at most `kCapacity` sheets and evicts the least recently used one.
+ * Thread-safe; compiling happens outside the lock.
+ */
+class CssStylesheetCache final {
+public:
+  static constexpr size_t kCapacity = 64;
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t entries = 0;
+    // Time spent compiling stylesheets on misses.
+    double compileMilliseconds = 0;
+  };
+
+  /**
+   * @brief The compiled stylesheet for `blocks`, compiling it on a miss.
+   * Documents without `<style>` blocks share one empty sheet and are not
+   * counted.
+   */
+  static std::shared_ptr<const CssStylesheet> get(const std::vector<std::string_view>& blocks);
+
+  static Stats stats();
+
+  /**
+   * @brief Drops every cached sheet and resets the counters.
+   */
+  static void clear();
+};
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,104 @@
+//
+// NitroTextEllipsize.cpp
+// Truncating a line of text to a width at grapheme cluster boundaries
+//
+
+#include "NitroTextEllipsize.hpp"
+#include "NitroTextGrapheme.hpp"
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+// Measures whole clusters inwards from one end of a line.
+struct ClusterWalk {
+  std::string_view text;
+  const GlyphAdvanceCache& advances;
+  float letterSpacing;
+
+  float width(size_t from, size_t to) const { return advances.width(text.substr(from, to - from), letterSpacing); }
+
+  // The furthest boundary from `from` up to `limit` whose clusters fit
+  // `budget`; adds their width to `used`.
+  size_t forwards(size_t from, size_t limit, float budget, float& used) const
+  {
+    size_t at = from;
+    while (at < limit) {
+      const size_t next = nextGraphemeBoundary(text, at);
+      const float cluster = width(at, next);
+      if (used + cluster > budget) break;
+      used += cluster;
+      at = next;
+    }
+    return at;
+  }
+
+  // The same, walking back from `from` down to `limit`.
+  size_t backwards(size_t from, size_t limit, float budget, float& used) const
+  {
+    size_t at = from;
+    while (at > limit) {
+      const size_t previous = previousGraphemeBoundary(text, at);
+      const float cluster = width(previous, at);
+      if (used + cluster > budget) break;
+      used += cluster;
+      at = previous;
+    }
+    return at;
+  }
+};
+
+} // namespace
+
+std::string ellipsize(std::string_view text, float maxWidth, EllipsizeMode ellipsizeMode,
+                      const GlyphAdvanceCache& advances, float letterSpacing, std::string_view ellipsis)
+{
+  const ClusterWalk walk{text, advances, letterSpacing};
+  const float available = maxWidth - advances.width(ellipsis, letterSpacing);
+
+  // One walk from the start decides whether the text fits, and finds where
+  // `CLIP` and `TAIL` cut on the way.
+  float used = 0;
+  size_t fits = 0;
+  size_t tail = 0;
+  while (fits < text.size()) {
+    const size_t next = nextGraphemeBoundary(text, fits);
+    const float cluster = walk.width(fits, next);
+    if (used + cluster > maxWidth) break;
+    used += cluster;
+    fits = next;
+    if (used <= available) tail = fits;
+  }
+  if (fits == text.size()) return std::string(text);
+
+  std::string out;
+  switch (ellipsizeMode) {
+  case EllipsizeMode::CLIP:
+    out.assign(text.substr(0, fits));
+    break;
+  case EllipsizeMode::HEAD: {
+    float kept = 0;
+    const size_t start = walk.backwards(text.size(), 0, available, kept);
+    out.reserve(ellipsis.size() + text.size() - start);
+    out.append(ellipsis).append(text.substr(start));
+    break;
+  }
+  case EllipsizeMode::MIDDLE: {
+    // The start gets the first half, the end whatever the start left.
+    float kept = 0;
+    const size_t head = walk.forwards(0, text.size(), available / 2, kept);
+    const size_t start = walk.backwards(text.size(), head, available, kept);
+    out.reserve(head + ellipsis.size() + text.size() - start);
+    out.append(text.substr(0, head)).append(ellipsis).append(text.substr(start));
+    break;
+  }
+  case EllipsizeMode::TAIL:
+  default:
+    out.reserve(tail + ellipsis.size());
+    out.append(text.substr(0, tail)).append(ellipsis);
+    break;
+  }
+  return out;
+}
+
+} // namespace margelo::nitro::nitrotext
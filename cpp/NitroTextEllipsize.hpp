@@ -0,0 +1,36 @@
+//
+// NitroTextEllipsize.hpp
+// Truncating a line of text to a width at grapheme cluster boundaries
+//
+
+#pragma once
+
+#include "EllipsizeMode.hpp"
+#include "NitroTextGlyphAdvances.hpp"
+
+#include <string>
+#include <string_view>
+
+namespace margelo::nitro::nitrotext {
+
+// U+2026 HORIZONTAL ELLIPSIS, what `<Text>` draws where it cuts.
+constexpr std::string_view kEllipsis = "\xE2\x80\xA6";
+
+/**
+ * @brief `text` cut down to fit `maxWidth` on one line, the way
+ * `ellipsizeMode` truncates the last line: `TAIL` keeps the start, `HEAD`
+ * the end and `MIDDLE` both ends, with `ellipsis` in place of what was cut;
+ * `CLIP` keeps the start as is. Text that fits is returned whole, and when
+ * not even the ellipsis fits, it is all that is left.
+ *
+ * Cuts only fall between grapheme clusters, so emoji sequences, flags and
+ * combining marks are kept or dropped whole. Clusters are measured one at a
+ * time with `advances` (without kerning across them), walking in from the
+ * ends that are kept, so a cut costs the width of the line, not the length
+ * of the text.
+ */
+std::string ellipsize(std::string_view text, float maxWidth, EllipsizeMode ellipsizeMode,
+                      const GlyphAdvanceCache& advances, float letterSpacing = 0,
+                      std::string_view ellipsis = kEllipsis);
+
+} // namespace margelo::nitro::nitrotext
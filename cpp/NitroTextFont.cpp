@@ -0,0 +1,360 @@
+//
+// NitroTextFont.cpp
+//
+
+#include "NitroTextFont.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+// Font files are big-endian throughout.
+uint16_t u16(const uint8_t* p) noexcept
+{
+  return static_cast<uint16_t>(p[0] << 8 | p[1]);
+}
+
+int16_t s16(const uint8_t* p) noexcept
+{
+  return static_cast<int16_t>(u16(p));
+}
+
+uint32_t u32(const uint8_t* p) noexcept
+{
+  return static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 |
+         static_cast<uint32_t>(p[2]) << 8 | p[3];
+}
+
+constexpr uint32_t tag(const char (&name)[5]) noexcept
+{
+  return static_cast<uint32_t>(name[0]) << 24 | static_cast<uint32_t>(name[1]) << 16 |
+         static_cast<uint32_t>(name[2]) << 8 | static_cast<uint32_t>(name[3]);
+}
+
+struct FontRegistry {
+  std::mutex mutex;
+  std::unordered_map<std::string, std::weak_ptr<const FontFile>> files;
+};
+
+FontRegistry& registry()
+{
+  // Intentionally leaked, like the stylesheet cache.
+  static auto* instance = new FontRegistry();
+  return *instance;
+}
+
+} // namespace
+
+FontFile::~FontFile()
+{
+  ::munmap(const_cast<uint8_t*>(data_), size_);
+}
+
+std::shared_ptr<const FontFile> FontFile::open(const std::string& path)
+{
+  auto& files = registry();
+  std::lock_guard<std::mutex> lock(files.mutex);
+  auto& entry = files.files[path];
+  if (auto font = entry.lock()) {
+    return font;
+  }
+
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    files.files.erase(path);
+    return nullptr;
+  }
+  struct stat status;
+  if (::fstat(fd, &status) != 0 || status.st_size < 12) {
+    ::close(fd);
+    files.files.erase(path);
+    return nullptr;
+  }
+  const auto size = static_cast<size_t>(status.st_size);
+  void* mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps the file alive on its own.
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    files.files.erase(path);
+    return nullptr;
+  }
+
+  std::shared_ptr<FontFile> font(new FontFile(static_cast<const uint8_t*>(mapped), size));
+  if (!font->readDirectory()) {
+    files.files.erase(path);
+    return nullptr;
+  }
+  entry = font;
+  return font;
+}
+
+bool FontFile::readDirectory() noexcept
+{
+  const uint32_t version = u32(data_);
+  if (version != 0x00010000 && version != tag("true") && version != tag("OTTO")) {
+    return false;
+  }
+  const uint16_t numTables = u16(data_ + 4);
+  if (12 + 16 * static_cast<size_t>(numTables) > size_) {
+    return false;
+  }
+  for (uint16_t i = 0; i < numTables; i++) {
+    const uint8_t* record = data_ + 12 + 16 * static_cast<size_t>(i);
+    const Table table{u32(record + 8), u32(record + 12)};
+    if (static_cast<uint64_t>(table.offset) + table.length > size_) {
+      continue;
+    }
+    switch (u32(record)) {
+    case tag("head"): head_ = table; break;
+    case tag("hhea"): hhea_ = table; break;
+    case tag("hmtx"): hmtx_ = table; break;
+    case tag("OS/2"): os2_ = table; break;
+    case tag("cmap"): cmap_ = table; break;
+    case tag("kern"): kern_ = table; break;
+    case tag("maxp"): maxp_ = table; break;
+    default: break;
+    }
+  }
+  return head_.length > 0 && hhea_.length > 0 && hmtx_.length > 0 && cmap_.length > 0;
+}
+
+void FontFile::loadMetrics() const
+{
+  if (head_.length >= 54) {
+    const uint16_t unitsPerEm = u16(data_ + head_.offset + 18);
+    if (unitsPerEm >= 16 && unitsPerEm <= 16384) {
+      metrics_.unitsPerEm = unitsPerEm;
+    }
+  }
+  if (hhea_.length >= 36) {
+    const uint8_t* hhea = data_ + hhea_.offset;
+    metrics_.ascender = s16(hhea + 4);
+    metrics_.descender = s16(hhea + 6);
+    metrics_.lineGap = s16(hhea + 8);
+    numberOfHMetrics_ = std::min<uint32_t>(u16(hhea + 34), hmtx_.length / 4);
+  }
+  glyphCount_ = maxp_.length >= 6 ? u16(data_ + maxp_.offset + 4) : numberOfHMetrics_;
+
+  if (os2_.length >= 78) {
+    const uint8_t* os2 = data_ + os2_.offset;
+    const bool useTypoMetrics = (u16(os2 + 62) & 0x80) != 0;
+    if (useTypoMetrics) {
+      metrics_.ascender = s16(os2 + 68);
+      metrics_.descender = s16(os2 + 70);
+      metrics_.lineGap = s16(os2 + 72);
+    }
+    if (os2_.length >= 90 && u16(os2) >= 2) {
+      metrics_.xHeight = s16(os2 + 86);
+      metrics_.capHeight = s16(os2 + 88);
+    }
+  }
+}
+
+const FontFile::Metrics& FontFile::metrics() const
+{
+  std::call_once(metricsOnce_, [this] { loadMetrics(); });
+  return metrics_;
+}
+
+uint16_t FontFile::glyphCount() const
+{
+  std::call_once(metricsOnce_, [this] { loadMetrics(); });
+  return glyphCount_;
+}
+
+uint16_t FontFile::advance(uint16_t glyph) const
+{
+  std::call_once(metricsOnce_, [this] { loadMetrics(); });
+  if (numberOfHMetrics_ == 0 || glyph >= glyphCount_) {
+    return 0;
+  }
+  // Glyphs past the last metric share its advance (monospaced tails).
+  const uint16_t index = std::min<uint16_t>(glyph, numberOfHMetrics_ - 1);
+  return u16(data_ + hmtx_.offset + 4 * static_cast<size_t>(index));
+}
+
+void FontFile::loadCmap() const
+{
+  if (cmap_.length < 4) {
+    return;
+  }
+  const uint8_t* cmap = data_ + cmap_.offset;
+  const uint32_t count = std::min<uint32_t>(u16(cmap + 2), (cmap_.length - 4) / 8);
+  int bestScore = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    const uint8_t* record = cmap + 4 + 8 * i;
+    const uint16_t platform = u16(record);
+    const uint16_t encoding = u16(record + 2);
+    const uint32_t offset = u32(record + 4);
+    if (static_cast<uint64_t>(offset) + 8 > cmap_.length) {
+      continue;
+    }
+    const uint8_t* subtable = cmap + offset;
+    const uint16_t format = u16(subtable);
+    const bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+    if (!unicode) {
+      continue;
+    }
+
+    int score = 0;
+    if (format == 12 && static_cast<uint64_t>(offset) + 16 <= cmap_.length) {
+      const uint64_t length = u32(subtable + 4);
+      const uint64_t groups = u32(subtable + 12);
+      if (16 + 12 * groups <= length && offset + length <= cmap_.length) {
+        score = 2;
+      }
+    } else if (format == 4 && static_cast<uint64_t>(offset) + 14 <= cmap_.length) {
+      // Not bounded by the subtable's own length field: some fonts
+      // understate it for a full-BMP subtable.
+      const uint32_t segCountX2 = u16(subtable + 6);
+      if (segCountX2 > 0 && segCountX2 % 2 == 0 && 16 + 4 * segCountX2 <= cmap_.length - offset) {
+        score = 1;
+      }
+    }
+    if (score > bestScore) {
+      bestScore = score;
+      cmapSubtable_ = cmap_.offset + offset;
+      cmapFormat_ = format;
+    }
+  }
+}
+
+uint16_t FontFile::glyphIndex(char32_t codepoint) const
+{
+  std::call_once(cmapOnce_, [this] { loadCmap(); });
+  const uint8_t* subtable = data_ + cmapSubtable_;
+
+  if (cmapFormat_ == 12) {
+    const uint8_t* groups = subtable + 16;
+    size_t low = 0;
+    size_t high = u32(subtable + 12);
+    while (low < high) {
+      const size_t mid = (low + high) / 2;
+      const uint8_t* group = groups + 12 * mid;
+      if (codepoint < u32(group)) {
+        high = mid;
+      } else if (codepoint > u32(group + 4)) {
+        low = mid + 1;
+      } else {
+        const uint32_t glyph = u32(group + 8) + (codepoint - u32(group));
+        return glyph <= 0xFFFF ? static_cast<uint16_t>(glyph) : 0;
+      }
+    }
+    return 0;
+  }
+
+  if (cmapFormat_ != 4 || codepoint > 0xFFFF) {
+    return 0;
+  }
+  const uint32_t segCountX2 = u16(subtable + 6);
+  const uint8_t* endCodes = subtable + 14;
+  const uint8_t* startCodes = endCodes + segCountX2 + 2;
+  const uint8_t* idDeltas = startCodes + segCountX2;
+  const uint8_t* idRangeOffsets = idDeltas + segCountX2;
+
+  // The first segment ending at or after the codepoint.
+  size_t low = 0;
+  size_t high = segCountX2 / 2;
+  while (low < high) {
+    const size_t mid = (low + high) / 2;
+    if (u16(endCodes + 2 * mid) < codepoint) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == segCountX2 / 2) {
+    return 0;
+  }
+  const uint16_t start = u16(startCodes + 2 * low);
+  if (codepoint < start) {
+    return 0;
+  }
+  const uint16_t delta = u16(idDeltas + 2 * low);
+  const uint16_t rangeOffset = u16(idRangeOffsets + 2 * low);
+  if (rangeOffset == 0) {
+    return static_cast<uint16_t>(codepoint + delta);
+  }
+  // `idRangeOffset` is relative to its own position in the subtable.
+  const uint8_t* glyphAddress = idRangeOffsets + 2 * low + rangeOffset + 2 * (codepoint - start);
+  if (glyphAddress + 2 > data_ + cmap_.offset + cmap_.length) {
+    return 0;
+  }
+  const uint16_t glyph = u16(glyphAddress);
+  return glyph == 0 ? 0 : static_cast<uint16_t>(glyph + delta);
+}
+
+void FontFile::loadKern() const
+{
+  // Only the Microsoft layout (version 0); Apple's `kern` is AAT territory.
+  if (kern_.length < 4 || u16(data_ + kern_.offset) != 0) {
+    return;
+  }
+  const uint8_t* kern = data_ + kern_.offset;
+  const uint16_t count = u16(kern + 2);
+  uint32_t position = 4;
+  for (uint16_t i = 0; i < count && position + 14 <= kern_.length; i++) {
+    const uint8_t* subtable = kern + position;
+    const uint16_t length = u16(subtable + 2);
+    const uint16_t coverage = u16(subtable + 4);
+    // The 16-bit length overflows for big last subtables; those run to the end.
+    const uint32_t end = i + 1 == count || length < 14 ? kern_.length : std::min(position + length, kern_.length);
+
+    // Format 0, horizontal, neither minimum values nor cross-stream.
+    if ((coverage >> 8) == 0 && (coverage & 0x7) == 0x1 && kernSubtableCount_ < kMaxKernSubtables) {
+      const uint32_t pairs = std::min<uint32_t>(u16(subtable + 6), (end - position - 14) / 6);
+      if (pairs > 0) {
+        kernSubtables_[kernSubtableCount_++] = KernSubtable{
+            .pairs = kern_.offset + position + 14,
+            .count = pairs,
+            .replaces = (coverage & 0x8) != 0,
+        };
+      }
+    }
+    position = end;
+  }
+}
+
+bool FontFile::hasKerning() const
+{
+  std::call_once(kernOnce_, [this] { loadKern(); });
+  return kernSubtableCount_ > 0;
+}
+
+int16_t FontFile::kerning(uint16_t left, uint16_t right) const
+{
+  std::call_once(kernOnce_, [this] { loadKern(); });
+  const uint32_t key = static_cast<uint32_t>(left) << 16 | right;
+  int32_t total = 0;
+  for (size_t i = 0; i < kernSubtableCount_; i++) {
+    const KernSubtable& subtable = kernSubtables_[i];
+    const uint8_t* pairs = data_ + subtable.pairs;
+    // Pairs are sorted by (left, right) read as one 32-bit key.
+    size_t low = 0;
+    size_t high = subtable.count;
+    while (low < high) {
+      const size_t mid = (low + high) / 2;
+      const uint32_t pair = u32(pairs + 6 * mid);
+      if (pair < key) {
+        low = mid + 1;
+      } else if (pair > key) {
+        high = mid;
+      } else {
+        const int16_t value = s16(pairs + 6 * mid + 4);
+        total = subtable.replaces ? value : total + value;
+        break;
+      }
+    }
+  }
+  return static_cast<int16_t>(std::clamp<int32_t>(total, INT16_MIN, INT16_MAX));
+}
+
+} // namespace margelo::nitro::nitrotext
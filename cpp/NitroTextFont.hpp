@@ -0,0 +1,124 @@
+//
+// NitroTextFont.hpp
+// Glyph advances and vertical metrics read straight from font files
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * A TrueType or OpenType font file, memory-mapped and read in place.
+ *
+ * Only what measuring text needs is read: the character map, horizontal
+ * advances, vertical metrics and legacy `kern` pairs. Opening a file reads
+ * just its table directory; each table is parsed on first use, and lookups
+ * then read the mapped bytes directly without copying them.
+ *
+ * A file is mapped once per process: `open` hands out the same instance for
+ * as long as anyone holds it. Malformed tables read as absent, never out of
+ * bounds. Thread-safe.
+ */
+class FontFile final {
+public:
+  /**
+   * Vertical metrics in font units. Descender is negative below the
+   * baseline. Cap height and x-height are 0 when the font does not say.
+   */
+  struct Metrics {
+    uint16_t unitsPerEm = 1000;
+    int16_t ascender = 0;
+    int16_t descender = 0;
+    int16_t lineGap = 0;
+    int16_t capHeight = 0;
+    int16_t xHeight = 0;
+  };
+
+  ~FontFile();
+
+  FontFile(const FontFile&) = delete;
+  FontFile& operator=(const FontFile&) = delete;
+
+  /**
+   * @brief The font at `path`, or null if it cannot be read or is not a
+   * TrueType/OpenType font. Collections (`.ttc`) are not supported.
+   */
+  static std::shared_ptr<const FontFile> open(const std::string& path);
+
+  /**
+   * @brief `head`, `hhea` and `OS/2` metrics. Typographic metrics win over
+   * `hhea` when the font asks for them with `USE_TYPO_METRICS`.
+   */
+  const Metrics& metrics() const;
+
+  /**
+   * @brief The glyph for `codepoint`, or 0 (`.notdef`) if the font has none.
+   */
+  uint16_t glyphIndex(char32_t codepoint) const;
+
+  /**
+   * @brief The advance width of `glyph` in font units.
+   */
+  uint16_t advance(uint16_t glyph) const;
+
+  /**
+   * @brief The `kern` table adjustment between two glyphs in font units,
+   * 0 when there is none. Fonts that kern through `GPOS` only read as 0.
+   */
+  int16_t kerning(uint16_t left, uint16_t right) const;
+
+  /**
+   * @brief Whether the font has a legacy `kern` table with pairs to apply.
+   */
+  bool hasKerning() const;
+
+  uint16_t glyphCount() const;
+  size_t size() const noexcept { return size_; }
+
+private:
+  struct Table {
+    uint32_t offset = 0;
+    uint32_t length = 0;
+  };
+  struct KernSubtable {
+    uint32_t pairs = 0;
+    uint32_t count = 0;
+    bool replaces = false;
+  };
+  static constexpr size_t kMaxKernSubtables = 4;
+
+  FontFile(const uint8_t* data, size_t size) noexcept : data_(data), size_(size) {}
+
+  bool readDirectory() noexcept;
+
+  void loadMetrics() const;
+  void loadCmap() const;
+  void loadKern() const;
+
+  const uint8_t* data_;
+  size_t size_;
+
+  Table head_, hhea_, hmtx_, os2_, cmap_, kern_, maxp_;
+
+  mutable std::once_flag metricsOnce_;
+  mutable Metrics metrics_;
+  mutable uint16_t numberOfHMetrics_ = 0;
+  mutable uint16_t glyphCount_ = 0;
+
+  mutable std::once_flag cmapOnce_;
+  // The chosen subtable: format 12 (all planes) or 4 (BMP only).
+  mutable uint32_t cmapSubtable_ = 0;
+  mutable uint16_t cmapFormat_ = 0;
+
+  mutable std::once_flag kernOnce_;
+  mutable KernSubtable kernSubtables_[kMaxKernSubtables];
+  mutable size_t kernSubtableCount_ = 0;
+};
+
+} // namespace margelo::nitro::nitrotext
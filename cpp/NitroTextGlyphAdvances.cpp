@@ -0,0 +1,309 @@
+//
+// NitroTextGlyphAdvances.cpp
+//
+
+#include "NitroTextGlyphAdvances.hpp"
+#include "NitroTextSimdScan.hpp"
+#include "NitroTextUtf8.hpp"
+
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+/**
+ * @brief The length of the pure ASCII prefix of `p[0, n)`, eight bytes a
+ * step.
+ */
+size_t asciiPrefix(const uint8_t* p, size_t n) noexcept
+{
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, p + i, sizeof(word));
+    if ((word & 0x8080808080808080ull) != 0) break;
+  }
+  while (i < n && p[i] < 0x80) i++;
+  return i;
+}
+
+/**
+ * @brief The sum of `table[p[i]]` over an ASCII run. `planes` holds the same
+ * table split into its bytes, `planes[b][c]` being byte `b` of `table[c]`,
+ * for the NEON byte lookups.
+ */
+float sumAdvances(const uint8_t* p, size_t n, const float* table,
+                  [[maybe_unused]] const uint8_t (*planes)[128]) noexcept
+{
+  size_t i = 0;
+#if defined(NITRO_TEXT_SIMD_NEON)
+  // NEON has no gather, but a table lookup of 16 bytes from 64. Each byte of
+  // the 16 advances is looked up in its plane, the low half of the table
+  // first and the high half over it, then the bytes are zipped back into
+  // floats.
+  float total = 0;
+  if (n >= 16) {
+    uint8x16x4_t low[4];
+    uint8x16x4_t high[4];
+    for (int b = 0; b < 4; b++) {
+      low[b] = vld1q_u8_x4(planes[b]);
+      high[b] = vld1q_u8_x4(planes[b] + 64);
+    }
+    const uint8x16_t half = vdupq_n_u8(64);
+    float32x4_t sums[4] = {vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0)};
+    for (; i + 16 <= n; i += 16) {
+      const uint8x16_t index = vld1q_u8(p + i);
+      // Below 64 this wraps out of range, where `vqtbx4q_u8` keeps the low byte.
+      const uint8x16_t highIndex = vsubq_u8(index, half);
+      uint8x16_t bytes[4];
+      for (int b = 0; b < 4; b++) {
+        bytes[b] = vqtbx4q_u8(vqtbl4q_u8(low[b], index), high[b], highIndex);
+      }
+      const uint16x8_t first01 = vreinterpretq_u16_u8(vzip1q_u8(bytes[0], bytes[1]));
+      const uint16x8_t last01 = vreinterpretq_u16_u8(vzip2q_u8(bytes[0], bytes[1]));
+      const uint16x8_t first23 = vreinterpretq_u16_u8(vzip1q_u8(bytes[2], bytes[3]));
+      const uint16x8_t last23 = vreinterpretq_u16_u8(vzip2q_u8(bytes[2], bytes[3]));
+      sums[0] = vaddq_f32(sums[0], vreinterpretq_f32_u16(vzip1q_u16(first01, first23)));
+      sums[1] = vaddq_f32(sums[1], vreinterpretq_f32_u16(vzip2q_u16(first01, first23)));
+      sums[2] = vaddq_f32(sums[2], vreinterpretq_f32_u16(vzip1q_u16(last01, last23)));
+      sums[3] = vaddq_f32(sums[3], vreinterpretq_f32_u16(vzip2q_u16(last01, last23)));
+    }
+    total = vaddvq_f32(vaddq_f32(vaddq_f32(sums[0], sums[1]), vaddq_f32(sums[2], sums[3])));
+  }
+#elif defined(NITRO_TEXT_SIMD_AVX2)
+  __m256 low = _mm256_setzero_ps();
+  __m256 high = _mm256_setzero_ps();
+  for (; i + 16 <= n; i += 16) {
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    low = _mm256_add_ps(low, _mm256_i32gather_ps(table, _mm256_cvtepu8_epi32(bytes), 4));
+    high = _mm256_add_ps(high, _mm256_i32gather_ps(table, _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)), 4));
+  }
+  const __m256 both = _mm256_add_ps(low, high);
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(both), _mm256_extractf128_ps(both, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 1));
+  float total = _mm_cvtss_f32(sum);
+#else
+  // Without a gather, four independent sums keep the loads in flight.
+  float sums[4] = {0, 0, 0, 0};
+  for (; i + 4 <= n; i += 4) {
+    sums[0] += table[p[i]];
+    sums[1] += table[p[i + 1]];
+    sums[2] += table[p[i + 2]];
+    sums[3] += table[p[i + 3]];
+  }
+  float total = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+#endif
+  for (; i < n; i++) total += table[p[i]];
+  return total;
+}
+
+/**
+ * @brief The kerning between the neighbours `p[k - 1]` and `p[k]` of an
+ * ASCII run, in font units, from a 128 x 128 pair table.
+ */
+int32_t sumKerning(const uint8_t* p, size_t n, const int16_t* pairs) noexcept
+{
+  int32_t total = 0;
+  size_t k = 1;
+#if defined(NITRO_TEXT_SIMD_AVX2)
+  __m256i sum = _mm256_setzero_si256();
+  for (; k + 8 <= n; k += 8) {
+    const __m256i left = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + k - 1)));
+    const __m256i right = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + k)));
+    const __m256i index = _mm256_add_epi32(_mm256_slli_epi32(left, 7), right);
+    // Gathers 32 bits at each pair; the low half is the pair, sign-extended.
+    const __m256i raw = _mm256_i32gather_epi32(reinterpret_cast<const int*>(pairs), index, 2);
+    sum = _mm256_add_epi32(sum, _mm256_srai_epi32(_mm256_slli_epi32(raw, 16), 16));
+  }
+  __m128i lanes = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+  lanes = _mm_add_epi32(lanes, _mm_shuffle_epi32(lanes, _MM_SHUFFLE(1, 0, 3, 2)));
+  lanes = _mm_add_epi32(lanes, _mm_shuffle_epi32(lanes, _MM_SHUFFLE(2, 3, 0, 1)));
+  total = _mm_cvtsi128_si32(lanes);
+#endif
+  for (; k < n; k++) total += pairs[p[k - 1] * 128 + p[k]];
+  return total;
+}
+
+struct CacheKey {
+  const FontFile* font;
+  float fontSize;
+
+  bool operator==(const CacheKey& other) const noexcept
+  {
+    return font == other.font && fontSize == other.fontSize;
+  }
+};
+
+struct CacheKeyHash {
+  size_t operator()(const CacheKey& key) const noexcept
+  {
+    return std::hash<const void*>()(key.font) * 31 + std::hash<float>()(key.fontSize);
+  }
+};
+
+struct CacheRegistry {
+  // A handful of fonts at a handful of sizes; cleared when this fills up.
+  static constexpr size_t kCapacity = 256;
+
+  std::mutex mutex;
+  std::unordered_map<CacheKey, std::shared_ptr<const GlyphAdvanceCache>, CacheKeyHash> caches;
+};
+
+CacheRegistry& registry()
+{
+  // Intentionally leaked, like the stylesheet cache.
+  static auto* instance = new CacheRegistry();
+  return *instance;
+}
+
+uint32_t slotHash(char32_t codepoint) noexcept
+{
+  return static_cast<uint32_t>(codepoint) * 0x9E3779B1u;
+}
+
+} // namespace
+
+GlyphAdvanceCache::GlyphAdvanceCache(std::shared_ptr<const FontFile> font, float fontSize)
+    : font_(std::move(font)),
+      fontSize_(fontSize),
+      scale_(fontSize / font_->metrics().unitsPerEm),
+      kerning_(font_->hasKerning()),
+      slots_(64)
+{
+  for (char32_t c = 0; c < 128; c++) {
+    const GlyphAdvance resolved = resolve(c);
+    asciiGlyphs_[c] = resolved.glyph;
+    asciiAdvances_[c] = resolved.advance;
+    uint32_t bits;
+    std::memcpy(&bits, &resolved.advance, sizeof(bits));
+    for (int b = 0; b < 4; b++) asciiAdvanceBytes_[b][c] = static_cast<uint8_t>(bits >> (8 * b));
+  }
+  if (kerning_) {
+    asciiKerning_.assign(128 * 128 + 1, 0);
+    for (size_t left = 0; left < 128; left++) {
+      for (size_t right = 0; right < 128; right++) {
+        asciiKerning_[left * 128 + right] = font_->kerning(asciiGlyphs_[left], asciiGlyphs_[right]);
+      }
+    }
+  }
+}
+
+std::shared_ptr<const GlyphAdvanceCache> GlyphAdvanceCache::shared(const std::shared_ptr<const FontFile>& font,
+                                                                   float fontSize)
+{
+  auto& caches = registry();
+  std::lock_guard<std::mutex> lock(caches.mutex);
+  const CacheKey key{font.get(), fontSize};
+  if (auto it = caches.caches.find(key); it != caches.caches.end()) {
+    return it->second;
+  }
+  if (caches.caches.size() >= CacheRegistry::kCapacity) {
+    caches.caches.clear();
+  }
+  auto cache = std::make_shared<const GlyphAdvanceCache>(font, fontSize);
+  caches.caches.emplace(key, cache);
+  return cache;
+}
+
+const char* GlyphAdvanceCache::backend() noexcept
+{
+#if defined(NITRO_TEXT_SIMD_AVX2)
+  return "AVX2 gather";
+#elif defined(NITRO_TEXT_SIMD_NEON)
+  return "NEON table lookup";
+#else
+  return "scalar";
+#endif
+}
+
+GlyphAdvance GlyphAdvanceCache::resolve(char32_t codepoint) const
+{
+  const uint16_t glyph = font_->glyphIndex(codepoint);
+  return GlyphAdvance{glyph, font_->advance(glyph) * scale_};
+}
+
+GlyphAdvance GlyphAdvanceCache::lookupLocked(char32_t codepoint) const
+{
+  const size_t mask = slots_.size() - 1;
+  for (size_t index = slotHash(codepoint) & mask;; index = (index + 1) & mask) {
+    const Slot& slot = slots_[index];
+    if (slot.codepoint == codepoint) return slot.value;
+    if (slot.codepoint == 0) return insertLocked(codepoint);
+  }
+}
+
+GlyphAdvance GlyphAdvanceCache::insertLocked(char32_t codepoint) const
+{
+  if ((size_ + 1) * 2 > slots_.size()) {
+    std::vector<Slot> grown(slots_.size() * 2);
+    for (const Slot& slot : slots_) {
+      if (slot.codepoint == 0) continue;
+      size_t at = slotHash(slot.codepoint) & (grown.size() - 1);
+      while (grown[at].codepoint != 0) at = (at + 1) & (grown.size() - 1);
+      grown[at] = slot;
+    }
+    slots_ = std::move(grown);
+  }
+  const size_t mask = slots_.size() - 1;
+  size_t index = slotHash(codepoint) & mask;
+  while (slots_[index].codepoint != 0) index = (index + 1) & mask;
+  const GlyphAdvance resolved = resolve(codepoint);
+  slots_[index] = Slot{codepoint, resolved};
+  size_++;
+  return resolved;
+}
+
+GlyphAdvance GlyphAdvanceCache::lookup(char32_t codepoint) const
+{
+  if (codepoint < 128) {
+    return GlyphAdvance{asciiGlyphs_[codepoint], asciiAdvances_[codepoint]};
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lookupLocked(codepoint);
+}
+
+float GlyphAdvanceCache::width(std::string_view text, float letterSpacing) const
+{
+  const auto* bytes = reinterpret_cast<const uint8_t*>(text.data());
+  std::unique_lock<std::mutex> lock(mutex_, std::defer_lock);
+  float advance = 0;
+  int32_t kerning = 0;
+  size_t characters = 0;
+  // The glyph before `i`, for kerning across runs.
+  bool hasPrevious = false;
+  uint16_t previous = 0;
+
+  size_t i = 0;
+  while (i < text.size()) {
+    if (bytes[i] < 0x80) {
+      const size_t run = asciiPrefix(bytes + i, text.size() - i);
+      advance += sumAdvances(bytes + i, run, asciiAdvances_, asciiAdvanceBytes_);
+      if (kerning_) {
+        if (hasPrevious) kerning += font_->kerning(previous, asciiGlyphs_[bytes[i]]);
+        kerning += sumKerning(bytes + i, run, asciiKerning_.data());
+      }
+      characters += run;
+      previous = asciiGlyphs_[bytes[i + run - 1]];
+      hasPrevious = true;
+      i += run;
+      continue;
+    }
+
+    const char32_t codepoint = decodeUtf8(text, i);
+    if (!lock.owns_lock()) lock.lock();
+    const GlyphAdvance resolved = lookupLocked(codepoint);
+    advance += resolved.advance;
+    if (kerning_ && hasPrevious) kerning += font_->kerning(previous, resolved.glyph);
+    characters++;
+    previous = resolved.glyph;
+    hasPrevious = true;
+  }
+  return advance + static_cast<float>(kerning) * scale_ + letterSpacing * static_cast<float>(characters);
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,109 @@
+//
+// NitroTextGlyphAdvances.hpp
+// Cached glyph advances of a font at one size, and run widths from them
+//
+
+#pragma once
+
+#include "NitroTextFont.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+struct GlyphAdvance {
+  uint16_t glyph = 0;
+  // In points.
+  float advance = 0;
+};
+
+/**
+ * The advances of one `FontFile` at one font size, cached per codepoint, and
+ * the widths of runs of text summed from them.
+ *
+ * ASCII is resolved up front into a dense 128-entry table, so the common
+ * case is an indexed load (a vector gather on AVX2, byte table lookups on
+ * NEON) with no hashing. Other
+ * codepoints are resolved on first use into an open-addressing table.
+ * The weight of a style picks the font file, so a file and a size are the
+ * whole key.
+ *
+ * Thread-safe: the ASCII table never changes, and the other one is only
+ * touched under a lock, taken once per run and only when the run has
+ * non-ASCII text.
+ */
+class GlyphAdvanceCache final {
+public:
+  GlyphAdvanceCache(std::shared_ptr<const FontFile> font, float fontSize);
+
+  GlyphAdvanceCache(const GlyphAdvanceCache&) = delete;
+  GlyphAdvanceCache& operator=(const GlyphAdvanceCache&) = delete;
+
+  /**
+   * @brief The process-wide cache of `font` at `fontSize`.
+   */
+  static std::shared_ptr<const GlyphAdvanceCache> shared(const std::shared_ptr<const FontFile>& font,
+                                                         float fontSize);
+
+  const FontFile& font() const noexcept { return *font_; }
+  float fontSize() const noexcept { return fontSize_; }
+
+  /**
+   * @brief Points per font unit.
+   */
+  float scale() const noexcept { return scale_; }
+
+  /**
+   * @brief The glyph and advance of `codepoint`; `.notdef` if the font has
+   * none.
+   */
+  GlyphAdvance lookup(char32_t codepoint) const;
+
+  /**
+   * @brief The width in points of UTF-8 `text` set on one line: the sum of
+   * its advances, the `kern` adjustment between neighbouring glyphs, and
+   * `letterSpacing` after every character, like `Fragment::letterSpacing`.
+   */
+  float width(std::string_view text, float letterSpacing = 0) const;
+
+  /**
+   * @brief The vector backend of the ASCII kernels, for benchmarks.
+   */
+  static const char* backend() noexcept;
+
+private:
+  struct Slot {
+    // 0 marks an empty slot; U+0000 is ASCII and never stored here.
+    char32_t codepoint = 0;
+    GlyphAdvance value;
+  };
+
+  GlyphAdvance resolve(char32_t codepoint) const;
+  GlyphAdvance lookupLocked(char32_t codepoint) const;
+  GlyphAdvance insertLocked(char32_t codepoint) const;
+
+  std::shared_ptr<const FontFile> font_;
+  float fontSize_;
+  float scale_;
+
+  float asciiAdvances_[128];
+  // The bytes of `asciiAdvances_`, least significant first, for NEON.
+  alignas(16) uint8_t asciiAdvanceBytes_[4][128];
+  uint16_t asciiGlyphs_[128];
+  // Kerning of every ASCII pair in font units, indexed `left * 128 + right`,
+  // with one entry of padding for 32-bit gathers. Empty without `kern`.
+  std::vector<int16_t> asciiKerning_;
+  bool kerning_;
+
+  mutable std::mutex mutex_;
+  // Power-of-two capacity, at most half full.
+  mutable std::vector<Slot> slots_;
+  mutable size_t size_ = 0;
+};
+
+} // namespace margelo::nitro::nitrotext
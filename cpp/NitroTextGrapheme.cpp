@@ -0,0 +1,241 @@
+//
+// NitroTextGrapheme.cpp
+// Grapheme cluster boundaries of UTF-8 text (UAX #29)
+//
+
+#include "NitroTextGrapheme.hpp"
+#include "NitroTextSimdScan.hpp"
+#include "NitroTextUtf8.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+using G = GraphemeBreakClass;
+
+constexpr size_t kClassCount = static_cast<size_t>(G::ExtendedPictographic) + 1;
+
+// What the rules say of two neighbouring codepoints on their own. GB11 and
+// GB12/GB13 also depend on what comes before; those pairs are marked for
+// the callers, who know the context.
+enum class Pair : uint8_t { Break, Keep, Emoji, Flag };
+
+constexpr bool isControl(G c) { return c == G::CR || c == G::LF || c == G::Control; }
+
+constexpr Pair pairRule(G previous, G current)
+{
+  // GB3
+  if (previous == G::CR && current == G::LF) return Pair::Keep;
+  // GB4, GB5
+  if (isControl(previous) || isControl(current)) return Pair::Break;
+  // GB6-GB8: Hangul syllable sequences
+  if (previous == G::L && (current == G::L || current == G::V || current == G::LV || current == G::LVT)) {
+    return Pair::Keep;
+  }
+  if ((previous == G::LV || previous == G::V) && (current == G::V || current == G::T)) return Pair::Keep;
+  if ((previous == G::LVT || previous == G::T) && current == G::T) return Pair::Keep;
+  // GB9, GB9a, GB9b
+  if (current == G::Extend || current == G::ZWJ || current == G::SpacingMark) return Pair::Keep;
+  if (previous == G::Prepend) return Pair::Keep;
+  // GB11: ExtPict Extend* ZWJ × ExtPict
+  if (previous == G::ZWJ && current == G::ExtendedPictographic) return Pair::Emoji;
+  // GB12, GB13: regional indicators pair up into flags
+  if (previous == G::RegionalIndicator && current == G::RegionalIndicator) return Pair::Flag;
+  // GB999
+  return Pair::Break;
+}
+
+constexpr auto kPairs = [] {
+  std::array<std::array<Pair, kClassCount>, kClassCount> table{};
+  for (size_t previous = 0; previous < kClassCount; previous++) {
+    for (size_t current = 0; current < kClassCount; current++) {
+      table[previous][current] = pairRule(static_cast<G>(previous), static_cast<G>(current));
+    }
+  }
+  return table;
+}();
+
+constexpr Pair pairOf(G previous, G current)
+{
+  return kPairs[static_cast<size_t>(previous)][static_cast<size_t>(current)];
+}
+
+inline bool isAscii(char c) { return static_cast<uint8_t>(c) < 0x80; }
+
+inline G classBefore(std::string_view text, size_t& at) { return graphemeBreakClass(decodeUtf8Before(text, at)); }
+
+// Whether `current` stays in the cluster of `previous`, the codepoint at
+// `before` right ahead of it, looking further back for GB11 and GB12/GB13.
+bool joins(std::string_view text, size_t before, G previous, G current)
+{
+  switch (pairOf(previous, current)) {
+  case Pair::Break:
+    return false;
+  case Pair::Keep:
+    return true;
+  case Pair::Emoji:
+    // The ZWJ at `before` must follow a pictograph and its extenders.
+    while (before > 0) {
+      const G earlier = classBefore(text, before);
+      if (earlier != G::Extend) return earlier == G::ExtendedPictographic;
+    }
+    return false;
+  case Pair::Flag: {
+    // Only an odd number of indicators up to `previous` leaves one unpaired.
+    bool odd = true;
+    while (before > 0 && classBefore(text, before) == G::RegionalIndicator) odd = !odd;
+    return odd;
+  }
+  }
+  return false;
+}
+
+// The boundary after the one at `at`, which is before the end.
+size_t stepForward(std::string_view text, size_t at)
+{
+  if (at + 1 < text.size() && isAscii(text[at]) && isAscii(text[at + 1])) {
+    return text[at] == '\r' && text[at + 1] == '\n' ? at + 2 : at + 1;
+  }
+  G previous = graphemeBreakClass(decodeUtf8(text, at));
+  // The cluster so far ends in ExtPict Extend* with at most one ZWJ after
+  // (GB11), or in an odd number of regional indicators (GB12, GB13).
+  bool pictographic = previous == G::ExtendedPictographic;
+  bool oddFlags = previous == G::RegionalIndicator;
+  while (at < text.size()) {
+    size_t next = at;
+    const G current = graphemeBreakClass(decodeUtf8(text, next));
+    switch (pairOf(previous, current)) {
+    case Pair::Break:
+      return at;
+    case Pair::Emoji:
+      if (!pictographic) return at;
+      break;
+    case Pair::Flag:
+      if (!oddFlags) return at;
+      break;
+    case Pair::Keep:
+      break;
+    }
+    if (current == G::ExtendedPictographic) {
+      pictographic = true;
+    } else if (current == G::Extend || current == G::ZWJ) {
+      pictographic = pictographic && previous != G::ZWJ;
+    } else {
+      pictographic = false;
+    }
+    oddFlags = current == G::RegionalIndicator && !(previous == G::RegionalIndicator && oddFlags);
+    previous = current;
+    at = next;
+  }
+  return at;
+}
+
+// The last boundary at or before `start`, the start of a codepoint of class
+// `current`.
+size_t clusterStart(std::string_view text, size_t start, G current)
+{
+  while (start > 0) {
+    size_t before = start;
+    const G previous = classBefore(text, before);
+    if (!joins(text, before, previous, current)) return start;
+    start = before;
+    current = previous;
+  }
+  return 0;
+}
+
+// The boundary before the one at `at`, which is after the start.
+size_t stepBackward(std::string_view text, size_t at)
+{
+  if (at == 1) return 0;
+  if (isAscii(text[at - 1]) && isAscii(text[at - 2])) {
+    return text[at - 2] == '\r' && text[at - 1] == '\n' ? at - 2 : at - 1;
+  }
+  const G current = classBefore(text, at);
+  return clusterStart(text, at, current);
+}
+
+// The start of the codepoint `offset` falls in: `offset` itself unless it
+// is inside a well-formed multi-byte sequence.
+size_t codepointStart(std::string_view text, size_t offset)
+{
+  for (size_t back = 1; back <= 3 && back <= offset; back++) {
+    const size_t lead = offset - back;
+    if ((static_cast<uint8_t>(text[lead]) & 0xC0) == 0x80) continue;
+    size_t end = lead;
+    decodeUtf8(text, end);
+    return end > offset ? lead : offset;
+  }
+  return offset;
+}
+
+} // namespace
+
+size_t nextGraphemeBoundary(std::string_view text, size_t offset, size_t count) noexcept
+{
+  size_t at = std::min(offset, text.size());
+  if (count == 1) return at < text.size() ? stepForward(text, at) : at;
+  while (count > 0 && at < text.size()) {
+    // Every byte of a printable ASCII run is a cluster of its own, bar the
+    // last, which a mark or a control may still follow.
+    size_t run = simd::findControlOrNonAscii(text, at);
+    if (run == std::string_view::npos) run = text.size();
+    if (run - at > 1) {
+      const size_t skip = std::min(count, run - at - 1);
+      at += skip;
+      count -= skip;
+      if (count == 0) break;
+    }
+    at = stepForward(text, at);
+    count--;
+  }
+  return at;
+}
+
+size_t previousGraphemeBoundary(std::string_view text, size_t offset, size_t count) noexcept
+{
+  size_t at = std::min(offset, text.size());
+  for (; count > 0 && at > 0; count--) at = stepBackward(text, at);
+  return at;
+}
+
+bool isGraphemeBoundary(std::string_view text, size_t offset) noexcept
+{
+  if (offset == 0 || offset == text.size()) return true;
+  if (offset > text.size() || codepointStart(text, offset) != offset) return false;
+  size_t before = offset;
+  const G previous = classBefore(text, before);
+  size_t after = offset;
+  const G current = graphemeBreakClass(decodeUtf8(text, after));
+  return !joins(text, before, previous, current);
+}
+
+size_t floorGraphemeBoundary(std::string_view text, size_t offset) noexcept
+{
+  if (offset >= text.size()) return text.size();
+  const size_t start = codepointStart(text, offset);
+  size_t after = start;
+  return clusterStart(text, start, graphemeBreakClass(decodeUtf8(text, after)));
+}
+
+size_t countGraphemes(std::string_view text) noexcept
+{
+  size_t count = 0;
+  size_t at = 0;
+  while (at < text.size()) {
+    size_t run = simd::findControlOrNonAscii(text, at);
+    if (run == std::string_view::npos) run = text.size();
+    if (run - at > 1) {
+      count += run - at - 1;
+      at = run - 1;
+    }
+    at = stepForward(text, at);
+    count++;
+  }
+  return count;
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,87 @@
+//
+// NitroTextGrapheme.hpp
+// Grapheme cluster boundaries of UTF-8 text (UAX #29)
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * Grapheme_Cluster_Break values of UAX #29, with Extended_Pictographic (from
+ * emoji-data.txt) as a value of its own: no codepoint has both. The order is
+ * shared with scripts/generate-unicode-tables.mjs.
+ */
+enum class GraphemeBreakClass : uint8_t {
+  Other,
+  CR,
+  LF,
+  Control,
+  Extend,
+  ZWJ,
+  RegionalIndicator,
+  Prepend,
+  SpacingMark,
+  L,
+  V,
+  T,
+  LV,
+  LVT,
+  ExtendedPictographic,
+};
+
+/**
+ * @brief The `GraphemeBreakClass` of `codepoint`. Generated into
+ * NitroTextGraphemeTables.cpp.
+ */
+GraphemeBreakClass graphemeBreakClass(char32_t codepoint) noexcept;
+
+// Extended grapheme clusters, the user-perceived characters that cuts such
+// as ellipsizing must never split: an emoji ZWJ sequence, a flag, a letter
+// with its combining marks, a Hangul syllable, CR LF.
+//
+// Boundaries follow the default rules of UAX #29 (GB3-GB13, GB999) and can
+// be walked from any boundary in either direction, so a cut near the end of
+// a long string never scans from its start. Offsets are in bytes; the start
+// and end of the text are always boundaries. Malformed UTF-8 reads as one
+// U+FFFD per bad byte, the same both ways.
+//
+// Between two ASCII bytes there is always a boundary, except inside CR LF,
+// so ASCII is stepped a byte at a time without a table lookup, and counting
+// skips runs of printable ASCII a register at a time (see
+// `simd::findControlOrNonAscii`).
+
+/**
+ * @brief The boundary `count` clusters after the boundary `offset`, or the
+ * end of the text if it has fewer.
+ */
+size_t nextGraphemeBoundary(std::string_view text, size_t offset, size_t count = 1) noexcept;
+
+/**
+ * @brief The boundary `count` clusters before the boundary `offset`, or 0 if
+ * the text has fewer.
+ */
+size_t previousGraphemeBoundary(std::string_view text, size_t offset, size_t count = 1) noexcept;
+
+/**
+ * @brief Whether a cut at byte `offset` keeps every cluster whole. False
+ * inside a UTF-8 sequence.
+ */
+bool isGraphemeBoundary(std::string_view text, size_t offset) noexcept;
+
+/**
+ * @brief The last boundary at or before `offset`: where to cut instead of a
+ * byte offset that may fall inside a cluster.
+ */
+size_t floorGraphemeBoundary(std::string_view text, size_t offset) noexcept;
+
+/**
+ * @brief The number of grapheme clusters in `text`.
+ */
+size_t countGraphemes(std::string_view text) noexcept;
+
+} // namespace margelo::nitro::nitrotext
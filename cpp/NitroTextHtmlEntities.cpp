@@ -0,0 +1,1529 @@
+//
+// NitroTextHtmlEntities.cpp
+// Named character references understood by the native HTML renderer
+//
+// Generated by scripts/generate-html-entities.mjs from the WHATWG entity
+// list; do not edit by hand.
+//
+
+#include "NitroTextHtmlEntities.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+struct EntityRecord {
+  uint16_t nameOffset;
+  uint16_t valueOffset;
+  uint8_t nameLength;
+  uint8_t valueLength;
+};
+
+constexpr size_t kEntityCount = 2133;
+constexpr size_t kBucketCount = 1024;
+constexpr size_t kSlotCount = 4096;
+constexpr uint16_t kEmptySlot = 0xffff;
+
+static_assert(kMaxHtmlEntityNameLength == 31, "regenerate NitroTextHtmlEntities.cpp");
+
+// Every name, sorted, back to back.
+constexpr char kNames[] =
+    "AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogonAopfApplyFunctionAringAsc"
+    "rAssignAtildeAumlBackslashBarvBarwedBcyBecauseBernoullisBetaBfrBopfBreveBscrBump"
+    "eqCHcyCOPYCacuteCapCapitalDifferentialDCayleysCcaronCcedilCcircCconintCdotCedill"
+    "aCenterDotCfrChiCircleDotCircleMinusCirclePlusCircleTimesClockwiseContourIntegra"
+    "lCloseCurlyDoubleQuoteCloseCurlyQuoteColonColoneCongruentConintContourIntegralCo"
+    "pfCoproductCounterClockwiseContourIntegralCrossCscrCupCupCapDDDDotrahdDJcyDScyDZ"
+    "cyDaggerDarrDashvDcaronDcyDelDeltaDfrDiacriticalAcuteDiacriticalDotDiacriticalDo"
+    "ubleAcuteDiacriticalGraveDiacriticalTildeDiamondDifferentialDDopfDotDotDotDotEqu"
+    "alDoubleContourIntegralDoubleDotDoubleDownArrowDoubleLeftArrowDoubleLeftRightArr"
+    "owDoubleLeftTeeDoubleLongLeftArrowDoubleLongLeftRightArrowDoubleLongRightArrowDo"
+    "ubleRightArrowDoubleRightTeeDoubleUpArrowDoubleUpDownArrowDoubleVerticalBarDownA"
+    "rrowDownArrowBarDownArrowUpArrowDownBreveDownLeftRightVectorDownLeftTeeVectorDow"
+    "nLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVectorDownRightVectorBarD"
+    "ownTeeDownTeeArrowDownarrowDscrDstrokENGETHEacuteEcaronEcircEcyEdotEfrEgraveElem"
+    "entEmacrEmptySmallSquareEmptyVerySmallSquareEogonEopfEpsilonEqualEqualTildeEquil"
+    "ibriumEscrEsimEtaEumlExistsExponentialEFcyFfrFilledSmallSquareFilledVerySmallSqu"
+    "areFopfForAllFouriertrfFscrGJcyGTGammaGammadGbreveGcedilGcircGcyGdotGfrGgGopfGre"
+    "aterEqualGreaterEqualLessGreaterFullEqualGreaterGreaterGreaterLessGreaterSlantEq"
+    "ualGreaterTildeGscrGtHARDcyHacekHatHcircHfrHilbertSpaceHopfHorizontalLineHscrHst"
+    "rokHumpDownHumpHumpEqualIEcyIJligIOcyIacuteIcircIcyIdotIfrIgraveImImacrImaginary"
+    "IImpliesIntIntegralIntersectionInvisibleCommaInvisibleTimesIogonIopfIotaIscrItil"
+    "deIukcyIumlJcircJcyJfrJopfJscrJsercyJukcyKHcyKJcyKappaKcedilKcyKfrKopfKscrLJcyLT"
+    "LacuteLambdaLangLaplacetrfLarrLcaronLcedilLcyLeftAngleBracketLeftArrowLeftArrowB"
+    "arLeftArrowRightArrowLeftCeilingLeftDoubleBracketLeftDownTeeVectorLeftDownVector"
+    "LeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTeeLeftTeeArrowLeftTe"
+    "eVectorLeftTriangleLeftTriangleBarLeftTriangleEqualLeftUpDownVectorLeftUpTeeVect"
+    "orLeftUpVectorLeftUpVectorBarLeftVectorLeftVectorBarLeftarrowLeftrightarrowLessE"
+    "qualGreaterLessFullEqualLessGreaterLessLessLessSlantEqualLessTildeLfrLlLleftarro"
+    "wLmidotLongLeftArrowLongLeftRightArrowLongRightArrowLongleftarrowLongleftrightar"
+    "rowLongrightarrowLopfLowerLeftArrowLowerRightArrowLscrLshLstrokLtMapMcyMediumSpa"
+    "ceMellintrfMfrMinusPlusMopfMscrMuNJcyNacuteNcaronNcedilNcyNegativeMediumSpaceNeg"
+    "ativeThickSpaceNegativeThinSpaceNegativeVeryThinSpaceNestedGreaterGreaterNestedL"
+    "essLessNewLineNfrNoBreakNonBreakingSpaceNopfNotNotCongruentNotCupCapNotDoubleVer"
+    "ticalBarNotElementNotEqualNotEqualTildeNotExistsNotGreaterNotGreaterEqualNotGrea"
+    "terFullEqualNotGreaterGreaterNotGreaterLessNotGreaterSlantEqualNotGreaterTildeNo"
+    "tHumpDownHumpNotHumpEqualNotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNo"
+    "tLessNotLessEqualNotLessGreaterNotLessLessNotLessSlantEqualNotLessTildeNotNested"
+    "GreaterGreaterNotNestedLessLessNotPrecedesNotPrecedesEqualNotPrecedesSlantEqualN"
+    "otReverseElementNotRightTriangleNotRightTriangleBarNotRightTriangleEqualNotSquar"
+    "eSubsetNotSquareSubsetEqualNotSquareSupersetNotSquareSupersetEqualNotSubsetNotSu"
+    "bsetEqualNotSucceedsNotSucceedsEqualNotSucceedsSlantEqualNotSucceedsTildeNotSupe"
+    "rsetNotSupersetEqualNotTildeNotTildeEqualNotTildeFullEqualNotTildeTildeNotVertic"
+    "alBarNscrNtildeNuOEligOacuteOcircOcyOdblacOfrOgraveOmacrOmegaOmicronOopfOpenCurl"
+    "yDoubleQuoteOpenCurlyQuoteOrOscrOslashOtildeOtimesOumlOverBarOverBraceOverBracke"
+    "tOverParenthesisPartialDPcyPfrPhiPiPlusMinusPoincareplanePopfPrPrecedesPrecedesE"
+    "qualPrecedesSlantEqualPrecedesTildePrimeProductProportionProportionalPscrPsiQUOT"
+    "QfrQopfQscrRBarrREGRacuteRangRarrRarrtlRcaronRcedilRcyReReverseElementReverseEqu"
+    "ilibriumReverseUpEquilibriumRfrRhoRightAngleBracketRightArrowRightArrowBarRightA"
+    "rrowLeftArrowRightCeilingRightDoubleBracketRightDownTeeVectorRightDownVectorRigh"
+    "tDownVectorBarRightFloorRightTeeRightTeeArrowRightTeeVectorRightTriangleRightTri"
+    "angleBarRightTriangleEqualRightUpDownVectorRightUpTeeVectorRightUpVectorRightUpV"
+    "ectorBarRightVectorRightVectorBarRightarrowRopfRoundImpliesRrightarrowRscrRshRul"
+    "eDelayedSHCHcySHcySOFTcySacuteScScaronScedilScircScySfrShortDownArrowShortLeftAr"
+    "rowShortRightArrowShortUpArrowSigmaSmallCircleSopfSqrtSquareSquareIntersectionSq"
+    "uareSubsetSquareSubsetEqualSquareSupersetSquareSupersetEqualSquareUnionSscrStarS"
+    "ubSubsetSubsetEqualSucceedsSucceedsEqualSucceedsSlantEqualSucceedsTildeSuchThatS"
+    "umSupSupersetSupersetEqualSupsetTHORNTRADETSHcyTScyTabTauTcaronTcedilTcyTfrThere"
+    "foreThetaThickSpaceThinSpaceTildeTildeEqualTildeFullEqualTildeTildeTopfTripleDot"
+    "TscrTstrokUacuteUarrUarrocirUbrcyUbreveUcircUcyUdblacUfrUgraveUmacrUnderBarUnder"
+    "BraceUnderBracketUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrow"
+    "DownArrowUpDownArrowUpEquilibriumUpTeeUpTeeArrowUparrowUpdownarrowUpperLeftArrow"
+    "UpperRightArrowUpsiUpsilonUringUscrUtildeUumlVDashVbarVcyVdashVdashlVeeVerbarVer"
+    "tVerticalBarVerticalLineVerticalSeparatorVerticalTildeVeryThinSpaceVfrVopfVscrVv"
+    "dashWcircWedgeWfrWopfWscrXfrXiXopfXscrYAcyYIcyYUcyYacuteYcircYcyYfrYopfYscrYumlZ"
+    "HcyZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabreveacacEacdacircacut"
+    "eacyaeligafafragravealefsymalephalphaamacramalgampandandandanddandslopeandvangan"
+    "geangleangmsdangmsdaaangmsdabangmsdacangmsdadangmsdaeangmsdafangmsdagangmsdahang"
+    "rtangrtvbangrtvbdangsphangstangzarraogonaopfapapEapacirapeapidaposapproxapproxeq"
+    "aringascrastasympasympeqatildeaumlawconintawintbNotbackcongbackepsilonbackprimeb"
+    "acksimbacksimeqbarveebarwedbarwedgebbrkbbrktbrkbcongbcybdquobecausbecausebemptyv"
+    "bepsibernoubetabethbetweenbfrbigcapbigcircbigcupbigodotbigoplusbigotimesbigsqcup"
+    "bigstarbigtriangledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozengeblack"
+    "squareblacktriangleblacktriangledownblacktriangleleftblacktrianglerightblankblk1"
+    "2blk14blk34blockbnebnequivbnotbopfbotbottombowtieboxDLboxDRboxDlboxDrboxHboxHDbo"
+    "xHUboxHdboxHuboxULboxURboxUlboxUrboxVboxVHboxVLboxVRboxVhboxVlboxVrboxboxboxdLbo"
+    "xdRboxdlboxdrboxhboxhDboxhUboxhdboxhuboxminusboxplusboxtimesboxuLboxuRboxulboxur"
+    "boxvboxvHboxvLboxvRboxvhboxvlboxvrbprimebrevebrvbarbscrbsemibsimbsimebsolbsolbbs"
+    "olhsubbullbulletbumpbumpEbumpebumpeqcacutecapcapandcapbrcupcapcapcapcupcapdotcap"
+    "scaretcaronccapsccaronccedilccircccupsccupssmcdotcedilcemptyvcentcenterdotcfrchc"
+    "ycheckcheckmarkchicircirEcirccirceqcirclearrowleftcirclearrowrightcircledRcircle"
+    "dScircledastcircledcirccircleddashcirecirfnintcirmidcirscirclubsclubsuitcoloncol"
+    "onecoloneqcommacommatcompcompfncomplementcomplexescongcongdotconintcopfcoprodcop"
+    "ycopysrcrarrcrosscscrcsubcsubecsupcsupectdotcudarrlcudarrrcueprcuesccularrcularr"
+    "pcupcupbrcapcupcapcupcupcupdotcuporcupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyv"
+    "eecurlywedgecurrencurvearrowleftcurvearrowrightcuveecuwedcwconintcwintcylctydArr"
+    "dHardaggerdalethdarrdashdashvdbkarowdblacdcarondcyddddaggerddarrddotseqdegdeltad"
+    "emptyvdfishtdfrdharldharrdiamdiamonddiamondsuitdiamsdiedigammadisindivdividedivi"
+    "deontimesdivonxdjcydlcorndlcropdollardopfdotdoteqdoteqdotdotminusdotplusdotsquar"
+    "edoublebarwedgedownarrowdowndownarrowsdownharpoonleftdownharpoonrightdrbkarowdrc"
+    "orndrcropdscrdscydsoldstrokdtdotdtridtrifduarrduhardwangledzcydzigrarreDDoteDote"
+    "acuteeasterecaronecirecircecolonecyedoteeefDotefregegraveegsegsdotelelinterselle"
+    "lselsdotemacremptyemptysetemptyvemspemsp13emsp14engenspeogoneopfepareparslepluse"
+    "psiepsilonepsiveqcirceqcoloneqsimeqslantgtreqslantlessequalsequestequivequivDDeq"
+    "vparslerDoterarrescresdotesimetaetheumleuroexclexistexpectationexponentialefalli"
+    "ngdotseqfcyfemaleffiligffligfflligffrfiligfjligflatflligfltnsfnoffopfforallforkf"
+    "orkvfpartintfrac12frac13frac14frac15frac16frac18frac23frac25frac34frac35frac38fr"
+    "ac45frac56frac58frac78fraslfrownfscrgEgElgacutegammagammadgapgbrevegcircgcygdotg"
+    "egelgeqgeqqgeqslantgesgesccgesdotgesdotogesdotolgeslgeslesgfrggggggimelgjcyglglE"
+    "glagljgnEgnapgnapproxgnegneqgneqqgnsimgopfgravegscrgsimgsimegsimlgtgtccgtcirgtdo"
+    "tgtlPargtquestgtrapproxgtrarrgtrdotgtreqlessgtreqqlessgtrlessgtrsimgvertneqqgvnE"
+    "hArrhairsphalfhamilthardcyharrharrcirharrwhbarhcircheartsheartsuithellipherconhf"
+    "rhksearowhkswarowhoarrhomththookleftarrowhookrightarrowhopfhorbarhscrhslashhstro"
+    "khybullhypheniacuteicicircicyiecyiexcliffifrigraveiiiiiintiiintiinfiniiotaijligi"
+    "macrimageimaglineimagpartimathimofimpedinincareinfininfintieinodotintintcalinteg"
+    "ersintercalintlarhkintprodiocyiogoniopfiotaiprodiquestiscrisinisinEisindotisinsi"
+    "sinsvisinvititildeiukcyiumljcircjcyjfrjmathjopfjscrjsercyjukcykappakappavkcedilk"
+    "cykfrkgreenkhcykjcykopfkscrlAarrlArrlAtaillBarrlElEglHarlacutelaemptyvlagranlamb"
+    "dalanglangdlanglelaplaquolarrlarrblarrbfslarrfslarrhklarrlplarrpllarrsimlarrtlla"
+    "tlataillatelateslbarrlbbrklbracelbracklbrkelbrksldlbrkslulcaronlcedillceillcublc"
+    "yldcaldquoldquorldrdharldrusharldshleleftarrowleftarrowtailleftharpoondownleftha"
+    "rpoonupleftleftarrowsleftrightarrowleftrightarrowsleftrightharpoonsleftrightsqui"
+    "garrowleftthreetimeslegleqleqqleqslantleslescclesdotlesdotolesdotorlesglesgesles"
+    "sapproxlessdotlesseqgtrlesseqqgtrlessgtrlesssimlfishtlfloorlfrlglgElhardlharulha"
+    "rullhblkliraljcyllllarrllcornerllhardlltrilmidotlmoustlmoustachelnElnaplnapproxl"
+    "nelneqlneqqlnsimloangloarrlobrklongleftarrowlongleftrightarrowlongmapstolongrigh"
+    "tarrowlooparrowleftlooparrowrightloparlopflopluslotimeslowastlowbarlozlozengeloz"
+    "flparlparltlrarrlrcornerlrharlrhardlrmlrtrilsaquolscrlshlsimlsimelsimglsqblsquol"
+    "squorlstrokltltccltcirltdotlthreeltimesltlarrltquestltrParltriltrieltriflurdshar"
+    "luruharlvertneqqlvnEmDDotmacrmalemaltmaltesemapmapstomapstodownmapstoleftmapstou"
+    "pmarkermcommamcymdashmeasuredanglemfrmhomicromidmidastmidcirmiddotminusminusbmin"
+    "usdminusdumlcpmldrmnplusmodelsmopfmpmscrmstposmumultimapmumapnGgnGtnGtvnLeftarro"
+    "wnLeftrightarrownLlnLtnLtvnRightarrownVDashnVdashnablanacutenairanangnapnapEnapi"
+    "dnaposnapproxnaturnaturalnaturalsnbspnbumpnbumpencapncaronncedilncongncongdotncu"
+    "pncyndashneneArrnearhknearrnearrownedotnequivnesearnesimnexistnexistsnfrngEngeng"
+    "eqngeqqngeqslantngesngsimngtngtrnhArrnharrnhparninisnisdnivnjcynlArrnlEnlarrnldr"
+    "nlenleftarrownleftrightarrownleqnleqqnleqslantnlesnlessnlsimnltnltrinltrienmidno"
+    "pfnotnotinnotinEnotindotnotinvanotinvbnotinvcnotninotnivanotnivbnotnivcnparnpara"
+    "llelnparslnpartnpolintnprnprcuenprenprecnpreceqnrArrnrarrnrarrcnrarrwnrightarrow"
+    "nrtrinrtrienscnsccuenscenscrnshortmidnshortparallelnsimnsimensimeqnsmidnsparnsqs"
+    "ubensqsupensubnsubEnsubensubsetnsubseteqnsubseteqqnsuccnsucceqnsupnsupEnsupensup"
+    "setnsupseteqnsupseteqqntglntildentlgntriangleleftntrianglelefteqntrianglerightnt"
+    "rianglerighteqnunumnumeronumspnvDashnvHarrnvapnvdashnvgenvgtnvinfinnvlArrnvlenvl"
+    "tnvltrienvrArrnvrtrienvsimnwArrnwarhknwarrnwarrownwnearoSoacuteoastocirocircocyo"
+    "dashodblacodivodotodsoldoeligofcirofrogonograveogtohbarohmointolarrolcirolcrosso"
+    "lineoltomacromegaomicronomidominusoopfoparoperpoplusororarrordorderorderofordfor"
+    "dmorigoforororslopeorvoscroslashosolotildeotimesotimesasoumlovbarparparaparallel"
+    "parsimparslpartpcypercntperiodpermilperppertenkpfrphiphivphmmatphonepipitchforkp"
+    "ivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdupluseplusmnplussimplust"
+    "wopmpointintpopfpoundprprEprapprcuepreprecprecapproxpreccurlyeqpreceqprecnapprox"
+    "precneqqprecnsimprecsimprimeprimesprnEprnapprnsimprodprofalarproflineprofsurfpro"
+    "pproptoprsimprurelpscrpsipuncspqfrqintqopfqprimeqscrquaternionsquatintquestquest"
+    "eqquotrAarrrArrrAtailrBarrrHarraceracuteradicraemptyvrangrangdrangerangleraquora"
+    "rrrarraprarrbrarrbfsrarrcrarrfsrarrhkrarrlprarrplrarrsimrarrtlrarrwratailratiora"
+    "tionalsrbarrrbbrkrbracerbrackrbrkerbrksldrbrkslurcaronrcedilrceilrcubrcyrdcardld"
+    "harrdquordquorrdshrealrealinerealpartrealsrectregrfishtrfloorrfrrhardrharurharul"
+    "rhorhovrightarrowrightarrowtailrightharpoondownrightharpoonuprightleftarrowsrigh"
+    "tleftharpoonsrightrightarrowsrightsquigarrowrightthreetimesringrisingdotseqrlArr"
+    "rlarrrlharrlmrmoustrmoustachernmidroangroarrrobrkroparropfroplusrotimesroublerpa"
+    "rrpargtrppolintrrarrrsaquorscrrshrsqbrsquorsquorrthreertimesrtrirtriertrifrtrilt"
+    "riruluharrupeerxsacutesbquoscscEscapscaronsccuescescedilscircscnEscnapscnsimscpo"
+    "lintscsimscysdotsdotbsdoteseArrsearhksearrsearrowsectsemiseswarsetminussetmnsext"
+    "sfrsfrownsharpshchcyshcyshortmidshortparallelshysigmasigmafsigmavsimsimdotsimesi"
+    "meqsimgsimgEsimlsimlEsimnesimplussimrarrslarrsmallsetminussmashpsmeparslsmidsmil"
+    "esmtsmtesmtessoftcysolsolbsolbarsopfspadesspadesuitsparsqcapsqcapssqcupsqcupssqs"
+    "ubsqsubesqsubsetsqsubseteqsqsupsqsupesqsupsetsqsupseteqsqusquaresquarfsqufsrarrs"
+    "scrssetmnssmilesstarfstarstarfstraightepsilonstraightphistrnssubsubEsubdotsubesu"
+    "bedotsubmultsubnEsubnesubplussubrarrsubsetsubseteqsubseteqqsubsetneqsubsetneqqsu"
+    "bsimsubsubsubsupsuccsuccapproxsucccurlyeqsucceqsuccnapproxsuccneqqsuccnsimsuccsi"
+    "msumsungsupsup1sup2sup3supEsupdotsupdsubsupesupedotsuphsolsuphsubsuplarrsupmults"
+    "upnEsupnesupplussupsetsupseteqsupseteqqsupsetneqsupsetneqqsupsimsupsubsupsupswAr"
+    "rswarhkswarrswarrowswnwarszligtargettautbrktcarontcediltcytdottelrectfrthere4the"
+    "reforethetathetasymthetavthickapproxthicksimthinspthkapthksimthorntildetimestime"
+    "sbtimesbartimesdtinttoeatoptopbottopcirtopftopforktosatprimetradetriangletriangl"
+    "edowntrianglelefttrianglelefteqtriangleqtrianglerighttrianglerighteqtridottrietr"
+    "iminustriplustrisbtritimetrpeziumtscrtscytshcytstroktwixttwoheadleftarrowtwohead"
+    "rightarrowuArruHaruacuteuarrubrcyubreveucircucyudarrudblacudharufishtufrugraveuh"
+    "arluharruhblkulcornulcornerulcropultriumacrumluogonuopfuparrowupdownarrowupharpo"
+    "onleftupharpoonrightuplusupsiupsihupsilonupuparrowsurcornurcornerurcropuringurtr"
+    "iuscrutdotutildeutriutrifuuarruumluwanglevArrvBarvBarvvDashvangrtvarepsilonvarka"
+    "ppavarnothingvarphivarpivarproptovarrvarrhovarsigmavarsubsetneqvarsubsetneqqvars"
+    "upsetneqvarsupsetneqqvarthetavartriangleleftvartrianglerightvcyvdashveeveebarvee"
+    "eqvellipverbarvertvfrvltrivnsubvnsupvopfvpropvrtrivscrvsubnEvsubnevsupnEvsupnevz"
+    "igzagwcircwedbarwedgewedgeqweierpwfrwonwopfwpwrwreathwscrxArrxarrxcapxcircxcupxd"
+    "trixfrxhArrxharrxixlArrxlarrxmapxnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxup"
+    "lusxutrixveexwedgeyacuteyacyycircycyyenyfryicyyopfyscryucyyumlzacutezcaronzcyzdo"
+    "tzeetrfzetazfrzhcyzigrarrzopfzscrzwjzwnj";
+
+// The UTF-8 replacement of every name, in the same order.
+constexpr char kValues[] =
+    "\xc3\x86&\xc3\x81\xc4\x82\xc3\x82\xd0\x90\xf0\x9d\x94\x84\xc3\x80\xce\x91\xc4"
+    "\x80\xe2\xa9\x93\xc4\x84\xf0\x9d\x94\xb8\xe2\x81\xa1\xc3\x85\xf0\x9d\x92\x9c\xe2"
+    "\x89\x94\xc3\x83\xc3\x84\xe2\x88\x96\xe2\xab\xa7\xe2\x8c\x86\xd0\x91\xe2\x88\xb5"
+    "\xe2\x84\xac\xce\x92\xf0\x9d\x94\x85\xf0\x9d\x94\xb9\xcb\x98\xe2\x84\xac\xe2\x89"
+    "\x8e\xd0\xa7\xc2\xa9\xc4\x86\xe2\x8b\x92\xe2\x85\x85\xe2\x84\xad\xc4\x8c\xc3\x87"
+    "\xc4\x88\xe2\x88\xb0\xc4\x8a\xc2\xb8\xc2\xb7\xe2\x84\xad\xce\xa7\xe2\x8a\x99\xe2"
+    "\x8a\x96\xe2\x8a\x95\xe2\x8a\x97\xe2\x88\xb2\xe2\x80\x9d\xe2\x80\x99\xe2\x88\xb7"
+    "\xe2\xa9\xb4\xe2\x89\xa1\xe2\x88\xaf\xe2\x88\xae\xe2\x84\x82\xe2\x88\x90\xe2\x88"
+    "\xb3\xe2\xa8\xaf\xf0\x9d\x92\x9e\xe2\x8b\x93\xe2\x89\x8d\xe2\x85\x85\xe2\xa4\x91"
+    "\xd0\x82\xd0\x85\xd0\x8f\xe2\x80\xa1\xe2\x86\xa1\xe2\xab\xa4\xc4\x8e\xd0\x94\xe2"
+    "\x88\x87\xce\x94\xf0\x9d\x94\x87\xc2\xb4\xcb\x99\xcb\x9d`\xcb\x9c\xe2\x8b\x84"
+    "\xe2\x85\x86\xf0\x9d\x94\xbb\xc2\xa8\xe2\x83\x9c\xe2\x89\x90\xe2\x88\xaf\xc2\xa8"
+    "\xe2\x87\x93\xe2\x87\x90\xe2\x87\x94\xe2\xab\xa4\xe2\x9f\xb8\xe2\x9f\xba\xe2\x9f"
+    "\xb9\xe2\x87\x92\xe2\x8a\xa8\xe2\x87\x91\xe2\x87\x95\xe2\x88\xa5\xe2\x86\x93\xe2"
+    "\xa4\x93\xe2\x87\xb5\xcc\x91\xe2\xa5\x90\xe2\xa5\x9e\xe2\x86\xbd\xe2\xa5\x96\xe2"
+    "\xa5\x9f\xe2\x87\x81\xe2\xa5\x97\xe2\x8a\xa4\xe2\x86\xa7\xe2\x87\x93\xf0\x9d\x92"
+    "\x9f\xc4\x90\xc5\x8a\xc3\x90\xc3\x89\xc4\x9a\xc3\x8a\xd0\xad\xc4\x96\xf0\x9d\x94"
+    "\x88\xc3\x88\xe2\x88\x88\xc4\x92\xe2\x97\xbb\xe2\x96\xab\xc4\x98\xf0\x9d\x94\xbc"
+    "\xce\x95\xe2\xa9\xb5\xe2\x89\x82\xe2\x87\x8c\xe2\x84\xb0\xe2\xa9\xb3\xce\x97\xc3"
+    "\x8b\xe2\x88\x83\xe2\x85\x87\xd0\xa4\xf0\x9d\x94\x89\xe2\x97\xbc\xe2\x96\xaa\xf0"
+    "\x9d\x94\xbd\xe2\x88\x80\xe2\x84\xb1\xe2\x84\xb1\xd0\x83>\xce\x93\xcf\x9c\xc4"
+    "\x9e\xc4\xa2\xc4\x9c\xd0\x93\xc4\xa0\xf0\x9d\x94\x8a\xe2\x8b\x99\xf0\x9d\x94\xbe"
+    "\xe2\x89\xa5\xe2\x8b\x9b\xe2\x89\xa7\xe2\xaa\xa2\xe2\x89\xb7\xe2\xa9\xbe\xe2\x89"
+    "\xb3\xf0\x9d\x92\xa2\xe2\x89\xab\xd0\xaa\xcb\x87^\xc4\xa4\xe2\x84\x8c\xe2\x84"
+    "\x8b\xe2\x84\x8d\xe2\x94\x80\xe2\x84\x8b\xc4\xa6\xe2\x89\x8e\xe2\x89\x8f\xd0\x95"
+    "\xc4\xb2\xd0\x81\xc3\x8d\xc3\x8e\xd0\x98\xc4\xb0\xe2\x84\x91\xc3\x8c\xe2\x84\x91"
+    "\xc4\xaa\xe2\x85\x88\xe2\x87\x92\xe2\x88\xac\xe2\x88\xab\xe2\x8b\x82\xe2\x81\xa3"
+    "\xe2\x81\xa2\xc4\xae\xf0\x9d\x95\x80\xce\x99\xe2\x84\x90\xc4\xa8\xd0\x86\xc3\x8f"
+    "\xc4\xb4\xd0\x99\xf0\x9d\x94\x8d\xf0\x9d\x95\x81\xf0\x9d\x92\xa5\xd0\x88\xd0\x84"
+    "\xd0\xa5\xd0\x8c\xce\x9a\xc4\xb6\xd0\x9a\xf0\x9d\x94\x8e\xf0\x9d\x95\x82\xf0\x9d"
+    "\x92\xa6\xd0\x89<\xc4\xb9\xce\x9b\xe2\x9f\xaa\xe2\x84\x92\xe2\x86\x9e\xc4\xbd"
+    "\xc4\xbb\xd0\x9b\xe2\x9f\xa8\xe2\x86\x90\xe2\x87\xa4\xe2\x87\x86\xe2\x8c\x88\xe2"
+    "\x9f\xa6\xe2\xa5\xa1\xe2\x87\x83\xe2\xa5\x99\xe2\x8c\x8a\xe2\x86\x94\xe2\xa5\x8e"
+    "\xe2\x8a\xa3\xe2\x86\xa4\xe2\xa5\x9a\xe2\x8a\xb2\xe2\xa7\x8f\xe2\x8a\xb4\xe2\xa5"
+    "\x91\xe2\xa5\xa0\xe2\x86\xbf\xe2\xa5\x98\xe2\x86\xbc\xe2\xa5\x92\xe2\x87\x90\xe2"
+    "\x87\x94\xe2\x8b\x9a\xe2\x89\xa6\xe2\x89\xb6\xe2\xaa\xa1\xe2\xa9\xbd\xe2\x89\xb2"
+    "\xf0\x9d\x94\x8f\xe2\x8b\x98\xe2\x87\x9a\xc4\xbf\xe2\x9f\xb5\xe2\x9f\xb7\xe2\x9f"
+    "\xb6\xe2\x9f\xb8\xe2\x9f\xba\xe2\x9f\xb9\xf0\x9d\x95\x83\xe2\x86\x99\xe2\x86\x98"
+    "\xe2\x84\x92\xe2\x86\xb0\xc5\x81\xe2\x89\xaa\xe2\xa4\x85\xd0\x9c\xe2\x81\x9f\xe2"
+    "\x84\xb3\xf0\x9d\x94\x90\xe2\x88\x93\xf0\x9d\x95\x84\xe2\x84\xb3\xce\x9c\xd0\x8a"
+    "\xc5\x83\xc5\x87\xc5\x85\xd0\x9d\xe2\x80\x8b\xe2\x80\x8b\xe2\x80\x8b\xe2\x80\x8b"
+    "\xe2\x89\xab\xe2\x89\xaa\x0a\xf0\x9d\x94\x91\xe2\x81\xa0\xc2\xa0\xe2\x84\x95\xe2"
+    "\xab\xac\xe2\x89\xa2\xe2\x89\xad\xe2\x88\xa6\xe2\x88\x89\xe2\x89\xa0\xe2\x89\x82"
+    "\xcc\xb8\xe2\x88\x84\xe2\x89\xaf\xe2\x89\xb1\xe2\x89\xa7\xcc\xb8\xe2\x89\xab\xcc"
+    "\xb8\xe2\x89\xb9\xe2\xa9\xbe\xcc\xb8\xe2\x89\xb5\xe2\x89\x8e\xcc\xb8\xe2\x89\x8f"
+    "\xcc\xb8\xe2\x8b\xaa\xe2\xa7\x8f\xcc\xb8\xe2\x8b\xac\xe2\x89\xae\xe2\x89\xb0\xe2"
+    "\x89\xb8\xe2\x89\xaa\xcc\xb8\xe2\xa9\xbd\xcc\xb8\xe2\x89\xb4\xe2\xaa\xa2\xcc\xb8"
+    "\xe2\xaa\xa1\xcc\xb8\xe2\x8a\x80\xe2\xaa\xaf\xcc\xb8\xe2\x8b\xa0\xe2\x88\x8c\xe2"
+    "\x8b\xab\xe2\xa7\x90\xcc\xb8\xe2\x8b\xad\xe2\x8a\x8f\xcc\xb8\xe2\x8b\xa2\xe2\x8a"
+    "\x90\xcc\xb8\xe2\x8b\xa3\xe2\x8a\x82\xe2\x83\x92\xe2\x8a\x88\xe2\x8a\x81\xe2\xaa"
+    "\xb0\xcc\xb8\xe2\x8b\xa1\xe2\x89\xbf\xcc\xb8\xe2\x8a\x83\xe2\x83\x92\xe2\x8a\x89"
+    "\xe2\x89\x81\xe2\x89\x84\xe2\x89\x87\xe2\x89\x89\xe2\x88\xa4\xf0\x9d\x92\xa9\xc3"
+    "\x91\xce\x9d\xc5\x92\xc3\x93\xc3\x94\xd0\x9e\xc5\x90\xf0\x9d\x94\x92\xc3\x92\xc5"
+    "\x8c\xce\xa9\xce\x9f\xf0\x9d\x95\x86\xe2\x80\x9c\xe2\x80\x98\xe2\xa9\x94\xf0\x9d"
+    "\x92\xaa\xc3\x98\xc3\x95\xe2\xa8\xb7\xc3\x96\xe2\x80\xbe\xe2\x8f\x9e\xe2\x8e\xb4"
+    "\xe2\x8f\x9c\xe2\x88\x82\xd0\x9f\xf0\x9d\x94\x93\xce\xa6\xce\xa0\xc2\xb1\xe2\x84"
+    "\x8c\xe2\x84\x99\xe2\xaa\xbb\xe2\x89\xba\xe2\xaa\xaf\xe2\x89\xbc\xe2\x89\xbe\xe2"
+    "\x80\xb3\xe2\x88\x8f\xe2\x88\xb7\xe2\x88\x9d\xf0\x9d\x92\xab\xce\xa8\x22\xf0\x9d"
+    "\x94\x94\xe2\x84\x9a\xf0\x9d\x92\xac\xe2\xa4\x90\xc2\xae\xc5\x94\xe2\x9f\xab\xe2"
+    "\x86\xa0\xe2\xa4\x96\xc5\x98\xc5\x96\xd0\xa0\xe2\x84\x9c\xe2\x88\x8b\xe2\x87\x8b"
+    "\xe2\xa5\xaf\xe2\x84\x9c\xce\xa1\xe2\x9f\xa9\xe2\x86\x92\xe2\x87\xa5\xe2\x87\x84"
+    "\xe2\x8c\x89\xe2\x9f\xa7\xe2\xa5\x9d\xe2\x87\x82\xe2\xa5\x95\xe2\x8c\x8b\xe2\x8a"
+    "\xa2\xe2\x86\xa6\xe2\xa5\x9b\xe2\x8a\xb3\xe2\xa7\x90\xe2\x8a\xb5\xe2\xa5\x8f\xe2"
+    "\xa5\x9c\xe2\x86\xbe\xe2\xa5\x94\xe2\x87\x80\xe2\xa5\x93\xe2\x87\x92\xe2\x84\x9d"
+    "\xe2\xa5\xb0\xe2\x87\x9b\xe2\x84\x9b\xe2\x86\xb1\xe2\xa7\xb4\xd0\xa9\xd0\xa8\xd0"
+    "\xac\xc5\x9a\xe2\xaa\xbc\xc5\xa0\xc5\x9e\xc5\x9c\xd0\xa1\xf0\x9d\x94\x96\xe2\x86"
+    "\x93\xe2\x86\x90\xe2\x86\x92\xe2\x86\x91\xce\xa3\xe2\x88\x98\xf0\x9d\x95\x8a\xe2"
+    "\x88\x9a\xe2\x96\xa1\xe2\x8a\x93\xe2\x8a\x8f\xe2\x8a\x91\xe2\x8a\x90\xe2\x8a\x92"
+    "\xe2\x8a\x94\xf0\x9d\x92\xae\xe2\x8b\x86\xe2\x8b\x90\xe2\x8b\x90\xe2\x8a\x86\xe2"
+    "\x89\xbb\xe2\xaa\xb0\xe2\x89\xbd\xe2\x89\xbf\xe2\x88\x8b\xe2\x88\x91\xe2\x8b\x91"
+    "\xe2\x8a\x83\xe2\x8a\x87\xe2\x8b\x91\xc3\x9e\xe2\x84\xa2\xd0\x8b\xd0\xa6\x09\xce"
+    "\xa4\xc5\xa4\xc5\xa2\xd0\xa2\xf0\x9d\x94\x97\xe2\x88\xb4\xce\x98\xe2\x81\x9f\xe2"
+    "\x80\x8a\xe2\x80\x89\xe2\x88\xbc\xe2\x89\x83\xe2\x89\x85\xe2\x89\x88\xf0\x9d\x95"
+    "\x8b\xe2\x83\x9b\xf0\x9d\x92\xaf\xc5\xa6\xc3\x9a\xe2\x86\x9f\xe2\xa5\x89\xd0\x8e"
+    "\xc5\xac\xc3\x9b\xd0\xa3\xc5\xb0\xf0\x9d\x94\x98\xc3\x99\xc5\xaa_\xe2\x8f\x9f"
+    "\xe2\x8e\xb5\xe2\x8f\x9d\xe2\x8b\x83\xe2\x8a\x8e\xc5\xb2\xf0\x9d\x95\x8c\xe2\x86"
+    "\x91\xe2\xa4\x92\xe2\x87\x85\xe2\x86\x95\xe2\xa5\xae\xe2\x8a\xa5\xe2\x86\xa5\xe2"
+    "\x87\x91\xe2\x87\x95\xe2\x86\x96\xe2\x86\x97\xcf\x92\xce\xa5\xc5\xae\xf0\x9d\x92"
+    "\xb0\xc5\xa8\xc3\x9c\xe2\x8a\xab\xe2\xab\xab\xd0\x92\xe2\x8a\xa9\xe2\xab\xa6\xe2"
+    "\x8b\x81\xe2\x80\x96\xe2\x80\x96\xe2\x88\xa3|\xe2\x9d\x98\xe2\x89\x80\xe2\x80"
+    "\x8a\xf0\x9d\x94\x99\xf0\x9d\x95\x8d\xf0\x9d\x92\xb1\xe2\x8a\xaa\xc5\xb4\xe2\x8b"
+    "\x80\xf0\x9d\x94\x9a\xf0\x9d\x95\x8e\xf0\x9d\x92\xb2\xf0\x9d\x94\x9b\xce\x9e\xf0"
+    "\x9d\x95\x8f\xf0\x9d\x92\xb3\xd0\xaf\xd0\x87\xd0\xae\xc3\x9d\xc5\xb6\xd0\xab\xf0"
+    "\x9d\x94\x9c\xf0\x9d\x95\x90\xf0\x9d\x92\xb4\xc5\xb8\xd0\x96\xc5\xb9\xc5\xbd\xd0"
+    "\x97\xc5\xbb\xe2\x80\x8b\xce\x96\xe2\x84\xa8\xe2\x84\xa4\xf0\x9d\x92\xb5\xc3\xa1"
+    "\xc4\x83\xe2\x88\xbe\xe2\x88\xbe\xcc\xb3\xe2\x88\xbf\xc3\xa2\xc2\xb4\xd0\xb0\xc3"
+    "\xa6\xe2\x81\xa1\xf0\x9d\x94\x9e\xc3\xa0\xe2\x84\xb5\xe2\x84\xb5\xce\xb1\xc4\x81"
+    "\xe2\xa8\xbf&\xe2\x88\xa7\xe2\xa9\x95\xe2\xa9\x9c\xe2\xa9\x98\xe2\xa9\x9a\xe2"
+    "\x88\xa0\xe2\xa6\xa4\xe2\x88\xa0\xe2\x88\xa1\xe2\xa6\xa8\xe2\xa6\xa9\xe2\xa6\xaa"
+    "\xe2\xa6\xab\xe2\xa6\xac\xe2\xa6\xad\xe2\xa6\xae\xe2\xa6\xaf\xe2\x88\x9f\xe2\x8a"
+    "\xbe\xe2\xa6\x9d\xe2\x88\xa2\xc3\x85\xe2\x8d\xbc\xc4\x85\xf0\x9d\x95\x92\xe2\x89"
+    "\x88\xe2\xa9\xb0\xe2\xa9\xaf\xe2\x89\x8a\xe2\x89\x8b'\xe2\x89\x88\xe2\x89\x8a"
+    "\xc3\xa5\xf0\x9d\x92\xb6*\xe2\x89\x88\xe2\x89\x8d\xc3\xa3\xc3\xa4\xe2\x88\xb3"
+    "\xe2\xa8\x91\xe2\xab\xad\xe2\x89\x8c\xcf\xb6\xe2\x80\xb5\xe2\x88\xbd\xe2\x8b\x8d"
+    "\xe2\x8a\xbd\xe2\x8c\x85\xe2\x8c\x85\xe2\x8e\xb5\xe2\x8e\xb6\xe2\x89\x8c\xd0\xb1"
+    "\xe2\x80\x9e\xe2\x88\xb5\xe2\x88\xb5\xe2\xa6\xb0\xcf\xb6\xe2\x84\xac\xce\xb2\xe2"
+    "\x84\xb6\xe2\x89\xac\xf0\x9d\x94\x9f\xe2\x8b\x82\xe2\x97\xaf\xe2\x8b\x83\xe2\xa8"
+    "\x80\xe2\xa8\x81\xe2\xa8\x82\xe2\xa8\x86\xe2\x98\x85\xe2\x96\xbd\xe2\x96\xb3\xe2"
+    "\xa8\x84\xe2\x8b\x81\xe2\x8b\x80\xe2\xa4\x8d\xe2\xa7\xab\xe2\x96\xaa\xe2\x96\xb4"
+    "\xe2\x96\xbe\xe2\x97\x82\xe2\x96\xb8\xe2\x90\xa3\xe2\x96\x92\xe2\x96\x91\xe2\x96"
+    "\x93\xe2\x96\x88=\xe2\x83\xa5\xe2\x89\xa1\xe2\x83\xa5\xe2\x8c\x90\xf0\x9d\x95"
+    "\x93\xe2\x8a\xa5\xe2\x8a\xa5\xe2\x8b\x88\xe2\x95\x97\xe2\x95\x94\xe2\x95\x96\xe2"
+    "\x95\x93\xe2\x95\x90\xe2\x95\xa6\xe2\x95\xa9\xe2\x95\xa4\xe2\x95\xa7\xe2\x95\x9d"
+    "\xe2\x95\x9a\xe2\x95\x9c\xe2\x95\x99\xe2\x95\x91\xe2\x95\xac\xe2\x95\xa3\xe2\x95"
+    "\xa0\xe2\x95\xab\xe2\x95\xa2\xe2\x95\x9f\xe2\xa7\x89\xe2\x95\x95\xe2\x95\x92\xe2"
+    "\x94\x90\xe2\x94\x8c\xe2\x94\x80\xe2\x95\xa5\xe2\x95\xa8\xe2\x94\xac\xe2\x94\xb4"
+    "\xe2\x8a\x9f\xe2\x8a\x9e\xe2\x8a\xa0\xe2\x95\x9b\xe2\x95\x98\xe2\x94\x98\xe2\x94"
+    "\x94\xe2\x94\x82\xe2\x95\xaa\xe2\x95\xa1\xe2\x95\x9e\xe2\x94\xbc\xe2\x94\xa4\xe2"
+    "\x94\x9c\xe2\x80\xb5\xcb\x98\xc2\xa6\xf0\x9d\x92\xb7\xe2\x81\x8f\xe2\x88\xbd\xe2"
+    "\x8b\x8d\x5c\xe2\xa7\x85\xe2\x9f\x88\xe2\x80\xa2\xe2\x80\xa2\xe2\x89\x8e\xe2\xaa"
+    "\xae\xe2\x89\x8f\xe2\x89\x8f\xc4\x87\xe2\x88\xa9\xe2\xa9\x84\xe2\xa9\x89\xe2\xa9"
+    "\x8b\xe2\xa9\x87\xe2\xa9\x80\xe2\x88\xa9\xef\xb8\x80\xe2\x81\x81\xcb\x87\xe2\xa9"
+    "\x8d\xc4\x8d\xc3\xa7\xc4\x89\xe2\xa9\x8c\xe2\xa9\x90\xc4\x8b\xc2\xb8\xe2\xa6\xb2"
+    "\xc2\xa2\xc2\xb7\xf0\x9d\x94\xa0\xd1\x87\xe2\x9c\x93\xe2\x9c\x93\xcf\x87\xe2\x97"
+    "\x8b\xe2\xa7\x83\xcb\x86\xe2\x89\x97\xe2\x86\xba\xe2\x86\xbb\xc2\xae\xe2\x93\x88"
+    "\xe2\x8a\x9b\xe2\x8a\x9a\xe2\x8a\x9d\xe2\x89\x97\xe2\xa8\x90\xe2\xab\xaf\xe2\xa7"
+    "\x82\xe2\x99\xa3\xe2\x99\xa3:\xe2\x89\x94\xe2\x89\x94,@\xe2\x88\x81\xe2\x88\x98"
+    "\xe2\x88\x81\xe2\x84\x82\xe2\x89\x85\xe2\xa9\xad\xe2\x88\xae\xf0\x9d\x95\x94\xe2"
+    "\x88\x90\xc2\xa9\xe2\x84\x97\xe2\x86\xb5\xe2\x9c\x97\xf0\x9d\x92\xb8\xe2\xab\x8f"
+    "\xe2\xab\x91\xe2\xab\x90\xe2\xab\x92\xe2\x8b\xaf\xe2\xa4\xb8\xe2\xa4\xb5\xe2\x8b"
+    "\x9e\xe2\x8b\x9f\xe2\x86\xb6\xe2\xa4\xbd\xe2\x88\xaa\xe2\xa9\x88\xe2\xa9\x86\xe2"
+    "\xa9\x8a\xe2\x8a\x8d\xe2\xa9\x85\xe2\x88\xaa\xef\xb8\x80\xe2\x86\xb7\xe2\xa4\xbc"
+    "\xe2\x8b\x9e\xe2\x8b\x9f\xe2\x8b\x8e\xe2\x8b\x8f\xc2\xa4\xe2\x86\xb6\xe2\x86\xb7"
+    "\xe2\x8b\x8e\xe2\x8b\x8f\xe2\x88\xb2\xe2\x88\xb1\xe2\x8c\xad\xe2\x87\x93\xe2\xa5"
+    "\xa5\xe2\x80\xa0\xe2\x84\xb8\xe2\x86\x93\xe2\x80\x90\xe2\x8a\xa3\xe2\xa4\x8f\xcb"
+    "\x9d\xc4\x8f\xd0\xb4\xe2\x85\x86\xe2\x80\xa1\xe2\x87\x8a\xe2\xa9\xb7\xc2\xb0\xce"
+    "\xb4\xe2\xa6\xb1\xe2\xa5\xbf\xf0\x9d\x94\xa1\xe2\x87\x83\xe2\x87\x82\xe2\x8b\x84"
+    "\xe2\x8b\x84\xe2\x99\xa6\xe2\x99\xa6\xc2\xa8\xcf\x9d\xe2\x8b\xb2\xc3\xb7\xc3\xb7"
+    "\xe2\x8b\x87\xe2\x8b\x87\xd1\x92\xe2\x8c\x9e\xe2\x8c\x8d$\xf0\x9d\x95\x95\xcb"
+    "\x99\xe2\x89\x90\xe2\x89\x91\xe2\x88\xb8\xe2\x88\x94\xe2\x8a\xa1\xe2\x8c\x86\xe2"
+    "\x86\x93\xe2\x87\x8a\xe2\x87\x83\xe2\x87\x82\xe2\xa4\x90\xe2\x8c\x9f\xe2\x8c\x8c"
+    "\xf0\x9d\x92\xb9\xd1\x95\xe2\xa7\xb6\xc4\x91\xe2\x8b\xb1\xe2\x96\xbf\xe2\x96\xbe"
+    "\xe2\x87\xb5\xe2\xa5\xaf\xe2\xa6\xa6\xd1\x9f\xe2\x9f\xbf\xe2\xa9\xb7\xe2\x89\x91"
+    "\xc3\xa9\xe2\xa9\xae\xc4\x9b\xe2\x89\x96\xc3\xaa\xe2\x89\x95\xd1\x8d\xc4\x97\xe2"
+    "\x85\x87\xe2\x89\x92\xf0\x9d\x94\xa2\xe2\xaa\x9a\xc3\xa8\xe2\xaa\x96\xe2\xaa\x98"
+    "\xe2\xaa\x99\xe2\x8f\xa7\xe2\x84\x93\xe2\xaa\x95\xe2\xaa\x97\xc4\x93\xe2\x88\x85"
+    "\xe2\x88\x85\xe2\x88\x85\xe2\x80\x83\xe2\x80\x84\xe2\x80\x85\xc5\x8b\xe2\x80\x82"
+    "\xc4\x99\xf0\x9d\x95\x96\xe2\x8b\x95\xe2\xa7\xa3\xe2\xa9\xb1\xce\xb5\xce\xb5\xcf"
+    "\xb5\xe2\x89\x96\xe2\x89\x95\xe2\x89\x82\xe2\xaa\x96\xe2\xaa\x95=\xe2\x89\x9f"
+    "\xe2\x89\xa1\xe2\xa9\xb8\xe2\xa7\xa5\xe2\x89\x93\xe2\xa5\xb1\xe2\x84\xaf\xe2\x89"
+    "\x90\xe2\x89\x82\xce\xb7\xc3\xb0\xc3\xab\xe2\x82\xac!\xe2\x88\x83\xe2\x84\xb0"
+    "\xe2\x85\x87\xe2\x89\x92\xd1\x84\xe2\x99\x80\xef\xac\x83\xef\xac\x80\xef\xac\x84"
+    "\xf0\x9d\x94\xa3\xef\xac\x81\x66j\xe2\x99\xad\xef\xac\x82\xe2\x96\xb1\xc6\x92"
+    "\xf0\x9d\x95\x97\xe2\x88\x80\xe2\x8b\x94\xe2\xab\x99\xe2\xa8\x8d\xc2\xbd\xe2\x85"
+    "\x93\xc2\xbc\xe2\x85\x95\xe2\x85\x99\xe2\x85\x9b\xe2\x85\x94\xe2\x85\x96\xc2\xbe"
+    "\xe2\x85\x97\xe2\x85\x9c\xe2\x85\x98\xe2\x85\x9a\xe2\x85\x9d\xe2\x85\x9e\xe2\x81"
+    "\x84\xe2\x8c\xa2\xf0\x9d\x92\xbb\xe2\x89\xa7\xe2\xaa\x8c\xc7\xb5\xce\xb3\xcf\x9d"
+    "\xe2\xaa\x86\xc4\x9f\xc4\x9d\xd0\xb3\xc4\xa1\xe2\x89\xa5\xe2\x8b\x9b\xe2\x89\xa5"
+    "\xe2\x89\xa7\xe2\xa9\xbe\xe2\xa9\xbe\xe2\xaa\xa9\xe2\xaa\x80\xe2\xaa\x82\xe2\xaa"
+    "\x84\xe2\x8b\x9b\xef\xb8\x80\xe2\xaa\x94\xf0\x9d\x94\xa4\xe2\x89\xab\xe2\x8b\x99"
+    "\xe2\x84\xb7\xd1\x93\xe2\x89\xb7\xe2\xaa\x92\xe2\xaa\xa5\xe2\xaa\xa4\xe2\x89\xa9"
+    "\xe2\xaa\x8a\xe2\xaa\x8a\xe2\xaa\x88\xe2\xaa\x88\xe2\x89\xa9\xe2\x8b\xa7\xf0\x9d"
+    "\x95\x98`\xe2\x84\x8a\xe2\x89\xb3\xe2\xaa\x8e\xe2\xaa\x90>\xe2\xaa\xa7\xe2\xa9"
+    "\xba\xe2\x8b\x97\xe2\xa6\x95\xe2\xa9\xbc\xe2\xaa\x86\xe2\xa5\xb8\xe2\x8b\x97\xe2"
+    "\x8b\x9b\xe2\xaa\x8c\xe2\x89\xb7\xe2\x89\xb3\xe2\x89\xa9\xef\xb8\x80\xe2\x89\xa9"
+    "\xef\xb8\x80\xe2\x87\x94\xe2\x80\x8a\xc2\xbd\xe2\x84\x8b\xd1\x8a\xe2\x86\x94\xe2"
+    "\xa5\x88\xe2\x86\xad\xe2\x84\x8f\xc4\xa5\xe2\x99\xa5\xe2\x99\xa5\xe2\x80\xa6\xe2"
+    "\x8a\xb9\xf0\x9d\x94\xa5\xe2\xa4\xa5\xe2\xa4\xa6\xe2\x87\xbf\xe2\x88\xbb\xe2\x86"
+    "\xa9\xe2\x86\xaa\xf0\x9d\x95\x99\xe2\x80\x95\xf0\x9d\x92\xbd\xe2\x84\x8f\xc4\xa7"
+    "\xe2\x81\x83\xe2\x80\x90\xc3\xad\xe2\x81\xa3\xc3\xae\xd0\xb8\xd0\xb5\xc2\xa1\xe2"
+    "\x87\x94\xf0\x9d\x94\xa6\xc3\xac\xe2\x85\x88\xe2\xa8\x8c\xe2\x88\xad\xe2\xa7\x9c"
+    "\xe2\x84\xa9\xc4\xb3\xc4\xab\xe2\x84\x91\xe2\x84\x90\xe2\x84\x91\xc4\xb1\xe2\x8a"
+    "\xb7\xc6\xb5\xe2\x88\x88\xe2\x84\x85\xe2\x88\x9e\xe2\xa7\x9d\xc4\xb1\xe2\x88\xab"
+    "\xe2\x8a\xba\xe2\x84\xa4\xe2\x8a\xba\xe2\xa8\x97\xe2\xa8\xbc\xd1\x91\xc4\xaf\xf0"
+    "\x9d\x95\x9a\xce\xb9\xe2\xa8\xbc\xc2\xbf\xf0\x9d\x92\xbe\xe2\x88\x88\xe2\x8b\xb9"
+    "\xe2\x8b\xb5\xe2\x8b\xb4\xe2\x8b\xb3\xe2\x88\x88\xe2\x81\xa2\xc4\xa9\xd1\x96\xc3"
+    "\xaf\xc4\xb5\xd0\xb9\xf0\x9d\x94\xa7\xc8\xb7\xf0\x9d\x95\x9b\xf0\x9d\x92\xbf\xd1"
+    "\x98\xd1\x94\xce\xba\xcf\xb0\xc4\xb7\xd0\xba\xf0\x9d\x94\xa8\xc4\xb8\xd1\x85\xd1"
+    "\x9c\xf0\x9d\x95\x9c\xf0\x9d\x93\x80\xe2\x87\x9a\xe2\x87\x90\xe2\xa4\x9b\xe2\xa4"
+    "\x8e\xe2\x89\xa6\xe2\xaa\x8b\xe2\xa5\xa2\xc4\xba\xe2\xa6\xb4\xe2\x84\x92\xce\xbb"
+    "\xe2\x9f\xa8\xe2\xa6\x91\xe2\x9f\xa8\xe2\xaa\x85\xc2\xab\xe2\x86\x90\xe2\x87\xa4"
+    "\xe2\xa4\x9f\xe2\xa4\x9d\xe2\x86\xa9\xe2\x86\xab\xe2\xa4\xb9\xe2\xa5\xb3\xe2\x86"
+    "\xa2\xe2\xaa\xab\xe2\xa4\x99\xe2\xaa\xad\xe2\xaa\xad\xef\xb8\x80\xe2\xa4\x8c\xe2"
+    "\x9d\xb2{[\xe2\xa6\x8b\xe2\xa6\x8f\xe2\xa6\x8d\xc4\xbe\xc4\xbc\xe2\x8c\x88{\xd0"
+    "\xbb\xe2\xa4\xb6\xe2\x80\x9c\xe2\x80\x9e\xe2\xa5\xa7\xe2\xa5\x8b\xe2\x86\xb2\xe2"
+    "\x89\xa4\xe2\x86\x90\xe2\x86\xa2\xe2\x86\xbd\xe2\x86\xbc\xe2\x87\x87\xe2\x86\x94"
+    "\xe2\x87\x86\xe2\x87\x8b\xe2\x86\xad\xe2\x8b\x8b\xe2\x8b\x9a\xe2\x89\xa4\xe2\x89"
+    "\xa6\xe2\xa9\xbd\xe2\xa9\xbd\xe2\xaa\xa8\xe2\xa9\xbf\xe2\xaa\x81\xe2\xaa\x83\xe2"
+    "\x8b\x9a\xef\xb8\x80\xe2\xaa\x93\xe2\xaa\x85\xe2\x8b\x96\xe2\x8b\x9a\xe2\xaa\x8b"
+    "\xe2\x89\xb6\xe2\x89\xb2\xe2\xa5\xbc\xe2\x8c\x8a\xf0\x9d\x94\xa9\xe2\x89\xb6\xe2"
+    "\xaa\x91\xe2\x86\xbd\xe2\x86\xbc\xe2\xa5\xaa\xe2\x96\x84\xe2\x82\xa4\xd1\x99\xe2"
+    "\x89\xaa\xe2\x87\x87\xe2\x8c\x9e\xe2\xa5\xab\xe2\x97\xba\xc5\x80\xe2\x8e\xb0\xe2"
+    "\x8e\xb0\xe2\x89\xa8\xe2\xaa\x89\xe2\xaa\x89\xe2\xaa\x87\xe2\xaa\x87\xe2\x89\xa8"
+    "\xe2\x8b\xa6\xe2\x9f\xac\xe2\x87\xbd\xe2\x9f\xa6\xe2\x9f\xb5\xe2\x9f\xb7\xe2\x9f"
+    "\xbc\xe2\x9f\xb6\xe2\x86\xab\xe2\x86\xac\xe2\xa6\x85\xf0\x9d\x95\x9d\xe2\xa8\xad"
+    "\xe2\xa8\xb4\xe2\x88\x97_\xe2\x97\x8a\xe2\x97\x8a\xe2\xa7\xab(\xe2\xa6\x93\xe2"
+    "\x87\x86\xe2\x8c\x9f\xe2\x87\x8b\xe2\xa5\xad\xe2\x80\x8e\xe2\x8a\xbf\xe2\x80\xb9"
+    "\xf0\x9d\x93\x81\xe2\x86\xb0\xe2\x89\xb2\xe2\xaa\x8d\xe2\xaa\x8f[\xe2\x80\x98"
+    "\xe2\x80\x9a\xc5\x82<\xe2\xaa\xa6\xe2\xa9\xb9\xe2\x8b\x96\xe2\x8b\x8b\xe2\x8b"
+    "\x89\xe2\xa5\xb6\xe2\xa9\xbb\xe2\xa6\x96\xe2\x97\x83\xe2\x8a\xb4\xe2\x97\x82\xe2"
+    "\xa5\x8a\xe2\xa5\xa6\xe2\x89\xa8\xef\xb8\x80\xe2\x89\xa8\xef\xb8\x80\xe2\x88\xba"
+    "\xc2\xaf\xe2\x99\x82\xe2\x9c\xa0\xe2\x9c\xa0\xe2\x86\xa6\xe2\x86\xa6\xe2\x86\xa7"
+    "\xe2\x86\xa4\xe2\x86\xa5\xe2\x96\xae\xe2\xa8\xa9\xd0\xbc\xe2\x80\x94\xe2\x88\xa1"
+    "\xf0\x9d\x94\xaa\xe2\x84\xa7\xc2\xb5\xe2\x88\xa3*\xe2\xab\xb0\xc2\xb7\xe2\x88"
+    "\x92\xe2\x8a\x9f\xe2\x88\xb8\xe2\xa8\xaa\xe2\xab\x9b\xe2\x80\xa6\xe2\x88\x93\xe2"
+    "\x8a\xa7\xf0\x9d\x95\x9e\xe2\x88\x93\xf0\x9d\x93\x82\xe2\x88\xbe\xce\xbc\xe2\x8a"
+    "\xb8\xe2\x8a\xb8\xe2\x8b\x99\xcc\xb8\xe2\x89\xab\xe2\x83\x92\xe2\x89\xab\xcc\xb8"
+    "\xe2\x87\x8d\xe2\x87\x8e\xe2\x8b\x98\xcc\xb8\xe2\x89\xaa\xe2\x83\x92\xe2\x89\xaa"
+    "\xcc\xb8\xe2\x87\x8f\xe2\x8a\xaf\xe2\x8a\xae\xe2\x88\x87\xc5\x84\xe2\x82\xa6\xe2"
+    "\x88\xa0\xe2\x83\x92\xe2\x89\x89\xe2\xa9\xb0\xcc\xb8\xe2\x89\x8b\xcc\xb8\xc5\x89"
+    "\xe2\x89\x89\xe2\x99\xae\xe2\x99\xae\xe2\x84\x95\xc2\xa0\xe2\x89\x8e\xcc\xb8\xe2"
+    "\x89\x8f\xcc\xb8\xe2\xa9\x83\xc5\x88\xc5\x86\xe2\x89\x87\xe2\xa9\xad\xcc\xb8\xe2"
+    "\xa9\x82\xd0\xbd\xe2\x80\x93\xe2\x89\xa0\xe2\x87\x97\xe2\xa4\xa4\xe2\x86\x97\xe2"
+    "\x86\x97\xe2\x89\x90\xcc\xb8\xe2\x89\xa2\xe2\xa4\xa8\xe2\x89\x82\xcc\xb8\xe2\x88"
+    "\x84\xe2\x88\x84\xf0\x9d\x94\xab\xe2\x89\xa7\xcc\xb8\xe2\x89\xb1\xe2\x89\xb1\xe2"
+    "\x89\xa7\xcc\xb8\xe2\xa9\xbe\xcc\xb8\xe2\xa9\xbe\xcc\xb8\xe2\x89\xb5\xe2\x89\xaf"
+    "\xe2\x89\xaf\xe2\x87\x8e\xe2\x86\xae\xe2\xab\xb2\xe2\x88\x8b\xe2\x8b\xbc\xe2\x8b"
+    "\xba\xe2\x88\x8b\xd1\x9a\xe2\x87\x8d\xe2\x89\xa6\xcc\xb8\xe2\x86\x9a\xe2\x80\xa5"
+    "\xe2\x89\xb0\xe2\x86\x9a\xe2\x86\xae\xe2\x89\xb0\xe2\x89\xa6\xcc\xb8\xe2\xa9\xbd"
+    "\xcc\xb8\xe2\xa9\xbd\xcc\xb8\xe2\x89\xae\xe2\x89\xb4\xe2\x89\xae\xe2\x8b\xaa\xe2"
+    "\x8b\xac\xe2\x88\xa4\xf0\x9d\x95\x9f\xc2\xac\xe2\x88\x89\xe2\x8b\xb9\xcc\xb8\xe2"
+    "\x8b\xb5\xcc\xb8\xe2\x88\x89\xe2\x8b\xb7\xe2\x8b\xb6\xe2\x88\x8c\xe2\x88\x8c\xe2"
+    "\x8b\xbe\xe2\x8b\xbd\xe2\x88\xa6\xe2\x88\xa6\xe2\xab\xbd\xe2\x83\xa5\xe2\x88\x82"
+    "\xcc\xb8\xe2\xa8\x94\xe2\x8a\x80\xe2\x8b\xa0\xe2\xaa\xaf\xcc\xb8\xe2\x8a\x80\xe2"
+    "\xaa\xaf\xcc\xb8\xe2\x87\x8f\xe2\x86\x9b\xe2\xa4\xb3\xcc\xb8\xe2\x86\x9d\xcc\xb8"
+    "\xe2\x86\x9b\xe2\x8b\xab\xe2\x8b\xad\xe2\x8a\x81\xe2\x8b\xa1\xe2\xaa\xb0\xcc\xb8"
+    "\xf0\x9d\x93\x83\xe2\x88\xa4\xe2\x88\xa6\xe2\x89\x81\xe2\x89\x84\xe2\x89\x84\xe2"
+    "\x88\xa4\xe2\x88\xa6\xe2\x8b\xa2\xe2\x8b\xa3\xe2\x8a\x84\xe2\xab\x85\xcc\xb8\xe2"
+    "\x8a\x88\xe2\x8a\x82\xe2\x83\x92\xe2\x8a\x88\xe2\xab\x85\xcc\xb8\xe2\x8a\x81\xe2"
+    "\xaa\xb0\xcc\xb8\xe2\x8a\x85\xe2\xab\x86\xcc\xb8\xe2\x8a\x89\xe2\x8a\x83\xe2\x83"
+    "\x92\xe2\x8a\x89\xe2\xab\x86\xcc\xb8\xe2\x89\xb9\xc3\xb1\xe2\x89\xb8\xe2\x8b\xaa"
+    "\xe2\x8b\xac\xe2\x8b\xab\xe2\x8b\xad\xce\xbd#\xe2\x84\x96\xe2\x80\x87\xe2\x8a"
+    "\xad\xe2\xa4\x84\xe2\x89\x8d\xe2\x83\x92\xe2\x8a\xac\xe2\x89\xa5\xe2\x83\x92>"
+    "\xe2\x83\x92\xe2\xa7\x9e\xe2\xa4\x82\xe2\x89\xa4\xe2\x83\x92<\xe2\x83\x92\xe2"
+    "\x8a\xb4\xe2\x83\x92\xe2\xa4\x83\xe2\x8a\xb5\xe2\x83\x92\xe2\x88\xbc\xe2\x83\x92"
+    "\xe2\x87\x96\xe2\xa4\xa3\xe2\x86\x96\xe2\x86\x96\xe2\xa4\xa7\xe2\x93\x88\xc3\xb3"
+    "\xe2\x8a\x9b\xe2\x8a\x9a\xc3\xb4\xd0\xbe\xe2\x8a\x9d\xc5\x91\xe2\xa8\xb8\xe2\x8a"
+    "\x99\xe2\xa6\xbc\xc5\x93\xe2\xa6\xbf\xf0\x9d\x94\xac\xcb\x9b\xc3\xb2\xe2\xa7\x81"
+    "\xe2\xa6\xb5\xce\xa9\xe2\x88\xae\xe2\x86\xba\xe2\xa6\xbe\xe2\xa6\xbb\xe2\x80\xbe"
+    "\xe2\xa7\x80\xc5\x8d\xcf\x89\xce\xbf\xe2\xa6\xb6\xe2\x8a\x96\xf0\x9d\x95\xa0\xe2"
+    "\xa6\xb7\xe2\xa6\xb9\xe2\x8a\x95\xe2\x88\xa8\xe2\x86\xbb\xe2\xa9\x9d\xe2\x84\xb4"
+    "\xe2\x84\xb4\xc2\xaa\xc2\xba\xe2\x8a\xb6\xe2\xa9\x96\xe2\xa9\x97\xe2\xa9\x9b\xe2"
+    "\x84\xb4\xc3\xb8\xe2\x8a\x98\xc3\xb5\xe2\x8a\x97\xe2\xa8\xb6\xc3\xb6\xe2\x8c\xbd"
+    "\xe2\x88\xa5\xc2\xb6\xe2\x88\xa5\xe2\xab\xb3\xe2\xab\xbd\xe2\x88\x82\xd0\xbf%."
+    "\xe2\x80\xb0\xe2\x8a\xa5\xe2\x80\xb1\xf0\x9d\x94\xad\xcf\x86\xcf\x95\xe2\x84\xb3"
+    "\xe2\x98\x8e\xcf\x80\xe2\x8b\x94\xcf\x96\xe2\x84\x8f\xe2\x84\x8e\xe2\x84\x8f+"
+    "\xe2\xa8\xa3\xe2\x8a\x9e\xe2\xa8\xa2\xe2\x88\x94\xe2\xa8\xa5\xe2\xa9\xb2\xc2\xb1"
+    "\xe2\xa8\xa6\xe2\xa8\xa7\xc2\xb1\xe2\xa8\x95\xf0\x9d\x95\xa1\xc2\xa3\xe2\x89\xba"
+    "\xe2\xaa\xb3\xe2\xaa\xb7\xe2\x89\xbc\xe2\xaa\xaf\xe2\x89\xba\xe2\xaa\xb7\xe2\x89"
+    "\xbc\xe2\xaa\xaf\xe2\xaa\xb9\xe2\xaa\xb5\xe2\x8b\xa8\xe2\x89\xbe\xe2\x80\xb2\xe2"
+    "\x84\x99\xe2\xaa\xb5\xe2\xaa\xb9\xe2\x8b\xa8\xe2\x88\x8f\xe2\x8c\xae\xe2\x8c\x92"
+    "\xe2\x8c\x93\xe2\x88\x9d\xe2\x88\x9d\xe2\x89\xbe\xe2\x8a\xb0\xf0\x9d\x93\x85\xcf"
+    "\x88\xe2\x80\x88\xf0\x9d\x94\xae\xe2\xa8\x8c\xf0\x9d\x95\xa2\xe2\x81\x97\xf0\x9d"
+    "\x93\x86\xe2\x84\x8d\xe2\xa8\x96\x3f\xe2\x89\x9f\x22\xe2\x87\x9b\xe2\x87\x92\xe2"
+    "\xa4\x9c\xe2\xa4\x8f\xe2\xa5\xa4\xe2\x88\xbd\xcc\xb1\xc5\x95\xe2\x88\x9a\xe2\xa6"
+    "\xb3\xe2\x9f\xa9\xe2\xa6\x92\xe2\xa6\xa5\xe2\x9f\xa9\xc2\xbb\xe2\x86\x92\xe2\xa5"
+    "\xb5\xe2\x87\xa5\xe2\xa4\xa0\xe2\xa4\xb3\xe2\xa4\x9e\xe2\x86\xaa\xe2\x86\xac\xe2"
+    "\xa5\x85\xe2\xa5\xb4\xe2\x86\xa3\xe2\x86\x9d\xe2\xa4\x9a\xe2\x88\xb6\xe2\x84\x9a"
+    "\xe2\xa4\x8d\xe2\x9d\xb3}]\xe2\xa6\x8c\xe2\xa6\x8e\xe2\xa6\x90\xc5\x99\xc5\x97"
+    "\xe2\x8c\x89}\xd1\x80\xe2\xa4\xb7\xe2\xa5\xa9\xe2\x80\x9d\xe2\x80\x9d\xe2\x86"
+    "\xb3\xe2\x84\x9c\xe2\x84\x9b\xe2\x84\x9c\xe2\x84\x9d\xe2\x96\xad\xc2\xae\xe2\xa5"
+    "\xbd\xe2\x8c\x8b\xf0\x9d\x94\xaf\xe2\x87\x81\xe2\x87\x80\xe2\xa5\xac\xcf\x81\xcf"
+    "\xb1\xe2\x86\x92\xe2\x86\xa3\xe2\x87\x81\xe2\x87\x80\xe2\x87\x84\xe2\x87\x8c\xe2"
+    "\x87\x89\xe2\x86\x9d\xe2\x8b\x8c\xcb\x9a\xe2\x89\x93\xe2\x87\x8c\xe2\x87\x84\xe2"
+    "\x87\x8c\xe2\x80\x8f\xe2\x8e\xb1\xe2\x8e\xb1\xe2\xab\xae\xe2\x9f\xad\xe2\x87\xbe"
+    "\xe2\x9f\xa7\xe2\xa6\x86\xf0\x9d\x95\xa3\xe2\xa8\xae\xe2\xa8\xb5\xe2\x82\xbd)"
+    "\xe2\xa6\x94\xe2\xa8\x92\xe2\x87\x89\xe2\x80\xba\xf0\x9d\x93\x87\xe2\x86\xb1]"
+    "\xe2\x80\x99\xe2\x80\x99\xe2\x8b\x8c\xe2\x8b\x8a\xe2\x96\xb9\xe2\x8a\xb5\xe2\x96"
+    "\xb8\xe2\xa7\x8e\xe2\xa5\xa8\xe2\x82\xb9\xe2\x84\x9e\xc5\x9b\xe2\x80\x9a\xe2\x89"
+    "\xbb\xe2\xaa\xb4\xe2\xaa\xb8\xc5\xa1\xe2\x89\xbd\xe2\xaa\xb0\xc5\x9f\xc5\x9d\xe2"
+    "\xaa\xb6\xe2\xaa\xba\xe2\x8b\xa9\xe2\xa8\x93\xe2\x89\xbf\xd1\x81\xe2\x8b\x85\xe2"
+    "\x8a\xa1\xe2\xa9\xa6\xe2\x87\x98\xe2\xa4\xa5\xe2\x86\x98\xe2\x86\x98\xc2\xa7;"
+    "\xe2\xa4\xa9\xe2\x88\x96\xe2\x88\x96\xe2\x9c\xb6\xf0\x9d\x94\xb0\xe2\x8c\xa2\xe2"
+    "\x99\xaf\xd1\x89\xd1\x88\xe2\x88\xa3\xe2\x88\xa5\xc2\xad\xcf\x83\xcf\x82\xcf\x82"
+    "\xe2\x88\xbc\xe2\xa9\xaa\xe2\x89\x83\xe2\x89\x83\xe2\xaa\x9e\xe2\xaa\xa0\xe2\xaa"
+    "\x9d\xe2\xaa\x9f\xe2\x89\x86\xe2\xa8\xa4\xe2\xa5\xb2\xe2\x86\x90\xe2\x88\x96\xe2"
+    "\xa8\xb3\xe2\xa7\xa4\xe2\x88\xa3\xe2\x8c\xa3\xe2\xaa\xaa\xe2\xaa\xac\xe2\xaa\xac"
+    "\xef\xb8\x80\xd1\x8c/\xe2\xa7\x84\xe2\x8c\xbf\xf0\x9d\x95\xa4\xe2\x99\xa0\xe2"
+    "\x99\xa0\xe2\x88\xa5\xe2\x8a\x93\xe2\x8a\x93\xef\xb8\x80\xe2\x8a\x94\xe2\x8a\x94"
+    "\xef\xb8\x80\xe2\x8a\x8f\xe2\x8a\x91\xe2\x8a\x8f\xe2\x8a\x91\xe2\x8a\x90\xe2\x8a"
+    "\x92\xe2\x8a\x90\xe2\x8a\x92\xe2\x96\xa1\xe2\x96\xa1\xe2\x96\xaa\xe2\x96\xaa\xe2"
+    "\x86\x92\xf0\x9d\x93\x88\xe2\x88\x96\xe2\x8c\xa3\xe2\x8b\x86\xe2\x98\x86\xe2\x98"
+    "\x85\xcf\xb5\xcf\x95\xc2\xaf\xe2\x8a\x82\xe2\xab\x85\xe2\xaa\xbd\xe2\x8a\x86\xe2"
+    "\xab\x83\xe2\xab\x81\xe2\xab\x8b\xe2\x8a\x8a\xe2\xaa\xbf\xe2\xa5\xb9\xe2\x8a\x82"
+    "\xe2\x8a\x86\xe2\xab\x85\xe2\x8a\x8a\xe2\xab\x8b\xe2\xab\x87\xe2\xab\x95\xe2\xab"
+    "\x93\xe2\x89\xbb\xe2\xaa\xb8\xe2\x89\xbd\xe2\xaa\xb0\xe2\xaa\xba\xe2\xaa\xb6\xe2"
+    "\x8b\xa9\xe2\x89\xbf\xe2\x88\x91\xe2\x99\xaa\xe2\x8a\x83\xc2\xb9\xc2\xb2\xc2\xb3"
+    "\xe2\xab\x86\xe2\xaa\xbe\xe2\xab\x98\xe2\x8a\x87\xe2\xab\x84\xe2\x9f\x89\xe2\xab"
+    "\x97\xe2\xa5\xbb\xe2\xab\x82\xe2\xab\x8c\xe2\x8a\x8b\xe2\xab\x80\xe2\x8a\x83\xe2"
+    "\x8a\x87\xe2\xab\x86\xe2\x8a\x8b\xe2\xab\x8c\xe2\xab\x88\xe2\xab\x94\xe2\xab\x96"
+    "\xe2\x87\x99\xe2\xa4\xa6\xe2\x86\x99\xe2\x86\x99\xe2\xa4\xaa\xc3\x9f\xe2\x8c\x96"
+    "\xcf\x84\xe2\x8e\xb4\xc5\xa5\xc5\xa3\xd1\x82\xe2\x83\x9b\xe2\x8c\x95\xf0\x9d\x94"
+    "\xb1\xe2\x88\xb4\xe2\x88\xb4\xce\xb8\xcf\x91\xcf\x91\xe2\x89\x88\xe2\x88\xbc\xe2"
+    "\x80\x89\xe2\x89\x88\xe2\x88\xbc\xc3\xbe\xcb\x9c\xc3\x97\xe2\x8a\xa0\xe2\xa8\xb1"
+    "\xe2\xa8\xb0\xe2\x88\xad\xe2\xa4\xa8\xe2\x8a\xa4\xe2\x8c\xb6\xe2\xab\xb1\xf0\x9d"
+    "\x95\xa5\xe2\xab\x9a\xe2\xa4\xa9\xe2\x80\xb4\xe2\x84\xa2\xe2\x96\xb5\xe2\x96\xbf"
+    "\xe2\x97\x83\xe2\x8a\xb4\xe2\x89\x9c\xe2\x96\xb9\xe2\x8a\xb5\xe2\x97\xac\xe2\x89"
+    "\x9c\xe2\xa8\xba\xe2\xa8\xb9\xe2\xa7\x8d\xe2\xa8\xbb\xe2\x8f\xa2\xf0\x9d\x93\x89"
+    "\xd1\x86\xd1\x9b\xc5\xa7\xe2\x89\xac\xe2\x86\x9e\xe2\x86\xa0\xe2\x87\x91\xe2\xa5"
+    "\xa3\xc3\xba\xe2\x86\x91\xd1\x9e\xc5\xad\xc3\xbb\xd1\x83\xe2\x87\x85\xc5\xb1\xe2"
+    "\xa5\xae\xe2\xa5\xbe\xf0\x9d\x94\xb2\xc3\xb9\xe2\x86\xbf\xe2\x86\xbe\xe2\x96\x80"
+    "\xe2\x8c\x9c\xe2\x8c\x9c\xe2\x8c\x8f\xe2\x97\xb8\xc5\xab\xc2\xa8\xc5\xb3\xf0\x9d"
+    "\x95\xa6\xe2\x86\x91\xe2\x86\x95\xe2\x86\xbf\xe2\x86\xbe\xe2\x8a\x8e\xcf\x85\xcf"
+    "\x92\xcf\x85\xe2\x87\x88\xe2\x8c\x9d\xe2\x8c\x9d\xe2\x8c\x8e\xc5\xaf\xe2\x97\xb9"
+    "\xf0\x9d\x93\x8a\xe2\x8b\xb0\xc5\xa9\xe2\x96\xb5\xe2\x96\xb4\xe2\x87\x88\xc3\xbc"
+    "\xe2\xa6\xa7\xe2\x87\x95\xe2\xab\xa8\xe2\xab\xa9\xe2\x8a\xa8\xe2\xa6\x9c\xcf\xb5"
+    "\xcf\xb0\xe2\x88\x85\xcf\x95\xcf\x96\xe2\x88\x9d\xe2\x86\x95\xcf\xb1\xcf\x82\xe2"
+    "\x8a\x8a\xef\xb8\x80\xe2\xab\x8b\xef\xb8\x80\xe2\x8a\x8b\xef\xb8\x80\xe2\xab\x8c"
+    "\xef\xb8\x80\xcf\x91\xe2\x8a\xb2\xe2\x8a\xb3\xd0\xb2\xe2\x8a\xa2\xe2\x88\xa8\xe2"
+    "\x8a\xbb\xe2\x89\x9a\xe2\x8b\xae||\xf0\x9d\x94\xb3\xe2\x8a\xb2\xe2\x8a\x82\xe2"
+    "\x83\x92\xe2\x8a\x83\xe2\x83\x92\xf0\x9d\x95\xa7\xe2\x88\x9d\xe2\x8a\xb3\xf0\x9d"
+    "\x93\x8b\xe2\xab\x8b\xef\xb8\x80\xe2\x8a\x8a\xef\xb8\x80\xe2\xab\x8c\xef\xb8\x80"
+    "\xe2\x8a\x8b\xef\xb8\x80\xe2\xa6\x9a\xc5\xb5\xe2\xa9\x9f\xe2\x88\xa7\xe2\x89\x99"
+    "\xe2\x84\x98\xf0\x9d\x94\xb4\xe2\x82\xa9\xf0\x9d\x95\xa8\xe2\x84\x98\xe2\x89\x80"
+    "\xe2\x89\x80\xf0\x9d\x93\x8c\xe2\x87\x97\xe2\x86\x97\xe2\x8b\x82\xe2\x97\xaf\xe2"
+    "\x8b\x83\xe2\x96\xbd\xf0\x9d\x94\xb5\xe2\x9f\xba\xe2\x9f\xb7\xce\xbe\xe2\x9f\xb8"
+    "\xe2\x9f\xb5\xe2\x9f\xbc\xe2\x8b\xbb\xe2\xa8\x80\xf0\x9d\x95\xa9\xe2\xa8\x81\xe2"
+    "\xa8\x82\xe2\x9f\xb9\xe2\x9f\xb6\xf0\x9d\x93\x8d\xe2\xa8\x86\xe2\xa8\x84\xe2\x96"
+    "\xb3\xe2\x8b\x81\xe2\x8b\x80\xc3\xbd\xd1\x8f\xc5\xb7\xd1\x8b\xc2\xa5\xf0\x9d\x94"
+    "\xb6\xd1\x97\xf0\x9d\x95\xaa\xf0\x9d\x93\x8e\xd1\x8e\xc3\xbf\xc5\xba\xc5\xbe\xd0"
+    "\xb7\xc5\xbc\xe2\x84\xa8\xce\xb6\xf0\x9d\x94\xb7\xd0\xb6\xe2\x87\x9d\xf0\x9d\x95"
+    "\xab\xf0\x9d\x93\x8f\xe2\x80\x8d\xe2\x80\x8c";
+
+constexpr std::array<EntityRecord, kEntityCount> kEntities = {{
+    {0, 0, 5, 2}, {5, 2, 3, 1}, {8, 3, 6, 2}, {14, 5, 6, 2},
+    {20, 7, 5, 2}, {25, 9, 3, 2}, {28, 11, 3, 4}, {31, 15, 6, 2},
+    {37, 17, 5, 2}, {42, 19, 5, 2}, {47, 21, 3, 3}, {50, 24, 5, 2},
+    {55, 26, 4, 4}, {59, 30, 13, 3}, {72, 33, 5, 2}, {77, 35, 4, 4},
+    {81, 39, 6, 3}, {87, 42, 6, 2}, {93, 44, 4, 2}, {97, 46, 9, 3},
+    {106, 49, 4, 3}, {110, 52, 6, 3}, {116, 55, 3, 2}, {119, 57, 7, 3},
+    {126, 60, 10, 3}, {136, 63, 4, 2}, {140, 65, 3, 4}, {143, 69, 4, 4},
+    {147, 73, 5, 2}, {152, 75, 4, 3}, {156, 78, 6, 3}, {162, 81, 4, 2},
+    {166, 83, 4, 2}, {170, 85, 6, 2}, {176, 87, 3, 3}, {179, 90, 20, 3},
+    {199, 93, 7, 3}, {206, 96, 6, 2}, {212, 98, 6, 2}, {218, 100, 5, 2},
+    {223, 102, 7, 3}, {230, 105, 4, 2}, {234, 107, 7, 2}, {241, 109, 9, 2},
+    {250, 111, 3, 3}, {253, 114, 3, 2}, {256, 116, 9, 3}, {265, 119, 11, 3},
+    {276, 122, 10, 3}, {286, 125, 11, 3}, {297, 128, 24, 3}, {321, 131, 21, 3},
+    {342, 134, 15, 3}, {357, 137, 5, 3}, {362, 140, 6, 3}, {368, 143, 9, 3},
+    {377, 146, 6, 3}, {383, 149, 15, 3}, {398, 152, 4, 3}, {402, 155, 9, 3},
+    {411, 158, 31, 3}, {442, 161, 5, 3}, {447, 164, 4, 4}, {451, 168, 3, 3},
+    {454, 171, 6, 3}, {460, 174, 2, 3}, {462, 177, 8, 3}, {470, 180, 4, 2},
+    {474, 182, 4, 2}, {478, 184, 4, 2}, {482, 186, 6, 3}, {488, 189, 4, 3},
+    {492, 192, 5, 3}, {497, 195, 6, 2}, {503, 197, 3, 2}, {506, 199, 3, 3},
+    {509, 202, 5, 2}, {514, 204, 3, 4}, {517, 208, 16, 2}, {533, 210, 14, 2},
+    {547, 212, 22, 2}, {569, 214, 16, 1}, {585, 215, 16, 2}, {601, 217, 7, 3},
+    {608, 220, 13, 3}, {621, 223, 4, 4}, {625, 227, 3, 2}, {628, 229, 6, 3},
+    {634, 232, 8, 3}, {642, 235, 21, 3}, {663, 238, 9, 2}, {672, 240, 15, 3},
+    {687, 243, 15, 3}, {702, 246, 20, 3}, {722, 249, 13, 3}, {735, 252, 19, 3},
+    {754, 255, 24, 3}, {778, 258, 20, 3}, {798, 261, 16, 3}, {814, 264, 14, 3},
+    {828, 267, 13, 3}, {841, 270, 17, 3}, {858, 273, 17, 3}, {875, 276, 9, 3},
+    {884, 279, 12, 3}, {896, 282, 16, 3}, {912, 285, 9, 2}, {921, 287, 19, 3},
+    {940, 290, 17, 3}, {957, 293, 14, 3}, {971, 296, 17, 3}, {988, 299, 18, 3},
+    {1006, 302, 15, 3}, {1021, 305, 18, 3}, {1039, 308, 7, 3}, {1046, 311, 12, 3},
+    {1058, 314, 9, 3}, {1067, 317, 4, 4}, {1071, 321, 6, 2}, {1077, 323, 3, 2},
+    {1080, 325, 3, 2}, {1083, 327, 6, 2}, {1089, 329, 6, 2}, {1095, 331, 5, 2},
+    {1100, 333, 3, 2}, {1103, 335, 4, 2}, {1107, 337, 3, 4}, {1110, 341, 6, 2},
+    {1116, 343, 7, 3}, {1123, 346, 5, 2}, {1128, 348, 16, 3}, {1144, 351, 20, 3},
+    {1164, 354, 5, 2}, {1169, 356, 4, 4}, {1173, 360, 7, 2}, {1180, 362, 5, 3},
+    {1185, 365, 10, 3}, {1195, 368, 11, 3}, {1206, 371, 4, 3}, {1210, 374, 4, 3},
+    {1214, 377, 3, 2}, {1217, 379, 4, 2}, {1221, 381, 6, 3}, {1227, 384, 12, 3},
+    {1239, 387, 3, 2}, {1242, 389, 3, 4}, {1245, 393, 17, 3}, {1262, 396, 21, 3},
+    {1283, 399, 4, 4}, {1287, 403, 6, 3}, {1293, 406, 10, 3}, {1303, 409, 4, 3},
+    {1307, 412, 4, 2}, {1311, 414, 2, 1}, {1313, 415, 5, 2}, {1318, 417, 6, 2},
+    {1324, 419, 6, 2}, {1330, 421, 6, 2}, {1336, 423, 5, 2}, {1341, 425, 3, 2},
+    {1344, 427, 4, 2}, {1348, 429, 3, 4}, {1351, 433, 2, 3}, {1353, 436, 4, 4},
+    {1357, 440, 12, 3}, {1369, 443, 16, 3}, {1385, 446, 16, 3}, {1401, 449, 14, 3},
+    {1415, 452, 11, 3}, {1426, 455, 17, 3}, {1443, 458, 12, 3}, {1455, 461, 4, 4},
+    {1459, 465, 2, 3}, {1461, 468, 6, 2}, {1467, 470, 5, 2}, {1472, 472, 3, 1},
+    {1475, 473, 5, 2}, {1480, 475, 3, 3}, {1483, 478, 12, 3}, {1495, 481, 4, 3},
+    {1499, 484, 14, 3}, {1513, 487, 4, 3}, {1517, 490, 6, 2}, {1523, 492, 12, 3},
+    {1535, 495, 9, 3}, {1544, 498, 4, 2}, {1548, 500, 5, 2}, {1553, 502, 4, 2},
+    {1557, 504, 6, 2}, {1563, 506, 5, 2}, {1568, 508, 3, 2}, {1571, 510, 4, 2},
+    {1575, 512, 3, 3}, {1578, 515, 6, 2}, {1584, 517, 2, 3}, {1586, 520, 5, 2},
+    {1591, 522, 10, 3}, {1601, 525, 7, 3}, {1608, 528, 3, 3}, {1611, 531, 8, 3},
+    {1619, 534, 12, 3}, {1631, 537, 14, 3}, {1645, 540, 14, 3}, {1659, 543, 5, 2},
+    {1664, 545, 4, 4}, {1668, 549, 4, 2}, {1672, 551, 4, 3}, {1676, 554, 6, 2},
+    {1682, 556, 5, 2}, {1687, 558, 4, 2}, {1691, 560, 5, 2}, {1696, 562, 3, 2},
+    {1699, 564, 3, 4}, {1702, 568, 4, 4}, {1706, 572, 4, 4}, {1710, 576, 6, 2},
+    {1716, 578, 5, 2}, {1721, 580, 4, 2}, {1725, 582, 4, 2}, {1729, 584, 5, 2},
+    {1734, 586, 6, 2}, {1740, 588, 3, 2}, {1743, 590, 3, 4}, {1746, 594, 4, 4},
+    {1750, 598, 4, 4}, {1754, 602, 4, 2}, {1758, 604, 2, 1}, {1760, 605, 6, 2},
+    {1766, 607, 6, 2}, {1772, 609, 4, 3}, {1776, 612, 10, 3}, {1786, 615, 4, 3},
+    {1790, 618, 6, 2}, {1796, 620, 6, 2}, {1802, 622, 3, 2}, {1805, 624, 16, 3},
+    {1821, 627, 9, 3}, {1830, 630, 12, 3}, {1842, 633, 19, 3}, {1861, 636, 11, 3},
+    {1872, 639, 17, 3}, {1889, 642, 17, 3}, {1906, 645, 14, 3}, {1920, 648, 17, 3},
+    {1937, 651, 9, 3}, {1946, 654, 14, 3}, {1960, 657, 15, 3}, {1975, 660, 7, 3},
+    {1982, 663, 12, 3}, {1994, 666, 13, 3}, {2007, 669, 12, 3}, {2019, 672, 15, 3},
+    {2034, 675, 17, 3}, {2051, 678, 16, 3}, {2067, 681, 15, 3}, {2082, 684, 12, 3},
+    {2094, 687, 15, 3}, {2109, 690, 10, 3}, {2119, 693, 13, 3}, {2132, 696, 9, 3},
+    {2141, 699, 14, 3}, {2155, 702, 16, 3}, {2171, 705, 13, 3}, {2184, 708, 11, 3},
+    {2195, 711, 8, 3}, {2203, 714, 14, 3}, {2217, 717, 9, 3}, {2226, 720, 3, 4},
+    {2229, 724, 2, 3}, {2231, 727, 10, 3}, {2241, 730, 6, 2}, {2247, 732, 13, 3},
+    {2260, 735, 18, 3}, {2278, 738, 14, 3}, {2292, 741, 13, 3}, {2305, 744, 18, 3},
+    {2323, 747, 14, 3}, {2337, 750, 4, 4}, {2341, 754, 14, 3}, {2355, 757, 15, 3},
+    {2370, 760, 4, 3}, {2374, 763, 3, 3}, {2377, 766, 6, 2}, {2383, 768, 2, 3},
+    {2385, 771, 3, 3}, {2388, 774, 3, 2}, {2391, 776, 11, 3}, {2402, 779, 9, 3},
+    {2411, 782, 3, 4}, {2414, 786, 9, 3}, {2423, 789, 4, 4}, {2427, 793, 4, 3},
+    {2431, 796, 2, 2}, {2433, 798, 4, 2}, {2437, 800, 6, 2}, {2443, 802, 6, 2},
+    {2449, 804, 6, 2}, {2455, 806, 3, 2}, {2458, 808, 19, 3}, {2477, 811, 18, 3},
+    {2495, 814, 17, 3}, {2512, 817, 21, 3}, {2533, 820, 20, 3}, {2553, 823, 14, 3},
+    {2567, 826, 7, 1}, {2574, 827, 3, 4}, {2577, 831, 7, 3}, {2584, 834, 16, 2},
+    {2600, 836, 4, 3}, {2604, 839, 3, 3}, {2607, 842, 12, 3}, {2619, 845, 9, 3},
+    {2628, 848, 20, 3}, {2648, 851, 10, 3}, {2658, 854, 8, 3}, {2666, 857, 13, 5},
+    {2679, 862, 9, 3}, {2688, 865, 10, 3}, {2698, 868, 15, 3}, {2713, 871, 19, 5},
+    {2732, 876, 17, 5}, {2749, 881, 14, 3}, {2763, 884, 20, 5}, {2783, 889, 15, 3},
+    {2798, 892, 15, 5}, {2813, 897, 12, 5}, {2825, 902, 15, 3}, {2840, 905, 18, 5},
+    {2858, 910, 20, 3}, {2878, 913, 7, 3}, {2885, 916, 12, 3}, {2897, 919, 14, 3},
+    {2911, 922, 11, 5}, {2922, 927, 17, 5}, {2939, 932, 12, 3}, {2951, 935, 23, 5},
+    {2974, 940, 17, 5}, {2991, 945, 11, 3}, {3002, 948, 16, 5}, {3018, 953, 21, 3},
+    {3039, 956, 17, 3}, {3056, 959, 16, 3}, {3072, 962, 19, 5}, {3091, 967, 21, 3},
+    {3112, 970, 15, 5}, {3127, 975, 20, 3}, {3147, 978, 17, 5}, {3164, 983, 22, 3},
+    {3186, 986, 9, 6}, {3195, 992, 14, 3}, {3209, 995, 11, 3}, {3220, 998, 16, 5},
+    {3236, 1003, 21, 3}, {3257, 1006, 16, 5}, {3273, 1011, 11, 6}, {3284, 1017, 16, 3},
+    {3300, 1020, 8, 3}, {3308, 1023, 13, 3}, {3321, 1026, 17, 3}, {3338, 1029, 13, 3},
+    {3351, 1032, 14, 3}, {3365, 1035, 4, 4}, {3369, 1039, 6, 2}, {3375, 1041, 2, 2},
+    {3377, 1043, 5, 2}, {3382, 1045, 6, 2}, {3388, 1047, 5, 2}, {3393, 1049, 3, 2},
+    {3396, 1051, 6, 2}, {3402, 1053, 3, 4}, {3405, 1057, 6, 2}, {3411, 1059, 5, 2},
+    {3416, 1061, 5, 2}, {3421, 1063, 7, 2}, {3428, 1065, 4, 4}, {3432, 1069, 20, 3},
+    {3452, 1072, 14, 3}, {3466, 1075, 2, 3}, {3468, 1078, 4, 4}, {3472, 1082, 6, 2},
+    {3478, 1084, 6, 2}, {3484, 1086, 6, 3}, {3490, 1089, 4, 2}, {3494, 1091, 7, 3},
+    {3501, 1094, 9, 3}, {3510, 1097, 11, 3}, {3521, 1100, 15, 3}, {3536, 1103, 8, 3},
+    {3544, 1106, 3, 2}, {3547, 1108, 3, 4}, {3550, 1112, 3, 2}, {3553, 1114, 2, 2},
+    {3555, 1116, 9, 2}, {3564, 1118, 13, 3}, {3577, 1121, 4, 3}, {3581, 1124, 2, 3},
+    {3583, 1127, 8, 3}, {3591, 1130, 13, 3}, {3604, 1133, 18, 3}, {3622, 1136, 13, 3},
+    {3635, 1139, 5, 3}, {3640, 1142, 7, 3}, {3647, 1145, 10, 3}, {3657, 1148, 12, 3},
+    {3669, 1151, 4, 4}, {3673, 1155, 3, 2}, {3676, 1157, 4, 1}, {3680, 1158, 3, 4},
+    {3683, 1162, 4, 3}, {3687, 1165, 4, 4}, {3691, 1169, 5, 3}, {3696, 1172, 3, 2},
+    {3699, 1174, 6, 2}, {3705, 1176, 4, 3}, {3709, 1179, 4, 3}, {3713, 1182, 6, 3},
+    {3719, 1185, 6, 2}, {3725, 1187, 6, 2}, {3731, 1189, 3, 2}, {3734, 1191, 2, 3},
+    {3736, 1194, 14, 3}, {3750, 1197, 18, 3}, {3768, 1200, 20, 3}, {3788, 1203, 3, 3},
+    {3791, 1206, 3, 2}, {3794, 1208, 17, 3}, {3811, 1211, 10, 3}, {3821, 1214, 13, 3},
+    {3834, 1217, 19, 3}, {3853, 1220, 12, 3}, {3865, 1223, 18, 3}, {3883, 1226, 18, 3},
+    {3901, 1229, 15, 3}, {3916, 1232, 18, 3}, {3934, 1235, 10, 3}, {3944, 1238, 8, 3},
+    {3952, 1241, 13, 3}, {3965, 1244, 14, 3}, {3979, 1247, 13, 3}, {3992, 1250, 16, 3},
+    {4008, 1253, 18, 3}, {4026, 1256, 17, 3}, {4043, 1259, 16, 3}, {4059, 1262, 13, 3},
+    {4072, 1265, 16, 3}, {4088, 1268, 11, 3}, {4099, 1271, 14, 3}, {4113, 1274, 10, 3},
+    {4123, 1277, 4, 3}, {4127, 1280, 12, 3}, {4139, 1283, 11, 3}, {4150, 1286, 4, 3},
+    {4154, 1289, 3, 3}, {4157, 1292, 11, 3}, {4168, 1295, 6, 2}, {4174, 1297, 4, 2},
+    {4178, 1299, 6, 2}, {4184, 1301, 6, 2}, {4190, 1303, 2, 3}, {4192, 1306, 6, 2},
+    {4198, 1308, 6, 2}, {4204, 1310, 5, 2}, {4209, 1312, 3, 2}, {4212, 1314, 3, 4},
+    {4215, 1318, 14, 3}, {4229, 1321, 14, 3}, {4243, 1324, 15, 3}, {4258, 1327, 12, 3},
+    {4270, 1330, 5, 2}, {4275, 1332, 11, 3}, {4286, 1335, 4, 4}, {4290, 1339, 4, 3},
+    {4294, 1342, 6, 3}, {4300, 1345, 18, 3}, {4318, 1348, 12, 3}, {4330, 1351, 17, 3},
+    {4347, 1354, 14, 3}, {4361, 1357, 19, 3}, {4380, 1360, 11, 3}, {4391, 1363, 4, 4},
+    {4395, 1367, 4, 3}, {4399, 1370, 3, 3}, {4402, 1373, 6, 3}, {4408, 1376, 11, 3},
+    {4419, 1379, 8, 3}, {4427, 1382, 13, 3}, {4440, 1385, 18, 3}, {4458, 1388, 13, 3},
+    {4471, 1391, 8, 3}, {4479, 1394, 3, 3}, {4482, 1397, 3, 3}, {4485, 1400, 8, 3},
+    {4493, 1403, 13, 3}, {4506, 1406, 6, 3}, {4512, 1409, 5, 2}, {4517, 1411, 5, 3},
+    {4522, 1414, 5, 2}, {4527, 1416, 4, 2}, {4531, 1418, 3, 1}, {4534, 1419, 3, 2},
+    {4537, 1421, 6, 2}, {4543, 1423, 6, 2}, {4549, 1425, 3, 2}, {4552, 1427, 3, 4},
+    {4555, 1431, 9, 3}, {4564, 1434, 5, 2}, {4569, 1436, 10, 6}, {4579, 1442, 9, 3},
+    {4588, 1445, 5, 3}, {4593, 1448, 10, 3}, {4603, 1451, 14, 3}, {4617, 1454, 10, 3},
+    {4627, 1457, 4, 4}, {4631, 1461, 9, 3}, {4640, 1464, 4, 4}, {4644, 1468, 6, 2},
+    {4650, 1470, 6, 2}, {4656, 1472, 4, 3}, {4660, 1475, 8, 3}, {4668, 1478, 5, 2},
+    {4673, 1480, 6, 2}, {4679, 1482, 5, 2}, {4684, 1484, 3, 2}, {4687, 1486, 6, 2},
+    {4693, 1488, 3, 4}, {4696, 1492, 6, 2}, {4702, 1494, 5, 2}, {4707, 1496, 8, 1},
+    {4715, 1497, 10, 3}, {4725, 1500, 12, 3}, {4737, 1503, 16, 3}, {4753, 1506, 5, 3},
+    {4758, 1509, 9, 3}, {4767, 1512, 5, 2}, {4772, 1514, 4, 4}, {4776, 1518, 7, 3},
+    {4783, 1521, 10, 3}, {4793, 1524, 16, 3}, {4809, 1527, 11, 3}, {4820, 1530, 13, 3},
+    {4833, 1533, 5, 3}, {4838, 1536, 10, 3}, {4848, 1539, 7, 3}, {4855, 1542, 11, 3},
+    {4866, 1545, 14, 3}, {4880, 1548, 15, 3}, {4895, 1551, 4, 2}, {4899, 1553, 7, 2},
+    {4906, 1555, 5, 2}, {4911, 1557, 4, 4}, {4915, 1561, 6, 2}, {4921, 1563, 4, 2},
+    {4925, 1565, 5, 3}, {4930, 1568, 4, 3}, {4934, 1571, 3, 2}, {4937, 1573, 5, 3},
+    {4942, 1576, 6, 3}, {4948, 1579, 3, 3}, {4951, 1582, 6, 3}, {4957, 1585, 4, 3},
+    {4961, 1588, 11, 3}, {4972, 1591, 12, 1}, {4984, 1592, 17, 3}, {5001, 1595, 13, 3},
+    {5014, 1598, 13, 3}, {5027, 1601, 3, 4}, {5030, 1605, 4, 4}, {5034, 1609, 4, 4},
+    {5038, 1613, 6, 3}, {5044, 1616, 5, 2}, {5049, 1618, 5, 3}, {5054, 1621, 3, 4},
+    {5057, 1625, 4, 4}, {5061, 1629, 4, 4}, {5065, 1633, 3, 4}, {5068, 1637, 2, 2},
+    {5070, 1639, 4, 4}, {5074, 1643, 4, 4}, {5078, 1647, 4, 2}, {5082, 1649, 4, 2},
+    {5086, 1651, 4, 2}, {5090, 1653, 6, 2}, {5096, 1655, 5, 2}, {5101, 1657, 3, 2},
+    {5104, 1659, 3, 4}, {5107, 1663, 4, 4}, {5111, 1667, 4, 4}, {5115, 1671, 4, 2},
+    {5119, 1673, 4, 2}, {5123, 1675, 6, 2}, {5129, 1677, 6, 2}, {5135, 1679, 3, 2},
+    {5138, 1681, 4, 2}, {5142, 1683, 14, 3}, {5156, 1686, 4, 2}, {5160, 1688, 3, 3},
+    {5163, 1691, 4, 3}, {5167, 1694, 4, 4}, {5171, 1698, 6, 2}, {5177, 1700, 6, 2},
+    {5183, 1702, 2, 3}, {5185, 1705, 3, 5}, {5188, 1710, 3, 3}, {5191, 1713, 5, 2},
+    {5196, 1715, 5, 2}, {5201, 1717, 3, 2}, {5204, 1719, 5, 2}, {5209, 1721, 2, 3},
+    {5211, 1724, 3, 4}, {5214, 1728, 6, 2}, {5220, 1730, 7, 3}, {5227, 1733, 5, 3},
+    {5232, 1736, 5, 2}, {5237, 1738, 5, 2}, {5242, 1740, 5, 3}, {5247, 1743, 3, 1},
+    {5250, 1744, 3, 3}, {5253, 1747, 6, 3}, {5259, 1750, 4, 3}, {5263, 1753, 8, 3},
+    {5271, 1756, 4, 3}, {5275, 1759, 3, 3}, {5278, 1762, 4, 3}, {5282, 1765, 5, 3},
+    {5287, 1768, 6, 3}, {5293, 1771, 8, 3}, {5301, 1774, 8, 3}, {5309, 1777, 8, 3},
+    {5317, 1780, 8, 3}, {5325, 1783, 8, 3}, {5333, 1786, 8, 3}, {5341, 1789, 8, 3},
+    {5349, 1792, 8, 3}, {5357, 1795, 5, 3}, {5362, 1798, 7, 3}, {5369, 1801, 8, 3},
+    {5377, 1804, 6, 3}, {5383, 1807, 5, 2}, {5388, 1809, 7, 3}, {5395, 1812, 5, 2},
+    {5400, 1814, 4, 4}, {5404, 1818, 2, 3}, {5406, 1821, 3, 3}, {5409, 1824, 6, 3},
+    {5415, 1827, 3, 3}, {5418, 1830, 4, 3}, {5422, 1833, 4, 1}, {5426, 1834, 6, 3},
+    {5432, 1837, 8, 3}, {5440, 1840, 5, 2}, {5445, 1842, 4, 4}, {5449, 1846, 3, 1},
+    {5452, 1847, 5, 3}, {5457, 1850, 7, 3}, {5464, 1853, 6, 2}, {5470, 1855, 4, 2},
+    {5474, 1857, 8, 3}, {5482, 1860, 5, 3}, {5487, 1863, 4, 3}, {5491, 1866, 8, 3},
+    {5499, 1869, 11, 2}, {5510, 1871, 9, 3}, {5519, 1874, 7, 3}, {5526, 1877, 9, 3},
+    {5535, 1880, 6, 3}, {5541, 1883, 6, 3}, {5547, 1886, 8, 3}, {5555, 1889, 4, 3},
+    {5559, 1892, 8, 3}, {5567, 1895, 5, 3}, {5572, 1898, 3, 2}, {5575, 1900, 5, 3},
+    {5580, 1903, 6, 3}, {5586, 1906, 7, 3}, {5593, 1909, 7, 3}, {5600, 1912, 5, 2},
+    {5605, 1914, 6, 3}, {5611, 1917, 4, 2}, {5615, 1919, 4, 3}, {5619, 1922, 7, 3},
+    {5626, 1925, 3, 4}, {5629, 1929, 6, 3}, {5635, 1932, 7, 3}, {5642, 1935, 6, 3},
+    {5648, 1938, 7, 3}, {5655, 1941, 8, 3}, {5663, 1944, 9, 3}, {5672, 1947, 8, 3},
+    {5680, 1950, 7, 3}, {5687, 1953, 15, 3}, {5702, 1956, 13, 3}, {5715, 1959, 8, 3},
+    {5723, 1962, 6, 3}, {5729, 1965, 8, 3}, {5737, 1968, 6, 3}, {5743, 1971, 12, 3},
+    {5755, 1974, 11, 3}, {5766, 1977, 13, 3}, {5779, 1980, 17, 3}, {5796, 1983, 17, 3},
+    {5813, 1986, 18, 3}, {5831, 1989, 5, 3}, {5836, 1992, 5, 3}, {5841, 1995, 5, 3},
+    {5846, 1998, 5, 3}, {5851, 2001, 5, 3}, {5856, 2004, 3, 4}, {5859, 2008, 7, 6},
+    {5866, 2014, 4, 3}, {5870, 2017, 4, 4}, {5874, 2021, 3, 3}, {5877, 2024, 6, 3},
+    {5883, 2027, 6, 3}, {5889, 2030, 5, 3}, {5894, 2033, 5, 3}, {5899, 2036, 5, 3},
+    {5904, 2039, 5, 3}, {5909, 2042, 4, 3}, {5913, 2045, 5, 3}, {5918, 2048, 5, 3},
+    {5923, 2051, 5, 3}, {5928, 2054, 5, 3}, {5933, 2057, 5, 3}, {5938, 2060, 5, 3},
+    {5943, 2063, 5, 3}, {5948, 2066, 5, 3}, {5953, 2069, 4, 3}, {5957, 2072, 5, 3},
+    {5962, 2075, 5, 3}, {5967, 2078, 5, 3}, {5972, 2081, 5, 3}, {5977, 2084, 5, 3},
+    {5982, 2087, 5, 3}, {5987, 2090, 6, 3}, {5993, 2093, 5, 3}, {5998, 2096, 5, 3},
+    {6003, 2099, 5, 3}, {6008, 2102, 5, 3}, {6013, 2105, 4, 3}, {6017, 2108, 5, 3},
+    {6022, 2111, 5, 3}, {6027, 2114, 5, 3}, {6032, 2117, 5, 3}, {6037, 2120, 8, 3},
+    {6045, 2123, 7, 3}, {6052, 2126, 8, 3}, {6060, 2129, 5, 3}, {6065, 2132, 5, 3},
+    {6070, 2135, 5, 3}, {6075, 2138, 5, 3}, {6080, 2141, 4, 3}, {6084, 2144, 5, 3},
+    {6089, 2147, 5, 3}, {6094, 2150, 5, 3}, {6099, 2153, 5, 3}, {6104, 2156, 5, 3},
+    {6109, 2159, 5, 3}, {6114, 2162, 6, 3}, {6120, 2165, 5, 2}, {6125, 2167, 6, 2},
+    {6131, 2169, 4, 4}, {6135, 2173, 5, 3}, {6140, 2176, 4, 3}, {6144, 2179, 5, 3},
+    {6149, 2182, 4, 1}, {6153, 2183, 5, 3}, {6158, 2186, 8, 3}, {6166, 2189, 4, 3},
+    {6170, 2192, 6, 3}, {6176, 2195, 4, 3}, {6180, 2198, 5, 3}, {6185, 2201, 5, 3},
+    {6190, 2204, 6, 3}, {6196, 2207, 6, 2}, {6202, 2209, 3, 3}, {6205, 2212, 6, 3},
+    {6211, 2215, 8, 3}, {6219, 2218, 6, 3}, {6225, 2221, 6, 3}, {6231, 2224, 6, 3},
+    {6237, 2227, 4, 6}, {6241, 2233, 5, 3}, {6246, 2236, 5, 2}, {6251, 2238, 5, 3},
+    {6256, 2241, 6, 2}, {6262, 2243, 6, 2}, {6268, 2245, 5, 2}, {6273, 2247, 5, 3},
+    {6278, 2250, 7, 3}, {6285, 2253, 4, 2}, {6289, 2255, 5, 2}, {6294, 2257, 7, 3},
+    {6301, 2260, 4, 2}, {6305, 2262, 9, 2}, {6314, 2264, 3, 4}, {6317, 2268, 4, 2},
+    {6321, 2270, 5, 3}, {6326, 2273, 9, 3}, {6335, 2276, 3, 2}, {6338, 2278, 3, 3},
+    {6341, 2281, 4, 3}, {6345, 2284, 4, 2}, {6349, 2286, 6, 3}, {6355, 2289, 15, 3},
+    {6370, 2292, 16, 3}, {6386, 2295, 8, 2}, {6394, 2297, 8, 3}, {6402, 2300, 10, 3},
+    {6412, 2303, 11, 3}, {6423, 2306, 11, 3}, {6434, 2309, 4, 3}, {6438, 2312, 8, 3},
+    {6446, 2315, 6, 3}, {6452, 2318, 7, 3}, {6459, 2321, 5, 3}, {6464, 2324, 8, 3},
+    {6472, 2327, 5, 1}, {6477, 2328, 6, 3}, {6483, 2331, 7, 3}, {6490, 2334, 5, 1},
+    {6495, 2335, 6, 1}, {6501, 2336, 4, 3}, {6505, 2339, 6, 3}, {6511, 2342, 10, 3},
+    {6521, 2345, 9, 3}, {6530, 2348, 4, 3}, {6534, 2351, 7, 3}, {6541, 2354, 6, 3},
+    {6547, 2357, 4, 4}, {6551, 2361, 6, 3}, {6557, 2364, 4, 2}, {6561, 2366, 6, 3},
+    {6567, 2369, 5, 3}, {6572, 2372, 5, 3}, {6577, 2375, 4, 4}, {6581, 2379, 4, 3},
+    {6585, 2382, 5, 3}, {6590, 2385, 4, 3}, {6594, 2388, 5, 3}, {6599, 2391, 5, 3},
+    {6604, 2394, 7, 3}, {6611, 2397, 7, 3}, {6618, 2400, 5, 3}, {6623, 2403, 5, 3},
+    {6628, 2406, 6, 3}, {6634, 2409, 7, 3}, {6641, 2412, 3, 3}, {6644, 2415, 8, 3},
+    {6652, 2418, 6, 3}, {6658, 2421, 6, 3}, {6664, 2424, 6, 3}, {6670, 2427, 5, 3},
+    {6675, 2430, 4, 6}, {6679, 2436, 6, 3}, {6685, 2439, 7, 3}, {6692, 2442, 11, 3},
+    {6703, 2445, 11, 3}, {6714, 2448, 8, 3}, {6722, 2451, 10, 3}, {6732, 2454, 6, 2},
+    {6738, 2456, 14, 3}, {6752, 2459, 15, 3}, {6767, 2462, 5, 3}, {6772, 2465, 5, 3},
+    {6777, 2468, 8, 3}, {6785, 2471, 5, 3}, {6790, 2474, 6, 3}, {6796, 2477, 4, 3},
+    {6800, 2480, 4, 3}, {6804, 2483, 6, 3}, {6810, 2486, 6, 3}, {6816, 2489, 4, 3},
+    {6820, 2492, 4, 3}, {6824, 2495, 5, 3}, {6829, 2498, 7, 3}, {6836, 2501, 5, 2},
+    {6841, 2503, 6, 2}, {6847, 2505, 3, 2}, {6850, 2507, 2, 3}, {6852, 2510, 7, 3},
+    {6859, 2513, 5, 3}, {6864, 2516, 7, 3}, {6871, 2519, 3, 2}, {6874, 2521, 5, 2},
+    {6879, 2523, 7, 3}, {6886, 2526, 6, 3}, {6892, 2529, 3, 4}, {6895, 2533, 5, 3},
+    {6900, 2536, 5, 3}, {6905, 2539, 4, 3}, {6909, 2542, 7, 3}, {6916, 2545, 11, 3},
+    {6927, 2548, 5, 3}, {6932, 2551, 3, 2}, {6935, 2553, 7, 2}, {6942, 2555, 5, 3},
+    {6947, 2558, 3, 2}, {6950, 2560, 6, 2}, {6956, 2562, 13, 3}, {6969, 2565, 6, 3},
+    {6975, 2568, 4, 2}, {6979, 2570, 6, 3}, {6985, 2573, 6, 3}, {6991, 2576, 6, 1},
+    {6997, 2577, 4, 4}, {7001, 2581, 3, 2}, {7004, 2583, 5, 3}, {7009, 2586, 8, 3},
+    {7017, 2589, 8, 3}, {7025, 2592, 7, 3}, {7032, 2595, 9, 3}, {7041, 2598, 14, 3},
+    {7055, 2601, 9, 3}, {7064, 2604, 14, 3}, {7078, 2607, 15, 3}, {7093, 2610, 16, 3},
+    {7109, 2613, 8, 3}, {7117, 2616, 6, 3}, {7123, 2619, 6, 3}, {7129, 2622, 4, 4},
+    {7133, 2626, 4, 2}, {7137, 2628, 4, 3}, {7141, 2631, 6, 2}, {7147, 2633, 5, 3},
+    {7152, 2636, 4, 3}, {7156, 2639, 5, 3}, {7161, 2642, 5, 3}, {7166, 2645, 5, 3},
+    {7171, 2648, 7, 3}, {7178, 2651, 4, 2}, {7182, 2653, 8, 3}, {7190, 2656, 5, 3},
+    {7195, 2659, 4, 3}, {7199, 2662, 6, 2}, {7205, 2664, 6, 3}, {7211, 2667, 6, 2},
+    {7217, 2669, 4, 3}, {7221, 2672, 5, 2}, {7226, 2674, 6, 3}, {7232, 2677, 3, 2},
+    {7235, 2679, 4, 2}, {7239, 2681, 2, 3}, {7241, 2684, 5, 3}, {7246, 2687, 3, 4},
+    {7249, 2691, 2, 3}, {7251, 2694, 6, 2}, {7257, 2696, 3, 3}, {7260, 2699, 6, 3},
+    {7266, 2702, 2, 3}, {7268, 2705, 8, 3}, {7276, 2708, 3, 3}, {7279, 2711, 3, 3},
+    {7282, 2714, 6, 3}, {7288, 2717, 5, 2}, {7293, 2719, 5, 3}, {7298, 2722, 8, 3},
+    {7306, 2725, 6, 3}, {7312, 2728, 4, 3}, {7316, 2731, 6, 3}, {7322, 2734, 6, 3},
+    {7328, 2737, 3, 2}, {7331, 2739, 4, 3}, {7335, 2742, 5, 2}, {7340, 2744, 4, 4},
+    {7344, 2748, 4, 3}, {7348, 2751, 6, 3}, {7354, 2754, 5, 3}, {7359, 2757, 4, 2},
+    {7363, 2759, 7, 2}, {7370, 2761, 5, 2}, {7375, 2763, 6, 3}, {7381, 2766, 7, 3},
+    {7388, 2769, 5, 3}, {7393, 2772, 10, 3}, {7403, 2775, 11, 3}, {7414, 2778, 6, 1},
+    {7420, 2779, 6, 3}, {7426, 2782, 5, 3}, {7431, 2785, 7, 3}, {7438, 2788, 8, 3},
+    {7446, 2791, 5, 3}, {7451, 2794, 5, 3}, {7456, 2797, 4, 3}, {7460, 2800, 5, 3},
+    {7465, 2803, 4, 3}, {7469, 2806, 3, 2}, {7472, 2808, 3, 2}, {7475, 2810, 4, 2},
+    {7479, 2812, 4, 3}, {7483, 2815, 4, 1}, {7487, 2816, 5, 3}, {7492, 2819, 11, 3},
+    {7503, 2822, 12, 3}, {7515, 2825, 13, 3}, {7528, 2828, 3, 2}, {7531, 2830, 6, 3},
+    {7537, 2833, 6, 3}, {7543, 2836, 5, 3}, {7548, 2839, 6, 3}, {7554, 2842, 3, 4},
+    {7557, 2846, 5, 3}, {7562, 2849, 5, 2}, {7567, 2851, 4, 3}, {7571, 2854, 5, 3},
+    {7576, 2857, 5, 3}, {7581, 2860, 4, 2}, {7585, 2862, 4, 4}, {7589, 2866, 6, 3},
+    {7595, 2869, 4, 3}, {7599, 2872, 5, 3}, {7604, 2875, 8, 3}, {7612, 2878, 6, 2},
+    {7618, 2880, 6, 3}, {7624, 2883, 6, 2}, {7630, 2885, 6, 3}, {7636, 2888, 6, 3},
+    {7642, 2891, 6, 3}, {7648, 2894, 6, 3}, {7654, 2897, 6, 3}, {7660, 2900, 6, 2},
+    {7666, 2902, 6, 3}, {7672, 2905, 6, 3}, {7678, 2908, 6, 3}, {7684, 2911, 6, 3},
+    {7690, 2914, 6, 3}, {7696, 2917, 6, 3}, {7702, 2920, 5, 3}, {7707, 2923, 5, 3},
+    {7712, 2926, 4, 4}, {7716, 2930, 2, 3}, {7718, 2933, 3, 3}, {7721, 2936, 6, 2},
+    {7727, 2938, 5, 2}, {7732, 2940, 6, 2}, {7738, 2942, 3, 3}, {7741, 2945, 6, 2},
+    {7747, 2947, 5, 2}, {7752, 2949, 3, 2}, {7755, 2951, 4, 2}, {7759, 2953, 2, 3},
+    {7761, 2956, 3, 3}, {7764, 2959, 3, 3}, {7767, 2962, 4, 3}, {7771, 2965, 8, 3},
+    {7779, 2968, 3, 3}, {7782, 2971, 5, 3}, {7787, 2974, 6, 3}, {7793, 2977, 7, 3},
+    {7800, 2980, 8, 3}, {7808, 2983, 4, 6}, {7812, 2989, 6, 3}, {7818, 2992, 3, 4},
+    {7821, 2996, 2, 3}, {7823, 2999, 3, 3}, {7826, 3002, 5, 3}, {7831, 3005, 4, 2},
+    {7835, 3007, 2, 3}, {7837, 3010, 3, 3}, {7840, 3013, 3, 3}, {7843, 3016, 3, 3},
+    {7846, 3019, 3, 3}, {7849, 3022, 4, 3}, {7853, 3025, 8, 3}, {7861, 3028, 3, 3},
+    {7864, 3031, 4, 3}, {7868, 3034, 5, 3}, {7873, 3037, 5, 3}, {7878, 3040, 4, 4},
+    {7882, 3044, 5, 1}, {7887, 3045, 4, 3}, {7891, 3048, 4, 3}, {7895, 3051, 5, 3},
+    {7900, 3054, 5, 3}, {7905, 3057, 2, 1}, {7907, 3058, 4, 3}, {7911, 3061, 5, 3},
+    {7916, 3064, 5, 3}, {7921, 3067, 6, 3}, {7927, 3070, 7, 3}, {7934, 3073, 9, 3},
+    {7943, 3076, 6, 3}, {7949, 3079, 6, 3}, {7955, 3082, 9, 3}, {7964, 3085, 10, 3},
+    {7974, 3088, 7, 3}, {7981, 3091, 6, 3}, {7987, 3094, 9, 6}, {7996, 3100, 4, 6},
+    {8000, 3106, 4, 3}, {8004, 3109, 6, 3}, {8010, 3112, 4, 2}, {8014, 3114, 6, 3},
+    {8020, 3117, 6, 2}, {8026, 3119, 4, 3}, {8030, 3122, 7, 3}, {8037, 3125, 5, 3},
+    {8042, 3128, 4, 3}, {8046, 3131, 5, 2}, {8051, 3133, 6, 3}, {8057, 3136, 9, 3},
+    {8066, 3139, 6, 3}, {8072, 3142, 6, 3}, {8078, 3145, 3, 4}, {8081, 3149, 8, 3},
+    {8089, 3152, 8, 3}, {8097, 3155, 5, 3}, {8102, 3158, 6, 3}, {8108, 3161, 13, 3},
+    {8121, 3164, 14, 3}, {8135, 3167, 4, 4}, {8139, 3171, 6, 3}, {8145, 3174, 4, 4},
+    {8149, 3178, 6, 3}, {8155, 3181, 6, 2}, {8161, 3183, 6, 3}, {8167, 3186, 6, 3},
+    {8173, 3189, 6, 2}, {8179, 3191, 2, 3}, {8181, 3194, 5, 2}, {8186, 3196, 3, 2},
+    {8189, 3198, 4, 2}, {8193, 3200, 5, 2}, {8198, 3202, 3, 3}, {8201, 3205, 3, 4},
+    {8204, 3209, 6, 2}, {8210, 3211, 2, 3}, {8212, 3214, 6, 3}, {8218, 3217, 5, 3},
+    {8223, 3220, 6, 3}, {8229, 3223, 5, 3}, {8234, 3226, 5, 2}, {8239, 3228, 5, 2},
+    {8244, 3230, 5, 3}, {8249, 3233, 8, 3}, {8257, 3236, 8, 3}, {8265, 3239, 5, 2},
+    {8270, 3241, 4, 3}, {8274, 3244, 5, 2}, {8279, 3246, 2, 3}, {8281, 3249, 6, 3},
+    {8287, 3252, 5, 3}, {8292, 3255, 8, 3}, {8300, 3258, 6, 2}, {8306, 3260, 3, 3},
+    {8309, 3263, 6, 3}, {8315, 3266, 8, 3}, {8323, 3269, 8, 3}, {8331, 3272, 8, 3},
+    {8339, 3275, 7, 3}, {8346, 3278, 4, 2}, {8350, 3280, 5, 2}, {8355, 3282, 4, 4},
+    {8359, 3286, 4, 2}, {8363, 3288, 5, 3}, {8368, 3291, 6, 2}, {8374, 3293, 4, 4},
+    {8378, 3297, 4, 3}, {8382, 3300, 5, 3}, {8387, 3303, 7, 3}, {8394, 3306, 5, 3},
+    {8399, 3309, 6, 3}, {8405, 3312, 5, 3}, {8410, 3315, 2, 3}, {8412, 3318, 6, 2},
+    {8418, 3320, 5, 2}, {8423, 3322, 4, 2}, {8427, 3324, 5, 2}, {8432, 3326, 3, 2},
+    {8435, 3328, 3, 4}, {8438, 3332, 5, 2}, {8443, 3334, 4, 4}, {8447, 3338, 4, 4},
+    {8451, 3342, 6, 2}, {8457, 3344, 5, 2}, {8462, 3346, 5, 2}, {8467, 3348, 6, 2},
+    {8473, 3350, 6, 2}, {8479, 3352, 3, 2}, {8482, 3354, 3, 4}, {8485, 3358, 6, 2},
+    {8491, 3360, 4, 2}, {8495, 3362, 4, 2}, {8499, 3364, 4, 4}, {8503, 3368, 4, 4},
+    {8507, 3372, 5, 3}, {8512, 3375, 4, 3}, {8516, 3378, 6, 3}, {8522, 3381, 5, 3},
+    {8527, 3384, 2, 3}, {8529, 3387, 3, 3}, {8532, 3390, 4, 3}, {8536, 3393, 6, 2},
+    {8542, 3395, 8, 3}, {8550, 3398, 6, 3}, {8556, 3401, 6, 2}, {8562, 3403, 4, 3},
+    {8566, 3406, 5, 3}, {8571, 3409, 6, 3}, {8577, 3412, 3, 3}, {8580, 3415, 5, 2},
+    {8585, 3417, 4, 3}, {8589, 3420, 5, 3}, {8594, 3423, 7, 3}, {8601, 3426, 6, 3},
+    {8607, 3429, 6, 3}, {8613, 3432, 6, 3}, {8619, 3435, 6, 3}, {8625, 3438, 7, 3},
+    {8632, 3441, 6, 3}, {8638, 3444, 3, 3}, {8641, 3447, 6, 3}, {8647, 3450, 4, 3},
+    {8651, 3453, 5, 6}, {8656, 3459, 5, 3}, {8661, 3462, 5, 3}, {8666, 3465, 6, 1},
+    {8672, 3466, 6, 1}, {8678, 3467, 5, 3}, {8683, 3470, 7, 3}, {8690, 3473, 7, 3},
+    {8697, 3476, 6, 2}, {8703, 3478, 6, 2}, {8709, 3480, 5, 3}, {8714, 3483, 4, 1},
+    {8718, 3484, 3, 2}, {8721, 3486, 4, 3}, {8725, 3489, 5, 3}, {8730, 3492, 6, 3},
+    {8736, 3495, 7, 3}, {8743, 3498, 8, 3}, {8751, 3501, 4, 3}, {8755, 3504, 2, 3},
+    {8757, 3507, 9, 3}, {8766, 3510, 13, 3}, {8779, 3513, 15, 3}, {8794, 3516, 13, 3},
+    {8807, 3519, 14, 3}, {8821, 3522, 14, 3}, {8835, 3525, 15, 3}, {8850, 3528, 17, 3},
+    {8867, 3531, 19, 3}, {8886, 3534, 14, 3}, {8900, 3537, 3, 3}, {8903, 3540, 3, 3},
+    {8906, 3543, 4, 3}, {8910, 3546, 8, 3}, {8918, 3549, 3, 3}, {8921, 3552, 5, 3},
+    {8926, 3555, 6, 3}, {8932, 3558, 7, 3}, {8939, 3561, 8, 3}, {8947, 3564, 4, 6},
+    {8951, 3570, 6, 3}, {8957, 3573, 10, 3}, {8967, 3576, 7, 3}, {8974, 3579, 9, 3},
+    {8983, 3582, 10, 3}, {8993, 3585, 7, 3}, {9000, 3588, 7, 3}, {9007, 3591, 6, 3},
+    {9013, 3594, 6, 3}, {9019, 3597, 3, 4}, {9022, 3601, 2, 3}, {9024, 3604, 3, 3},
+    {9027, 3607, 5, 3}, {9032, 3610, 5, 3}, {9037, 3613, 6, 3}, {9043, 3616, 5, 3},
+    {9048, 3619, 4, 3}, {9052, 3622, 4, 2}, {9056, 3624, 2, 3}, {9058, 3627, 5, 3},
+    {9063, 3630, 8, 3}, {9071, 3633, 6, 3}, {9077, 3636, 5, 3}, {9082, 3639, 6, 2},
+    {9088, 3641, 6, 3}, {9094, 3644, 10, 3}, {9104, 3647, 3, 3}, {9107, 3650, 4, 3},
+    {9111, 3653, 8, 3}, {9119, 3656, 3, 3}, {9122, 3659, 4, 3}, {9126, 3662, 5, 3},
+    {9131, 3665, 5, 3}, {9136, 3668, 5, 3}, {9141, 3671, 5, 3}, {9146, 3674, 5, 3},
+    {9151, 3677, 13, 3}, {9164, 3680, 18, 3}, {9182, 3683, 10, 3}, {9192, 3686, 14, 3},
+    {9206, 3689, 13, 3}, {9219, 3692, 14, 3}, {9233, 3695, 5, 3}, {9238, 3698, 4, 4},
+    {9242, 3702, 6, 3}, {9248, 3705, 7, 3}, {9255, 3708, 6, 3}, {9261, 3711, 6, 1},
+    {9267, 3712, 3, 3}, {9270, 3715, 7, 3}, {9277, 3718, 4, 3}, {9281, 3721, 4, 1},
+    {9285, 3722, 6, 3}, {9291, 3725, 5, 3}, {9296, 3728, 8, 3}, {9304, 3731, 5, 3},
+    {9309, 3734, 6, 3}, {9315, 3737, 3, 3}, {9318, 3740, 5, 3}, {9323, 3743, 6, 3},
+    {9329, 3746, 4, 4}, {9333, 3750, 3, 3}, {9336, 3753, 4, 3}, {9340, 3756, 5, 3},
+    {9345, 3759, 5, 3}, {9350, 3762, 4, 1}, {9354, 3763, 5, 3}, {9359, 3766, 6, 3},
+    {9365, 3769, 6, 2}, {9371, 3771, 2, 1}, {9373, 3772, 4, 3}, {9377, 3775, 5, 3},
+    {9382, 3778, 5, 3}, {9387, 3781, 6, 3}, {9393, 3784, 6, 3}, {9399, 3787, 6, 3},
+    {9405, 3790, 7, 3}, {9412, 3793, 6, 3}, {9418, 3796, 4, 3}, {9422, 3799, 5, 3},
+    {9427, 3802, 5, 3}, {9432, 3805, 8, 3}, {9440, 3808, 7, 3}, {9447, 3811, 9, 6},
+    {9456, 3817, 4, 6}, {9460, 3823, 5, 3}, {9465, 3826, 4, 2}, {9469, 3828, 4, 3},
+    {9473, 3831, 4, 3}, {9477, 3834, 7, 3}, {9484, 3837, 3, 3}, {9487, 3840, 6, 3},
+    {9493, 3843, 10, 3}, {9503, 3846, 10, 3}, {9513, 3849, 8, 3}, {9521, 3852, 6, 3},
+    {9527, 3855, 6, 3}, {9533, 3858, 3, 2}, {9536, 3860, 5, 3}, {9541, 3863, 13, 3},
+    {9554, 3866, 3, 4}, {9557, 3870, 3, 3}, {9560, 3873, 5, 2}, {9565, 3875, 3, 3},
+    {9568, 3878, 6, 1}, {9574, 3879, 6, 3}, {9580, 3882, 6, 2}, {9586, 3884, 5, 3},
+    {9591, 3887, 6, 3}, {9597, 3890, 6, 3}, {9603, 3893, 7, 3}, {9610, 3896, 4, 3},
+    {9614, 3899, 4, 3}, {9618, 3902, 6, 3}, {9624, 3905, 6, 3}, {9630, 3908, 4, 4},
+    {9634, 3912, 2, 3}, {9636, 3915, 4, 4}, {9640, 3919, 6, 3}, {9646, 3922, 2, 2},
+    {9648, 3924, 8, 3}, {9656, 3927, 5, 3}, {9661, 3930, 3, 5}, {9664, 3935, 3, 6},
+    {9667, 3941, 4, 5}, {9671, 3946, 10, 3}, {9681, 3949, 15, 3}, {9696, 3952, 3, 5},
+    {9699, 3957, 3, 6}, {9702, 3963, 4, 5}, {9706, 3968, 11, 3}, {9717, 3971, 6, 3},
+    {9723, 3974, 6, 3}, {9729, 3977, 5, 3}, {9734, 3980, 6, 2}, {9740, 3982, 5, 3},
+    {9745, 3985, 4, 6}, {9749, 3991, 3, 3}, {9752, 3994, 4, 5}, {9756, 3999, 5, 5},
+    {9761, 4004, 5, 2}, {9766, 4006, 7, 3}, {9773, 4009, 5, 3}, {9778, 4012, 7, 3},
+    {9785, 4015, 8, 3}, {9793, 4018, 4, 2}, {9797, 4020, 5, 5}, {9802, 4025, 6, 5},
+    {9808, 4030, 4, 3}, {9812, 4033, 6, 2}, {9818, 4035, 6, 2}, {9824, 4037, 5, 3},
+    {9829, 4040, 8, 5}, {9837, 4045, 4, 3}, {9841, 4048, 3, 2}, {9844, 4050, 5, 3},
+    {9849, 4053, 2, 3}, {9851, 4056, 5, 3}, {9856, 4059, 6, 3}, {9862, 4062, 5, 3},
+    {9867, 4065, 7, 3}, {9874, 4068, 5, 5}, {9879, 4073, 6, 3}, {9885, 4076, 6, 3},
+    {9891, 4079, 5, 5}, {9896, 4084, 6, 3}, {9902, 4087, 7, 3}, {9909, 4090, 3, 4},
+    {9912, 4094, 3, 5}, {9915, 4099, 3, 3}, {9918, 4102, 4, 3}, {9922, 4105, 5, 5},
+    {9927, 4110, 9, 5}, {9936, 4115, 4, 5}, {9940, 4120, 5, 3}, {9945, 4123, 3, 3},
+    {9948, 4126, 4, 3}, {9952, 4129, 5, 3}, {9957, 4132, 5, 3}, {9962, 4135, 5, 3},
+    {9967, 4138, 2, 3}, {9969, 4141, 3, 3}, {9972, 4144, 4, 3}, {9976, 4147, 3, 3},
+    {9979, 4150, 4, 2}, {9983, 4152, 5, 3}, {9988, 4155, 3, 5}, {9991, 4160, 5, 3},
+    {9996, 4163, 4, 3}, {10000, 4166, 3, 3}, {10003, 4169, 10, 3}, {10013, 4172, 15, 3},
+    {10028, 4175, 4, 3}, {10032, 4178, 5, 5}, {10037, 4183, 9, 5}, {10046, 4188, 4, 5},
+    {10050, 4193, 5, 3}, {10055, 4196, 5, 3}, {10060, 4199, 3, 3}, {10063, 4202, 5, 3},
+    {10068, 4205, 6, 3}, {10074, 4208, 4, 3}, {10078, 4211, 4, 4}, {10082, 4215, 3, 2},
+    {10085, 4217, 5, 3}, {10090, 4220, 6, 5}, {10096, 4225, 8, 5}, {10104, 4230, 7, 3},
+    {10111, 4233, 7, 3}, {10118, 4236, 7, 3}, {10125, 4239, 5, 3}, {10130, 4242, 7, 3},
+    {10137, 4245, 7, 3}, {10144, 4248, 7, 3}, {10151, 4251, 4, 3}, {10155, 4254, 9, 3},
+    {10164, 4257, 6, 6}, {10170, 4263, 5, 5}, {10175, 4268, 7, 3}, {10182, 4271, 3, 3},
+    {10185, 4274, 6, 3}, {10191, 4277, 4, 5}, {10195, 4282, 5, 3}, {10200, 4285, 7, 5},
+    {10207, 4290, 5, 3}, {10212, 4293, 5, 3}, {10217, 4296, 6, 5}, {10223, 4301, 6, 5},
+    {10229, 4306, 11, 3}, {10240, 4309, 5, 3}, {10245, 4312, 6, 3}, {10251, 4315, 3, 3},
+    {10254, 4318, 6, 3}, {10260, 4321, 4, 5}, {10264, 4326, 4, 4}, {10268, 4330, 9, 3},
+    {10277, 4333, 14, 3}, {10291, 4336, 4, 3}, {10295, 4339, 5, 3}, {10300, 4342, 6, 3},
+    {10306, 4345, 5, 3}, {10311, 4348, 5, 3}, {10316, 4351, 7, 3}, {10323, 4354, 7, 3},
+    {10330, 4357, 4, 3}, {10334, 4360, 5, 5}, {10339, 4365, 5, 3}, {10344, 4368, 7, 6},
+    {10351, 4374, 9, 3}, {10360, 4377, 10, 5}, {10370, 4382, 5, 3}, {10375, 4385, 7, 5},
+    {10382, 4390, 4, 3}, {10386, 4393, 5, 5}, {10391, 4398, 5, 3}, {10396, 4401, 7, 6},
+    {10403, 4407, 9, 3}, {10412, 4410, 10, 5}, {10422, 4415, 4, 3}, {10426, 4418, 6, 2},
+    {10432, 4420, 4, 3}, {10436, 4423, 13, 3}, {10449, 4426, 15, 3}, {10464, 4429, 14, 3},
+    {10478, 4432, 16, 3}, {10494, 4435, 2, 2}, {10496, 4437, 3, 1}, {10499, 4438, 6, 3},
+    {10505, 4441, 5, 3}, {10510, 4444, 6, 3}, {10516, 4447, 6, 3}, {10522, 4450, 4, 6},
+    {10526, 4456, 6, 3}, {10532, 4459, 4, 6}, {10536, 4465, 4, 4}, {10540, 4469, 7, 3},
+    {10547, 4472, 6, 3}, {10553, 4475, 4, 6}, {10557, 4481, 4, 4}, {10561, 4485, 7, 6},
+    {10568, 4491, 6, 3}, {10574, 4494, 7, 6}, {10581, 4500, 5, 6}, {10586, 4506, 5, 3},
+    {10591, 4509, 6, 3}, {10597, 4512, 5, 3}, {10602, 4515, 7, 3}, {10609, 4518, 6, 3},
+    {10615, 4521, 2, 3}, {10617, 4524, 6, 2}, {10623, 4526, 4, 3}, {10627, 4529, 4, 3},
+    {10631, 4532, 5, 2}, {10636, 4534, 3, 2}, {10639, 4536, 5, 3}, {10644, 4539, 6, 2},
+    {10650, 4541, 4, 3}, {10654, 4544, 4, 3}, {10658, 4547, 6, 3}, {10664, 4550, 5, 2},
+    {10669, 4552, 5, 3}, {10674, 4555, 3, 4}, {10677, 4559, 4, 2}, {10681, 4561, 6, 2},
+    {10687, 4563, 3, 3}, {10690, 4566, 5, 3}, {10695, 4569, 3, 2}, {10698, 4571, 4, 3},
+    {10702, 4574, 5, 3}, {10707, 4577, 5, 3}, {10712, 4580, 7, 3}, {10719, 4583, 5, 3},
+    {10724, 4586, 3, 3}, {10727, 4589, 5, 2}, {10732, 4591, 5, 2}, {10737, 4593, 7, 2},
+    {10744, 4595, 4, 3}, {10748, 4598, 6, 3}, {10754, 4601, 4, 4}, {10758, 4605, 4, 3},
+    {10762, 4608, 5, 3}, {10767, 4611, 5, 3}, {10772, 4614, 2, 3}, {10774, 4617, 5, 3},
+    {10779, 4620, 3, 3}, {10782, 4623, 5, 3}, {10787, 4626, 7, 3}, {10794, 4629, 4, 2},
+    {10798, 4631, 4, 2}, {10802, 4633, 6, 3}, {10808, 4636, 4, 3}, {10812, 4639, 7, 3},
+    {10819, 4642, 3, 3}, {10822, 4645, 4, 3}, {10826, 4648, 6, 2}, {10832, 4650, 4, 3},
+    {10836, 4653, 6, 2}, {10842, 4655, 6, 3}, {10848, 4658, 8, 3}, {10856, 4661, 4, 2},
+    {10860, 4663, 5, 3}, {10865, 4666, 3, 3}, {10868, 4669, 4, 2}, {10872, 4671, 8, 3},
+    {10880, 4674, 6, 3}, {10886, 4677, 5, 3}, {10891, 4680, 4, 3}, {10895, 4683, 3, 2},
+    {10898, 4685, 6, 1}, {10904, 4686, 6, 1}, {10910, 4687, 6, 3}, {10916, 4690, 4, 3},
+    {10920, 4693, 7, 3}, {10927, 4696, 3, 4}, {10930, 4700, 3, 2}, {10933, 4702, 4, 2},
+    {10937, 4704, 6, 3}, {10943, 4707, 5, 3}, {10948, 4710, 2, 2}, {10950, 4712, 9, 3},
+    {10959, 4715, 3, 2}, {10962, 4717, 6, 3}, {10968, 4720, 7, 3}, {10975, 4723, 6, 3},
+    {10981, 4726, 4, 1}, {10985, 4727, 8, 3}, {10993, 4730, 5, 3}, {10998, 4733, 7, 3},
+    {11005, 4736, 6, 3}, {11011, 4739, 6, 3}, {11017, 4742, 5, 3}, {11022, 4745, 6, 2},
+    {11028, 4747, 7, 3}, {11035, 4750, 7, 3}, {11042, 4753, 2, 2}, {11044, 4755, 8, 3},
+    {11052, 4758, 4, 4}, {11056, 4762, 5, 2}, {11061, 4764, 2, 3}, {11063, 4767, 3, 3},
+    {11066, 4770, 4, 3}, {11070, 4773, 5, 3}, {11075, 4776, 3, 3}, {11078, 4779, 4, 3},
+    {11082, 4782, 10, 3}, {11092, 4785, 11, 3}, {11103, 4788, 6, 3}, {11109, 4791, 11, 3},
+    {11120, 4794, 8, 3}, {11128, 4797, 8, 3}, {11136, 4800, 7, 3}, {11143, 4803, 5, 3},
+    {11148, 4806, 6, 3}, {11154, 4809, 4, 3}, {11158, 4812, 5, 3}, {11163, 4815, 6, 3},
+    {11169, 4818, 4, 3}, {11173, 4821, 8, 3}, {11181, 4824, 8, 3}, {11189, 4827, 8, 3},
+    {11197, 4830, 4, 3}, {11201, 4833, 6, 3}, {11207, 4836, 5, 3}, {11212, 4839, 6, 3},
+    {11218, 4842, 4, 4}, {11222, 4846, 3, 2}, {11225, 4848, 6, 3}, {11231, 4851, 3, 4},
+    {11234, 4855, 4, 3}, {11238, 4858, 4, 4}, {11242, 4862, 6, 3}, {11248, 4865, 4, 4},
+    {11252, 4869, 11, 3}, {11263, 4872, 7, 3}, {11270, 4875, 5, 1}, {11275, 4876, 7, 3},
+    {11282, 4879, 4, 1}, {11286, 4880, 5, 3}, {11291, 4883, 4, 3}, {11295, 4886, 6, 3},
+    {11301, 4889, 5, 3}, {11306, 4892, 4, 3}, {11310, 4895, 4, 5}, {11314, 4900, 6, 2},
+    {11320, 4902, 5, 3}, {11325, 4905, 8, 3}, {11333, 4908, 4, 3}, {11337, 4911, 5, 3},
+    {11342, 4914, 5, 3}, {11347, 4917, 6, 3}, {11353, 4920, 5, 2}, {11358, 4922, 4, 3},
+    {11362, 4925, 6, 3}, {11368, 4928, 5, 3}, {11373, 4931, 7, 3}, {11380, 4934, 5, 3},
+    {11385, 4937, 6, 3}, {11391, 4940, 6, 3}, {11397, 4943, 6, 3}, {11403, 4946, 6, 3},
+    {11409, 4949, 7, 3}, {11416, 4952, 6, 3}, {11422, 4955, 5, 3}, {11427, 4958, 6, 3},
+    {11433, 4961, 5, 3}, {11438, 4964, 9, 3}, {11447, 4967, 5, 3}, {11452, 4970, 5, 3},
+    {11457, 4973, 6, 1}, {11463, 4974, 6, 1}, {11469, 4975, 5, 3}, {11474, 4978, 7, 3},
+    {11481, 4981, 7, 3}, {11488, 4984, 6, 2}, {11494, 4986, 6, 2}, {11500, 4988, 5, 3},
+    {11505, 4991, 4, 1}, {11509, 4992, 3, 2}, {11512, 4994, 4, 3}, {11516, 4997, 7, 3},
+    {11523, 5000, 5, 3}, {11528, 5003, 6, 3}, {11534, 5006, 4, 3}, {11538, 5009, 4, 3},
+    {11542, 5012, 7, 3}, {11549, 5015, 8, 3}, {11557, 5018, 5, 3}, {11562, 5021, 4, 3},
+    {11566, 5024, 3, 2}, {11569, 5026, 6, 3}, {11575, 5029, 6, 3}, {11581, 5032, 3, 4},
+    {11584, 5036, 5, 3}, {11589, 5039, 5, 3}, {11594, 5042, 6, 3}, {11600, 5045, 3, 2},
+    {11603, 5047, 4, 2}, {11607, 5049, 10, 3}, {11617, 5052, 14, 3}, {11631, 5055, 16, 3},
+    {11647, 5058, 14, 3}, {11661, 5061, 15, 3}, {11676, 5064, 17, 3}, {11693, 5067, 16, 3},
+    {11709, 5070, 15, 3}, {11724, 5073, 15, 3}, {11739, 5076, 4, 2}, {11743, 5078, 12, 3},
+    {11755, 5081, 5, 3}, {11760, 5084, 5, 3}, {11765, 5087, 5, 3}, {11770, 5090, 3, 3},
+    {11773, 5093, 6, 3}, {11779, 5096, 10, 3}, {11789, 5099, 5, 3}, {11794, 5102, 5, 3},
+    {11799, 5105, 5, 3}, {11804, 5108, 5, 3}, {11809, 5111, 5, 3}, {11814, 5114, 4, 4},
+    {11818, 5118, 6, 3}, {11824, 5121, 7, 3}, {11831, 5124, 6, 3}, {11837, 5127, 4, 1},
+    {11841, 5128, 6, 3}, {11847, 5131, 8, 3}, {11855, 5134, 5, 3}, {11860, 5137, 6, 3},
+    {11866, 5140, 4, 4}, {11870, 5144, 3, 3}, {11873, 5147, 4, 1}, {11877, 5148, 5, 3},
+    {11882, 5151, 6, 3}, {11888, 5154, 6, 3}, {11894, 5157, 6, 3}, {11900, 5160, 4, 3},
+    {11904, 5163, 5, 3}, {11909, 5166, 5, 3}, {11914, 5169, 8, 3}, {11922, 5172, 7, 3},
+    {11929, 5175, 5, 3}, {11934, 5178, 2, 3}, {11936, 5181, 6, 2}, {11942, 5183, 5, 3},
+    {11947, 5186, 2, 3}, {11949, 5189, 3, 3}, {11952, 5192, 4, 3}, {11956, 5195, 6, 2},
+    {11962, 5197, 5, 3}, {11967, 5200, 3, 3}, {11970, 5203, 6, 2}, {11976, 5205, 5, 2},
+    {11981, 5207, 4, 3}, {11985, 5210, 5, 3}, {11990, 5213, 6, 3}, {11996, 5216, 8, 3},
+    {12004, 5219, 5, 3}, {12009, 5222, 3, 2}, {12012, 5224, 4, 3}, {12016, 5227, 5, 3},
+    {12021, 5230, 5, 3}, {12026, 5233, 5, 3}, {12031, 5236, 6, 3}, {12037, 5239, 5, 3},
+    {12042, 5242, 7, 3}, {12049, 5245, 4, 2}, {12053, 5247, 4, 1}, {12057, 5248, 6, 3},
+    {12063, 5251, 8, 3}, {12071, 5254, 5, 3}, {12076, 5257, 4, 3}, {12080, 5260, 3, 4},
+    {12083, 5264, 6, 3}, {12089, 5267, 5, 3}, {12094, 5270, 6, 2}, {12100, 5272, 4, 2},
+    {12104, 5274, 8, 3}, {12112, 5277, 13, 3}, {12125, 5280, 3, 2}, {12128, 5282, 5, 2},
+    {12133, 5284, 6, 2}, {12139, 5286, 6, 2}, {12145, 5288, 3, 3}, {12148, 5291, 6, 3},
+    {12154, 5294, 4, 3}, {12158, 5297, 5, 3}, {12163, 5300, 4, 3}, {12167, 5303, 5, 3},
+    {12172, 5306, 4, 3}, {12176, 5309, 5, 3}, {12181, 5312, 5, 3}, {12186, 5315, 7, 3},
+    {12193, 5318, 7, 3}, {12200, 5321, 5, 3}, {12205, 5324, 13, 3}, {12218, 5327, 6, 3},
+    {12224, 5330, 8, 3}, {12232, 5333, 4, 3}, {12236, 5336, 5, 3}, {12241, 5339, 3, 3},
+    {12244, 5342, 4, 3}, {12248, 5345, 5, 6}, {12253, 5351, 6, 2}, {12259, 5353, 3, 1},
+    {12262, 5354, 4, 3}, {12266, 5357, 6, 3}, {12272, 5360, 4, 4}, {12276, 5364, 6, 3},
+    {12282, 5367, 9, 3}, {12291, 5370, 4, 3}, {12295, 5373, 5, 3}, {12300, 5376, 6, 6},
+    {12306, 5382, 5, 3}, {12311, 5385, 6, 6}, {12317, 5391, 5, 3}, {12322, 5394, 6, 3},
+    {12328, 5397, 8, 3}, {12336, 5400, 10, 3}, {12346, 5403, 5, 3}, {12351, 5406, 6, 3},
+    {12357, 5409, 8, 3}, {12365, 5412, 10, 3}, {12375, 5415, 3, 3}, {12378, 5418, 6, 3},
+    {12384, 5421, 6, 3}, {12390, 5424, 4, 3}, {12394, 5427, 5, 3}, {12399, 5430, 4, 4},
+    {12403, 5434, 6, 3}, {12409, 5437, 6, 3}, {12415, 5440, 6, 3}, {12421, 5443, 4, 3},
+    {12425, 5446, 5, 3}, {12430, 5449, 15, 2}, {12445, 5451, 11, 2}, {12456, 5453, 5, 2},
+    {12461, 5455, 3, 3}, {12464, 5458, 4, 3}, {12468, 5461, 6, 3}, {12474, 5464, 4, 3},
+    {12478, 5467, 7, 3}, {12485, 5470, 7, 3}, {12492, 5473, 5, 3}, {12497, 5476, 5, 3},
+    {12502, 5479, 7, 3}, {12509, 5482, 7, 3}, {12516, 5485, 6, 3}, {12522, 5488, 8, 3},
+    {12530, 5491, 9, 3}, {12539, 5494, 9, 3}, {12548, 5497, 10, 3}, {12558, 5500, 6, 3},
+    {12564, 5503, 6, 3}, {12570, 5506, 6, 3}, {12576, 5509, 4, 3}, {12580, 5512, 10, 3},
+    {12590, 5515, 11, 3}, {12601, 5518, 6, 3}, {12607, 5521, 11, 3}, {12618, 5524, 8, 3},
+    {12626, 5527, 8, 3}, {12634, 5530, 7, 3}, {12641, 5533, 3, 3}, {12644, 5536, 4, 3},
+    {12648, 5539, 3, 3}, {12651, 5542, 4, 2}, {12655, 5544, 4, 2}, {12659, 5546, 4, 2},
+    {12663, 5548, 4, 3}, {12667, 5551, 6, 3}, {12673, 5554, 7, 3}, {12680, 5557, 4, 3},
+    {12684, 5560, 7, 3}, {12691, 5563, 7, 3}, {12698, 5566, 7, 3}, {12705, 5569, 7, 3},
+    {12712, 5572, 7, 3}, {12719, 5575, 5, 3}, {12724, 5578, 5, 3}, {12729, 5581, 7, 3},
+    {12736, 5584, 6, 3}, {12742, 5587, 8, 3}, {12750, 5590, 9, 3}, {12759, 5593, 9, 3},
+    {12768, 5596, 10, 3}, {12778, 5599, 6, 3}, {12784, 5602, 6, 3}, {12790, 5605, 6, 3},
+    {12796, 5608, 5, 3}, {12801, 5611, 6, 3}, {12807, 5614, 5, 3}, {12812, 5617, 7, 3},
+    {12819, 5620, 6, 3}, {12825, 5623, 5, 2}, {12830, 5625, 6, 3}, {12836, 5628, 3, 2},
+    {12839, 5630, 4, 3}, {12843, 5633, 6, 2}, {12849, 5635, 6, 2}, {12855, 5637, 3, 2},
+    {12858, 5639, 4, 3}, {12862, 5642, 6, 3}, {12868, 5645, 3, 4}, {12871, 5649, 6, 3},
+    {12877, 5652, 9, 3}, {12886, 5655, 5, 2}, {12891, 5657, 8, 2}, {12899, 5659, 6, 2},
+    {12905, 5661, 11, 3}, {12916, 5664, 8, 3}, {12924, 5667, 6, 3}, {12930, 5670, 5, 3},
+    {12935, 5673, 6, 3}, {12941, 5676, 5, 2}, {12946, 5678, 5, 2}, {12951, 5680, 5, 2},
+    {12956, 5682, 6, 3}, {12962, 5685, 8, 3}, {12970, 5688, 6, 3}, {12976, 5691, 4, 3},
+    {12980, 5694, 4, 3}, {12984, 5697, 3, 3}, {12987, 5700, 6, 3}, {12993, 5703, 6, 3},
+    {12999, 5706, 4, 4}, {13003, 5710, 7, 3}, {13010, 5713, 4, 3}, {13014, 5716, 6, 3},
+    {13020, 5719, 5, 3}, {13025, 5722, 8, 3}, {13033, 5725, 12, 3}, {13045, 5728, 12, 3},
+    {13057, 5731, 14, 3}, {13071, 5734, 9, 3}, {13080, 5737, 13, 3}, {13093, 5740, 15, 3},
+    {13108, 5743, 6, 3}, {13114, 5746, 4, 3}, {13118, 5749, 8, 3}, {13126, 5752, 7, 3},
+    {13133, 5755, 5, 3}, {13138, 5758, 7, 3}, {13145, 5761, 8, 3}, {13153, 5764, 4, 4},
+    {13157, 5768, 4, 2}, {13161, 5770, 5, 2}, {13166, 5772, 6, 2}, {13172, 5774, 5, 3},
+    {13177, 5777, 16, 3}, {13193, 5780, 17, 3}, {13210, 5783, 4, 3}, {13214, 5786, 4, 3},
+    {13218, 5789, 6, 2}, {13224, 5791, 4, 3}, {13228, 5794, 5, 2}, {13233, 5796, 6, 2},
+    {13239, 5798, 5, 2}, {13244, 5800, 3, 2}, {13247, 5802, 5, 3}, {13252, 5805, 6, 2},
+    {13258, 5807, 5, 3}, {13263, 5810, 6, 3}, {13269, 5813, 3, 4}, {13272, 5817, 6, 2},
+    {13278, 5819, 5, 3}, {13283, 5822, 5, 3}, {13288, 5825, 5, 3}, {13293, 5828, 6, 3},
+    {13299, 5831, 8, 3}, {13307, 5834, 6, 3}, {13313, 5837, 5, 3}, {13318, 5840, 5, 2},
+    {13323, 5842, 3, 2}, {13326, 5844, 5, 2}, {13331, 5846, 4, 4}, {13335, 5850, 7, 3},
+    {13342, 5853, 11, 3}, {13353, 5856, 13, 3}, {13366, 5859, 14, 3}, {13380, 5862, 5, 3},
+    {13385, 5865, 4, 2}, {13389, 5867, 5, 2}, {13394, 5869, 7, 2}, {13401, 5871, 10, 3},
+    {13411, 5874, 6, 3}, {13417, 5877, 8, 3}, {13425, 5880, 6, 3}, {13431, 5883, 5, 2},
+    {13436, 5885, 5, 3}, {13441, 5888, 4, 4}, {13445, 5892, 5, 3}, {13450, 5895, 6, 2},
+    {13456, 5897, 4, 3}, {13460, 5900, 5, 3}, {13465, 5903, 5, 3}, {13470, 5906, 4, 2},
+    {13474, 5908, 7, 3}, {13481, 5911, 4, 3}, {13485, 5914, 4, 3}, {13489, 5917, 5, 3},
+    {13494, 5920, 5, 3}, {13499, 5923, 6, 3}, {13505, 5926, 10, 2}, {13515, 5928, 8, 2},
+    {13523, 5930, 10, 3}, {13533, 5933, 6, 2}, {13539, 5935, 5, 2}, {13544, 5937, 9, 3},
+    {13553, 5940, 4, 3}, {13557, 5943, 6, 2}, {13563, 5945, 8, 2}, {13571, 5947, 12, 6},
+    {13583, 5953, 13, 6}, {13596, 5959, 12, 6}, {13608, 5965, 13, 6}, {13621, 5971, 8, 2},
+    {13629, 5973, 15, 3}, {13644, 5976, 16, 3}, {13660, 5979, 3, 2}, {13663, 5981, 5, 3},
+    {13668, 5984, 3, 3}, {13671, 5987, 6, 3}, {13677, 5990, 5, 3}, {13682, 5993, 6, 3},
+    {13688, 5996, 6, 1}, {13694, 5997, 4, 1}, {13698, 5998, 3, 4}, {13701, 6002, 5, 3},
+    {13706, 6005, 5, 6}, {13711, 6011, 5, 6}, {13716, 6017, 4, 4}, {13720, 6021, 5, 3},
+    {13725, 6024, 5, 3}, {13730, 6027, 4, 4}, {13734, 6031, 6, 6}, {13740, 6037, 6, 6},
+    {13746, 6043, 6, 6}, {13752, 6049, 6, 6}, {13758, 6055, 7, 3}, {13765, 6058, 5, 2},
+    {13770, 6060, 6, 3}, {13776, 6063, 5, 3}, {13781, 6066, 6, 3}, {13787, 6069, 6, 3},
+    {13793, 6072, 3, 4}, {13796, 6076, 3, 3}, {13799, 6079, 4, 4}, {13803, 6083, 2, 3},
+    {13805, 6086, 2, 3}, {13807, 6089, 6, 3}, {13813, 6092, 4, 4}, {13817, 6096, 4, 3},
+    {13821, 6099, 4, 3}, {13825, 6102, 4, 3}, {13829, 6105, 5, 3}, {13834, 6108, 4, 3},
+    {13838, 6111, 5, 3}, {13843, 6114, 3, 4}, {13846, 6118, 5, 3}, {13851, 6121, 5, 3},
+    {13856, 6124, 2, 2}, {13858, 6126, 5, 3}, {13863, 6129, 5, 3}, {13868, 6132, 4, 3},
+    {13872, 6135, 4, 3}, {13876, 6138, 5, 3}, {13881, 6141, 4, 4}, {13885, 6145, 6, 3},
+    {13891, 6148, 6, 3}, {13897, 6151, 5, 3}, {13902, 6154, 5, 3}, {13907, 6157, 4, 4},
+    {13911, 6161, 6, 3}, {13917, 6164, 6, 3}, {13923, 6167, 5, 3}, {13928, 6170, 4, 3},
+    {13932, 6173, 6, 3}, {13938, 6176, 6, 2}, {13944, 6178, 4, 2}, {13948, 6180, 5, 2},
+    {13953, 6182, 3, 2}, {13956, 6184, 3, 2}, {13959, 6186, 3, 4}, {13962, 6190, 4, 2},
+    {13966, 6192, 4, 4}, {13970, 6196, 4, 4}, {13974, 6200, 4, 2}, {13978, 6202, 4, 2},
+    {13982, 6204, 6, 2}, {13988, 6206, 6, 2}, {13994, 6208, 3, 2}, {13997, 6210, 4, 2},
+    {14001, 6212, 6, 3}, {14007, 6215, 4, 2}, {14011, 6217, 3, 4}, {14014, 6221, 4, 2},
+    {14018, 6223, 7, 3}, {14025, 6226, 4, 4}, {14029, 6230, 4, 4}, {14033, 6234, 3, 3},
+    {14036, 6237, 4, 3},
+}};
+
+// Seed per bucket of `hashEntityName(name, 0)`.
+constexpr std::array<uint16_t, kBucketCount> kSeeds = {{
+    1, 4, 6, 1, 8, 5, 0, 22, 1, 2, 1, 2,
+    1, 1, 1, 1, 3, 3, 2, 1, 3, 2, 3, 1,
+    3, 1, 3, 1, 3, 0, 1, 3, 1, 3, 2, 1,
+    2, 1, 1, 3, 1, 1, 3, 1, 4, 6, 1, 5,
+    2, 2, 2, 1, 1, 2, 0, 13, 0, 1, 1, 2,
+    1, 2, 1, 3, 2, 3, 3, 1, 1, 0, 13, 2,
+    1, 1, 0, 4, 8, 1, 8, 2, 2, 4, 1, 1,
+    1, 3, 11, 1, 1, 6, 1, 3, 3, 0, 1, 1,
+    1, 3, 1, 3, 1, 4, 0, 1, 1, 0, 3, 1,
+    1, 3, 1, 1, 3, 2, 0, 3, 2, 14, 1, 1,
+    2, 1, 0, 1, 1, 1, 6, 5, 1, 1, 3, 1,
+    5, 0, 2, 4, 1, 1, 0, 4, 2, 1, 2, 1,
+    4, 0, 0, 1, 1, 2, 3, 5, 2, 1, 3, 1,
+    1, 3, 6, 1, 1, 1, 4, 2, 1, 0, 0, 1,
+    2, 0, 5, 1, 5, 1, 5, 1, 2, 5, 2, 3,
+    1, 4, 0, 1, 2, 2, 2, 4, 0, 0, 1, 7,
+    6, 1, 0, 1, 2, 0, 2, 1, 1, 2, 7, 1,
+    1, 63, 64, 0, 0, 0, 7, 1, 0, 2, 2, 0,
+    1, 1, 2, 1, 2, 8, 3, 1, 1, 4, 7, 2,
+    1, 0, 1, 1, 2, 3, 1, 65, 1, 1, 2, 3,
+    2, 1, 0, 1, 1, 8, 38, 2, 3, 0, 0, 3,
+    1, 3, 1, 1, 1, 1, 1, 1, 2, 1, 3, 3,
+    2, 0, 0, 4, 1, 5, 1, 1, 1, 3, 1, 1,
+    1, 1, 1, 4, 1, 3, 1, 0, 2, 8, 1, 0,
+    1, 3, 4, 1, 2, 1, 0, 2, 2, 2, 5, 1,
+    1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 6, 1,
+    1, 3, 0, 9, 2, 2, 0, 3, 1, 2, 3, 1,
+    2, 2, 0, 2, 3, 0, 0, 3, 1, 1, 3, 5,
+    10, 2, 1, 1, 5, 3, 0, 1, 1, 1, 2, 1,
+    6, 1, 9, 1, 10, 1, 5, 1, 1, 2, 1, 1,
+    3, 8, 1, 0, 2, 0, 1, 32, 0, 0, 2, 4,
+    4, 2, 1, 2, 1, 3, 2, 2, 0, 4, 1, 65,
+    1, 2, 4, 1, 2, 11, 1, 0, 1, 2, 2, 1,
+    1, 15, 1, 15, 1, 2, 9, 4, 0, 2, 1, 4,
+    1, 1, 1, 0, 2, 2, 0, 7, 3, 1, 2, 2,
+    2, 2, 1, 4, 0, 1, 1, 1, 4, 1, 1, 1,
+    2, 1, 0, 6, 2, 1, 0, 2, 2, 2, 2, 3,
+    2, 2, 3, 4, 1, 8, 4, 4, 3, 3, 2, 1,
+    1, 0, 0, 1, 16, 2, 2, 1, 1, 0, 0, 1,
+    3, 1, 2, 1, 2, 2, 1, 2, 2, 4, 0, 1,
+    9, 6, 9, 1, 1, 1, 3, 1, 1, 0, 5, 21,
+    5, 1, 1, 2, 4, 1, 0, 0, 0, 6, 2, 2,
+    1, 5, 0, 3, 6, 4, 1, 0, 1, 2, 1, 1,
+    2, 1, 1, 2, 4, 1, 1, 1, 0, 4, 4, 3,
+    0, 2, 4, 11, 3, 5, 24, 0, 5, 0, 60, 0,
+    0, 2, 6, 1, 0, 13, 0, 0, 0, 6, 2, 1,
+    4, 65, 1, 1, 1, 3, 4, 1, 2, 2, 2, 1,
+    1, 1, 0, 0, 3, 1, 0, 1, 2, 3, 1, 1,
+    1, 0, 5, 2, 0, 6, 8, 3, 1, 2, 4, 1,
+    3, 1, 4, 1, 1, 7, 1, 0, 1, 1, 1, 1,
+    1, 1, 6, 3, 1, 1, 9, 1, 1, 1, 0, 7,
+    7, 3, 1, 0, 0, 2, 4, 1, 2, 6, 2, 0,
+    0, 0, 1, 11, 2, 3, 2, 59, 6, 1, 1, 64,
+    1, 8, 1, 1, 2, 1, 1, 3, 4, 0, 1, 2,
+    1, 0, 1, 69, 4, 1, 1, 1, 20, 5, 1, 0,
+    0, 3, 1, 1, 1, 0, 66, 0, 0, 0, 1, 1,
+    3, 2, 3, 1, 1, 4, 3, 0, 17, 39, 1, 2,
+    2, 1, 0, 4, 1, 3, 3, 2, 0, 23, 3, 1,
+    3, 4, 0, 1, 5, 3, 1, 1, 2, 2, 1, 3,
+    11, 1, 2, 0, 0, 1, 6, 1, 4, 0, 1, 2,
+    1, 1, 2, 0, 15, 2, 14, 3, 1, 4, 1, 2,
+    2, 6, 2, 34, 1, 1, 2, 1, 1, 1, 1, 2,
+    1, 1, 2, 5, 2, 2, 1, 1, 8, 2, 2, 0,
+    2, 0, 1, 5, 17, 3, 3, 0, 5, 1, 4, 1,
+    0, 6, 7, 1, 2, 5, 0, 65, 3, 1, 1, 5,
+    0, 1, 4, 38, 0, 0, 3, 9, 3, 1, 1, 0,
+    2, 1, 2, 0, 3, 2, 2, 4, 1, 0, 6, 69,
+    1, 8, 1, 0, 4, 22, 2, 7, 1, 1, 2, 1,
+    1, 2, 1, 7, 1, 1, 1, 4, 1, 2, 1, 1,
+    6, 2, 1, 2, 3, 5, 0, 7, 3, 5, 2, 4,
+    5, 1, 5, 0, 2, 7, 1, 2, 0, 12, 2, 2,
+    2, 1, 2, 3, 4, 0, 0, 1, 1, 1, 4, 2,
+    3, 1, 72, 0, 2, 12, 2, 0, 2, 0, 1, 0,
+    2, 2, 1, 13, 1, 12, 64, 66, 0, 2, 3, 0,
+    0, 66, 56, 1, 1, 3, 1, 0, 2, 1, 66, 1,
+    1, 1, 6, 2, 3, 1, 1, 0, 5, 0, 3, 1,
+    4, 1, 11, 0, 3, 1, 2, 2, 1, 1, 0, 5,
+    1, 19, 1, 4, 0, 2, 7, 3, 1, 2, 14, 3,
+    5, 1, 2, 2, 0, 4, 3, 1, 3, 3, 3, 0,
+    4, 2, 9, 7, 0, 0, 1, 2, 21, 2, 1, 1,
+    1, 13, 4, 1, 2, 1, 1, 0, 5, 4, 1, 16,
+    2, 1, 25, 1, 0, 0, 3, 2, 27, 4, 13, 0,
+    3, 3, 5, 2, 1, 64, 3, 1, 0, 8, 9, 0,
+    4, 2, 5, 2, 5, 3, 2, 0, 2, 1, 70, 2,
+    0, 27, 1, 7, 0, 65, 1, 0, 1, 6, 1, 2,
+    1, 1, 1, 7,
+}};
+
+// Index into kEntities per slot of `hashEntityName(name, seed)`.
+constexpr std::array<uint16_t, kSlotCount> kSlots = {{
+    1238, 1369, 65535, 1797, 65535, 1347, 684, 65535, 1975, 65535, 65535, 65535,
+    65535, 65535, 65535, 2111, 65535, 65535, 65535, 65535, 2042, 65535, 22, 236,
+    65535, 65535, 408, 65535, 65535, 65535, 65535, 2065, 1656, 65535, 65535, 247,
+    747, 65535, 1865, 1534, 65535, 1628, 65535, 1510, 65535, 65535, 65535, 65535,
+    1849, 191, 65535, 65535, 65535, 537, 686, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1019, 1643, 40, 65535, 1307, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1680, 1757, 65535, 65535, 65535, 443, 2086, 65535,
+    2059, 65535, 695, 1742, 1322, 65535, 2051, 65535, 1740, 65535, 86, 65535,
+    65535, 1553, 1961, 65535, 2056, 65535, 658, 718, 2082, 65535, 65535, 2092,
+    65535, 65535, 65535, 295, 65535, 57, 1886, 65535, 65535, 226, 847, 1476,
+    1530, 1930, 1057, 65535, 1819, 65535, 826, 65535, 1245, 940, 1147, 65535,
+    65535, 65535, 109, 126, 1502, 65535, 1524, 1735, 854, 516, 1165, 65535,
+    1208, 65535, 65535, 750, 65535, 953, 65535, 65535, 766, 65535, 1556, 1983,
+    65535, 65535, 309, 65535, 1537, 980, 1368, 65535, 65535, 65535, 65535, 65535,
+    1626, 65535, 65535, 147, 1263, 2061, 65535, 1052, 572, 1925, 88, 2115,
+    1946, 33, 65535, 1779, 1406, 1902, 65535, 340, 65535, 65535, 736, 65535,
+    65535, 1791, 65535, 65535, 752, 1471, 867, 65535, 65535, 353, 65535, 818,
+    65535, 1356, 547, 65535, 65535, 715, 1820, 1631, 1267, 1021, 1048, 896,
+    1900, 65535, 65535, 1029, 1320, 65535, 65535, 65535, 1249, 1349, 65535, 65535,
+    629, 1345, 1727, 489, 65535, 1658, 65535, 1336, 2089, 65535, 1558, 501,
+    65535, 1783, 1918, 65535, 65535, 923, 717, 65535, 2033, 719, 1196, 65535,
+    65535, 65535, 65535, 208, 2034, 1498, 65535, 65535, 65535, 65535, 857, 65535,
+    65535, 1595, 65535, 1101, 1552, 601, 1235, 1337, 928, 65535, 65535, 1035,
+    125, 2131, 1370, 65535, 1976, 65535, 1209, 65535, 65535, 117, 65535, 375,
+    1943, 2024, 65535, 65535, 259, 2070, 1469, 661, 265, 65535, 626, 65535,
+    1466, 65535, 459, 1059, 541, 2015, 345, 65535, 65535, 65535, 238, 65535,
+    65535, 65535, 65535, 65535, 1780, 635, 65535, 1846, 65535, 1141, 65535, 65535,
+    55, 1456, 65535, 65535, 65535, 338, 1795, 660, 950, 65535, 835, 65535,
+    65535, 391, 1037, 65535, 799, 1496, 183, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1792, 65535, 65535, 744, 196, 2066, 65535, 1548, 65535, 65535,
+    65535, 1762, 1151, 65535, 1928, 849, 1969, 65535, 579, 1957, 65535, 2067,
+    65535, 925, 1301, 65535, 1480, 783, 65535, 65535, 1695, 726, 1044, 65535,
+    128, 65535, 2124, 1253, 65535, 1871, 1286, 65535, 65535, 65535, 65535, 65535,
+    65, 65535, 65535, 308, 1305, 721, 1042, 65535, 65535, 934, 65535, 65535,
+    2064, 1198, 2077, 2013, 65535, 1108, 65535, 240, 231, 1413, 65535, 65535,
+    786, 1018, 65535, 1154, 65535, 65535, 65535, 65535, 1395, 65535, 372, 554,
+    859, 1342, 65535, 1825, 143, 1255, 1239, 1549, 65535, 65535, 293, 176,
+    65535, 562, 65535, 1344, 504, 65535, 832, 65535, 65535, 1371, 65535, 1001,
+    1098, 578, 65535, 1915, 1570, 65535, 65535, 65535, 1062, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 349, 886, 65535, 2058, 1393, 1981, 65535, 1150,
+    65535, 844, 91, 65535, 962, 778, 1053, 65535, 65535, 487, 1223, 1056,
+    1418, 865, 1452, 1582, 65535, 65535, 510, 65535, 1513, 178, 841, 456,
+    638, 65535, 1329, 65535, 1064, 1248, 65535, 1470, 367, 1126, 520, 65535,
+    65535, 65535, 65535, 1250, 65535, 65535, 65535, 171, 65535, 992, 705, 65535,
+    65535, 65535, 65535, 566, 514, 1597, 65535, 65535, 1916, 65535, 65535, 809,
+    363, 65535, 65535, 65535, 1099, 2049, 611, 65535, 65535, 65535, 610, 65535,
+    815, 1826, 65535, 65535, 1505, 663, 979, 65535, 1986, 65535, 592, 1661,
+    2060, 132, 65535, 186, 2016, 65535, 65535, 1575, 432, 65535, 1373, 1781,
+    65535, 1115, 65535, 1231, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 1428, 65535, 229, 2114, 65535, 65535, 65535, 65535, 65535, 823, 65535,
+    65535, 65535, 1760, 65535, 519, 1008, 931, 177, 65535, 65535, 65535, 65535,
+    65535, 65535, 2026, 861, 102, 65535, 65535, 1748, 1568, 1354, 65535, 748,
+    1447, 65535, 65535, 155, 65535, 65535, 65535, 65535, 65535, 199, 65535, 65535,
+    1801, 1380, 65535, 1557, 65535, 65535, 65535, 65535, 853, 65535, 1949, 65535,
+    702, 65535, 233, 65535, 65535, 65535, 237, 1845, 782, 622, 614, 65535,
+    65535, 65535, 1289, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1358,
+    65535, 1464, 65535, 1966, 17, 65535, 672, 65535, 219, 65535, 65535, 1275,
+    65535, 65535, 65535, 1149, 1216, 65535, 1854, 65535, 527, 1653, 65535, 65535,
+    486, 65535, 1686, 152, 65535, 1605, 560, 2107, 997, 1669, 65535, 1654,
+    941, 912, 1749, 1624, 65535, 396, 2000, 65535, 65535, 1908, 960, 687,
+    1617, 65535, 706, 1455, 65535, 65535, 65535, 275, 1127, 1738, 106, 65535,
+    65535, 1363, 796, 65535, 1978, 1987, 65535, 1700, 65535, 65535, 556, 65535,
+    1758, 65535, 258, 65535, 65535, 65535, 36, 65535, 65535, 65535, 65535, 65535,
+    65535, 535, 65535, 1094, 503, 1555, 1405, 65535, 65535, 781, 373, 1191,
+    1596, 1587, 565, 548, 1402, 65535, 65535, 65535, 65535, 1939, 1333, 480,
+    65535, 65535, 1535, 1095, 8, 65535, 65535, 65535, 65535, 65535, 362, 215,
+    65535, 1573, 2078, 65535, 65535, 65535, 292, 65535, 609, 65535, 65535, 65535,
+    65535, 65535, 1160, 1519, 975, 530, 65535, 65535, 1889, 101, 65535, 29,
+    65535, 120, 65535, 1063, 269, 1261, 65535, 65535, 65535, 1031, 618, 1860,
+    1166, 328, 65535, 65535, 65535, 1837, 65535, 1103, 65535, 1387, 1638, 65535,
+    1202, 531, 65535, 617, 761, 902, 1853, 639, 1636, 65535, 1437, 61,
+    65535, 94, 65535, 87, 729, 65535, 248, 65535, 65535, 1441, 65535, 806,
+    1873, 1426, 1144, 1049, 222, 50, 1085, 1989, 2113, 14, 2106, 165,
+    364, 65535, 65535, 343, 1023, 1789, 65535, 65535, 65535, 542, 895, 722,
+    1205, 65535, 65535, 79, 803, 65535, 1720, 1376, 905, 65535, 1306, 65535,
+    78, 65535, 65535, 65535, 65535, 698, 1640, 65535, 65535, 910, 65535, 65535,
+    1616, 1043, 65535, 65535, 2084, 479, 65535, 65535, 164, 65535, 65535, 65535,
+    65535, 933, 65535, 113, 65535, 930, 65535, 65535, 65535, 1550, 65535, 65535,
+    1546, 840, 65535, 65535, 65535, 2125, 65535, 1517, 65535, 65535, 54, 65535,
+    1478, 1743, 2032, 1027, 65535, 506, 2028, 1226, 65535, 65535, 65535, 65535,
+    65535, 65535, 289, 65535, 65535, 1303, 65535, 65535, 65535, 746, 65535, 1348,
+    65535, 1161, 65535, 65535, 65535, 65535, 532, 985, 65535, 763, 65535, 65535,
+    1824, 593, 65535, 65535, 65535, 65535, 65535, 1266, 1079, 65535, 671, 1374,
+    65535, 1985, 2030, 65535, 65535, 65535, 65535, 35, 65535, 65535, 62, 65535,
+    65535, 65535, 2017, 65535, 1107, 65535, 65535, 65535, 830, 785, 1516, 1868,
+    733, 65535, 297, 1879, 65535, 65535, 65535, 65535, 1934, 65535, 65535, 410,
+    65535, 2118, 64, 1592, 65535, 769, 481, 1335, 884, 1015, 1972, 2040,
+    1834, 1887, 1388, 65535, 627, 190, 1483, 1316, 433, 1417, 65535, 935,
+    1164, 1033, 1157, 65535, 1682, 65535, 65535, 65535, 65535, 65535, 65535, 1377,
+    1952, 65535, 65535, 65535, 65535, 65535, 81, 1922, 1129, 1134, 1515, 571,
+    1645, 967, 1407, 942, 65535, 65535, 1172, 65535, 538, 274, 807, 1120,
+    65535, 65535, 540, 65535, 65535, 589, 51, 65535, 2123, 775, 65535, 65535,
+    65535, 221, 65535, 65535, 320, 1560, 524, 65535, 65535, 1416, 65535, 65535,
+    608, 65535, 65535, 65535, 1651, 318, 1858, 65535, 156, 1045, 1881, 2055,
+    65535, 65535, 263, 10, 65535, 1693, 74, 594, 1414, 1840, 266, 65535,
+    732, 509, 2008, 65535, 65535, 65535, 65535, 1890, 18, 65535, 65535, 1022,
+    1324, 65535, 65535, 846, 65535, 65535, 25, 464, 917, 65535, 65535, 714,
+    65535, 65535, 65535, 65535, 1877, 65535, 625, 65535, 974, 65535, 65535, 65535,
+    65535, 65535, 1493, 65535, 546, 452, 1412, 1467, 1192, 65535, 1186, 103,
+    65535, 65535, 65535, 952, 65535, 65535, 65535, 1982, 2099, 454, 65535, 1156,
+    82, 1097, 65535, 1694, 1083, 2091, 1116, 65535, 65535, 392, 65535, 65535,
+    65535, 1229, 765, 11, 65535, 65535, 65535, 65535, 521, 65535, 65535, 65535,
+    1420, 1086, 65535, 65535, 65535, 72, 1221, 65535, 1594, 1276, 505, 65535,
+    65535, 65535, 65535, 278, 65535, 65535, 409, 624, 1655, 65535, 2072, 1650,
+    965, 65535, 1473, 1785, 1838, 655, 65535, 1009, 65535, 1947, 978, 267,
+    1264, 441, 65535, 290, 1257, 65535, 65535, 65535, 2006, 179, 1171, 65535,
+    833, 65535, 65535, 279, 65535, 1813, 1508, 1326, 144, 65535, 65535, 1055,
+    621, 2127, 193, 852, 1726, 1528, 129, 65535, 1298, 65535, 1611, 919,
+    323, 65535, 65535, 1590, 245, 181, 1117, 1011, 65535, 1750, 1167, 65535,
+    369, 774, 65535, 65535, 1751, 1675, 402, 65535, 65535, 65535, 484, 21,
+    65535, 730, 65535, 65535, 65535, 1772, 431, 65535, 1422, 65535, 1489, 1950,
+    526, 650, 1327, 65535, 65535, 65535, 65535, 1995, 515, 1366, 65535, 65535,
+    140, 65535, 753, 65535, 1288, 65535, 65535, 65535, 205, 65535, 65535, 65535,
+    173, 1423, 65535, 496, 1547, 65535, 65535, 65535, 347, 65535, 1233, 65535,
+    65535, 65535, 1536, 65535, 65535, 15, 286, 65535, 1204, 522, 1716, 1280,
+    241, 187, 65535, 1683, 1454, 65535, 1533, 65535, 710, 1542, 2012, 1448,
+    65535, 65535, 65535, 253, 65535, 368, 816, 65535, 270, 65535, 620, 65535,
+    282, 1155, 65535, 151, 1240, 1176, 65535, 272, 65535, 65535, 414, 65535,
+    65535, 65535, 65535, 65535, 65535, 2011, 326, 65535, 65535, 536, 1809, 1355,
+    1885, 65535, 575, 65535, 65535, 65535, 767, 336, 1747, 65535, 65535, 2102,
+    65535, 789, 65535, 2035, 450, 1629, 65535, 207, 42, 65535, 1323, 65535,
+    65535, 65535, 1603, 65535, 1351, 65535, 65535, 65535, 1802, 97, 2101, 65535,
+    636, 65535, 603, 2100, 65535, 843, 310, 1627, 65535, 65535, 65535, 1143,
+    1142, 808, 65535, 107, 570, 892, 65535, 65535, 65535, 858, 65535, 65535,
+    359, 1180, 1494, 438, 2029, 65535, 65535, 65535, 465, 65535, 65535, 206,
+    544, 1805, 142, 1339, 65535, 2119, 65535, 65535, 598, 1484, 1076, 1274,
+    65535, 1756, 756, 604, 810, 47, 65535, 864, 1559, 65535, 1299, 65535,
+    65535, 65535, 399, 666, 65535, 65535, 478, 65535, 1182, 65535, 1105, 1788,
+    104, 65535, 65535, 1806, 65535, 1066, 65535, 65535, 398, 405, 65535, 65535,
+    411, 1123, 488, 65535, 1936, 65535, 1912, 1400, 65535, 855, 1784, 316,
+    19, 842, 65535, 65535, 641, 1069, 1074, 1979, 65535, 1384, 1279, 1836,
+    65535, 65535, 65535, 65535, 1397, 1403, 1125, 65535, 65535, 1346, 303, 65535,
+    1752, 65535, 65535, 659, 65535, 65535, 65535, 23, 693, 65535, 65535, 65535,
+    1897, 1790, 335, 563, 977, 424, 122, 2050, 65535, 65535, 299, 1088,
+    65535, 65535, 1688, 65535, 65535, 65535, 1189, 2110, 65535, 1701, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 712, 65535,
+    65535, 1880, 65535, 65535, 2044, 793, 569, 65535, 1993, 65535, 1698, 65535,
+    1973, 65535, 65535, 65535, 65535, 901, 932, 65535, 65535, 65535, 1241, 1486,
+    65535, 65535, 306, 2010, 1211, 65535, 65535, 388, 2031, 1904, 1588, 65535,
+    65535, 65535, 800, 1492, 65535, 1644, 65535, 65535, 561, 903, 65535, 466,
+    1832, 65535, 720, 65535, 65535, 65535, 65535, 1565, 2104, 597, 65535, 1621,
+    2122, 65535, 49, 65535, 65535, 65535, 1325, 1300, 65535, 1817, 197, 1330,
+    1034, 1649, 1181, 1717, 65535, 24, 65535, 65535, 2043, 1038, 65535, 1360,
+    65535, 871, 65535, 65535, 1424, 65535, 652, 65535, 65535, 65535, 1364, 667,
+    43, 65535, 1862, 1794, 1128, 1674, 65535, 65535, 65535, 836, 65535, 1882,
+    65535, 1604, 390, 543, 549, 65535, 755, 65535, 1956, 65535, 65535, 65535,
+    75, 65535, 65535, 882, 65535, 1451, 217, 834, 65535, 65535, 65535, 360,
+    1014, 65535, 1195, 2068, 65535, 2090, 65535, 65535, 873, 1843, 65535, 65535,
+    1201, 65535, 880, 65535, 2087, 771, 301, 65535, 2126, 327, 65535, 65535,
+    65535, 65535, 1531, 728, 439, 65535, 1713, 2027, 325, 65535, 65535, 493,
+    1931, 65535, 65535, 989, 65535, 65535, 1475, 145, 65535, 65535, 65535, 65535,
+    1472, 65535, 65535, 1520, 65535, 65535, 65535, 65535, 65535, 866, 1207, 65535,
+    65535, 911, 65535, 65535, 65535, 65535, 65535, 1847, 583, 149, 1766, 555,
+    65535, 65535, 1581, 65535, 821, 65535, 65535, 1442, 1087, 1399, 65535, 65535,
+    65535, 65535, 1435, 679, 498, 65535, 65535, 65535, 65535, 65535, 65535, 2088,
+    65535, 65535, 65535, 65535, 580, 65535, 442, 65535, 65535, 65535, 65535, 2129,
+    65535, 65535, 968, 225, 65535, 386, 1392, 447, 251, 1829, 1004, 2053,
+    65535, 1446, 682, 114, 65535, 65535, 907, 65535, 65535, 1770, 342, 65535,
+    180, 65535, 65535, 65535, 881, 224, 230, 640, 65535, 65535, 958, 65535,
+    65535, 65535, 938, 654, 65535, 1891, 305, 65535, 65535, 1227, 1866, 65535,
+    1793, 772, 1602, 65535, 65535, 65535, 65535, 65535, 65535, 969, 817, 1458,
+    1676, 1308, 65535, 65535, 804, 65535, 65535, 944, 65535, 1246, 65535, 65535,
+    65535, 65535, 1803, 116, 65535, 65535, 65535, 1152, 65535, 65535, 1309, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1362, 65535, 1383, 65535, 65535, 1178,
+    1707, 1668, 1899, 65535, 685, 1130, 1041, 65535, 65535, 65535, 65535, 65535,
+    850, 1935, 312, 770, 216, 1744, 65535, 65535, 346, 1774, 184, 65535,
+    1313, 65535, 65535, 65535, 65535, 65535, 389, 65535, 65535, 1728, 65535, 65535,
+    982, 694, 65535, 65535, 495, 1622, 255, 65535, 382, 65535, 699, 65535,
+    2057, 7, 894, 65535, 65535, 65535, 65535, 1232, 1812, 65535, 65535, 65535,
+    65535, 65535, 65535, 351, 692, 65535, 65535, 65535, 65535, 65535, 239, 1625,
+    1741, 606, 1277, 65535, 65535, 551, 1610, 65535, 577, 65535, 716, 65535,
+    65535, 280, 1132, 1285, 1639, 65535, 65535, 65535, 429, 1944, 2121, 65535,
+    1503, 65535, 65535, 741, 1585, 65535, 65535, 67, 65535, 1807, 1318, 1911,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 1896, 1739, 751, 65535, 1709,
+    607, 1124, 65535, 65535, 65535, 1633, 65535, 65535, 595, 1194, 2108, 814,
+    65535, 65535, 1878, 65535, 822, 65535, 1544, 65535, 1310, 1958, 65535, 146,
+    673, 294, 1252, 533, 1561, 65535, 1960, 65535, 65535, 284, 1197, 192,
+    1850, 65535, 472, 1404, 65535, 65535, 65535, 643, 829, 564, 65535, 65535,
+    65535, 451, 65535, 567, 65535, 1725, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 387, 65535, 461, 1321, 1777, 65535, 65535, 65535, 26, 65535, 65535,
+    65535, 1753, 65535, 65535, 65535, 2098, 956, 463, 65535, 1389, 65535, 1522,
+    1016, 65535, 1210, 65535, 0, 460, 65535, 987, 65535, 1179, 1933, 1869,
+    65535, 65535, 65535, 65535, 416, 2002, 65535, 52, 65535, 65535, 95, 65535,
+    1771, 65535, 65535, 65535, 65535, 1710, 65535, 798, 1168, 65535, 1580, 65535,
+    65535, 65535, 599, 220, 1514, 65535, 65535, 65535, 65535, 65535, 277, 1732,
+    65535, 65535, 1642, 65535, 92, 1618, 65535, 887, 65535, 65535, 65535, 1609,
+    1290, 65535, 65535, 65535, 707, 65535, 65535, 65535, 908, 65535, 65535, 831,
+    1071, 65535, 65535, 65535, 1215, 65535, 825, 65535, 1641, 420, 1965, 65535,
+    1619, 65535, 65535, 557, 65535, 65535, 971, 228, 820, 1671, 65535, 366,
+    458, 65535, 65535, 65535, 65535, 65535, 1736, 257, 377, 1340, 949, 65535,
+    65535, 65535, 65535, 1800, 65535, 1430, 65535, 1962, 981, 1977, 324, 1759,
+    1175, 1272, 48, 65535, 959, 819, 1050, 65535, 65535, 749, 802, 65535,
+    65535, 1259, 65535, 65535, 65535, 2079, 1564, 916, 412, 65535, 65535, 185,
+    65535, 166, 65535, 1381, 65535, 697, 647, 407, 790, 348, 1799, 65535,
+    1353, 65535, 65535, 1746, 65535, 65535, 65535, 65535, 999, 65535, 93, 1278,
+    65535, 65535, 915, 65535, 691, 1569, 65535, 65535, 1439, 590, 65535, 1731,
+    65535, 507, 2076, 976, 1543, 65535, 1190, 223, 65535, 65535, 65535, 1712,
+    1692, 1293, 1678, 65535, 65535, 545, 65535, 65535, 632, 65535, 65535, 878,
+    65535, 645, 1372, 65535, 65535, 1910, 1867, 65535, 1006, 1888, 283, 723,
+    65535, 1954, 1652, 65535, 65535, 212, 1646, 1990, 874, 1906, 482, 1612,
+    418, 65535, 966, 65535, 1136, 65535, 118, 65535, 1106, 65535, 65535, 65535,
+    65535, 134, 517, 1859, 1444, 65535, 1287, 2041, 897, 65535, 65535, 65535,
+    65535, 924, 612, 65535, 65535, 65535, 436, 332, 1068, 65535, 65535, 688,
+    65535, 65535, 65535, 65535, 246, 868, 358, 65535, 65535, 1386, 1697, 65535,
+    550, 65535, 65535, 862, 65535, 65535, 65535, 1512, 869, 502, 65535, 65535,
+    65535, 1170, 491, 860, 709, 65535, 250, 65535, 65535, 65535, 65535, 725,
+    1304, 435, 65535, 1804, 65535, 65535, 1104, 65535, 65535, 65535, 65535, 65535,
+    65535, 1919, 1715, 1214, 65535, 65535, 65535, 1816, 65535, 1236, 65535, 1734,
+    65535, 909, 1262, 53, 65535, 1185, 65535, 1007, 63, 354, 65535, 65535,
+    65535, 65535, 1844, 65535, 995, 65535, 1574, 65535, 65535, 65535, 1601, 1002,
+    65535, 69, 1527, 1525, 65535, 65535, 65535, 1632, 1579, 1269, 65535, 1311,
+    65535, 65535, 65535, 708, 65535, 65535, 65535, 65535, 1815, 65535, 1924, 65535,
+    121, 1554, 65535, 739, 352, 483, 773, 1077, 65535, 65535, 65535, 218,
+    644, 1193, 65535, 1000, 65535, 65535, 955, 302, 65535, 65535, 1449, 65535,
+    65535, 1708, 65535, 1254, 65535, 65535, 1297, 1730, 703, 668, 65535, 65535,
+    65535, 65535, 1256, 65535, 337, 1861, 65535, 65535, 1913, 1234, 123, 65535,
+    1137, 1408, 1870, 65535, 400, 37, 1003, 1461, 65535, 56, 65535, 383,
+    65535, 65535, 65535, 65535, 65535, 742, 1773, 1270, 65535, 471, 65535, 65535,
+    2095, 65535, 1538, 65535, 1217, 65535, 65535, 811, 65535, 890, 1666, 1719,
+    65535, 1821, 1312, 1874, 65535, 1159, 201, 65535, 376, 65535, 65535, 65535,
+    65535, 1937, 690, 65535, 1092, 701, 65535, 65535, 65535, 511, 1082, 321,
+    777, 983, 65535, 65535, 65535, 437, 711, 1482, 65535, 65535, 65535, 65535,
+    65535, 65535, 261, 65535, 473, 65535, 65535, 587, 65535, 65535, 65535, 65535,
+    1, 1465, 1153, 65535, 2048, 65535, 65535, 470, 65535, 65535, 65535, 65535,
+    553, 1810, 65535, 65535, 1681, 65535, 1967, 757, 879, 65535, 65535, 77,
+    906, 65535, 762, 1959, 1169, 1065, 65535, 65535, 1020, 65535, 65535, 2046,
+    427, 65535, 1111, 1385, 1992, 65535, 68, 988, 65535, 262, 1410, 65535,
+    65535, 469, 65535, 927, 900, 1158, 65535, 1856, 1828, 991, 1328, 1690,
+    791, 65535, 84, 65535, 65535, 1183, 65535, 743, 851, 65535, 65535, 65535,
+    65535, 65535, 209, 1433, 65535, 65535, 65535, 65535, 169, 339, 605, 317,
+    1084, 65535, 65535, 65535, 65535, 727, 1662, 65535, 1635, 1842, 141, 1507,
+    1497, 1541, 1436, 1994, 65535, 395, 1613, 2062, 65535, 12, 6, 2120,
+    65535, 65535, 65535, 1971, 65535, 249, 646, 65535, 65535, 1614, 65535, 65535,
+    65535, 1350, 65535, 65535, 65535, 65535, 65535, 65535, 1359, 65535, 89, 356,
+    700, 65535, 158, 65535, 268, 65535, 38, 65535, 2085, 1237, 65535, 213,
+    1892, 273, 167, 689, 65535, 1445, 65535, 65535, 65535, 210, 957, 65535,
+    745, 65535, 65535, 413, 1811, 65535, 83, 657, 65535, 170, 1199, 1872,
+    600, 65535, 65535, 65535, 448, 65535, 1504, 65535, 159, 573, 948, 65535,
+    65535, 1177, 65535, 65535, 764, 65535, 1745, 65535, 428, 58, 1146, 65535,
+    1711, 1224, 65535, 65535, 157, 65535, 65535, 738, 1218, 76, 926, 5,
+    65535, 65535, 1724, 1133, 631, 65535, 65535, 65535, 1319, 65535, 468, 65535,
+    936, 1545, 1796, 65535, 65535, 65535, 65535, 65535, 1499, 65535, 1926, 993,
+    65535, 490, 1365, 417, 65535, 232, 65535, 1457, 65535, 65535, 1798, 1010,
+    65535, 1332, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 380, 788,
+    65535, 202, 65535, 676, 65535, 85, 65535, 65535, 65535, 27, 1615, 80,
+    1283, 65535, 136, 1396, 65535, 1539, 65535, 474, 65535, 65535, 961, 65535,
+    65535, 65535, 65535, 1932, 252, 65535, 65535, 1091, 795, 885, 65535, 65535,
+    1046, 65535, 963, 508, 1244, 65535, 330, 1479, 65535, 1572, 1763, 65535,
+    1831, 65535, 1647, 525, 65535, 1980, 65535, 1634, 680, 65535, 65535, 946,
+    65535, 65535, 65535, 664, 1848, 65535, 1206, 65535, 937, 65535, 877, 990,
+    65535, 350, 1984, 3, 161, 1357, 1782, 1905, 65535, 876, 1375, 244,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1898, 65535, 737, 65535,
+    30, 1927, 65535, 65535, 1495, 65535, 475, 65535, 426, 65535, 65535, 66,
+    65535, 65535, 65535, 112, 65535, 1411, 394, 65535, 1951, 1941, 65535, 260,
+    65535, 1485, 98, 1145, 1334, 2071, 824, 401, 1637, 794, 65535, 492,
+    65535, 1067, 65535, 65535, 888, 648, 65535, 1787, 1630, 1030, 108, 65535,
+    2009, 1566, 65535, 1258, 2036, 65535, 65535, 65535, 2103, 285, 1450, 65535,
+    1667, 1822, 65535, 1228, 65535, 65535, 381, 65535, 792, 65535, 1841, 2116,
+    1225, 96, 65535, 65535, 2047, 131, 568, 4, 65535, 1073, 65535, 1589,
+    1938, 127, 65535, 65535, 65535, 65535, 31, 65535, 296, 1443, 357, 65535,
+    65535, 65535, 70, 65535, 1540, 65535, 65535, 138, 1028, 65535, 1875, 634,
+    65535, 65535, 28, 65535, 65535, 1606, 455, 65535, 65535, 65535, 1481, 1835,
+    1620, 534, 1718, 2025, 1830, 65535, 421, 1562, 616, 1314, 65535, 65535,
+    65535, 65535, 724, 1109, 430, 856, 1907, 65535, 65535, 1827, 65535, 768,
+    65535, 65535, 163, 65535, 596, 334, 65535, 65535, 1963, 65535, 576, 65535,
+    65535, 499, 1761, 65535, 1468, 65535, 1378, 65535, 160, 779, 449, 65535,
+    1529, 1699, 1401, 65535, 1921, 65535, 2093, 1391, 863, 65535, 943, 65535,
+    65535, 630, 65535, 1131, 633, 65535, 397, 304, 1230, 1440, 1487, 1586,
+    1818, 1754, 1702, 1060, 65535, 704, 65535, 65535, 65535, 65535, 1058, 2073,
+    65535, 65535, 1551, 65535, 440, 539, 65535, 827, 918, 462, 1598, 801,
+    45, 1997, 65535, 1361, 65535, 148, 1567, 243, 2105, 485, 1955, 1704,
+    1705, 1764, 65535, 65535, 154, 65535, 65535, 65535, 1459, 65535, 65535, 1909,
+    39, 195, 2014, 65535, 776, 1338, 453, 65535, 65535, 2001, 760, 65535,
+    65535, 71, 404, 65535, 65535, 2019, 1242, 731, 838, 65535, 60, 288,
+    65535, 2094, 65535, 135, 59, 65535, 2045, 870, 341, 133, 65535, 65535,
+    65535, 65535, 90, 898, 65535, 65535, 65535, 1648, 65535, 65535, 2054, 875,
+    65535, 1691, 65535, 65535, 65535, 1857, 65535, 65535, 1917, 2074, 1220, 65535,
+    805, 1855, 65535, 242, 1005, 65535, 1080, 670, 1599, 1118, 446, 828,
+    65535, 2083, 1729, 65535, 65535, 1901, 65535, 65535, 65535, 65535, 65535, 1222,
+    65535, 797, 839, 65535, 1282, 65535, 34, 1593, 1721, 65535, 1576, 1251,
+    619, 65535, 65535, 65535, 2007, 1578, 1162, 65535, 65535, 837, 65535, 65535,
+    1367, 1148, 1273, 65535, 649, 1415, 904, 65535, 65535, 1577, 168, 65535,
+    1657, 945, 65535, 65535, 1903, 174, 65535, 65535, 65535, 1212, 65535, 65535,
+    1122, 2109, 65535, 656, 65535, 65535, 65535, 65535, 1382, 65535, 46, 65535,
+    65535, 65535, 65535, 1814, 378, 65535, 1331, 1072, 65535, 683, 65535, 1733,
+    65535, 65535, 65535, 65535, 2117, 65535, 1477, 65535, 637, 65535, 759, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1894, 44, 65535, 65535,
+    457, 1851, 1292, 65535, 754, 385, 1302, 189, 677, 65535, 1184, 65535,
+    65535, 1265, 65535, 287, 65535, 65535, 65535, 1343, 162, 65535, 740, 1583,
+    65535, 1394, 65535, 65535, 1563, 32, 914, 1093, 1024, 65535, 996, 2069,
+    1755, 434, 1672, 1703, 2081, 298, 65535, 1425, 65535, 65535, 65535, 1833,
+    65535, 65535, 65535, 65535, 65535, 65535, 588, 65535, 65535, 65535, 65535, 1974,
+    1920, 581, 65535, 1100, 65535, 665, 65535, 65535, 172, 65535, 735, 110,
+    344, 1968, 2075, 65535, 1061, 65535, 65535, 582, 115, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 406, 558, 1786, 65535, 65535, 1434,
+    65535, 65535, 65535, 1970, 65535, 65535, 65535, 1488, 65535, 954, 65535, 65535,
+    1110, 1315, 65535, 675, 423, 65535, 2, 370, 16, 65535, 972, 994,
+    65535, 65535, 65535, 361, 65535, 254, 313, 1767, 65535, 1163, 1421, 1584,
+    65535, 65535, 784, 65535, 1291, 1341, 2018, 1506, 651, 65535, 65535, 2052,
+    65535, 65535, 65535, 422, 1139, 1526, 65535, 65535, 1778, 65535, 1284, 65535,
+    65535, 105, 65535, 315, 65535, 602, 65535, 1040, 276, 65535, 1295, 65535,
+    65535, 65535, 188, 65535, 1281, 65535, 1491, 379, 2004, 65535, 65535, 65535,
+    65535, 2022, 65535, 1776, 1017, 65535, 2063, 65535, 1923, 65535, 1659, 65535,
+    65535, 311, 65535, 65535, 2132, 65535, 1268, 65535, 200, 65535, 65535, 1317,
+    65535, 1119, 552, 65535, 41, 65535, 1271, 1352, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 1243, 65535, 65535, 322, 9, 1051, 65535, 1173, 1571,
+    1679, 920, 175, 65535, 1013, 494, 211, 65535, 65535, 1070, 65535, 365,
+    139, 256, 65535, 65535, 1864, 65535, 65535, 65535, 1607, 1768, 65535, 65535,
+    787, 613, 319, 1663, 65535, 65535, 65535, 65535, 65535, 65535, 986, 65535,
+    65535, 939, 137, 65535, 65535, 1623, 1839, 518, 513, 65535, 1670, 528,
+    65535, 893, 1673, 65535, 1948, 973, 65535, 65535, 1474, 559, 65535, 65535,
+    419, 65535, 65535, 65535, 2097, 65535, 355, 1823, 65535, 65535, 1500, 65535,
+    1737, 1174, 65535, 1940, 1379, 65535, 883, 65535, 1219, 65535, 845, 203,
+    65535, 1665, 1138, 1591, 182, 65535, 65535, 1511, 477, 374, 153, 529,
+    234, 1012, 2080, 65535, 1685, 150, 65535, 2020, 65535, 584, 1089, 235,
+    204, 1135, 65535, 73, 1025, 523, 1188, 929, 1390, 65535, 331, 1953,
+    1409, 65535, 65535, 65535, 65535, 1532, 65535, 65535, 415, 65535, 65535, 585,
+    65535, 65535, 65535, 1398, 100, 65535, 1112, 65535, 1213, 65535, 1863, 384,
+    65535, 1260, 65535, 1677, 964, 445, 1808, 1706, 1032, 65535, 1600, 65535,
+    65535, 2128, 1608, 65535, 65535, 1876, 1893, 678, 65535, 65535, 65535, 1081,
+    1775, 574, 65535, 586, 65535, 1102, 1523, 2130, 65535, 1462, 65535, 1429,
+    1090, 951, 1121, 998, 813, 921, 65535, 333, 65535, 872, 291, 65535,
+    65535, 1696, 65535, 2096, 65535, 65535, 848, 65535, 1687, 1999, 425, 214,
+    1113, 65535, 65535, 1942, 371, 65535, 1664, 65535, 674, 65535, 65535, 65535,
+    1929, 65535, 65535, 65535, 65535, 1660, 198, 65535, 1689, 65535, 65535, 65535,
+    1078, 65535, 970, 65535, 65535, 65535, 889, 65535, 65535, 65535, 669, 1895,
+    264, 65535, 65535, 922, 1187, 65535, 1114, 1247, 2112, 1714, 65535, 65535,
+    329, 1723, 681, 65535, 1296, 1964, 947, 1769, 65535, 1039, 1852, 696,
+    653, 1684, 1463, 1427, 227, 65535, 780, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1988, 1509, 891, 758, 1419, 1991, 65535, 2003, 65535, 65535,
+    99, 65535, 1914, 1722, 65535, 65535, 1998, 662, 65535, 65535, 628, 1945,
+    65535, 2037, 65535, 65535, 65535, 1026, 65535, 497, 65535, 65535, 20, 65535,
+    65535, 307, 130, 65535, 984, 591, 65535, 1431, 403, 65535, 1075, 65535,
+    65535, 65535, 300, 65535, 65535, 899, 271, 713, 734, 314, 1140, 500,
+    615, 2005, 642, 65535, 65535, 2021, 65535, 1490, 65535, 467, 476, 913,
+    65535, 65535, 65535, 65535, 65535, 1200, 65535, 65535, 65535, 65535, 65535, 65535,
+    1883, 1036, 65535, 65535, 65535, 65535, 65535, 1054, 65535, 65535, 65535, 623,
+    1765, 1438, 1518, 119, 812, 194, 65535, 65535, 65535, 65535, 124, 65535,
+    65535, 65535, 65535, 1096, 65535, 2038, 65535, 65535, 65535, 65535, 1884, 111,
+    65535, 1521, 65535, 65535, 1203, 393, 65535, 1432, 65535, 65535, 65535, 1294,
+    444, 13, 65535, 1460, 65535, 1501, 65535, 65535, 1047, 1996, 2039, 2023,
+    65535, 1453, 512, 281,
+}};
+
+constexpr uint32_t hashEntityName(std::string_view name, uint32_t seed)
+{
+  uint32_t h = 2166136261u ^ seed;
+  for (const char c : name) {
+    h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+  }
+  h ^= h >> 16;
+  h *= 0x7feb352du;
+  return h ^ (h >> 15);
+}
+
+} // namespace
+
+std::optional<std::string_view> lookupHtmlEntity(std::string_view name)
+{
+  if (name.empty() || name.size() > kMaxHtmlEntityNameLength) {
+    return std::nullopt;
+  }
+  const uint16_t seed = kSeeds[hashEntityName(name, 0) % kBucketCount];
+  const uint16_t index = kSlots[hashEntityName(name, seed) % kSlotCount];
+  if (index == kEmptySlot) {
+    return std::nullopt;
+  }
+  const EntityRecord& entity = kEntities[index];
+  if (std::string_view(kNames + entity.nameOffset, entity.nameLength) != name) {
+    return std::nullopt;
+  }
+  return std::string_view(kValues + entity.valueOffset, entity.valueLength);
+}
+
+} // namespace margelo::nitro::nitrotext
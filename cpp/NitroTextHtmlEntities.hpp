@@ -0,0 +1,30 @@
+//
+// NitroTextHtmlEntities.hpp
+// Named character references understood by the native HTML renderer
+//
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * Length of the longest name, `CounterClockwiseContourIntegral`.
+ */
+constexpr size_t kMaxHtmlEntityNameLength = 31;
+
+/**
+ * @brief Looks up a named character reference without its `&` and `;`
+ * ("amp", "nbsp", "frac12", ...) and returns its UTF-8 replacement. Names
+ * are case sensitive.
+ *
+ * Covers every HTML5 reference that ends in `;`, plus a few names the JS
+ * renderer's table adds. One hash probe into a perfect hash table, then a
+ * single name compare.
+ */
+std::optional<std::string_view> lookupHtmlEntity(std::string_view name);
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,110 @@
+//
+// NitroTextHtmlNames.cpp
+// Tag and attribute names of the native HTML parser as small integer IDs
+//
+
+#include "NitroTextHtmlNames.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+// Indexed by `HtmlName`, so also sorted.
+constexpr std::array<std::string_view, static_cast<size_t>(HtmlName::FirstDynamic)> kWellKnownNames = {
+    "#root",
+    "a", "alt", "area", "article", "aside",
+    "b", "base", "blockquote", "body", "br",
+    "center", "class", "classname", "code", "col",
+    "del", "div",
+    "em", "embed",
+    "figcaption", "figure", "font", "footer",
+    "h1", "h2", "h3", "h4", "h5", "h6", "head", "header", "height", "hr", "href", "html",
+    "i", "id", "img", "input",
+    "li", "link",
+    "main", "mark", "meta",
+    "nav",
+    "ol",
+    "p", "param", "pre",
+    "s", "script", "section", "small", "source", "span", "src", "strike", "strong", "style", "sub", "sup",
+    "table", "tbody", "td", "th", "thead", "title", "tr", "track",
+    "u", "ul",
+    "wbr", "width",
+};
+
+constexpr bool isSorted()
+{
+  for (size_t i = 1; i < kWellKnownNames.size(); i++) {
+    if (!(kWellKnownNames[i - 1] < kWellKnownNames[i])) return false;
+  }
+  return true;
+}
+static_assert(isSorted(), "HtmlName and kWellKnownNames must stay sorted for binary search");
+static_assert(kWellKnownNames.back() == "width", "kWellKnownNames is missing a name of HtmlName");
+
+} // namespace
+
+std::optional<HtmlName> HtmlNameTable::lookupWellKnown(std::string_view lowercaseName) noexcept
+{
+  auto it = std::lower_bound(kWellKnownNames.begin(), kWellKnownNames.end(), lowercaseName);
+  if (it == kWellKnownNames.end() || *it != lowercaseName) {
+    return std::nullopt;
+  }
+  return static_cast<HtmlName>(it - kWellKnownNames.begin());
+}
+
+std::string_view HtmlNameTable::str(HtmlName name) const noexcept
+{
+  const auto index = static_cast<size_t>(name);
+  if (index < kWellKnownNames.size()) {
+    return kWellKnownNames[index];
+  }
+  const size_t dynamicIndex = index - kWellKnownNames.size();
+  return dynamicIndex < dynamicNames_.size() ? dynamicNames_[dynamicIndex] : std::string_view();
+}
+
+std::string_view HtmlNameTable::lowercase(std::string_view rawName)
+{
+  auto isUpper = [](char c) { return c >= 'A' && c <= 'Z'; };
+  if (std::none_of(rawName.begin(), rawName.end(), isUpper)) {
+    return rawName;
+  }
+  lowercaseScratch_.assign(rawName);
+  for (char& c : lowercaseScratch_) {
+    if (isUpper(c)) c = static_cast<char>(c + ('a' - 'A'));
+  }
+  return lowercaseScratch_;
+}
+
+uint32_t* HtmlNameTable::findSlot(std::string_view name, size_t hash) noexcept
+{
+  if (slots_.empty()) return nullptr;
+  const size_t mask = slots_.size() - 1;
+  for (size_t i = hash & mask;; i = (i + 1) & mask) {
+    uint32_t& slot = slots_[i];
+    if (slot == 0 || str(static_cast<HtmlName>(slot)) == name) return &slot;
+  }
+}
+
+HtmlName HtmlNameTable::insertDynamic(std::string_view name, size_t hash)
+{
+  const auto id = static_cast<uint32_t>(kWellKnownNames.size() + dynamicNames_.size());
+  dynamicNames_.push_back(name);
+
+  // Keep the load factor at or below 1/2.
+  if (dynamicNames_.size() * 2 > slots_.size()) {
+    slots_.assign(std::max<size_t>(16, slots_.size() * 2), 0);
+    for (size_t i = 0; i < dynamicNames_.size(); i++) {
+      const std::string_view existing = dynamicNames_[i];
+      *findSlot(existing, std::hash<std::string_view>{}(existing)) =
+          static_cast<uint32_t>(kWellKnownNames.size() + i);
+    }
+  } else {
+    *findSlot(name, hash) = id;
+  }
+  return static_cast<HtmlName>(id);
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,162 @@
+//
+// NitroTextHtmlNames.hpp
+// Tag and attribute names of the native HTML parser as small integer IDs
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * A lowercased tag or attribute name. Every name the renderer or the CSS
+ * processor looks at is a fixed ID, so they can `switch` over it; any other
+ * name gets the next free ID of its document's `HtmlNameTable`.
+ *
+ * Keep the well-known names sorted (`kWellKnownNames` in the .cpp mirrors
+ * this list).
+ */
+enum class HtmlName : uint32_t {
+  Root, // "#root", the document
+  A,
+  Alt,
+  Area,
+  Article,
+  Aside,
+  B,
+  Base,
+  Blockquote,
+  Body,
+  Br,
+  Center,
+  Class,
+  ClassName,
+  Code,
+  Col,
+  Del,
+  Div,
+  Em,
+  Embed,
+  Figcaption,
+  Figure,
+  Font,
+  Footer,
+  H1,
+  H2,
+  H3,
+  H4,
+  H5,
+  H6,
+  Head,
+  Header,
+  Height,
+  Hr,
+  Href,
+  Html,
+  I,
+  Id,
+  Img,
+  Input,
+  Li,
+  Link,
+  Main,
+  Mark,
+  Meta,
+  Nav,
+  Ol,
+  P,
+  Param,
+  Pre,
+  S,
+  Script,
+  Section,
+  Small,
+  Source,
+  Span,
+  Src,
+  Strike,
+  Strong,
+  Style,
+  Sub,
+  Sup,
+  Table,
+  Tbody,
+  Td,
+  Th,
+  Thead,
+  Title,
+  Tr,
+  Track,
+  U,
+  Ul,
+  Wbr,
+  Width,
+  // First ID handed out to names outside the list above.
+  FirstDynamic,
+};
+
+/**
+ * Interns the tag and attribute names of one document.
+ *
+ * Well-known names resolve through a static sorted table. Other names are
+ * kept in a small open-addressing table; their text is a view into the
+ * source when it is already lowercase, so the source must outlive the table.
+ */
+class HtmlNameTable final {
+public:
+  /**
+   * @brief Returns the ID of `rawName` lowercased (ASCII).
+   * @param copyName Stores a lowercased name that is not in the source and
+   * returns a view that outlives the table (the document's arena).
+   */
+  template <typename CopyName>
+  HtmlName intern(std::string_view rawName, CopyName&& copyName)
+  {
+    const std::string_view lowered = lowercase(rawName);
+    if (auto known = lookupWellKnown(lowered)) return *known;
+    return internDynamic(lowered, rawName, copyName);
+  }
+
+  /**
+   * @brief The lowercased text of `name`.
+   */
+  std::string_view str(HtmlName name) const noexcept;
+
+  /**
+   * @brief Number of names outside the well-known list seen so far.
+   */
+  size_t dynamicCount() const noexcept { return dynamicNames_.size(); }
+
+  static std::optional<HtmlName> lookupWellKnown(std::string_view lowercaseName) noexcept;
+
+private:
+  std::string_view lowercase(std::string_view rawName);
+
+  template <typename CopyName>
+  HtmlName internDynamic(std::string_view lowered, std::string_view rawName, CopyName& copyName)
+  {
+    const size_t hash = std::hash<std::string_view>{}(lowered);
+    if (uint32_t* slot = findSlot(lowered, hash); slot != nullptr && *slot != 0) {
+      return static_cast<HtmlName>(*slot);
+    }
+    // Names already lowercase are views into the source.
+    const std::string_view stored = lowered.data() == rawName.data() ? rawName : copyName(lowered);
+    return insertDynamic(stored, hash);
+  }
+
+  uint32_t* findSlot(std::string_view name, size_t hash) noexcept;
+  HtmlName insertDynamic(std::string_view name, size_t hash);
+
+  std::string lowercaseScratch_;
+  std::vector<std::string_view> dynamicNames_;
+  // Open addressing over `dynamicNames_`; 0 is empty, otherwise the ID.
+  std::vector<uint32_t> slots_;
+};
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,97 @@
+//
+// NitroTextHtmlNode.hpp
+// Parsed HTML tree consumed by the native HTML renderer
+//
+
+#pragma once
+
+#include "NitroTextArena.hpp"
+#include "NitroTextHtmlNames.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace margelo::nitro::nitrotext {
+
+struct HtmlAttribute {
+  HtmlName name;
+  // Raw value, a view into the source.
+  std::string_view value;
+};
+
+/**
+ * An element or text node, allocated in its document's arena. Children form
+ * a singly linked list so appending never reallocates.
+ *
+ * Text and attribute values are views into the source and are left raw;
+ * entities are decoded when the text is rendered.
+ */
+struct HtmlNode {
+  enum class Type : uint8_t { Element, Text };
+
+  Type type = Type::Element;
+  HtmlName tag = HtmlName::Root;
+  uint32_t attributeCount = 0;
+  // Lowercased tag name of an element, "#root" for the document.
+  std::string_view tagName;
+  // Raw text of a text node.
+  std::string_view content;
+  // Attributes in source order, each name once (the last value wins, like
+  // assigning into a JS object).
+  const HtmlAttribute* attributes = nullptr;
+  HtmlNode* firstChild = nullptr;
+  HtmlNode* lastChild = nullptr;
+  HtmlNode* nextSibling = nullptr;
+
+  bool isText() const noexcept { return type == Type::Text; }
+
+  /**
+   * @brief The attribute value, or `std::nullopt` if the attribute is missing.
+   */
+  std::optional<std::string_view> attribute(HtmlName name) const noexcept
+  {
+    for (uint32_t i = 0; i < attributeCount; i++) {
+      if (attributes[i].name == name) return attributes[i].value;
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * @brief The attribute value if present and non-empty (JS truthiness).
+   */
+  std::optional<std::string_view> nonEmptyAttribute(HtmlName name) const noexcept
+  {
+    auto value = attribute(name);
+    return value.has_value() && !value->empty() ? value : std::nullopt;
+  }
+
+  void appendChild(HtmlNode* child) noexcept
+  {
+    if (lastChild != nullptr) {
+      lastChild->nextSibling = child;
+    } else {
+      firstChild = child;
+    }
+    lastChild = child;
+  }
+};
+
+static_assert(std::is_trivially_destructible_v<HtmlNode>, "HtmlNode lives in an Arena");
+
+/**
+ * A parsed document: the tree, its arena and its interned names.
+ *
+ * Text, attribute values and most names are views into the parsed source,
+ * so the source must outlive the document.
+ */
+struct HtmlDocument {
+  explicit HtmlDocument(size_t arenaChunkSize) : arena(arenaChunkSize) {}
+
+  Arena arena;
+  HtmlNameTable names;
+  HtmlNode* root = nullptr;
+};
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,181 @@
+//
+// NitroTextHtmlRenderCache.cpp
+// Process-wide cache of rendered `renderer="html"` markup
+//
+
+#include "NitroTextHtmlRenderCache.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+struct CacheEntry {
+  std::shared_ptr<const std::vector<Fragment>> fragments;
+  size_t bytes = 0;
+  uint64_t lastUsed = 0;
+};
+
+struct RenderTable {
+  std::mutex mutex;
+  std::unordered_map<std::string, CacheEntry> entries;
+  size_t bytes = 0;
+  uint64_t clock = 0;
+  HtmlRenderCache::Stats stats;
+};
+
+RenderTable& table()
+{
+  // Intentionally leaked, like the stylesheet cache.
+  static auto* instance = new RenderTable();
+  return *instance;
+}
+
+// Every field is tagged and strings are length-prefixed, so no two base
+// styles share a fingerprint.
+void appendField(std::string& key, char tag, const std::optional<std::string>& value)
+{
+  if (!value) return;
+  key.push_back(tag);
+  key += std::to_string(value->size());
+  key.push_back(':');
+  key += *value;
+}
+
+void appendField(std::string& key, char tag, const std::optional<double>& value)
+{
+  if (!value) return;
+  char bits[sizeof(double)];
+  std::memcpy(bits, &*value, sizeof(double));
+  key.push_back(tag);
+  key.append(bits, sizeof(double));
+}
+
+template <typename Enum>
+void appendField(std::string& key, char tag, const std::optional<Enum>& value)
+{
+  if (!value) return;
+  key.push_back(tag);
+  key.push_back(static_cast<char>(static_cast<int>(*value)));
+}
+
+// The base style's fingerprint, then the markup. `text` is not part of the
+// cascade, so it is left out.
+std::string makeKey(std::string_view html, const Fragment& base)
+{
+  std::string key;
+  key.reserve(html.size() + 64);
+  appendField(key, 'a', base.selectionColor);
+  appendField(key, 'b', base.fontSize);
+  appendField(key, 'c', base.fontWeight);
+  appendField(key, 'd', base.fontColor);
+  appendField(key, 'e', base.fragmentBackgroundColor);
+  appendField(key, 'f', base.fontStyle);
+  appendField(key, 'g', base.fontFamily);
+  appendField(key, 'h', base.lineHeight);
+  appendField(key, 'i', base.letterSpacing);
+  appendField(key, 'j', base.textAlign);
+  appendField(key, 'k', base.textTransform);
+  appendField(key, 'l', base.textDecorationLine);
+  appendField(key, 'm', base.textDecorationColor);
+  appendField(key, 'n', base.textDecorationStyle);
+  appendField(key, 'o', base.linkUrl);
+  key.push_back('|');
+  key.append(html);
+  return key;
+}
+
+size_t textBytes(const std::vector<Fragment>& fragments)
+{
+  size_t bytes = 0;
+  for (const auto& fragment : fragments) {
+    bytes += sizeof(Fragment) + (fragment.text ? fragment.text->size() : 0);
+  }
+  return bytes;
+}
+
+void evictLeastRecentlyUsed(RenderTable& t)
+{
+  auto oldest = t.entries.begin();
+  for (auto it = t.entries.begin(); it != t.entries.end(); ++it) {
+    if (it->second.lastUsed < oldest->second.lastUsed) oldest = it;
+  }
+  if (oldest == t.entries.end()) return;
+  t.bytes -= oldest->second.bytes;
+  t.entries.erase(oldest);
+}
+
+} // namespace
+
+std::shared_ptr<const std::vector<Fragment>> HtmlRenderCache::render(std::string_view html,
+                                                                     const Fragment& baseFragment)
+{
+  if (html.size() > kMaxEntryBytes) {
+    return std::make_shared<const std::vector<Fragment>>(HtmlRenderer::render(html, baseFragment).fragments);
+  }
+
+  auto& t = table();
+  std::string key = makeKey(html, baseFragment);
+  {
+    std::lock_guard<std::mutex> lock(t.mutex);
+    auto it = t.entries.find(key);
+    if (it != t.entries.end()) {
+      it->second.lastUsed = ++t.clock;
+      t.stats.hits++;
+      return it->second.fragments;
+    }
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  HtmlRenderResult result = HtmlRenderer::render(html, baseFragment);
+  const auto end = std::chrono::steady_clock::now();
+  auto fragments = std::make_shared<const std::vector<Fragment>>(std::move(result.fragments));
+  const size_t bytes = key.size() + textBytes(*fragments);
+
+  std::lock_guard<std::mutex> lock(t.mutex);
+  t.stats.misses++;
+  t.stats.renderMilliseconds += std::chrono::duration<double, std::milli>(end - start).count();
+  // Running out of time depends on the device and its load; another render
+  // may well finish.
+  if (result.exceeded == HtmlRenderLimit::Time) return fragments;
+  // Another thread may have rendered the same markup meanwhile; keep the
+  // stored result so every caller shares a single copy.
+  auto it = t.entries.find(key);
+  if (it != t.entries.end()) {
+    it->second.lastUsed = ++t.clock;
+    return it->second.fragments;
+  }
+  while (!t.entries.empty() && (t.entries.size() >= kCapacity || t.bytes + bytes > kMaxBytes)) {
+    evictLeastRecentlyUsed(t);
+  }
+  t.bytes += bytes;
+  t.entries.emplace(std::move(key), CacheEntry{fragments, bytes, ++t.clock});
+  return fragments;
+}
+
+HtmlRenderCache::Stats HtmlRenderCache::stats()
+{
+  auto& t = table();
+  std::lock_guard<std::mutex> lock(t.mutex);
+  Stats stats = t.stats;
+  stats.entries = t.entries.size();
+  stats.bytes = t.bytes;
+  return stats;
+}
+
+void HtmlRenderCache::clear()
+{
+  auto& t = table();
+  std::lock_guard<std::mutex> lock(t.mutex);
+  t.entries.clear();
+  t.bytes = 0;
+  t.stats = Stats();
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,62 @@
+//
+// NitroTextHtmlRenderCache.hpp
+// Process-wide cache of rendered `renderer="html"` markup
+//
+
+#pragma once
+
+#include "Fragment.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * Rendered fragments keyed by the markup and a fingerprint of the base
+ * style it cascades over.
+ *
+ * Notification templates, quoted replies and list rows that scroll out and
+ * back in render the same markup over and over, from different component
+ * instances. The first render parses it; every later one with byte-identical
+ * markup and an equal base style copies the immutable result without
+ * touching the parser.
+ *
+ * Holds at most `kCapacity` results and `kMaxBytes` of markup and text, and
+ * evicts the least recently used ones. Markup over `kMaxEntryBytes`, and
+ * renders that ran out of time, are never cached. Thread-safe; rendering
+ * happens outside the lock.
+ */
+class HtmlRenderCache final {
+public:
+  static constexpr size_t kCapacity = 256;
+  static constexpr size_t kMaxBytes = 8 * 1024 * 1024;
+  static constexpr size_t kMaxEntryBytes = 512 * 1024;
+
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+    // Time spent rendering on misses.
+    double renderMilliseconds = 0;
+  };
+
+  /**
+   * @brief The fragments `HtmlRenderer::render` gives for `html` over
+   * `baseFragment`, rendering them on a miss.
+   */
+  static std::shared_ptr<const std::vector<Fragment>> render(std::string_view html, const Fragment& baseFragment);
+
+  static Stats stats();
+
+  /**
+   * @brief Drops every cached result and resets the counters.
+   */
+  static void clear();
+};
+
+} // namespace margelo::nitro::nitrotext
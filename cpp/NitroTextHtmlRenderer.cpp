@@ -0,0 +1,1560 @@
+//
+// NitroTextHtmlRenderer.cpp
+// Native port of the `renderer="html"` HTML renderer
+//
+
+#include "NitroTextHtmlRenderer.hpp"
+#include "NitroTextCssProcessor.hpp"
+#include "NitroTextCssStylesheetCache.hpp"
+#include "NitroTextHtmlUtil.hpp"
+#include "NitroTextSimdScan.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+// BLOCK_TAGS, PRE_TAGS, VOID_TAGS and HEADING_SIZES in src/constants/html.ts.
+bool isBlockTag(HtmlName tag)
+{
+  switch (tag) {
+  case HtmlName::P:
+  case HtmlName::Div:
+  case HtmlName::Section:
+  case HtmlName::Article:
+  case HtmlName::Header:
+  case HtmlName::Footer:
+  case HtmlName::Aside:
+  case HtmlName::Main:
+  case HtmlName::Nav:
+  case HtmlName::Figure:
+  case HtmlName::Figcaption:
+  case HtmlName::Ul:
+  case HtmlName::Ol:
+  case HtmlName::Li:
+  case HtmlName::Pre:
+  case HtmlName::Blockquote:
+  case HtmlName::H1:
+  case HtmlName::H2:
+  case HtmlName::H3:
+  case HtmlName::H4:
+  case HtmlName::H5:
+  case HtmlName::H6:
+    return true;
+  default:
+    return false;
+  }
+}
+
+bool isPreTag(HtmlName tag)
+{
+  return tag == HtmlName::Pre || tag == HtmlName::Code;
+}
+
+bool isVoidTag(HtmlName tag)
+{
+  switch (tag) {
+  case HtmlName::Area:
+  case HtmlName::Base:
+  case HtmlName::Br:
+  case HtmlName::Col:
+  case HtmlName::Embed:
+  case HtmlName::Hr:
+  case HtmlName::Img:
+  case HtmlName::Input:
+  case HtmlName::Link:
+  case HtmlName::Meta:
+  case HtmlName::Param:
+  case HtmlName::Source:
+  case HtmlName::Track:
+  case HtmlName::Wbr:
+    return true;
+  default:
+    return false;
+  }
+}
+
+std::optional<double> headingSize(HtmlName tag)
+{
+  switch (tag) {
+  case HtmlName::H1: return 30;
+  case HtmlName::H2: return 26;
+  case HtmlName::H3: return 22;
+  case HtmlName::H4: return 20;
+  case HtmlName::H5: return 18;
+  case HtmlName::H6: return 16;
+  default: return std::nullopt;
+  }
+}
+
+/**
+ * Applies the built-in style of a semantic tag (`<b>`, `<em>`, `<h1>`, ...).
+ */
+void applySemanticStyle(HtmlName tag, Fragment& style)
+{
+  switch (tag) {
+  case HtmlName::Strong:
+  case HtmlName::B:
+    style.fontWeight = FontWeight::BOLD;
+    return;
+  case HtmlName::Em:
+  case HtmlName::I:
+    style.fontStyle = FontStyle::ITALIC;
+    return;
+  case HtmlName::U:
+    style.textDecorationLine = TextDecorationLine::UNDERLINE;
+    return;
+  case HtmlName::S:
+  case HtmlName::Del:
+  case HtmlName::Strike:
+    style.textDecorationLine = TextDecorationLine::LINE_THROUGH;
+    return;
+  case HtmlName::Mark:
+    style.fragmentBackgroundColor = "#fff9c4";
+    return;
+  default:
+    if (auto size = headingSize(tag)) {
+      style.fontSize = size;
+      style.fontWeight = FontWeight::BOLD;
+    }
+    return;
+  }
+}
+
+// FRAGMENT_STYLE_KEYS in src/constants/css.ts.
+bool shareStyle(const Fragment& a, const Fragment& b)
+{
+  return a.selectionColor == b.selectionColor && a.fontSize == b.fontSize &&
+         a.fontWeight == b.fontWeight && a.fontColor == b.fontColor &&
+         a.fragmentBackgroundColor == b.fragmentBackgroundColor && a.fontStyle == b.fontStyle &&
+         a.fontFamily == b.fontFamily && a.lineHeight == b.lineHeight &&
+         a.letterSpacing == b.letterSpacing && a.textAlign == b.textAlign &&
+         a.textTransform == b.textTransform && a.textDecorationLine == b.textDecorationLine &&
+         a.textDecorationColor == b.textDecorationColor &&
+         a.textDecorationStyle == b.textDecorationStyle && a.linkUrl == b.linkUrl;
+}
+
+// Erases the first `count` bytes of text, dropping the fragments left empty.
+void eraseLeadingText(std::vector<Fragment>& fragments, size_t count)
+{
+  size_t emptied = 0;
+  while (count > 0 && emptied < fragments.size()) {
+    std::string& text = *fragments[emptied].text;
+    const size_t take = std::min(count, text.size());
+    text.erase(0, take);
+    count -= take;
+    if (text.empty()) emptied++;
+  }
+  fragments.erase(fragments.begin(), fragments.begin() + static_cast<ptrdiff_t>(emptied));
+}
+
+/**
+ * The budget of one render, or of one session update, and the first limit
+ * it ran into. The clock is read on every `kClockInterval`th check only.
+ */
+class BudgetTracker final {
+public:
+  explicit BudgetTracker(const HtmlRenderBudget& budget) : budget_(budget) { restartClock(); }
+
+  const HtmlRenderBudget& budget() const noexcept { return budget_; }
+  HtmlRenderLimit exceeded() const noexcept { return exceeded_; }
+
+  // Keeps the first limit run into.
+  void trip(HtmlRenderLimit limit) noexcept
+  {
+    if (exceeded_ == HtmlRenderLimit::None) exceeded_ = limit;
+  }
+
+  void restartClock()
+  {
+    checks_ = 0;
+    timedOut_ = false;
+    hasDeadline_ = budget_.maxMilliseconds < kNoDeadline;
+    if (hasDeadline_) {
+      deadline_ = std::chrono::steady_clock::now() +
+                  std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                      std::chrono::duration<double, std::milli>(std::max(0.0, budget_.maxMilliseconds)));
+    }
+  }
+
+  void reset()
+  {
+    exceeded_ = HtmlRenderLimit::None;
+    restartClock();
+  }
+
+  bool outOfTime()
+  {
+    if (timedOut_) return true;
+    if (!hasDeadline_ || ++checks_ % kClockInterval != 0) return false;
+    if (std::chrono::steady_clock::now() < deadline_) return false;
+    timedOut_ = true;
+    trip(HtmlRenderLimit::Time);
+    return true;
+  }
+
+private:
+  static constexpr uint32_t kClockInterval = 64;
+  // A day; anything longer means no deadline.
+  static constexpr double kNoDeadline = 24 * 60 * 60 * 1000.0;
+
+  HtmlRenderBudget budget_;
+  HtmlRenderLimit exceeded_ = HtmlRenderLimit::None;
+  std::chrono::steady_clock::time_point deadline_;
+  uint32_t checks_ = 0;
+  bool hasDeadline_ = false;
+  bool timedOut_ = false;
+};
+
+/**
+ * The output being built: `plainText` is always the concatenation of the
+ * fragment texts.
+ *
+ * The length of the trailing whitespace and whether it holds a newline are
+ * kept up to date on every change, so the checks every element makes before
+ * it starts a line cost the same however long the output is.
+ *
+ * Text past the output limit is dropped, cut at a code point boundary.
+ *
+ * A streaming session renders the part of the markup that may still change
+ * provisionally: between `beginProvisional` and `rollback`, committed
+ * fragments and text are saved before they are first changed, so rolling
+ * back restores the state exactly.
+ */
+class AppendState final {
+public:
+  void append(std::string_view text, const Fragment& style)
+  {
+    if (text.empty() || full_) return;
+    if (text.size() > outputLimit_ - plainText_.size()) {
+      size_t fits = outputLimit_ - plainText_.size();
+      while (fits > 0 && (static_cast<unsigned char>(text[fits]) & 0xC0) == 0x80) fits--;
+      text = text.substr(0, fits);
+      full_ = true;
+      if (text.empty()) return;
+    }
+    plainText_.append(text);
+    trackTrailingWhitespace(text);
+    if (!fragments_.empty() && shareStyle(fragments_.back(), style)) {
+      touch(fragments_.size() - 1);
+      fragments_.back().text->append(text);
+      return;
+    }
+    touch(fragments_.size());
+    Fragment& fragment = fragments_.emplace_back(style);
+    fragment.text = std::string(text);
+  }
+
+  /**
+   * @brief Whether the text has anything but whitespace, i.e.
+   * `plainText.trim().length > 0`.
+   */
+  bool hasContent() const noexcept { return contentMarks_ > 0; }
+
+  /**
+   * @brief Grows whenever non-whitespace text is appended. Trimming only
+   * removes whitespace, so comparing two marks tells whether
+   * `plainText.trim().length` grew in between.
+   */
+  size_t contentMark() const noexcept { return contentMarks_; }
+
+  void limitOutput(size_t bytes) noexcept { outputLimit_ = bytes; }
+
+  /**
+   * @brief Whether text was dropped for going over the output limit.
+   */
+  bool full() const noexcept { return full_; }
+
+  bool endsWithNewline() const noexcept
+  {
+    return !plainText_.empty() && plainText_.back() == '\n';
+  }
+
+  /**
+   * @brief Byte length of the trailing whitespace and whether it holds a newline.
+   */
+  std::pair<size_t, bool> trailingWhitespace() const noexcept
+  {
+    return {trailingWhitespace_, trailingNewline_};
+  }
+
+  size_t leadingWhitespace() const { return plainText_.size() - html::trimStart(plainText_).size(); }
+
+  void removeTrailingWhitespace()
+  {
+    size_t remaining = trailingWhitespace_;
+    if (remaining == 0) return;
+    truncateText(plainText_.size() - remaining);
+    trailingWhitespace_ = 0;
+    trailingNewline_ = false;
+    while (remaining > 0 && !fragments_.empty()) {
+      touch(fragments_.size() - 1);
+      std::string& text = *fragments_.back().text;
+      const size_t take = std::min(remaining, text.size());
+      text.resize(text.size() - take);
+      remaining -= take;
+      if (text.empty()) fragments_.pop_back();
+    }
+  }
+
+  // Not provisional: it shifts every fragment.
+  void removeLeadingWhitespace()
+  {
+    const size_t remaining = leadingWhitespace();
+    if (remaining == 0) return;
+    plainText_.erase(0, remaining);
+    trailingWhitespace_ = std::min(trailingWhitespace_, plainText_.size());
+    trailingNewline_ = trailingNewline_ && trailingWhitespace_ > 0;
+    lowestTouched_ = 0;
+    eraseLeadingText(fragments_, remaining);
+  }
+
+  void beginProvisional()
+  {
+    provisional_ = true;
+    committedFragments_ = fragments_.size();
+    committedContentMarks_ = contentMarks_;
+    committedTrailingWhitespace_ = trailingWhitespace_;
+    committedTrailingNewline_ = trailingNewline_;
+    committedFull_ = full_;
+    savedFrom_ = fragments_.size();
+    savedTextFrom_ = plainText_.size();
+    resetTouched();
+  }
+
+  void rollback()
+  {
+    fragments_.resize(committedFragments_);
+    for (auto& [index, fragment] : saved_) fragments_[index] = std::move(fragment);
+    saved_.clear();
+    plainText_.resize(savedTextFrom_);
+    plainText_ += savedText_;
+    savedText_.clear();
+    contentMarks_ = committedContentMarks_;
+    trailingWhitespace_ = committedTrailingWhitespace_;
+    trailingNewline_ = committedTrailingNewline_;
+    full_ = committedFull_;
+    provisional_ = false;
+    resetTouched();
+  }
+
+  /**
+   * @brief The lowest index of a fragment changed, added or removed since
+   * `resetTouched`.
+   */
+  size_t lowestTouched() const noexcept { return lowestTouched_; }
+  void resetTouched() noexcept { lowestTouched_ = fragments_.size(); }
+
+  const std::vector<Fragment>& fragments() const noexcept { return fragments_; }
+
+  HtmlRenderResult finish() &&
+  {
+    return HtmlRenderResult{std::move(fragments_), std::move(plainText_)};
+  }
+
+private:
+  // Whitespace-only text extends the trailing run; anything else replaces it
+  // with the whitespace `text` ends in.
+  void trackTrailingWhitespace(std::string_view text)
+  {
+    size_t end = text.size();
+    bool newline = false;
+    while (size_t n = html::whitespaceBefore(text, end)) {
+      end -= n;
+      newline = newline || text[end] == '\n';
+    }
+    if (end == 0) {
+      trailingWhitespace_ += text.size();
+      trailingNewline_ = trailingNewline_ || newline;
+      return;
+    }
+    contentMarks_++;
+    trailingWhitespace_ = text.size() - end;
+    trailingNewline_ = newline;
+  }
+
+  void touch(size_t index)
+  {
+    lowestTouched_ = std::min(lowestTouched_, index);
+    // Only the last fragment ever changes, so the saved ones are always
+    // `[savedFrom_, committedFragments_)`.
+    if (provisional_ && index < savedFrom_) {
+      saved_.emplace_back(index, fragments_[index]);
+      savedFrom_ = index;
+    }
+  }
+
+  void truncateText(size_t size)
+  {
+    if (provisional_ && size < savedTextFrom_) {
+      savedText_.insert(0, plainText_, size, savedTextFrom_ - size);
+      savedTextFrom_ = size;
+    }
+    plainText_.resize(size);
+  }
+
+  std::vector<Fragment> fragments_;
+  std::string plainText_;
+  size_t contentMarks_ = 0;
+  size_t trailingWhitespace_ = 0;
+  bool trailingNewline_ = false;
+  size_t outputLimit_ = std::numeric_limits<size_t>::max();
+  bool full_ = false;
+  size_t lowestTouched_ = 0;
+
+  bool provisional_ = false;
+  size_t committedFragments_ = 0;
+  size_t committedContentMarks_ = 0;
+  size_t committedTrailingWhitespace_ = 0;
+  bool committedTrailingNewline_ = false;
+  bool committedFull_ = false;
+  std::vector<std::pair<size_t, Fragment>> saved_;
+  size_t savedFrom_ = 0;
+  // The committed text from `savedTextFrom_` on, before it was trimmed.
+  std::string savedText_;
+  size_t savedTextFrom_ = 0;
+};
+
+struct ListStackItem {
+  bool ordered;
+  int index;
+};
+
+/**
+ * Renders elements and text as they are entered and left, in document
+ * order: from a parsed tree with `walkChildren`, or straight from the
+ * tokenizer in a streaming session.
+ *
+ * Once the time budget runs out, elements entered later are flattened: their
+ * text renders in the style already in effect and nothing is looked up.
+ */
+class Walker final {
+  // An entered element that renders: what its children inherit and what
+  // leaving it appends.
+  struct Frame {
+    enum class Kind : uint8_t { Element, List, ListItem };
+
+    Kind kind = Kind::Element;
+    bool preformatted = false;
+    bool isBlock = false;
+    bool suppressNewlines = false;
+    bool onAncestorChain = false;
+    size_t contentBefore = 0;
+    Fragment style;
+    Fragment newlineStyle;
+  };
+
+public:
+  Walker(const CssStylesheet& stylesheet, const Fragment& base, BudgetTracker& budget)
+      : stylesheet_(stylesheet), budget_(budget)
+  {
+    frames_.reserve(64);
+    frames_.emplace_back().style = base;
+    state_.limitOutput(budget.budget().maxOutputBytes);
+  }
+
+  void walkChildren(const HtmlNode& parent)
+  {
+    // The next child to visit of every entered element, so that deep
+    // nesting does not grow the call stack.
+    std::vector<const HtmlNode*> pending;
+    pending.reserve(64);
+    pending.push_back(parent.firstChild);
+    while (!pending.empty()) {
+      const HtmlNode* node = pending.back();
+      if (node == nullptr) {
+        pending.pop_back();
+        if (!pending.empty()) leave();
+        continue;
+      }
+      // Past the output limit, only leave what was entered.
+      pending.back() = state_.full() ? nullptr : node->nextSibling;
+      if (state_.full()) continue;
+      if (node->isText()) {
+        text(node->content);
+      } else if (enter(*node)) {
+        pending.push_back(node->firstChild);
+      } else {
+        leave();
+      }
+    }
+  }
+
+  /**
+   * @brief Enters `node`, a child of the innermost entered element. Returns
+   * false if nothing inside it renders; it must still be left.
+   */
+  bool enter(const HtmlNode& node)
+  {
+    // Past the output limit, like `walkChildren`, only what was entered
+    // before is left.
+    if (state_.full()) {
+      skipDepth_++;
+      return false;
+    }
+    if (skipDepth_ == 0 && (flatDepth_ > 0 || budget_.outOfTime())) {
+      if (node.tag != HtmlName::Head && node.tag != HtmlName::Style && node.tag != HtmlName::Script) {
+        flatDepth_++;
+        return true;
+      }
+    } else if (skipDepth_ == 0 && enterElement(node)) {
+      return true;
+    }
+    skipDepth_++;
+    return false;
+  }
+
+  void leave()
+  {
+    if (skipDepth_ > 0) {
+      skipDepth_--;
+      return;
+    }
+    if (flatDepth_ > 0) {
+      flatDepth_--;
+      return;
+    }
+    const Frame& frame = frames_.back();
+    switch (frame.kind) {
+    case Frame::Kind::List:
+      listStack_.pop_back();
+      endBlock(frame.newlineStyle, frame.suppressNewlines);
+      break;
+    case Frame::Kind::ListItem:
+      endBlock(frame.newlineStyle, frame.suppressNewlines);
+      break;
+    case Frame::Kind::Element:
+      // Empty blocks add no spacing, so nested empty divs leave no blank lines.
+      if (frame.isBlock && state_.contentMark() > frame.contentBefore) {
+        endBlock(frame.newlineStyle, frame.suppressNewlines);
+      }
+      break;
+    }
+    if (frame.onAncestorChain) ancestors_.pop();
+    frames_.pop_back();
+  }
+
+  // Leaves every entered element, like the end of the document does.
+  void leaveAll()
+  {
+    while (skipDepth_ > 0 || flatDepth_ > 0 || frames_.size() > 1) leave();
+  }
+
+  void text(std::string_view raw)
+  {
+    if (skipDepth_ > 0) return;
+    const Frame& frame = frames_.back();
+    state_.append(html::decodeText(raw, !frame.preformatted, text_), frame.style);
+  }
+
+  // Everything `leaveAll` changes besides the output.
+  struct Checkpoint {
+    std::vector<Frame> frames;
+    std::vector<ListStackItem> listStack;
+    CssAncestorFilter ancestors;
+    size_t skipDepth;
+    size_t flatDepth;
+  };
+
+  Checkpoint checkpoint() const { return Checkpoint{frames_, listStack_, ancestors_, skipDepth_, flatDepth_}; }
+
+  void restore(Checkpoint&& checkpoint)
+  {
+    frames_ = std::move(checkpoint.frames);
+    listStack_ = std::move(checkpoint.listStack);
+    ancestors_ = std::move(checkpoint.ancestors);
+    skipDepth_ = checkpoint.skipDepth;
+    flatDepth_ = checkpoint.flatDepth;
+  }
+
+  AppendState& state() noexcept { return state_; }
+
+private:
+  bool enterElement(const HtmlNode& node)
+  {
+    const HtmlName tag = node.tag;
+    if (tag == HtmlName::Head || tag == HtmlName::Style || tag == HtmlName::Script) {
+      return false;
+    }
+
+    const CssAppliedStyle applied = CssProcessor::applyStylesFromSheet(node, ancestors_, stylesheet_);
+    if (applied.hidden) return false;
+    // Parsed in place: nothing is copied out of the attribute until it is
+    // merged into the style below.
+    const auto styleAttr = node.attribute(HtmlName::Style);
+    const CssInlineStyle inlineStyle = styleAttr ? CssProcessor::parseInlineStyle(*styleAttr) : CssInlineStyle();
+    if (inlineStyle.hidden) return false;
+
+    const Frame& parent = frames_.back();
+    Fragment nextStyle = parent.style;
+    if (applied.fragment) applied.fragment->applyTo(nextStyle);
+    inlineStyle.applyTo(nextStyle);
+    const bool suppressNewlines = applied.suppressNewlines || inlineStyle.suppressNewlines;
+
+    applySemanticStyle(tag, nextStyle);
+    if (tag == HtmlName::A) {
+      if (auto href = node.nonEmptyAttribute(HtmlName::Href)) {
+        nextStyle.linkUrl = std::string(*href);
+      }
+    }
+
+    // Backgrounds paint the element's own text only. Newlines never carry one.
+    Fragment newlineStyle = nextStyle;
+    newlineStyle.fragmentBackgroundColor = std::nullopt;
+
+    if (tag == HtmlName::Br) {
+      state_.append("\n", nextStyle);
+      return false;
+    }
+
+    if (tag == HtmlName::Img) {
+      if (state_.hasContent()) {
+        const auto [whitespace, newline] = state_.trailingWhitespace();
+        if (whitespace > 0) {
+          state_.removeTrailingWhitespace();
+          // After a block the alt text starts on exactly one new line.
+          if (newline) state_.append("\n", newlineStyle);
+        }
+      }
+      if (auto alt = node.nonEmptyAttribute(HtmlName::Alt)) {
+        state_.append(*alt, nextStyle);
+      }
+      return false;
+    }
+
+    const bool preformatted = parent.preformatted || isPreTag(tag);
+    const bool isBlock = isBlockTag(tag);
+    // `parent` dangles from here on.
+    Frame& frame = frames_.emplace_back();
+    frame.preformatted = preformatted;
+    frame.isBlock = isBlock;
+    frame.suppressNewlines = suppressNewlines;
+    // Keeps `node` on the ancestor chain while its children are walked.
+    if (stylesheet_.hasCombinators) {
+      ancestors_.push(node);
+      frame.onAncestorChain = true;
+    }
+
+    // An inline element right after a block starts on exactly one new line;
+    // plain spaces are kept for normal inline flow.
+    if (!isBlock && state_.hasContent()) {
+      if (state_.trailingWhitespace().second) {
+        state_.removeTrailingWhitespace();
+        state_.append("\n", newlineStyle);
+      }
+    }
+
+    if (tag == HtmlName::Ul || tag == HtmlName::Ol || tag == HtmlName::Li) {
+      startBlock(newlineStyle, suppressNewlines);
+      if (tag == HtmlName::Li) {
+        if (!listStack_.empty() && listStack_.back().ordered) {
+          state_.append(std::to_string(listStack_.back().index) + ". ", nextStyle);
+        } else {
+          state_.append("• ", nextStyle);
+        }
+        if (!listStack_.empty()) listStack_.back().index++;
+        frame.kind = Frame::Kind::ListItem;
+      } else {
+        const bool ordered = tag == HtmlName::Ol;
+        listStack_.push_back(ListStackItem{ordered, ordered ? 1 : 0});
+        frame.kind = Frame::Kind::List;
+      }
+      frame.style = std::move(nextStyle);
+      frame.newlineStyle = std::move(newlineStyle);
+      return true;
+    }
+
+    if (isBlock) {
+      startBlock(newlineStyle, suppressNewlines);
+    }
+
+    // Like `{ ...nextStyle }` minus a (non-empty) background.
+    frame.style = std::move(nextStyle);
+    if (frame.style.fragmentBackgroundColor.has_value() && !frame.style.fragmentBackgroundColor->empty()) {
+      frame.style.fragmentBackgroundColor = std::nullopt;
+    }
+    frame.newlineStyle = std::move(newlineStyle);
+    frame.contentBefore = state_.contentMark();
+    return true;
+  }
+
+  // Blocks start on a new line after existing content, plus a blank line
+  // (the default top margin) unless a zero margin suppresses it.
+  void startBlock(const Fragment& newlineStyle, bool suppressNewlines)
+  {
+    if (!state_.hasContent()) return;
+    state_.removeTrailingWhitespace();
+    state_.append("\n", newlineStyle);
+    if (!suppressNewlines) state_.append("\n", newlineStyle);
+  }
+
+  void endBlock(const Fragment& newlineStyle, bool suppressNewlines)
+  {
+    if (!state_.endsWithNewline()) state_.append("\n", newlineStyle);
+    if (!suppressNewlines) state_.append("\n", newlineStyle);
+  }
+
+  const CssStylesheet& stylesheet_;
+  BudgetTracker& budget_;
+  CssAncestorFilter ancestors_;
+  AppendState state_;
+  // The root's frame, then one per entered element that renders.
+  std::vector<Frame> frames_;
+  // Elements entered inside one that does not render.
+  size_t skipDepth_ = 0;
+  // Elements entered after the time budget ran out.
+  size_t flatDepth_ = 0;
+  std::vector<ListStackItem> listStack_;
+  // Reused for every text node.
+  std::string text_;
+};
+
+/**
+ * Removes `<style>` elements from the tree and collects their CSS, in
+ * document order.
+ */
+void stripStyleNodes(HtmlNode& root, std::vector<std::string_view>& styles)
+{
+  // An element being visited: its last child kept and the next to look at.
+  struct Level {
+    HtmlNode* node;
+    HtmlNode* previous;
+    HtmlNode* next;
+  };
+  std::vector<Level> levels{Level{&root, nullptr, root.firstChild}};
+  while (!levels.empty()) {
+    Level& level = levels.back();
+    HtmlNode* child = level.next;
+    if (child == nullptr) {
+      levels.pop_back();
+      continue;
+    }
+    level.next = child->nextSibling;
+    if (child->isText() || child->tag != HtmlName::Style) {
+      level.previous = child;
+      // `level` dangles from here on.
+      if (!child->isText()) levels.push_back(Level{child, nullptr, child->firstChild});
+      continue;
+    }
+    // The parser gives `<style>` at most one raw text child.
+    if (child->firstChild != nullptr && !html::trim(child->firstChild->content).empty()) {
+      styles.push_back(child->firstChild->content);
+    }
+    HtmlNode& node = *level.node;
+    (level.previous != nullptr ? level.previous->nextSibling : node.firstChild) = child->nextSibling;
+    if (node.lastChild == child) node.lastChild = level.previous;
+  }
+}
+
+bool startsWithIgnoringCase(std::string_view s, size_t pos, std::string_view prefix)
+{
+  if (pos + prefix.size() > s.size()) return false;
+  for (size_t i = 0; i < prefix.size(); i++) {
+    char c = s[pos + i];
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c + ('a' - 'A'));
+    if (c != prefix[i]) return false;
+  }
+  return true;
+}
+
+size_t findIgnoringCase(std::string_view s, std::string_view lowerNeedle, size_t from)
+{
+  for (size_t i = simd::findByte(s, from, '<'); i != std::string_view::npos; i = simd::findByte(s, i + 1, '<')) {
+    if (startsWithIgnoringCase(s, i, lowerNeedle)) return i;
+  }
+  return std::string_view::npos;
+}
+
+// Removes every `<!DOCTYPE …>`, like /<!DOCTYPE[\s\S]*?>/gi. Without one,
+// or with just one that starts the markup, `html` is returned as is or past
+// it; otherwise the result is copied into `arena`.
+std::string_view removeDoctype(std::string_view html, Arena& arena)
+{
+  size_t start = findIgnoringCase(html, "<!doctype", 0);
+  if (start == std::string_view::npos || html.find('>', start + 9) == std::string_view::npos) {
+    return html;
+  }
+  if (start == 0) {
+    const size_t end = html.find('>', 9);
+    const size_t next = findIgnoringCase(html, "<!doctype", end + 1);
+    if (next == std::string_view::npos || html.find('>', next + 9) == std::string_view::npos) {
+      return html.substr(end + 1);
+    }
+  }
+  char* out = static_cast<char*>(arena.allocate(html.size(), 1));
+  size_t length = 0;
+  size_t copied = 0;
+  while (start != std::string_view::npos) {
+    const size_t end = html.find('>', start + 9);
+    if (end == std::string_view::npos) break;
+    html.copy(out + length, start - copied, copied);
+    length += start - copied;
+    copied = end + 1;
+    start = findIgnoringCase(html, "<!doctype", copied);
+  }
+  length += html.copy(out + length, std::string_view::npos, copied);
+  return std::string_view(out, length);
+}
+
+bool isTagNameChar(char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == ':' ||
+         c == '-';
+}
+
+bool isAttributeNameChar(char c)
+{
+  return isTagNameChar(c) || c == '_';
+}
+
+bool isUnquotedValueChar(std::string_view s, size_t i)
+{
+  const char c = s[i];
+  return c != '"' && c != '\'' && c != '`' && c != '=' && c != '<' && c != '>' &&
+         html::whitespaceAt(s, i) == 0;
+}
+
+size_t skipWhitespace(std::string_view s, size_t i)
+{
+  while (size_t n = html::whitespaceAt(s, i)) i += n;
+  return i;
+}
+
+// What earlier `nextToken` calls over the same source found missing: once
+// no `-->` follows a comment, none follows any later one either.
+struct TokenScan {
+  bool noCommentEnd = false;
+  bool noCdataEnd = false;
+};
+
+/**
+ * Finds the next token like /<!--[\s\S]*?-->|<!\[CDATA\[[\s\S]*?\]\]>|<[^>]+>/g
+ * from `from`. Returns false if there is none.
+ *
+ * When `streaming`, it also stops at a comment or CDATA section that is not
+ * closed yet: more markup could close it, where today it would fall back to
+ * ending at the next `>`.
+ */
+template <bool streaming>
+bool nextToken(std::string_view s, size_t from, size_t& begin, size_t& end, TokenScan& scan)
+{
+  for (size_t i = simd::findByte(s, from, '<'); i != std::string_view::npos; i = simd::findByte(s, i + 1, '<')) {
+    if (s.compare(i, 4, "<!--") == 0) {
+      const size_t close = scan.noCommentEnd ? std::string_view::npos : s.find("-->", i + 4);
+      if (close != std::string_view::npos) {
+        begin = i;
+        end = close + 3;
+        return true;
+      }
+      if constexpr (streaming) return false;
+      scan.noCommentEnd = true;
+    } else if (s.compare(i, 9, "<![CDATA[") == 0) {
+      const size_t close = scan.noCdataEnd ? std::string_view::npos : s.find("]]>", i + 9);
+      if (close != std::string_view::npos) {
+        begin = i;
+        end = close + 3;
+        return true;
+      }
+      if constexpr (streaming) return false;
+      scan.noCdataEnd = true;
+    }
+    if (i + 1 < s.size() && s[i + 1] != '>') {
+      const size_t close = simd::findByte(s, i + 1, '>');
+      // Without a `>` left, no later `<` can start a token either.
+      if (close == std::string_view::npos) return false;
+      begin = i;
+      end = close + 1;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool startsRawTextElement(std::string_view s, size_t open, std::string_view name)
+{
+  const size_t nameEnd = open + 1 + name.size();
+  return startsWithIgnoringCase(s, open + 1, name) && (nameEnd == s.size() || !isTagNameChar(s[nameEnd]));
+}
+
+/**
+ * Appends the text of `markup` with its tags, comments and CDATA sections,
+ * and the contents of `<script>` and `<style>`, left out, in one pass.
+ */
+void appendWithoutTags(std::string_view markup, std::string& out)
+{
+  TokenScan scan;
+  size_t i = 0;
+  while (i < markup.size()) {
+    const size_t open = simd::findByte(markup, i, '<');
+    if (open == std::string_view::npos) break;
+    out.append(markup, i, open - i);
+    size_t begin = 0;
+    size_t end = 0;
+    if ((markup.compare(open, 4, "<!--") == 0 || markup.compare(open, 9, "<![CDATA[") == 0) &&
+        nextToken<false>(markup, open, begin, end, scan) && begin == open) {
+      i = end;
+      continue;
+    }
+    const size_t close = open + 1 < markup.size() && markup[open + 1] != '>'
+                             ? simd::findByte(markup, open + 1, '>')
+                             : std::string_view::npos;
+    if (close == std::string_view::npos) {
+      out.push_back('<');
+      i = open + 1;
+      continue;
+    }
+    i = close + 1;
+    std::string_view closeTag;
+    if (startsRawTextElement(markup, open, "script")) {
+      closeTag = "</script";
+    } else if (startsRawTextElement(markup, open, "style")) {
+      closeTag = "</style";
+    }
+    if (!closeTag.empty()) {
+      const size_t closeIndex = findIgnoringCase(markup, closeTag, i);
+      const size_t closeEnd =
+          closeIndex == std::string_view::npos ? closeIndex : simd::findByte(markup, closeIndex, '>');
+      if (closeEnd == std::string_view::npos) return;
+      i = closeEnd + 1;
+    }
+  }
+  if (i < markup.size()) out.append(markup, i);
+}
+
+/**
+ * Splits markup into tokens and keeps the stack of open elements. Elements,
+ * attribute arrays and lowercased names go to the arena; the scratch vectors
+ * are reused for every element, so tokenizing makes a fixed handful of heap
+ * allocations.
+ *
+ * Everything is reported to a sink, in document order:
+ *   text(parent, text)        text between tokens, raw
+ *   open(parent, element)     an element with its attributes
+ *   rawText(element, text)    the contents of `<script>` and `<style>`
+ *   close(element)            the element ended: right after `open` for void,
+ *                             self-closing and raw text elements
+ * Elements still open at the end are not closed.
+ *
+ * Past the node or depth limit of the budget, or out of time, the open
+ * elements are closed and the rest of the markup is reported as one text of
+ * the root, with the tags left out.
+ */
+class HtmlTokenizer final {
+public:
+  HtmlTokenizer(Arena& arena, HtmlNameTable& names, BudgetTracker& budget)
+      : arena_(arena), names_(names), budget_(budget)
+  {
+    stack_.reserve(64);
+    attributes_.reserve(16);
+    HtmlNode* root = arena_.make<HtmlNode>();
+    root->tagName = names_.str(HtmlName::Root);
+    stack_.push_back(root);
+  }
+
+  // Picks up where `other` stopped, with its open elements.
+  HtmlTokenizer(Arena& arena, HtmlNameTable& names, const HtmlTokenizer& other)
+      : arena_(arena), names_(names), budget_(other.budget_), stack_(other.stack_), nodes_(other.nodes_)
+  {
+    attributes_.reserve(16);
+  }
+
+  HtmlNode* root() const noexcept { return stack_.front(); }
+
+  /**
+   * @brief Reuses a closed element's node and attributes for the next one
+   * opened at its depth, for sinks that forget elements once closed. Memory
+   * then grows with the depth of the markup instead of its length.
+   */
+  void recycleClosedElements() noexcept { recycle_ = true; }
+
+  /**
+   * @brief Tokenizes `source` from `from` to its end.
+   */
+  template <typename Sink>
+  void finish(std::string_view source, size_t from, Sink& sink)
+  {
+    run<false>(source, from, sink);
+  }
+
+  /**
+   * @brief Tokenizes `source` from `from` up to the first token that markup
+   * appended to it could still change, and returns where it stopped. Text is
+   * reported once the token after it is, and tokens are copied to the arena
+   * first, so nothing refers into `source` afterwards.
+   */
+  template <typename Sink>
+  size_t advance(std::string_view source, size_t from, Sink& sink)
+  {
+    return run<true>(source, from, sink);
+  }
+
+private:
+  template <bool streaming, typename Sink>
+  size_t run(std::string_view source, size_t from, Sink& sink)
+  {
+    size_t lastIndex = from;
+    size_t begin = 0;
+    size_t end = 0;
+    TokenScan scan;
+    auto emitText = [&](size_t textEnd) {
+      if (textEnd <= lastIndex) return;
+      nodes_++;
+      sink.text(*stack_.back(), source.substr(lastIndex, textEnd - lastIndex));
+    };
+
+    while (nextToken<streaming>(source, lastIndex, begin, end, scan)) {
+      if (nodes_ > budget_.budget().maxNodes) budget_.trip(HtmlRenderLimit::Nodes);
+      if (nodes_ > budget_.budget().maxNodes || budget_.outOfTime()) {
+        emitText(begin);
+        return emitPlainText(source.substr(begin), sink, source.size());
+      }
+
+      std::string_view token = source.substr(begin, end - begin);
+      if (token.compare(0, 4, "<!--") == 0 || token.compare(0, 9, "<![CDATA[") == 0) {
+        emitText(begin);
+        lastIndex = end;
+        continue;
+      }
+
+      const bool closing = token.size() > 1 && token[1] == '/';
+      const bool selfClosing = token.size() >= 2 && token.compare(token.size() - 2, 2, "/>") == 0;
+      const size_t nameBegin = closing ? 2 : 1;
+      size_t nameEnd = nameBegin;
+      while (nameEnd < token.size() && isTagNameChar(token[nameEnd])) nameEnd++;
+      if (nameEnd == nameBegin) {
+        emitText(begin);
+        lastIndex = end;
+        continue;
+      }
+
+      // Raw text up to the matching close tag.
+      std::string_view closeTag;
+      if (!closing && nameEnd - nameBegin == 6 && startsWithIgnoringCase(token, nameBegin, "script")) {
+        closeTag = "</script";
+      } else if (!closing && nameEnd - nameBegin == 5 && startsWithIgnoringCase(token, nameBegin, "style")) {
+        closeTag = "</style";
+      }
+      size_t closeIndex = std::string_view::npos;
+      size_t closeEnd = std::string_view::npos;
+      if (!closeTag.empty()) {
+        closeIndex = findIgnoringCase(source, closeTag, end);
+        if (closeIndex != std::string_view::npos) closeEnd = simd::findByte(source, closeIndex, '>');
+        if constexpr (streaming) {
+          if (closeEnd == std::string_view::npos) {
+            emitText(begin);
+            return begin;
+          }
+        }
+      }
+
+      emitText(begin);
+      lastIndex = end;
+      if constexpr (streaming) token = arena_.copyString(token);
+
+      const HtmlName tag = intern(token.substr(nameBegin, nameEnd - nameBegin));
+      if (closing) {
+        popUntilTag(tag, sink);
+        continue;
+      }
+
+      // Everything between the name and the closing `>`.
+      const std::string_view attrChunk =
+          nameEnd < token.size() - 1 ? token.substr(nameEnd, token.size() - 1 - nameEnd) : std::string_view();
+
+      HtmlNode* element = newElement();
+      element->tag = tag;
+      element->tagName = names_.str(tag);
+      parseAttributes(attrChunk, *element);
+      nodes_ += 1 + element->attributeCount;
+      sink.open(*stack_.back(), *element);
+
+      if (!closeTag.empty()) {
+        const size_t rawEnd = closeIndex != std::string_view::npos ? closeIndex : source.size();
+        if (rawEnd > lastIndex) sink.rawText(*element, source.substr(lastIndex, rawEnd - lastIndex));
+        lastIndex = closeEnd == std::string_view::npos ? source.size() : closeEnd + 1;
+        sink.close(*element);
+        continue;
+      }
+
+      if (!selfClosing && !isVoidTag(tag)) {
+        if (stack_.size() > budget_.budget().maxDepth) {
+          sink.close(*element);
+          budget_.trip(HtmlRenderLimit::Depth);
+          return emitPlainText(source.substr(lastIndex), sink, source.size());
+        }
+        stack_.push_back(element);
+      } else {
+        sink.close(*element);
+      }
+    }
+
+    if constexpr (streaming) {
+      return lastIndex;
+    } else {
+      emitText(source.size());
+      return source.size();
+    }
+  }
+
+  // Reports `markup` as text of the root, without its tags, and returns `end`.
+  template <typename Sink>
+  size_t emitPlainText(std::string_view markup, Sink& sink, size_t end)
+  {
+    while (stack_.size() > 1) {
+      sink.close(*stack_.back());
+      stack_.pop_back();
+    }
+    std::string text;
+    appendWithoutTags(markup, text);
+    if (!text.empty()) sink.text(*stack_.front(), arena_.copyString(text));
+    return end;
+  }
+
+  HtmlName intern(std::string_view rawName)
+  {
+    return names_.intern(rawName, [this](std::string_view lowered) { return arena_.copyString(lowered); });
+  }
+
+  template <typename Sink>
+  void popUntilTag(HtmlName tag, Sink& sink)
+  {
+    while (stack_.size() > 1) {
+      HtmlNode* current = stack_.back();
+      stack_.pop_back();
+      sink.close(*current);
+      if (current->tag == tag) break;
+    }
+  }
+
+  /**
+   * Parses attributes like /([\w:-]+)(?:\s*=\s*("([^"]*)"|'([^']*)'|([^\s"'`=<>]+)))?/g.
+   */
+  void parseAttributes(std::string_view chunk, HtmlNode& element)
+  {
+    attributes_.clear();
+    attributeSerial_++;
+    size_t i = 0;
+    while (i < chunk.size()) {
+      if (!isAttributeNameChar(chunk[i])) {
+        i++;
+        continue;
+      }
+      const size_t nameBegin = i;
+      while (i < chunk.size() && isAttributeNameChar(chunk[i])) i++;
+      const HtmlName name = intern(chunk.substr(nameBegin, i - nameBegin));
+      std::string_view value;
+
+      size_t cursor = skipWhitespace(chunk, i);
+      if (cursor < chunk.size() && chunk[cursor] == '=') {
+        cursor = skipWhitespace(chunk, cursor + 1);
+        if (cursor < chunk.size() && (chunk[cursor] == '"' || chunk[cursor] == '\'')) {
+          const size_t close = chunk.find(chunk[cursor], cursor + 1);
+          if (close != std::string_view::npos) {
+            value = chunk.substr(cursor + 1, close - cursor - 1);
+            i = close + 1;
+          }
+        } else {
+          const size_t valueBegin = cursor;
+          while (cursor < chunk.size() && isUnquotedValueChar(chunk, cursor)) cursor++;
+          if (cursor > valueBegin) {
+            value = chunk.substr(valueBegin, cursor - valueBegin);
+            i = cursor;
+          }
+        }
+      }
+      setAttribute(name, value);
+    }
+    if (recycle_) {
+      // The element is the one `newElement` recycled at this depth.
+      auto& storage = recycled_[stack_.size()]->attributes;
+      storage.assign(attributes_.begin(), attributes_.end());
+      element.attributes = storage.data();
+    } else {
+      element.attributes = arena_.copyArray(attributes_.data(), attributes_.size());
+    }
+    element.attributeCount = static_cast<uint32_t>(attributes_.size());
+  }
+
+  // An element opened at the current depth. Whichever element was opened
+  // at this depth before has been closed since: it was either never pushed,
+  // or popped to get back here.
+  HtmlNode* newElement()
+  {
+    if (!recycle_) return arena_.make<HtmlNode>();
+    const size_t depth = stack_.size();
+    if (depth >= recycled_.size()) recycled_.resize(depth + 1);
+    auto& slot = recycled_[depth];
+    if (!slot) slot = std::make_unique<RecycledElement>();
+    slot->node = HtmlNode();
+    return &slot->node;
+  }
+
+  // A repeated attribute keeps its first position and takes the last value.
+  void setAttribute(HtmlName name, std::string_view value)
+  {
+    const auto id = static_cast<size_t>(name);
+    if (id >= attributeSlots_.size()) attributeSlots_.resize(id + 1);
+    AttributeSlot& slot = attributeSlots_[id];
+    if (slot.serial == attributeSerial_) {
+      attributes_[slot.index].value = value;
+      return;
+    }
+    slot = AttributeSlot{attributeSerial_, static_cast<uint32_t>(attributes_.size())};
+    attributes_.push_back(HtmlAttribute{name, value});
+  }
+
+  struct RecycledElement {
+    HtmlNode node;
+    std::vector<HtmlAttribute> attributes;
+  };
+
+  // Where an attribute name sits in `attributes_`, if `serial` is the
+  // current element's.
+  struct AttributeSlot {
+    uint32_t serial = 0;
+    uint32_t index = 0;
+  };
+
+  Arena& arena_;
+  HtmlNameTable& names_;
+  BudgetTracker& budget_;
+  std::vector<HtmlNode*> stack_;
+  std::vector<HtmlAttribute> attributes_;
+  std::vector<AttributeSlot> attributeSlots_;
+  uint32_t attributeSerial_ = 0;
+  // Elements, attributes and text nodes reported so far.
+  size_t nodes_ = 0;
+  bool recycle_ = false;
+  // Indexed by depth, see `recycleClosedElements`.
+  std::vector<std::unique_ptr<RecycledElement>> recycled_;
+};
+
+// Links the tokens into a document tree.
+class TreeSink final {
+public:
+  explicit TreeSink(Arena& arena) : arena_(arena) {}
+
+  void text(HtmlNode& parent, std::string_view text)
+  {
+    HtmlNode* node = arena_.make<HtmlNode>();
+    node->type = HtmlNode::Type::Text;
+    node->content = text;
+    parent.appendChild(node);
+  }
+  void open(HtmlNode& parent, HtmlNode& element) { parent.appendChild(&element); }
+  void rawText(HtmlNode& element, std::string_view text) { this->text(element, text); }
+  void close(HtmlNode&) {}
+
+private:
+  Arena& arena_;
+};
+
+// Renders the tokens as they come, collecting the CSS of `<style>` elements.
+class WalkerSink final {
+public:
+  WalkerSink(Walker& walker, std::vector<std::string_view>& styles) : walker_(walker), styles_(styles) {}
+
+  void text(HtmlNode&, std::string_view text) { walker_.text(text); }
+  void open(HtmlNode&, HtmlNode& element) { walker_.enter(element); }
+  void rawText(HtmlNode& element, std::string_view text)
+  {
+    if (element.tag == HtmlName::Style && !html::trim(text).empty()) styles_.push_back(text);
+  }
+  void close(HtmlNode&) { walker_.leave(); }
+
+private:
+  Walker& walker_;
+  std::vector<std::string_view>& styles_;
+};
+
+// Arena chunks for rendering without a tree.
+constexpr size_t kStreamArenaChunkSize = 16 * 1024;
+
+HtmlDocument makeDocument(size_t sourceSize)
+{
+  // A markup-heavy email takes about 5 bytes of tree per byte of source, so
+  // even those fit in two chunks. Every node consumes source bytes, which
+  // bounds the chunk count by a constant for any input.
+  return HtmlDocument(sourceSize * 3 + 4096);
+}
+
+// Parses `source`, which has no doctype left, into `document`.
+void parseTreeInto(HtmlDocument& document, std::string_view source, BudgetTracker& budget)
+{
+  HtmlTokenizer tokenizer(document.arena, document.names, budget);
+  TreeSink sink(document.arena);
+  tokenizer.finish(source, 0, sink);
+  document.root = tokenizer.root();
+}
+
+HtmlDocument parseTree(std::string_view html, BudgetTracker& budget)
+{
+  HtmlDocument document = makeDocument(html.size());
+  parseTreeInto(document, removeDoctype(html, document.arena), budget);
+  return document;
+}
+
+// Whether the tokenizer could find a `<style>` element in `source`.
+bool mayHaveStyleElement(std::string_view source)
+{
+  for (size_t i = findIgnoringCase(source, "<style", 0); i != std::string_view::npos;
+       i = findIgnoringCase(source, "<style", i + 1)) {
+    if (startsRawTextElement(source, i, "style")) return true;
+  }
+  return false;
+}
+
+HtmlRenderResult finishRender(Walker& walker, BudgetTracker& tracker)
+{
+  AppendState& state = walker.state();
+  state.removeLeadingWhitespace();
+  state.removeTrailingWhitespace();
+  if (state.full()) tracker.trip(HtmlRenderLimit::Output);
+  HtmlRenderResult result = std::move(state).finish();
+  result.exceeded = tracker.exceeded();
+  return result;
+}
+
+} // namespace
+
+HtmlDocument HtmlRenderer::parseHtmlTree(std::string_view html)
+{
+  BudgetTracker budget(HtmlRenderBudget::unlimited());
+  return parseTree(html, budget);
+}
+
+HtmlRenderResult HtmlRenderer::render(std::string_view html, const Fragment& baseFragment,
+                                      const HtmlRenderBudget& budget)
+{
+  BudgetTracker tracker(budget);
+  Fragment base = baseFragment;
+  base.text = std::nullopt;
+  // Holds the markup without its doctypes, if it has any, and the names the
+  // name table does not know.
+  Arena arena(kStreamArenaChunkSize);
+  const std::string_view source = removeDoctype(html, arena);
+
+  if (!mayHaveStyleElement(source)) {
+    // Nothing to collect a stylesheet from before walking: render the tokens
+    // as they come, in one pass, holding on to the open elements only.
+    HtmlNameTable names;
+    HtmlTokenizer tokenizer(arena, names, tracker);
+    tokenizer.recycleClosedElements();
+    Walker walker(*CssStylesheetCache::get({}), base, tracker);
+    std::vector<std::string_view> styles;
+    WalkerSink sink(walker, styles);
+    tokenizer.finish(source, 0, sink);
+    walker.leaveAll();
+    return finishRender(walker, tracker);
+  }
+
+  HtmlDocument document = makeDocument(source.size());
+  parseTreeInto(document, source, tracker);
+  std::vector<std::string_view> stylesheetBlocks;
+  stripStyleNodes(*document.root, stylesheetBlocks);
+  const auto stylesheet = CssStylesheetCache::get(stylesheetBlocks);
+
+  Walker walker(*stylesheet, base, tracker);
+  walker.walkChildren(*document.root);
+  return finishRender(walker, tracker);
+}
+
+/**
+ * The committed part of a session: everything up to `committed` in the
+ * source, tokenized and rendered with the elements still open.
+ */
+struct HtmlSession::State {
+  State(const Fragment& baseFragment, const HtmlRenderBudget& budget) : base(baseFragment), tracker(budget)
+  {
+    base.text = std::nullopt;
+  }
+
+  // Starts the committed part over, e.g. with a new stylesheet.
+  void restart()
+  {
+    walker.reset();
+    tokenizer.reset();
+    names = HtmlNameTable();
+    arena = Arena(kArenaChunkSize);
+    std::vector<std::string_view> blocks(styleBlocks.begin(), styleBlocks.end());
+    stylesheet = CssStylesheetCache::get(blocks);
+    tracker.reset();
+    tokenizer.emplace(arena, names, tracker);
+    walker.emplace(*stylesheet, base, tracker);
+    committed = 0;
+    leadingTrimmed = false;
+    previousProvisional = 0;
+  }
+
+  HtmlSessionUpdate renderAll()
+  {
+    previousProvisional = 0;
+    HtmlRenderResult result = HtmlRenderer::render(source, base, tracker.budget());
+    return HtmlSessionUpdate{0, std::move(result.fragments), result.exceeded};
+  }
+
+  // Whether the markup ran into the budget; from then on, every update
+  // renders from scratch within it.
+  bool overBudget()
+  {
+    if (tracker.exceeded() == HtmlRenderLimit::None && !walker->state().full()) return false;
+    renderWhole = true;
+    return true;
+  }
+
+  // Whether `<!DOCTYPE` appears anywhere from `from` on but first in the
+  // document. The renderer cuts those out before tokenizing, which may
+  // join text the session already rendered apart.
+  bool hasMisplacedDoctype(size_t from) const
+  {
+    const size_t first = source.size() - html::trimStart(source).size();
+    for (size_t i = findIgnoringCase(source, "<!doctype", from); i != std::string_view::npos;
+         i = findIgnoringCase(source, "<!doctype", i + 1)) {
+      if (i != first) return true;
+    }
+    return false;
+  }
+
+  HtmlSessionUpdate resume()
+  {
+    std::vector<std::string_view> styles;
+    {
+      WalkerSink sink(*walker, styles);
+      committed = tokenizer->advance(source, committed, sink);
+    }
+    if (overBudget()) return renderAll();
+    if (!styles.empty()) {
+      // A new `<style>` restyles what came before it: render everything
+      // again with the full stylesheet.
+      styleBlocks.insert(styleBlocks.end(), styles.begin(), styles.end());
+      restart();
+      std::vector<std::string_view> replayed;
+      WalkerSink sink(*walker, replayed);
+      committed = tokenizer->advance(source, 0, sink);
+      if (overBudget()) return renderAll();
+    }
+    return renderTail();
+  }
+
+  // Renders what follows `committed` as if the document ended there, then
+  // undoes it.
+  HtmlSessionUpdate renderTail()
+  {
+    AppendState& state = walker->state();
+    const bool wasTrimmed = leadingTrimmed;
+    if (!leadingTrimmed && state.hasContent()) {
+      state.removeLeadingWhitespace();
+      leadingTrimmed = true;
+    }
+    size_t stable = std::min(state.lowestTouched(), previousProvisional);
+    if (!wasTrimmed) stable = 0;
+
+    Walker::Checkpoint checkpoint = walker->checkpoint();
+    state.beginProvisional();
+    HtmlNameTable provisionalNames = names;
+    Arena provisionalArena(kArenaChunkSize);
+    HtmlTokenizer provisional(provisionalArena, provisionalNames, *tokenizer);
+    std::vector<std::string_view> styles;
+    WalkerSink sink(*walker, styles);
+    provisional.finish(source, committed, sink);
+    if (!styles.empty()) {
+      // An unfinished `<style>` styles the whole document.
+      state.rollback();
+      walker->restore(std::move(checkpoint));
+      return renderAll();
+    }
+    walker->leaveAll();
+    state.removeTrailingWhitespace();
+    if (overBudget()) {
+      state.rollback();
+      walker->restore(std::move(checkpoint));
+      return renderAll();
+    }
+
+    const std::vector<Fragment>& fragments = state.fragments();
+    stable = std::min({stable, state.lowestTouched(), fragments.size()});
+    if (!leadingTrimmed) stable = 0;
+    HtmlSessionUpdate update{stable, std::vector<Fragment>(fragments.begin() + static_cast<ptrdiff_t>(stable), fragments.end())};
+    if (!leadingTrimmed) eraseLeadingText(update.tail, state.leadingWhitespace());
+
+    previousProvisional = state.lowestTouched();
+    state.rollback();
+    walker->restore(std::move(checkpoint));
+    return update;
+  }
+
+  static constexpr size_t kArenaChunkSize = 16 * 1024;
+
+  Fragment base;
+  BudgetTracker tracker;
+  std::string source;
+  // Renders every update from scratch instead, see `hasMisplacedDoctype`.
+  bool renderWhole = false;
+
+  // Every `<style>` committed so far, in document order.
+  std::vector<std::string> styleBlocks;
+  std::shared_ptr<const CssStylesheet> stylesheet;
+
+  Arena arena{kArenaChunkSize};
+  HtmlNameTable names;
+  std::optional<HtmlTokenizer> tokenizer;
+  std::optional<Walker> walker;
+  size_t committed = 0;
+  bool leadingTrimmed = false;
+  // The lowest fragment the last update rendered provisionally: the caller
+  // holds those, the committed state does not.
+  size_t previousProvisional = 0;
+};
+
+HtmlSession::HtmlSession(const Fragment& baseFragment, const HtmlRenderBudget& budget)
+    : state_(std::make_unique<State>(baseFragment, budget))
+{
+  state_->restart();
+}
+
+HtmlSession::~HtmlSession() = default;
+HtmlSession::HtmlSession(HtmlSession&&) noexcept = default;
+HtmlSession& HtmlSession::operator=(HtmlSession&&) noexcept = default;
+
+const std::string& HtmlSession::source() const noexcept
+{
+  return state_->source;
+}
+
+HtmlSessionUpdate HtmlSession::append(std::string_view chunk)
+{
+  State& state = *state_;
+  const size_t previousSize = state.source.size();
+  state.source.append(chunk);
+  // A `<!DOCTYPE` may straddle the previous chunk.
+  const size_t from = previousSize >= 8 ? previousSize - 8 : 0;
+  if (!state.renderWhole && state.hasMisplacedDoctype(from)) state.renderWhole = true;
+  state.tracker.restartClock();
+  return state.renderWhole ? state.renderAll() : state.resume();
+}
+
+HtmlSessionUpdate HtmlSession::update(std::string_view html)
+{
+  const std::string& source = state_->source;
+  if (html.size() >= source.size() && html.compare(0, source.size(), source) == 0) {
+    return append(html.substr(source.size()));
+  }
+  reset();
+  return append(html);
+}
+
+void HtmlSession::reset()
+{
+  State& state = *state_;
+  state.source.clear();
+  state.styleBlocks.clear();
+  state.renderWhole = false;
+  state.restart();
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,154 @@
+//
+// NitroTextHtmlRenderer.hpp
+// Native port of the `renderer="html"` HTML renderer
+//
+
+#pragma once
+
+#include "Fragment.hpp"
+#include "NitroTextHtmlNode.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+// The limit of an `HtmlRenderBudget` a render ran into.
+enum class HtmlRenderLimit : uint8_t { None, Nodes, Depth, Output, Time };
+
+/**
+ * Bounds on the work one render may do, so untrusted markup (pathological
+ * nesting, huge attribute lists, thousands of unclosed tags) cannot stall
+ * the thread rendering it.
+ *
+ * When the parser runs into a limit, the rest of the markup renders as
+ * plain text in the base style: tags are dropped, entities decoded and
+ * whitespace collapsed. When rendering runs out of time, the remaining
+ * elements stop adding styles and spacing. Output past `maxOutputBytes` is
+ * cut off. The defaults leave any real document alone.
+ */
+struct HtmlRenderBudget {
+  // Elements, attributes and text nodes parsed.
+  size_t maxNodes = 500'000;
+  // Elements open at once.
+  size_t maxDepth = 1'000;
+  // Bytes of rendered text.
+  size_t maxOutputBytes = 8 * 1024 * 1024;
+  // Wall-clock time for parsing and rendering.
+  double maxMilliseconds = 500;
+
+  static HtmlRenderBudget unlimited() noexcept
+  {
+    constexpr size_t kNoLimit = std::numeric_limits<size_t>::max();
+    return HtmlRenderBudget{kNoLimit, kNoLimit, kNoLimit, std::numeric_limits<double>::infinity()};
+  }
+};
+
+struct HtmlRenderResult {
+  std::vector<Fragment> fragments;
+  // The concatenated fragment text.
+  std::string text;
+  // The first budget limit the render ran into, if any.
+  HtmlRenderLimit exceeded = HtmlRenderLimit::None;
+};
+
+/**
+ * Renders HTML markup to fragments natively.
+ *
+ * A port of `HTMLRenderer` in src/renderers/html.ts that must stay output
+ * compatible with it (src/renderers/html.test.ts is the reference): the same
+ * forgiving tokenizer, inline styles, semantic tags, list bullets and block
+ * spacing. Text is UTF-8 where JS works in UTF-16; only whitespace is ever
+ * trimmed, so the results are identical.
+ *
+ * `<style>` rules go further than the JS version (see `CssProcessor`):
+ * besides `*`, tag, class and id they match descendant (`a b`) and child
+ * (`a > b`) combinators, and apply in specificity, then source order. The
+ * open elements are only tracked when some rule has a combinator; a counting
+ * Bloom filter over their names (`CssAncestorFilter`) then rejects most
+ * rules whose ancestors are absent before any are walked.
+ */
+class HtmlRenderer final {
+public:
+  /**
+   * @brief Renders `html`, cascading every style over `baseFragment` (the
+   * component's own text style, `topStyles` in JS), within `budget`.
+   *
+   * Markup without a `<style>` element is rendered in one pass straight from
+   * its tokens, without building a tree, so it takes memory for the open
+   * elements only. Markup with one is parsed into a tree first, since its
+   * rules apply to the elements before it as well.
+   */
+  static HtmlRenderResult render(std::string_view html, const Fragment& baseFragment = Fragment(),
+                                 const HtmlRenderBudget& budget = HtmlRenderBudget());
+
+  /**
+   * @brief Parses `html` into a tree rooted at a "#root" element.
+   * `<script>` and `<style>` contents are kept as a single raw text child.
+   * The document refers into `html`, which must outlive it.
+   */
+  static HtmlDocument parseHtmlTree(std::string_view html);
+};
+
+struct HtmlSessionUpdate {
+  // How many leading fragments of the previous update are unchanged.
+  size_t stableCount = 0;
+  // The fragments after those. The previous fragments truncated to
+  // `stableCount` plus these are the whole render.
+  std::vector<Fragment> tail;
+  HtmlRenderLimit exceeded = HtmlRenderLimit::None;
+};
+
+/**
+ * Renders markup that arrives in chunks, such as a streamed answer, without
+ * starting over for every chunk.
+ *
+ * Every update renders exactly what `HtmlRenderer::render` would for the
+ * markup so far. The session tokenizes and renders everything up to the
+ * last token more markup cannot change, and keeps the open elements, the
+ * cascade and the list counters. Each update renders the rest as if the
+ * document ended there, then undoes that, so a chunk costs about its own
+ * length plus the open text run.
+ *
+ * A `<style>` that completes after content re-renders once with the full
+ * stylesheet. An unfinished `<style>`, or a `<!DOCTYPE` anywhere but first,
+ * makes updates render from scratch.
+ *
+ * The node, depth and output limits of `budget` apply to the markup so far,
+ * the time limit to each update. Once the markup runs into one, updates
+ * render from scratch within the budget.
+ */
+class HtmlSession final {
+public:
+  explicit HtmlSession(const Fragment& baseFragment = Fragment(),
+                       const HtmlRenderBudget& budget = HtmlRenderBudget());
+  ~HtmlSession();
+  HtmlSession(HtmlSession&&) noexcept;
+  HtmlSession& operator=(HtmlSession&&) noexcept;
+
+  /**
+   * @brief Appends `chunk` to the markup and renders it.
+   */
+  HtmlSessionUpdate append(std::string_view chunk);
+
+  /**
+   * @brief Renders `html`, appending when it extends the markup so far and
+   * starting over otherwise.
+   */
+  HtmlSessionUpdate update(std::string_view html);
+
+  void reset();
+
+  const std::string& source() const noexcept;
+
+private:
+  struct State;
+  std::unique_ptr<State> state_;
+};
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,371 @@
+//
+// NitroTextHtmlUtil.cpp
+// JS string semantics shared by the native HTML and CSS parsers
+//
+
+#include "NitroTextHtmlUtil.hpp"
+#include "NitroTextHtmlEntities.hpp"
+#include "NitroTextSimdScan.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace margelo::nitro::nitrotext::html {
+
+namespace {
+
+bool isMultiByteWhitespace(char32_t c)
+{
+  return c == 0x00A0 || c == 0x1680 || (c >= 0x2000 && c <= 0x200A) || c == 0x2028 ||
+         c == 0x2029 || c == 0x202F || c == 0x205F || c == 0x3000 || c == 0xFEFF;
+}
+
+bool isAsciiWhitespace(unsigned char c)
+{
+  return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+bool isHexDigit(char c)
+{
+  return isDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+bool isAsciiLetter(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+bool isAsciiAlphanumeric(char c) { return isAsciiLetter(c) || isDigit(c); }
+
+// Decodes the 2 or 3 byte sequence at `s[i]`; whitespace never needs more.
+char32_t decodeShortSequence(std::string_view s, size_t i, size_t& length)
+{
+  const auto b0 = static_cast<unsigned char>(s[i]);
+  if ((b0 & 0xE0) == 0xC0 && i + 1 < s.size()) {
+    length = 2;
+    return (static_cast<char32_t>(b0 & 0x1F) << 6) | (static_cast<unsigned char>(s[i + 1]) & 0x3F);
+  }
+  if ((b0 & 0xF0) == 0xE0 && i + 2 < s.size()) {
+    length = 3;
+    return (static_cast<char32_t>(b0 & 0x0F) << 12) |
+           (static_cast<char32_t>(static_cast<unsigned char>(s[i + 1]) & 0x3F) << 6) |
+           (static_cast<unsigned char>(s[i + 2]) & 0x3F);
+  }
+  length = 0;
+  return 0;
+}
+
+// Accumulates `digits` in `base`, saturating once past the code point range.
+uint32_t parseCodePoint(std::string_view digits, int base)
+{
+  uint32_t value = 0;
+  for (char c : digits) {
+    const uint32_t digit = isDigit(c) ? c - '0' : (c | 0x20) - 'a' + 10;
+    value = value * base + digit;
+    if (value > 0x10FFFF) return 0x110000;
+  }
+  return value;
+}
+
+} // namespace
+
+size_t whitespaceAt(std::string_view s, size_t i)
+{
+  if (i >= s.size()) return 0;
+  const auto c = static_cast<unsigned char>(s[i]);
+  if (c < 0x80) return isAsciiWhitespace(c) ? 1 : 0;
+  if (c != 0xC2 && c != 0xE1 && c != 0xE2 && c != 0xE3 && c != 0xEF) return 0;
+  size_t length = 0;
+  const char32_t codePoint = decodeShortSequence(s, i, length);
+  return length != 0 && isMultiByteWhitespace(codePoint) ? length : 0;
+}
+
+size_t whitespaceBefore(std::string_view s, size_t end)
+{
+  if (end == 0 || end > s.size()) return 0;
+  const auto last = static_cast<unsigned char>(s[end - 1]);
+  if (last < 0x80) return isAsciiWhitespace(last) ? 1 : 0;
+  if (end >= 2 && whitespaceAt(s, end - 2) == 2) return 2;
+  if (end >= 3 && whitespaceAt(s, end - 3) == 3) return 3;
+  return 0;
+}
+
+std::string_view trimStart(std::string_view s)
+{
+  size_t begin = 0;
+  while (size_t n = whitespaceAt(s, begin)) begin += n;
+  return s.substr(begin);
+}
+
+std::string_view trimEnd(std::string_view s)
+{
+  size_t end = s.size();
+  while (size_t n = whitespaceBefore(s, end)) end -= n;
+  return s.substr(0, end);
+}
+
+std::string_view trim(std::string_view s)
+{
+  return trimEnd(trimStart(s));
+}
+
+std::string toLowerAscii(std::string_view s)
+{
+  std::string out(s);
+  for (char& c : out) {
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c + ('a' - 'A'));
+  }
+  return out;
+}
+
+bool equalsIgnoringCase(std::string_view s, std::string_view lower) noexcept
+{
+  if (s.size() != lower.size()) return false;
+  for (size_t i = 0; i < s.size(); i++) {
+    char c = s[i];
+    if (c >= 'A' && c <= 'Z') c = static_cast<char>(c + ('a' - 'A'));
+    if (c != lower[i]) return false;
+  }
+  return true;
+}
+
+size_t encodeUtf8(char32_t c, char (&out)[4])
+{
+  if (c >= 0xD800 && c <= 0xDFFF) {
+    // A lone surrogate has no UTF-8 form.
+    c = 0xFFFD;
+  }
+  if (c < 0x80) {
+    out[0] = static_cast<char>(c);
+    return 1;
+  }
+  if (c < 0x800) {
+    out[0] = static_cast<char>(0xC0 | (c >> 6));
+    out[1] = static_cast<char>(0x80 | (c & 0x3F));
+    return 2;
+  }
+  if (c < 0x10000) {
+    out[0] = static_cast<char>(0xE0 | (c >> 12));
+    out[1] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+    out[2] = static_cast<char>(0x80 | (c & 0x3F));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xF0 | (c >> 18));
+  out[1] = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+  out[2] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+  out[3] = static_cast<char>(0x80 | (c & 0x3F));
+  return 4;
+}
+
+void appendUtf8(std::string& out, char32_t c)
+{
+  char bytes[4];
+  out.append(bytes, encodeUtf8(c, bytes));
+}
+
+namespace {
+
+struct EntityMatch {
+  // Index of the closing `;`.
+  size_t end = 0;
+  // Unset when the reference matched but is kept as written.
+  std::optional<std::string_view> replacement;
+};
+
+/**
+ * Matches /&(#x?[0-9a-fA-F]+|[a-zA-Z]+);/ at `text[amp]`. Numeric
+ * replacements are encoded into `scratch`.
+ */
+bool matchEntity(std::string_view text, size_t amp, char (&scratch)[4], EntityMatch& match)
+{
+  size_t cursor = amp + 1;
+  if (cursor < text.size() && text[cursor] == '#') {
+    cursor++;
+    const bool hex = cursor < text.size() && text[cursor] == 'x';
+    if (hex) cursor++;
+    const size_t digitsBegin = cursor;
+    while (cursor < text.size() && isHexDigit(text[cursor])) cursor++;
+    if (cursor == digitsBegin || cursor >= text.size() || text[cursor] != ';') return false;
+    std::string_view digits = text.substr(digitsBegin, cursor - digitsBegin);
+    if (!hex) {
+      // parseInt(…, 10) stops at the first hex-only digit.
+      size_t decimal = 0;
+      while (decimal < digits.size() && isDigit(digits[decimal])) decimal++;
+      digits = digits.substr(0, decimal);
+    }
+    match.end = cursor;
+    // String.fromCodePoint throws past U+10FFFF; keep the reference instead.
+    const uint32_t codePoint = digits.empty() ? 0x110000 : parseCodePoint(digits, hex ? 16 : 10);
+    if (codePoint <= 0x10FFFF) {
+      match.replacement = std::string_view(scratch, encodeUtf8(codePoint, scratch));
+    }
+    return true;
+  }
+  // Names start with a letter (`frac12`, `there4`); none is longer than
+  // kMaxHtmlEntityNameLength, so longer runs are never scanned to the end.
+  const size_t nameBegin = cursor;
+  if (cursor >= text.size() || !isAsciiLetter(text[cursor])) return false;
+  const size_t nameLimit = std::min(text.size(), nameBegin + kMaxHtmlEntityNameLength + 1);
+  while (cursor < nameLimit && isAsciiAlphanumeric(text[cursor])) cursor++;
+  if (cursor >= text.size() || text[cursor] != ';') return false;
+  match.end = cursor;
+  match.replacement = lookupHtmlEntity(text.substr(nameBegin, cursor - nameBegin));
+  return true;
+}
+
+/**
+ * Calls `sink` with consecutive chunks of `text` with its references
+ * decoded. A chunk never splits a code point.
+ */
+template <typename Sink>
+void decodeEntitiesInto(std::string_view text, Sink&& sink)
+{
+  size_t copied = 0;
+  char scratch[4];
+  size_t amp = simd::findByte(text, 0, '&');
+  while (amp != std::string_view::npos) {
+    EntityMatch match;
+    if (!matchEntity(text, amp, scratch, match)) {
+      amp = simd::findByte(text, amp + 1, '&');
+      continue;
+    }
+    if (match.replacement.has_value()) {
+      sink(text.substr(copied, amp - copied));
+      sink(*match.replacement);
+      copied = match.end + 1;
+    }
+    amp = simd::findByte(text, match.end + 1, '&');
+  }
+  sink(text.substr(copied));
+}
+
+/**
+ * Appends text to `out` with every whitespace run turned into one space.
+ * Runs may span chunks.
+ */
+class WhitespaceCollapser final {
+public:
+  explicit WhitespaceCollapser(std::string& out) : out_(out) {}
+
+  void operator()(std::string_view chunk)
+  {
+    size_t i = 0;
+    while (i < chunk.size()) {
+      if (const size_t n = whitespaceAt(chunk, i)) {
+        if (!inWhitespace_) out_.push_back(' ');
+        inWhitespace_ = true;
+        i += n;
+        continue;
+      }
+      // Copy up to the next byte that may need work in one go. Lone spaces
+      // are part of the run; one that ends it joins whitespace right after
+      // it, which may start the next chunk.
+      const size_t special = simd::findTextSpecial(chunk, i + 1);
+      const size_t runEnd = special == std::string_view::npos ? chunk.size() : special;
+      out_.append(chunk, i, runEnd - i);
+      inWhitespace_ = chunk[runEnd - 1] == ' ';
+      i = runEnd;
+    }
+  }
+
+private:
+  std::string& out_;
+  bool inWhitespace_ = false;
+};
+
+} // namespace
+
+std::string decodeEntities(std::string_view text)
+{
+  std::string out;
+  out.reserve(text.size());
+  decodeEntitiesInto(text, [&out](std::string_view chunk) { out.append(chunk); });
+  return out;
+}
+
+std::string collapseWhitespace(std::string_view text)
+{
+  std::string out;
+  out.reserve(text.size());
+  WhitespaceCollapser collapser(out);
+  collapser(text);
+  return out;
+}
+
+std::string_view decodeText(std::string_view text, bool collapse, std::string& scratch)
+{
+  const size_t special = collapse ? simd::findTextSpecial(text, 0) : simd::findByte(text, 0, '&');
+  if (special == std::string_view::npos) {
+    return text;
+  }
+  scratch.clear();
+  appendDecodedText(text, collapse, scratch);
+  return scratch;
+}
+
+void appendDecodedText(std::string_view text, bool collapse, std::string& out)
+{
+  if (!collapse) {
+    decodeEntitiesInto(text, [&out](std::string_view chunk) { out.append(chunk); });
+    return;
+  }
+  decodeEntitiesInto(text, WhitespaceCollapser(out));
+}
+
+std::optional<double> parseNumeric(std::string_view value)
+{
+  // parseFloat: leading whitespace, then the longest decimal literal prefix.
+  value = trimStart(value);
+  size_t end = 0;
+  if (end < value.size() && (value[end] == '+' || value[end] == '-')) end++;
+  size_t digits = 0;
+  while (end < value.size() && isDigit(value[end])) end++, digits++;
+  if (end < value.size() && value[end] == '.') {
+    end++;
+    while (end < value.size() && isDigit(value[end])) end++, digits++;
+  }
+  if (digits == 0) return std::nullopt;
+  if (end < value.size() && (value[end] == 'e' || value[end] == 'E')) {
+    size_t exponent = end + 1;
+    if (exponent < value.size() && (value[exponent] == '+' || value[exponent] == '-')) exponent++;
+    if (exponent < value.size() && isDigit(value[exponent])) {
+      end = exponent;
+      while (end < value.size() && isDigit(value[end])) end++;
+    }
+  }
+  // strtod needs a terminator; literals this short, which is all of them in
+  // practice, are copied to the stack instead of a string.
+  char buffer[64];
+  std::string literal;
+  const char* terminated = buffer;
+  if (end < sizeof(buffer)) {
+    std::memcpy(buffer, value.data(), end);
+    buffer[end] = '\0';
+  } else {
+    literal.assign(value.substr(0, end));
+    terminated = literal.c_str();
+  }
+  const double n = std::strtod(terminated, nullptr);
+  if (!std::isfinite(n)) return std::nullopt;
+  return n;
+}
+
+bool isZeroMargin(std::string_view value)
+{
+  const auto trimmed = trim(value);
+  if (trimmed == "0") return true;
+  const auto n = parseNumeric(trimmed);
+  return n.has_value() && *n == 0;
+}
+
+std::string stripQuotes(std::string_view value)
+{
+  std::string out;
+  for (char c : trim(value)) {
+    if (c != '"' && c != '\'') out.push_back(c);
+  }
+  return out;
+}
+
+} // namespace margelo::nitro::nitrotext::html
@@ -0,0 +1,117 @@
+//
+// NitroTextHtmlUtil.hpp
+// JS string semantics shared by the native HTML and CSS parsers
+//
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * The native renderer must produce exactly what `HTMLRenderer` produces in
+ * JS, so these helpers reproduce the JS primitives it is built on (`trim`,
+ * `/\s/`, `parseFloat`, ...) over UTF-8. Whitespace is the ECMAScript set:
+ * ASCII whitespace plus U+00A0, U+1680, U+2000-U+200A, U+2028, U+2029,
+ * U+202F, U+205F, U+3000 and U+FEFF. All of them are single UTF-16 code
+ * units, so counting removed code points matches JS string lengths.
+ */
+namespace margelo::nitro::nitrotext::html {
+
+/**
+ * @brief Byte length of the whitespace code point starting at `s[i]`, or 0.
+ */
+size_t whitespaceAt(std::string_view s, size_t i);
+
+/**
+ * @brief Byte length of the whitespace code point ending right before
+ * `s[end]`, or 0.
+ */
+size_t whitespaceBefore(std::string_view s, size_t end);
+
+/**
+ * @brief Calls `onToken` for every non-empty token of `value` split on
+ * whitespace, like `value.split(/\s+/).filter(Boolean)`.
+ */
+template <typename Fn>
+void forEachToken(std::string_view value, Fn&& onToken)
+{
+  size_t i = 0;
+  while (i < value.size()) {
+    while (size_t n = whitespaceAt(value, i)) i += n;
+    const size_t begin = i;
+    while (i < value.size() && whitespaceAt(value, i) == 0) i++;
+    if (i > begin) onToken(value.substr(begin, i - begin));
+  }
+}
+
+std::string_view trimStart(std::string_view s);
+std::string_view trimEnd(std::string_view s);
+std::string_view trim(std::string_view s);
+
+/**
+ * @brief `toLowerCase` for the ASCII range; tag, attribute and property names
+ * are ASCII.
+ */
+std::string toLowerAscii(std::string_view s);
+
+/**
+ * @brief Whether `toLowerAscii(s) == lower`, without building the lowercase
+ * copy. `lower` must be lowercase.
+ */
+bool equalsIgnoringCase(std::string_view s, std::string_view lower) noexcept;
+
+/**
+ * @brief Decodes `&name;`, `&#123;` and `&#x1F;` references like
+ * `decodeEntities` in src/renderers/utils.ts. Unknown names are kept as is.
+ */
+std::string decodeEntities(std::string_view text);
+
+/**
+ * @brief Replaces every run of whitespace with a single space.
+ */
+std::string collapseWhitespace(std::string_view text);
+
+/**
+ * @brief `decodeEntities(text)`, through `collapseWhitespace` if `collapse`
+ * is set. Returns `text` itself, copying nothing, when a vector scan finds
+ * nothing to decode or collapse; otherwise decodes into `scratch` and returns
+ * a view of it.
+ */
+std::string_view decodeText(std::string_view text, bool collapse, std::string& scratch);
+
+/**
+ * @brief Appends `decodeEntities(text)` to `out`, through
+ * `collapseWhitespace` if `collapse` is set, in a single pass.
+ */
+void appendDecodedText(std::string_view text, bool collapse, std::string& out);
+
+/**
+ * @brief `parseFloat`, returning `std::nullopt` for NaN and infinities.
+ */
+std::optional<double> parseNumeric(std::string_view value);
+
+/**
+ * @brief Whether a margin value is zero ("0", "0px", "-0em", ...).
+ */
+bool isZeroMargin(std::string_view value);
+
+/**
+ * @brief Trims `value` and removes every single and double quote from it.
+ */
+std::string stripQuotes(std::string_view value);
+
+/**
+ * @brief Encodes `codePoint` as UTF-8 into `out` and returns the byte count.
+ * Lone surrogates become U+FFFD.
+ */
+size_t encodeUtf8(char32_t codePoint, char (&out)[4]);
+
+/**
+ * @brief Appends `codePoint` to `out` as UTF-8.
+ */
+void appendUtf8(std::string& out, char32_t codePoint);
+
+} // namespace margelo::nitro::nitrotext::html
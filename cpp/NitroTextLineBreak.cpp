@@ -0,0 +1,297 @@
+//
+// NitroTextLineBreak.cpp
+//
+
+#include "NitroTextLineBreak.hpp"
+#include "NitroTextSimdScan.hpp"
+#include "NitroTextUtf8.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+using C = LineBreakClass;
+
+constexpr bool isOneOf(C value, C a, C b) noexcept { return value == a || value == b; }
+
+constexpr bool isOneOf(C value, C a, C b, C c) noexcept { return value == a || value == b || value == c; }
+
+constexpr bool isAlphabetic(C value) noexcept { return isOneOf(value, C::AL, C::HL); }
+
+constexpr bool isHangul(C value) noexcept
+{
+  return value == C::JL || value == C::JV || value == C::JT || value == C::H2 || value == C::H3;
+}
+
+// Classes a combining mark attaches to (LB9).
+constexpr bool takesMarks(C value) noexcept
+{
+  return !(value == C::BK || value == C::CR || value == C::LF || value == C::NL || value == C::SP ||
+           value == C::ZW);
+}
+
+constexpr size_t kClassCount = static_cast<size_t>(C::RI) + 1;
+
+// Whether LB25 would keep `(PR | PO) × (OP | HY)` together: a number must
+// follow, past any combining marks.
+bool numberFollows(std::string_view text, size_t from)
+{
+  while (from < text.size()) {
+    const C next = lineBreakClass(decodeUtf8(text, from));
+    if (next != C::CM && next != C::ZWJ) return next == C::NU;
+  }
+  return false;
+}
+
+} // namespace
+
+LineBreaker::LineBreaker(std::string_view text, LineBreakStrategyIOS strategy)
+    : text_(text),
+      hangulWords_(strategy == LineBreakStrategyIOS::STANDARD || strategy == LineBreakStrategyIOS::HANGUL_WORD)
+{
+}
+
+constexpr std::optional<LineBreaker::Decision> LineBreaker::applyHardRules(const State& state, C& current,
+                                                                           uint8_t& flags)
+{
+  const C previous = state.previous;
+  // LB4, LB5
+  if (previous == C::BK || previous == C::LF || previous == C::NL) return Decision::Mandatory;
+  if (previous == C::CR) return current == C::LF ? Decision::Keep : Decision::Mandatory;
+  // LB6, LB7
+  if (current == C::BK || current == C::CR || current == C::LF || current == C::NL) return Decision::Keep;
+  if (current == C::SP || current == C::ZW) return Decision::Keep;
+  // LB8, LB8a
+  if (previous == C::ZW || (previous == C::SP && state.beforeSpaces == C::ZW)) return Decision::Allowed;
+  if (state.previousZwj) return Decision::Keep;
+  // LB9, LB10
+  if (current == C::CM || current == C::ZWJ) {
+    if (takesMarks(previous)) return Decision::Keep;
+    current = C::AL;
+    flags = 0;
+  }
+  return std::nullopt;
+}
+
+constexpr LineBreaker::Decision LineBreaker::applyPairRules(const State& state, C current, uint8_t flags,
+                                                            std::string_view text, size_t after)
+{
+  const C previous = state.previous;
+  // The class before any spaces the text ends in.
+  const C spaced = previous == C::SP ? state.beforeSpaces : previous;
+
+  // LB11, LB12, LB12a
+  if (current == C::WJ || previous == C::WJ || previous == C::GL) return Decision::Keep;
+  if (current == C::GL && previous != C::SP && previous != C::BA && previous != C::HY) return Decision::Keep;
+  // LB13
+  if (current == C::CL || current == C::CP || current == C::EX || current == C::IS || current == C::SY) {
+    return Decision::Keep;
+  }
+  // LB14-LB17, across spaces.
+  if (spaced == C::OP) return Decision::Keep;
+  if (current == C::OP && spaced == C::QU) return Decision::Keep;
+  if (current == C::NS && isOneOf(spaced, C::CL, C::CP)) return Decision::Keep;
+  if (current == C::B2 && spaced == C::B2) return Decision::Keep;
+  // LB18
+  if (previous == C::SP) return Decision::Allowed;
+  // LB19, LB20
+  if (current == C::QU || previous == C::QU) return Decision::Keep;
+  if (current == C::CB || previous == C::CB) return Decision::Allowed;
+  // LB21, LB21a, LB21b
+  if (isOneOf(current, C::BA, C::HY, C::NS) || previous == C::BB) return Decision::Keep;
+  if (isOneOf(previous, C::HY, C::BA) && state.beforePrevious == C::HL) return Decision::Keep;
+  if (previous == C::SY && current == C::HL) return Decision::Keep;
+  // LB22
+  if (current == C::IN) return Decision::Keep;
+  // LB23, LB23a, LB24
+  if ((isAlphabetic(previous) && current == C::NU) || (previous == C::NU && isAlphabetic(current))) {
+    return Decision::Keep;
+  }
+  if ((previous == C::PR && isOneOf(current, C::ID, C::EB, C::EM)) ||
+      (isOneOf(previous, C::ID, C::EB, C::EM) && current == C::PO)) {
+    return Decision::Keep;
+  }
+  if ((isOneOf(previous, C::PR, C::PO) && isAlphabetic(current)) ||
+      (isAlphabetic(previous) && isOneOf(current, C::PR, C::PO))) {
+    return Decision::Keep;
+  }
+  // LB25, as the regular expression
+  //   (PR | PO)? (OP | HY)? NU (NU | SY | IS)* (CL | CP)? (PR | PO)?
+  if (state.numeric == Numeric::Digits && isOneOf(current, C::NU, C::SY, C::IS)) return Decision::Keep;
+  if (state.numeric != Numeric::None && isOneOf(current, C::PR, C::PO)) return Decision::Keep;
+  if (isOneOf(previous, C::OP, C::HY) && current == C::NU) return Decision::Keep;
+  if (isOneOf(previous, C::PR, C::PO) &&
+      (current == C::NU || (isOneOf(current, C::OP, C::HY) && numberFollows(text, after)))) {
+    return Decision::Keep;
+  }
+  // LB26, LB27: Korean syllable blocks.
+  if (previous == C::JL && (isOneOf(current, C::JL, C::JV) || isOneOf(current, C::H2, C::H3))) {
+    return Decision::Keep;
+  }
+  if (isOneOf(previous, C::JV, C::H2) && isOneOf(current, C::JV, C::JT)) return Decision::Keep;
+  if (isOneOf(previous, C::JT, C::H3) && current == C::JT) return Decision::Keep;
+  if ((isHangul(previous) && current == C::PO) || (previous == C::PR && isHangul(current))) {
+    return Decision::Keep;
+  }
+  // LB28, LB29
+  if (isAlphabetic(previous) && isAlphabetic(current)) return Decision::Keep;
+  if (previous == C::IS && isAlphabetic(current)) return Decision::Keep;
+  // LB30
+  if (isOneOf(previous, C::AL, C::HL, C::NU) && current == C::OP && !(flags & kLineBreakEastAsianWide)) {
+    return Decision::Keep;
+  }
+  if (previous == C::CP && !(state.previousFlags & kLineBreakEastAsianWide) && isOneOf(current, C::AL, C::HL, C::NU)) {
+    return Decision::Keep;
+  }
+  // LB30a, LB30b
+  if (previous == C::RI && current == C::RI && state.oddRegionalIndicators) return Decision::Keep;
+  if (current == C::EM && (previous == C::EB || (state.previousFlags & kLineBreakPictographicReserved))) {
+    return Decision::Keep;
+  }
+  // LB31
+  return Decision::Allowed;
+}
+
+constexpr bool LineBreaker::readsState(C previous, C current)
+{
+  // LB25: whether a number precedes. After NU it always does, and only NU,
+  // SY, IS, CL and CP can end one.
+  if (isOneOf(current, C::NU, C::SY, C::IS) && isOneOf(previous, C::SY, C::IS)) return true;
+  if (isOneOf(current, C::PR, C::PO) && (isOneOf(previous, C::SY, C::IS) || isOneOf(previous, C::CL, C::CP))) {
+    return true;
+  }
+  if (isOneOf(previous, C::PR, C::PO) && isOneOf(current, C::OP, C::HY)) return true;
+  // LB30, LB30a, LB30b: East Asian Width, pairs of regional indicators and
+  // unassigned pictographs.
+  if (isOneOf(previous, C::AL, C::HL, C::NU) && current == C::OP) return true;
+  if (previous == C::CP && isOneOf(current, C::AL, C::HL, C::NU)) return true;
+  return (previous == C::RI && current == C::RI) || current == C::EM;
+}
+
+LineBreaker::Decision LineBreaker::decide(C current, uint8_t flags) const
+{
+  using Table = std::array<std::array<uint8_t, kClassCount>, kClassCount>;
+  constexpr uint8_t kReadsState = 0xff;
+  // The pair rules for every two classes that need nothing else, and
+  // kReadsState for the rest. LB21a also looks two characters back, which
+  // is checked below.
+  static constexpr Table kPairs = [] {
+    Table pairs{};
+    for (size_t p = 0; p < kClassCount; p++) {
+      for (size_t c = 0; c < kClassCount; c++) {
+        State state;
+        state.previous = static_cast<C>(p);
+        state.numeric = state.previous == C::NU ? Numeric::Digits : Numeric::None;
+        pairs[p][c] = readsState(state.previous, static_cast<C>(c))
+                          ? kReadsState
+                          : static_cast<uint8_t>(applyPairRules(state, static_cast<C>(c), 0, {}, 0));
+      }
+    }
+    return pairs;
+  }();
+  // After spaces, by the class before them and the next one (LB14-LB18).
+  static constexpr Table kAfterSpaces = [] {
+    Table pairs{};
+    for (size_t b = 0; b < kClassCount; b++) {
+      for (size_t c = 0; c < kClassCount; c++) {
+        State state;
+        state.previous = C::SP;
+        state.beforeSpaces = static_cast<C>(b);
+        pairs[b][c] = static_cast<uint8_t>(applyPairRules(state, static_cast<C>(c), 0, {}, 0));
+      }
+    }
+    return pairs;
+  }();
+
+  if (const auto decision = applyHardRules(state_, current, flags)) return *decision;
+  if (state_.previous == C::SP) {
+    return static_cast<Decision>(kAfterSpaces[static_cast<size_t>(state_.beforeSpaces)][static_cast<size_t>(current)]);
+  }
+  const uint8_t pair = kPairs[static_cast<size_t>(state_.previous)][static_cast<size_t>(current)];
+  if (pair != kReadsState && state_.beforePrevious != C::HL) return static_cast<Decision>(pair);
+  return applyPairRules(state_, current, flags, text_, position_);
+}
+
+void LineBreaker::commit(State& state, C current, uint8_t flags)
+{
+  state.previousZwj = current == C::ZWJ;
+  if (current == C::CM || current == C::ZWJ) {
+    // LB9: the mark continues its base.
+    if (takesMarks(state.previous)) return;
+    // LB10
+    current = C::AL;
+    flags = 0;
+  }
+  if (current == C::SP && state.previous != C::SP) state.beforeSpaces = state.previous;
+  if (current == C::NU) {
+    state.numeric = Numeric::Digits;
+  } else if (state.numeric == Numeric::Digits && isOneOf(current, C::SY, C::IS)) {
+    state.numeric = Numeric::Digits;
+  } else if (state.numeric == Numeric::Digits && isOneOf(current, C::CL, C::CP)) {
+    state.numeric = Numeric::Closed;
+  } else {
+    state.numeric = Numeric::None;
+  }
+  state.oddRegionalIndicators = current == C::RI && !(state.previous == C::RI && state.oddRegionalIndicators);
+  state.beforePrevious = state.previous;
+  state.previous = current;
+  state.previousFlags = flags;
+}
+
+void LineBreaker::skipAlphanumerics()
+{
+  // AL, HL or NU followed by ASCII letters and digits (AL and NU) never
+  // breaks (LB23, LB25, LB28), so only the state at the end matters.
+  if (!isOneOf(state_.previous, C::AL, C::HL, C::NU)) return;
+  const size_t end = std::min(simd::findNotAlphanumeric(text_, position_), text_.size());
+  if (end == position_) return;
+  const auto asciiClass = [](char c) { return c <= '9' ? C::NU : C::AL; };
+  state_.beforePrevious = end - position_ >= 2 ? asciiClass(text_[end - 2]) : state_.previous;
+  state_.previous = asciiClass(text_[end - 1]);
+  state_.previousFlags = 0;
+  state_.previousZwj = false;
+  state_.oddRegionalIndicators = false;
+  state_.numeric = state_.previous == C::NU ? Numeric::Digits : Numeric::None;
+  position_ = end;
+}
+
+std::optional<LineBreak> LineBreaker::next()
+{
+  while (position_ < text_.size()) {
+    if (position_ > 0) {
+      skipAlphanumerics();
+      if (position_ == text_.size()) break;
+    }
+    const size_t at = position_;
+    const uint8_t property = lineBreakProperty(decodeUtf8(text_, position_));
+    auto current = static_cast<C>(property & kLineBreakClassMask);
+    const uint8_t flags = property & ~kLineBreakClassMask;
+    if (hangulWords_ && isHangul(current)) current = C::AL;
+
+    // LB2: never at the start of the text.
+    const Decision decision = at == 0 ? Decision::Keep : decide(current, flags);
+    commit(state_, current, flags);
+    if (decision != Decision::Keep) {
+      return LineBreak{at, decision == Decision::Mandatory};
+    }
+  }
+  // LB3
+  if (finished_ || text_.empty()) return std::nullopt;
+  finished_ = true;
+  return LineBreak{text_.size(), true};
+}
+
+std::vector<LineBreak> findLineBreaks(std::string_view text, LineBreakStrategyIOS strategy)
+{
+  std::vector<LineBreak> breaks;
+  LineBreaker breaker(text, strategy);
+  while (const auto lineBreak = breaker.next()) {
+    breaks.push_back(*lineBreak);
+  }
+  return breaks;
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,137 @@
+//
+// NitroTextLineBreak.hpp
+// Line break opportunities of UTF-8 text (UAX #14)
+//
+
+#pragma once
+
+#include "LineBreakStrategyIOS.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * Line breaking classes of UAX #14 after rule LB1: AI, SG and XX resolve to
+ * AL, SA to CM or AL by general category, and CJ to NS. The order is shared
+ * with scripts/generate-unicode-tables.mjs.
+ */
+enum class LineBreakClass : uint8_t {
+  BK, CR, LF, CM, NL, WJ, ZW, GL, SP, ZWJ,
+  B2, BA, BB, HY, CB, CL, CP, EX, IN, NS,
+  OP, QU, IS, NU, PO, PR, SY, AL, EB, EM,
+  H2, H3, HL, ID, JL, JV, JT, RI,
+};
+
+constexpr uint8_t kLineBreakClassMask = 0x3f;
+// Set on OP and CP with East_Asian_Width F, W or H, which LB30 leaves out.
+constexpr uint8_t kLineBreakEastAsianWide = 0x40;
+// Set on unassigned Extended_Pictographic codepoints, for LB30b.
+constexpr uint8_t kLineBreakPictographicReserved = 0x80;
+
+/**
+ * @brief The `LineBreakClass` of `codepoint` in the low bits, and the flags
+ * above. Generated into NitroTextLineBreakTables.cpp.
+ */
+uint8_t lineBreakProperty(char32_t codepoint) noexcept;
+
+inline LineBreakClass lineBreakClass(char32_t codepoint) noexcept
+{
+  return static_cast<LineBreakClass>(lineBreakProperty(codepoint) & kLineBreakClassMask);
+}
+
+struct LineBreak {
+  // Byte offset of the first character of the next line.
+  size_t offset = 0;
+  // After a hard line break (LB4, LB5) or at the end of the text (LB3).
+  bool mandatory = false;
+
+  bool operator==(const LineBreak& other) const noexcept
+  {
+    return offset == other.offset && mandatory == other.mandatory;
+  }
+};
+
+/**
+ * Walks the line break opportunities of UTF-8 text, first to last, by the
+ * default algorithm of UAX #14 with the tailorings of `lineBreakStrategyIOS`:
+ *
+ * - `HANGUL_WORD` keeps Korean words together, breaking only where spaces
+ *   or punctuation allow: Hangul syllables and jamo are treated as AL, the
+ *   tailoring UAX #14 describes for Korean written with spaces.
+ * - `STANDARD`, the default on iOS, includes Hangul word priority.
+ * - `PUSH_OUT` and `NONE` break by the default rules. Pushing lines out to
+ *   avoid a lone last word is a decision of line fitting, not of where
+ *   breaks are allowed.
+ *
+ * Numbers follow the regular expression tailoring of LB25, as the Unicode
+ * test data does. Scripts that need a dictionary (Thai, Lao, Khmer, ...)
+ * only break at spaces and punctuation.
+ *
+ * Most pairs of classes decide a break on their own; those go through a
+ * table built from the rules at compile time, and only the rest through the
+ * rules themselves. Runs of ASCII letters and digits are skipped a register
+ * at a time (see `simd::findNotAlphanumeric`): nothing breaks inside them,
+ * so prose only meets the rules at word edges.
+ */
+class LineBreaker final {
+public:
+  explicit LineBreaker(std::string_view text, LineBreakStrategyIOS strategy = LineBreakStrategyIOS::STANDARD);
+
+  /**
+   * @brief The next break opportunity, in increasing order of offset. The
+   * last one is the mandatory break at the end of the text; empty text has
+   * none.
+   */
+  std::optional<LineBreak> next();
+
+private:
+  enum class Numeric : uint8_t { None, Digits, Closed };
+
+  enum class Decision : uint8_t { Keep, Allowed, Mandatory };
+
+  // What the rules see of the text before the next character.
+  struct State {
+    // The class of the last character, with combining marks folded into
+    // their base (LB9, LB10). Starts out as a class no mark attaches to.
+    LineBreakClass previous = LineBreakClass::LF;
+    uint8_t previousFlags = 0;
+    // The class before `previous` (LB21a), and before the spaces the text
+    // ends in (LB8, LB14-LB17).
+    LineBreakClass beforePrevious = LineBreakClass::LF;
+    LineBreakClass beforeSpaces = LineBreakClass::LF;
+    // The last character was a ZWJ, folded or not (LB8a).
+    bool previousZwj = false;
+    // The text ends in an odd number of regional indicators (LB30a).
+    bool oddRegionalIndicators = false;
+    // Where the text ends in the number expression of LB25.
+    Numeric numeric = Numeric::None;
+  };
+
+  static constexpr std::optional<Decision> applyHardRules(const State& state, LineBreakClass& current,
+                                                          uint8_t& flags);
+  static constexpr Decision applyPairRules(const State& state, LineBreakClass current, uint8_t flags,
+                                           std::string_view text, size_t after);
+  static constexpr bool readsState(LineBreakClass previous, LineBreakClass current);
+  static void commit(State& state, LineBreakClass current, uint8_t flags);
+  Decision decide(LineBreakClass current, uint8_t flags) const;
+  void skipAlphanumerics();
+
+  std::string_view text_;
+  bool hangulWords_;
+  size_t position_ = 0;
+  bool finished_ = false;
+  State state_;
+};
+
+/**
+ * @brief Every line break opportunity of `text`; see `LineBreaker`.
+ */
+std::vector<LineBreak> findLineBreaks(std::string_view text,
+                                      LineBreakStrategyIOS strategy = LineBreakStrategyIOS::STANDARD);
+
+} // namespace margelo::nitro::nitrotext
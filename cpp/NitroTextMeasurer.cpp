@@ -0,0 +1,392 @@
+//
+// NitroTextMeasurer.cpp
+//
+
+#include "NitroTextMeasurer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
+#include <react/renderer/textlayoutmanager/TextLayoutManagerExtended.h>
+
+namespace margelo::nitro::nitrotext::views {
+
+namespace {
+
+// How much the user's text size setting scales `textAttributes`, as the
+// platform text stack applies it.
+react::Float fontSizeMultiplier(const react::TextAttributes &textAttributes)
+{
+  if (!textAttributes.allowFontScaling.value_or(true) ||
+      std::isnan(textAttributes.fontSizeMultiplier)) {
+    return 1;
+  }
+  if (textAttributes.maxFontSizeMultiplier >= 1) {
+    return std::min(
+        textAttributes.fontSizeMultiplier,
+        textAttributes.maxFontSizeMultiplier);
+  }
+  return textAttributes.fontSizeMultiplier;
+}
+
+EllipsizeMode toEllipsizeMode(react::EllipsizeMode ellipsizeMode)
+{
+  switch (ellipsizeMode) {
+  case react::EllipsizeMode::Clip:
+    return EllipsizeMode::CLIP;
+  case react::EllipsizeMode::Head:
+    return EllipsizeMode::HEAD;
+  case react::EllipsizeMode::Middle:
+    return EllipsizeMode::MIDDLE;
+  case react::EllipsizeMode::Tail:
+  default:
+    return EllipsizeMode::TAIL;
+  }
+}
+
+LineBreakStrategyIOS toLineBreakStrategy(
+    std::optional<react::LineBreakStrategy> lineBreakStrategy)
+{
+  switch (lineBreakStrategy.value_or(react::LineBreakStrategy::Standard)) {
+  case react::LineBreakStrategy::None:
+    return LineBreakStrategyIOS::NONE;
+  case react::LineBreakStrategy::HangulWordPriority:
+    return LineBreakStrategyIOS::HANGUL_WORD;
+  case react::LineBreakStrategy::PushOut:
+    return LineBreakStrategyIOS::PUSH_OUT;
+  case react::LineBreakStrategy::Standard:
+  default:
+    return LineBreakStrategyIOS::STANDARD;
+  }
+}
+
+} // namespace
+
+std::shared_ptr<const TextMeasurer> TextMeasurer::fromContextContainer(
+    const std::shared_ptr<const react::ContextContainer> &contextContainer)
+{
+  if (contextContainer) {
+    if (auto injected =
+            contextContainer->find<std::shared_ptr<const TextMeasurer>>(
+                kContextContainerKey);
+        injected && *injected) {
+      return *injected;
+    }
+  }
+  return std::make_shared<const TextLayoutManagerMeasurer>(
+      std::make_shared<const react::TextLayoutManager>(contextContainer));
+}
+
+TextLayoutManagerMeasurer::TextLayoutManagerMeasurer(
+    std::shared_ptr<const react::TextLayoutManager> textLayoutManager)
+    : textLayoutManager_(std::move(textLayoutManager))
+{
+}
+
+react::TextMeasurement TextLayoutManagerMeasurer::measure(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    const react::TextLayoutContext &layoutContext,
+    const react::LayoutConstraints &layoutConstraints) const
+{
+  return textLayoutManager_->measure(
+      attributedStringBox,
+      paragraphAttributes,
+      layoutContext,
+      layoutConstraints);
+}
+
+react::LinesMeasurements TextLayoutManagerMeasurer::measureLines(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    react::Size size) const
+{
+  if constexpr (react::TextLayoutManagerExtended::supportsLineMeasurement()) {
+    return react::TextLayoutManagerExtended(*textLayoutManager_)
+        .measureLines(attributedStringBox, paragraphAttributes, size);
+  } else {
+    return {};
+  }
+}
+
+CachingTextMeasurer::CachingTextMeasurer(
+    std::shared_ptr<const TextMeasurer> measurer)
+    : measurer_(std::move(measurer))
+{
+}
+
+react::TextMeasurement CachingTextMeasurer::measure(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    const react::TextLayoutContext &layoutContext,
+    const react::LayoutConstraints &layoutConstraints) const
+{
+  auto measure = [&] {
+    return measurer_->measure(
+        attributedStringBox,
+        paragraphAttributes,
+        layoutContext,
+        layoutConstraints);
+  };
+  // An opaque platform string has nothing to key on.
+  if (attributedStringBox.getMode() !=
+      react::AttributedStringBox::Mode::Value) {
+    return measure();
+  }
+  return cache_.get(
+      react::TextMeasureCacheKey{
+          .attributedString = attributedStringBox.getValue(),
+          .paragraphAttributes = paragraphAttributes,
+          .layoutConstraints = layoutConstraints},
+      measure);
+}
+
+react::LinesMeasurements CachingTextMeasurer::measureLines(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    react::Size size) const
+{
+  return measurer_->measureLines(
+      attributedStringBox, paragraphAttributes, size);
+}
+
+FixedAdvanceTextMeasurer::FixedAdvanceTextMeasurer(
+    react::Float advance, react::Float lineHeight)
+    : advance_(advance), lineHeight_(lineHeight)
+{
+}
+
+std::vector<FixedAdvanceTextMeasurer::Line> FixedAdvanceTextMeasurer::layout(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    react::Float maxWidth) const
+{
+  std::vector<Line> lines;
+  if (attributedStringBox.getMode() !=
+      react::AttributedStringBox::Mode::Value) {
+    return lines;
+  }
+  const std::string text = attributedStringBox.getValue().getString();
+  if (text.empty()) {
+    return lines;
+  }
+  // Unconstrained (infinite) widths never wrap.
+  const react::Float fit = maxWidth / advance_;
+  const size_t perLine = fit < 1e9f
+      ? std::max<size_t>(1, static_cast<size_t>(fit))
+      : SIZE_MAX;
+  const size_t maxLines = paragraphAttributes.maximumNumberOfLines > 0
+      ? static_cast<size_t>(paragraphAttributes.maximumNumberOfLines)
+      : SIZE_MAX;
+
+  auto isContinuation = [&](size_t i) {
+    return (static_cast<uint8_t>(text[i]) & 0xC0) == 0x80;
+  };
+
+  size_t start = 0;
+  while (start <= text.size() && lines.size() < maxLines) {
+    size_t end = text.find('\n', start);
+    if (end == std::string::npos) {
+      end = text.size();
+    }
+    // Wraps the paragraph [start, end) into lines of `perLine` characters.
+    size_t lineStart = start;
+    do {
+      size_t at = lineStart;
+      size_t characters = 0;
+      // Up to the last character that is not a space.
+      size_t visible = 0;
+      // Just past the last space, and what was visible before it.
+      size_t breakAt = std::string::npos;
+      size_t breakVisible = 0;
+      size_t lineEnd = end;
+      while (at < end) {
+        if (text[at] == ' ') {
+          // Spaces hang past the end of the line.
+          at++;
+          characters++;
+          breakAt = at;
+          breakVisible = visible;
+          continue;
+        }
+        if (characters + 1 > perLine && at > lineStart) {
+          lineEnd = breakAt != std::string::npos ? breakAt : at;
+          visible = breakAt != std::string::npos ? breakVisible : visible;
+          break;
+        }
+        do {
+          at++;
+        } while (at < end && isContinuation(at));
+        visible = ++characters;
+      }
+      lines.push_back(Line{
+          .text = text.substr(lineStart, lineEnd - lineStart),
+          .characters = visible});
+      lineStart = lineEnd;
+    } while (lineStart < end && lines.size() < maxLines);
+    start = end + 1;
+  }
+  return lines;
+}
+
+react::TextMeasurement FixedAdvanceTextMeasurer::measure(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    const react::TextLayoutContext & /* layoutContext */,
+    const react::LayoutConstraints &layoutConstraints) const
+{
+  const auto lines = layout(
+      attributedStringBox,
+      paragraphAttributes,
+      layoutConstraints.maximumSize.width);
+  size_t widest = 0;
+  for (const auto &line : lines) {
+    widest = std::max(widest, line.characters);
+  }
+  return react::TextMeasurement{
+      .size = {
+          .width = static_cast<react::Float>(widest) * advance_,
+          .height = static_cast<react::Float>(lines.size()) * lineHeight_},
+      .attachments = {}};
+}
+
+react::LinesMeasurements FixedAdvanceTextMeasurer::measureLines(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    react::Size size) const
+{
+  react::LinesMeasurements measurements;
+  const auto lines =
+      layout(attributedStringBox, paragraphAttributes, size.width);
+  measurements.reserve(lines.size());
+  for (size_t i = 0; i < lines.size(); i++) {
+    measurements.emplace_back(
+        lines[i].text,
+        react::Rect{
+            .origin = {.x = 0, .y = static_cast<react::Float>(i) * lineHeight_},
+            .size = {
+                .width =
+                    static_cast<react::Float>(lines[i].characters) * advance_,
+                .height = lineHeight_}},
+        /* descender */ lineHeight_ * 0.2f,
+        /* capHeight */ lineHeight_ * 0.56f,
+        /* ascender */ lineHeight_ * 0.8f,
+        /* xHeight */ lineHeight_ * 0.4f);
+  }
+  return measurements;
+}
+
+FontFileTextMeasurer::FontFileTextMeasurer(
+    FontResolver resolveFont,
+    std::shared_ptr<const TextMeasurer> fallback)
+    : resolveFont_(std::move(resolveFont)), fallback_(std::move(fallback))
+{
+}
+
+std::optional<ParagraphLayout> FontFileTextMeasurer::layout(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    react::Float maxWidth) const
+{
+  if (attributedStringBox.getMode() !=
+          react::AttributedStringBox::Mode::Value ||
+      paragraphAttributes.adjustsFontSizeToFit) {
+    return std::nullopt;
+  }
+  const auto &fragments = attributedStringBox.getValue().getFragments();
+  std::vector<ParagraphRun> runs;
+  runs.reserve(fragments.size());
+  for (const auto &fragment : fragments) {
+    const auto &attributes = fragment.textAttributes;
+    const auto transform =
+        attributes.textTransform.value_or(react::TextTransform::None);
+    if (transform != react::TextTransform::None &&
+        transform != react::TextTransform::Unset) {
+      return std::nullopt;
+    }
+    auto font = resolveFont_(attributes);
+    if (!font) {
+      return std::nullopt;
+    }
+    const react::Float multiplier = fontSizeMultiplier(attributes);
+    const react::Float fontSize =
+        std::isnan(attributes.fontSize) ? 14 : attributes.fontSize;
+    runs.push_back(ParagraphRun{
+        .text = fragment.string,
+        .advances = GlyphAdvanceCache::shared(font, fontSize * multiplier),
+        .letterSpacing = std::isnan(attributes.letterSpacing)
+            ? 0
+            : attributes.letterSpacing,
+        .lineHeight = std::isnan(attributes.lineHeight)
+            ? 0
+            : attributes.lineHeight * multiplier});
+  }
+
+  ParagraphStyle style;
+  style.maximumNumberOfLines = paragraphAttributes.maximumNumberOfLines > 0
+      ? static_cast<size_t>(paragraphAttributes.maximumNumberOfLines)
+      : 0;
+  style.ellipsizeMode = toEllipsizeMode(paragraphAttributes.ellipsizeMode);
+  // Set per fragment, but the same on all of them.
+  if (!fragments.empty()) {
+    style.lineBreakStrategy = toLineBreakStrategy(
+        fragments.front().textAttributes.lineBreakStrategy);
+  }
+  return layoutParagraph(runs, maxWidth, style);
+}
+
+react::TextMeasurement FontFileTextMeasurer::measure(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    const react::TextLayoutContext &layoutContext,
+    const react::LayoutConstraints &layoutConstraints) const
+{
+  const auto paragraph = layout(
+      attributedStringBox,
+      paragraphAttributes,
+      layoutConstraints.maximumSize.width);
+  if (!paragraph) {
+    return fallback_->measure(
+        attributedStringBox,
+        paragraphAttributes,
+        layoutContext,
+        layoutConstraints);
+  }
+  return react::TextMeasurement{
+      .size = {.width = paragraph->width, .height = paragraph->height},
+      .attachments = {}};
+}
+
+react::LinesMeasurements FontFileTextMeasurer::measureLines(
+    const react::AttributedStringBox &attributedStringBox,
+    const react::ParagraphAttributes &paragraphAttributes,
+    react::Size size) const
+{
+  const auto paragraph =
+      layout(attributedStringBox, paragraphAttributes, size.width);
+  if (!paragraph) {
+    return fallback_->measureLines(
+        attributedStringBox, paragraphAttributes, size);
+  }
+  react::LinesMeasurements measurements;
+  measurements.reserve(paragraph->lines.size());
+  for (const auto &line : paragraph->lines) {
+    measurements.emplace_back(
+        line.text,
+        react::Rect{
+            .origin = {.x = 0, .y = line.top},
+            .size = {.width = line.width, .height = line.height}},
+        line.descender,
+        line.capHeight,
+        line.ascender,
+        line.xHeight);
+  }
+  return measurements;
+}
+
+} // namespace margelo::nitro::nitrotext::views
@@ -0,0 +1,211 @@
+//
+// NitroTextMeasurer.hpp
+// The text layout engine NitroTextShadowNode measures with
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "NitroTextParagraph.hpp"
+
+#include <react/renderer/attributedstring/AttributedStringBox.h>
+#include <react/renderer/attributedstring/ParagraphAttributes.h>
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/textlayoutmanager/TextLayoutContext.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
+#include <react/renderer/utils/ContextContainer.h>
+
+namespace facebook::react {
+class TextLayoutManager;
+}
+
+namespace margelo::nitro::nitrotext::views {
+
+using namespace facebook;
+
+/**
+ * Measures attributed strings for `NitroTextShadowNode`.
+ *
+ * The default, `TextLayoutManagerMeasurer`, asks the platform text stack.
+ * Anything else (a cache in front of it, the portable
+ * `FontFileTextMeasurer`, a deterministic fake for benchmarks) can stand in
+ * for it: put a `std::shared_ptr<const TextMeasurer>` into the
+ * `ContextContainer` under `kContextContainerKey`, or hand one to the shadow
+ * node directly.
+ *
+ * Called from the layout thread of every surface at once, so implementations
+ * must be thread-safe.
+ */
+class TextMeasurer {
+public:
+  static constexpr const char *kContextContainerKey = "NitroTextMeasurer";
+
+  virtual ~TextMeasurer() = default;
+
+  /**
+   * @brief The size of the laid out text, within `layoutConstraints`.
+   */
+  virtual react::TextMeasurement measure(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      const react::TextLayoutContext &layoutContext,
+      const react::LayoutConstraints &layoutConstraints) const = 0;
+
+  /**
+   * @brief The lines of the text laid out at `size`, for the baseline.
+   * Empty when the engine cannot tell; the node then aligns on its bottom
+   * edge.
+   */
+  virtual react::LinesMeasurements measureLines(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      react::Size size) const = 0;
+
+  /**
+   * @brief The measurer registered in `contextContainer`, or a
+   * `TextLayoutManagerMeasurer` over it.
+   */
+  static std::shared_ptr<const TextMeasurer> fromContextContainer(
+      const std::shared_ptr<const react::ContextContainer> &contextContainer);
+};
+
+/**
+ * Measures with React Native's `TextLayoutManager`, like `<Text>` does.
+ */
+class TextLayoutManagerMeasurer final : public TextMeasurer {
+public:
+  explicit TextLayoutManagerMeasurer(
+      std::shared_ptr<const react::TextLayoutManager> textLayoutManager);
+
+  react::TextMeasurement measure(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      const react::TextLayoutContext &layoutContext,
+      const react::LayoutConstraints &layoutConstraints) const override;
+
+  react::LinesMeasurements measureLines(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      react::Size size) const override;
+
+private:
+  std::shared_ptr<const react::TextLayoutManager> textLayoutManager_;
+};
+
+/**
+ * Remembers the measurements of another measurer, keyed like
+ * `TextLayoutManager` keys its own: the attributed string compared
+ * layout-wise, the paragraph attributes and the constraints. For engines
+ * without a cache of their own; `TextLayoutManager` already has one.
+ * `measureLines` runs once per layout, for the baseline, and is passed
+ * through.
+ */
+class CachingTextMeasurer final : public TextMeasurer {
+public:
+  explicit CachingTextMeasurer(std::shared_ptr<const TextMeasurer> measurer);
+
+  react::TextMeasurement measure(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      const react::TextLayoutContext &layoutContext,
+      const react::LayoutConstraints &layoutConstraints) const override;
+
+  react::LinesMeasurements measureLines(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      react::Size size) const override;
+
+private:
+  std::shared_ptr<const TextMeasurer> measurer_;
+  mutable react::TextMeasureCache cache_;
+};
+
+/**
+ * A deterministic measurer for benchmarks and tests, independent of fonts:
+ * every character (a UTF-8 codepoint) is `advance` wide and every line
+ * `lineHeight` tall. Lines break at `\n`, wrap after the last space that
+ * fits (or anywhere in a word longer than the line) and stop at
+ * `maximumNumberOfLines`; trailing spaces take no width.
+ */
+class FixedAdvanceTextMeasurer final : public TextMeasurer {
+public:
+  FixedAdvanceTextMeasurer(react::Float advance, react::Float lineHeight);
+
+  react::TextMeasurement measure(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      const react::TextLayoutContext &layoutContext,
+      const react::LayoutConstraints &layoutConstraints) const override;
+
+  react::LinesMeasurements measureLines(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      react::Size size) const override;
+
+private:
+  struct Line {
+    std::string text;
+    // Without trailing spaces.
+    size_t characters;
+  };
+
+  std::vector<Line> layout(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      react::Float maxWidth) const;
+
+  react::Float advance_;
+  react::Float lineHeight_;
+};
+
+/**
+ * Measures from font files with `layoutParagraph`, the same on every
+ * platform and without the platform text stack. `resolveFont` picks the
+ * file for a fragment's family, weight and style. Strings it has no file
+ * for, or that need more than advances (text transforms, fitting the font
+ * size to the box, opaque platform strings), go to `fallback`.
+ *
+ * Opt-in: nothing registers it, since only the app knows where its font
+ * files are. To measure with it, register one in the `ContextContainer`
+ * under `kContextContainerKey`, with a `TextLayoutManagerMeasurer` as the
+ * fallback. It only measures; the platform view still draws the text and
+ * truncates it with `ellipsizeMode`, so the fonts it resolves must be the
+ * ones the platform draws with.
+ */
+class FontFileTextMeasurer final : public TextMeasurer {
+public:
+  using FontResolver = std::function<std::shared_ptr<const FontFile>(
+      const react::TextAttributes &textAttributes)>;
+
+  FontFileTextMeasurer(
+      FontResolver resolveFont,
+      std::shared_ptr<const TextMeasurer> fallback);
+
+  react::TextMeasurement measure(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      const react::TextLayoutContext &layoutContext,
+      const react::LayoutConstraints &layoutConstraints) const override;
+
+  react::LinesMeasurements measureLines(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      react::Size size) const override;
+
+private:
+  // Empty when `fallback` has to measure.
+  std::optional<ParagraphLayout> layout(
+      const react::AttributedStringBox &attributedStringBox,
+      const react::ParagraphAttributes &paragraphAttributes,
+      react::Float maxWidth) const;
+
+  FontResolver resolveFont_;
+  std::shared_ptr<const TextMeasurer> fallback_;
+};
+
+} // namespace margelo::nitro::nitrotext::views
@@ -0,0 +1,248 @@
+//
+// NitroTextParagraph.cpp
+// Laying out styled runs of text into lines, from font files
+//
+
+#include "NitroTextParagraph.hpp"
+#include "NitroTextEllipsize.hpp"
+#include "NitroTextGrapheme.hpp"
+#include "NitroTextLineBreak.hpp"
+#include "NitroTextUtf8.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+bool isHardBreak(LineBreakClass c)
+{
+  return c == LineBreakClass::BK || c == LineBreakClass::CR || c == LineBreakClass::LF || c == LineBreakClass::NL;
+}
+
+// The runs laid end to end.
+struct RunText {
+  const std::vector<ParagraphRun>& runs;
+  std::string text;
+  // Where each run starts in `text`.
+  std::vector<size_t> starts;
+
+  explicit RunText(const std::vector<ParagraphRun>& runs) : runs(runs)
+  {
+    starts.reserve(runs.size());
+    for (const auto& run : runs) {
+      starts.push_back(text.size());
+      text.append(run.text);
+    }
+  }
+
+  // The run `offset` falls in; the last one at the end of the text.
+  size_t runAt(size_t offset) const
+  {
+    return static_cast<size_t>(std::upper_bound(starts.begin(), starts.end(), offset) - starts.begin()) - 1;
+  }
+
+  size_t runEnd(size_t run) const { return run + 1 < starts.size() ? starts[run + 1] : text.size(); }
+
+  float width(size_t from, size_t to) const
+  {
+    float total = 0;
+    for (size_t run = runAt(from); from < to; run++) {
+      const size_t end = std::min(to, runEnd(run));
+      if (end > from) {
+        total += runs[run].advances->width(std::string_view(text).substr(from, end - from), runs[run].letterSpacing);
+      }
+      from = std::max(from, end);
+    }
+    return total;
+  }
+
+  // [from, to) without the hard line breaks it ends in.
+  size_t withoutHardBreak(size_t from, size_t to) const
+  {
+    while (to > from) {
+      size_t before = to;
+      if (!isHardBreak(lineBreakClass(decodeUtf8Before(text, before)))) break;
+      to = before;
+    }
+    return to;
+  }
+
+  // [from, to) without the spaces it ends in.
+  size_t withoutSpaces(size_t from, size_t to) const
+  {
+    while (to > from && text[to - 1] == ' ') to--;
+    return to;
+  }
+
+  // The end of the paragraph `from` is in: the next hard line break.
+  size_t paragraphEnd(size_t from) const
+  {
+    for (size_t at = from; at < text.size();) {
+      const size_t start = at;
+      if (isHardBreak(lineBreakClass(decodeUtf8(text, at)))) return start;
+    }
+    return text.size();
+  }
+
+  // The furthest cluster boundary after `from` up to `to` whose clusters
+  // fit `limit`, with at least one cluster; their width in `used`.
+  size_t fitClusters(size_t from, size_t to, float limit, float& used) const
+  {
+    size_t at = from;
+    used = 0;
+    while (at < to) {
+      const size_t next = std::min(to, nextGraphemeBoundary(text, at));
+      const float cluster = width(at, next);
+      if (at > from && used + cluster > limit) break;
+      used += cluster;
+      at = next;
+    }
+    return at;
+  }
+
+  // Raises the line's metrics to those of `run`.
+  void addMetrics(size_t run, ParagraphLine& line) const
+  {
+    const GlyphAdvanceCache& advances = *runs[run].advances;
+    const FontFile::Metrics& metrics = advances.font().metrics();
+    const float scale = advances.scale();
+    const float ascender = metrics.ascender * scale;
+    const float descender = -metrics.descender * scale;
+    const float height =
+        runs[run].lineHeight > 0 ? runs[run].lineHeight : ascender + descender + metrics.lineGap * scale;
+    const float leading = (height - ascender - descender) / 2;
+    line.ascender = std::max(line.ascender, ascender + leading);
+    line.descender = std::max(line.descender, descender + leading);
+    line.height = std::max({line.height, height, line.ascender + line.descender});
+    line.capHeight = std::max(line.capHeight, metrics.capHeight * scale);
+    line.xHeight = std::max(line.xHeight, metrics.xHeight * scale);
+  }
+};
+
+class LineBuilder {
+public:
+  LineBuilder(const RunText& text, float maxWidth, const ParagraphStyle& style, ParagraphLayout& layout)
+      : text_(text),
+        maxWidth_(maxWidth),
+        style_(style),
+        maxLines_(style.maximumNumberOfLines > 0 ? style.maximumNumberOfLines : SIZE_MAX),
+        layout_(layout)
+  {
+  }
+
+  /**
+   * Ends a line on [start, end), `width` wide, with `more` lines to come.
+   * False once the lines are used up.
+   */
+  bool add(size_t start, size_t end, float width, bool more)
+  {
+    ParagraphLine line;
+    line.start = start;
+    line.end = end;
+    line.text = text_.text.substr(start, end - start);
+    line.width = width;
+    const size_t last = end > start ? text_.runAt(end - 1) : text_.runAt(start);
+    for (size_t run = text_.runAt(start); run <= last; run++) {
+      if (text_.runEnd(run) > text_.starts[run] || start == end) text_.addMetrics(run, line);
+    }
+    layout_.lines.push_back(std::move(line));
+    if (more && layout_.lines.size() >= maxLines_) {
+      truncate(layout_.lines.back());
+      return false;
+    }
+    return true;
+  }
+
+  void finish()
+  {
+    float top = 0;
+    for (auto& line : layout_.lines) {
+      line.top = top;
+      top += line.height;
+      layout_.width = std::max(layout_.width, line.width);
+    }
+    layout_.height = top;
+  }
+
+private:
+  void truncate(ParagraphLine& line)
+  {
+    const ParagraphRun& run = text_.runs[text_.runAt(line.start)];
+    line.end = text_.paragraphEnd(line.start);
+    line.text = ellipsize(std::string_view(text_.text).substr(line.start, line.end - line.start), maxWidth_,
+                          style_.ellipsizeMode, *run.advances, run.letterSpacing);
+    line.width = run.advances->width(line.text, run.letterSpacing);
+    layout_.truncated = true;
+  }
+
+  const RunText& text_;
+  float maxWidth_;
+  const ParagraphStyle& style_;
+  size_t maxLines_;
+  ParagraphLayout& layout_;
+};
+
+// Fills `lines` until the text or the lines run out.
+void addLines(const RunText& text, float maxWidth, const ParagraphStyle& style, LineBuilder& lines)
+{
+  const size_t size = text.text.size();
+  // The line so far, with and without the spaces it ends in.
+  size_t lineStart = 0;
+  float lineWidth = 0;
+  float lineVisible = 0;
+  // Each segment runs from one break opportunity to the next. A NaN or
+  // infinite `maxWidth` fails every comparison below, so nothing wraps.
+  size_t segmentStart = 0;
+  LineBreaker breaker(text.text, style.lineBreakStrategy);
+  while (const auto lineBreak = breaker.next()) {
+    const size_t segmentEnd = lineBreak->offset;
+    const size_t contentEnd = lineBreak->mandatory ? text.withoutHardBreak(segmentStart, segmentEnd) : segmentEnd;
+    const size_t visibleEnd = text.withoutSpaces(segmentStart, contentEnd);
+    float visible = text.width(segmentStart, visibleEnd);
+
+    if (segmentStart > lineStart && lineWidth + visible > maxWidth) {
+      if (!lines.add(lineStart, segmentStart, lineVisible, true)) return;
+      lineStart = segmentStart;
+      lineWidth = 0;
+      lineVisible = 0;
+    }
+    // Too wide for a line of its own: break between clusters.
+    while (segmentStart == lineStart && visible > maxWidth) {
+      float used = 0;
+      const size_t cut = text.fitClusters(segmentStart, visibleEnd, maxWidth, used);
+      if (cut >= visibleEnd) break;
+      if (!lines.add(lineStart, cut, used, true)) return;
+      segmentStart = lineStart = cut;
+      visible = text.width(segmentStart, visibleEnd);
+    }
+
+    lineVisible = lineWidth + visible;
+    lineWidth = lineVisible + text.width(visibleEnd, contentEnd);
+    segmentStart = segmentEnd;
+    if (lineBreak->mandatory) {
+      // A hard break at the very end still starts an empty last line.
+      if (!lines.add(lineStart, contentEnd, lineVisible, segmentEnd < size || contentEnd < segmentEnd)) return;
+      lineStart = segmentEnd;
+      lineWidth = 0;
+      lineVisible = 0;
+    }
+  }
+  if (text.withoutHardBreak(0, size) < size) lines.add(size, size, 0, false);
+}
+
+} // namespace
+
+ParagraphLayout layoutParagraph(const std::vector<ParagraphRun>& runs, float maxWidth, const ParagraphStyle& style)
+{
+  ParagraphLayout layout;
+  const RunText text(runs);
+  if (text.text.empty()) return layout;
+  LineBuilder lines(text, maxWidth, style, layout);
+  addLines(text, maxWidth, style, lines);
+  lines.finish();
+  return layout;
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,83 @@
+//
+// NitroTextParagraph.hpp
+// Laying out styled runs of text into lines, from font files
+//
+
+#pragma once
+
+#include "EllipsizeMode.hpp"
+#include "LineBreakStrategyIOS.hpp"
+#include "NitroTextGlyphAdvances.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * A run of text in one font at one size.
+ */
+struct ParagraphRun {
+  // Must outlive the `layoutParagraph` call.
+  std::string_view text;
+  std::shared_ptr<const GlyphAdvanceCache> advances;
+  float letterSpacing = 0;
+  // In points; 0 for the font's own ascender, descender and line gap.
+  float lineHeight = 0;
+};
+
+struct ParagraphStyle {
+  // 0 for no limit.
+  size_t maximumNumberOfLines = 0;
+  EllipsizeMode ellipsizeMode = EllipsizeMode::TAIL;
+  LineBreakStrategyIOS lineBreakStrategy = LineBreakStrategyIOS::STANDARD;
+};
+
+struct ParagraphLine {
+  // The byte range of the line in the text of all runs laid end to end,
+  // without the hard line break that ends it.
+  size_t start = 0;
+  size_t end = 0;
+  // What the line shows: the text of the range, or the ellipsized rest of
+  // its paragraph on a truncated last line.
+  std::string text;
+  float top = 0;
+  // Without trailing spaces, which hang past the edge.
+  float width = 0;
+  float height = 0;
+  // From the tallest font on the line, in points, both positive. A line
+  // height taller or shorter than the font's splits the difference evenly
+  // above and below.
+  float ascender = 0;
+  float descender = 0;
+  float capHeight = 0;
+  float xHeight = 0;
+};
+
+struct ParagraphLayout {
+  std::vector<ParagraphLine> lines;
+  // The widest line.
+  float width = 0;
+  float height = 0;
+  // Lines were cut off at `maximumNumberOfLines`.
+  bool truncated = false;
+};
+
+/**
+ * @brief Lays out `runs` in lines no wider than `maxWidth`, the way `<Text>`
+ * wraps: greedily, at the break opportunities of `LineBreaker`, with hard
+ * breaks ending lines (one at the very end leaves an empty last line) and
+ * trailing spaces hanging. A word wider than a line
+ * is broken between grapheme clusters. An infinite `maxWidth` never wraps.
+ *
+ * Past `maximumNumberOfLines` the rest of the last line's paragraph is cut
+ * to fit by `ellipsize`, measured in the font of the run the line starts
+ * in. Widths are summed per run, without kerning across runs.
+ */
+ParagraphLayout layoutParagraph(const std::vector<ParagraphRun>& runs, float maxWidth,
+                                const ParagraphStyle& style = {});
+
+} // namespace margelo::nitro::nitrotext
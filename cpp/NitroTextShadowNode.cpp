@@ -6,12 +6,15 @@
 #include "NitroTextUtil.hpp"
 
 #include <cmath>
+#include <cstdint>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <react/renderer/attributedstring/AttributedStringBox.h>
-#include <react/renderer/textlayoutmanager/TextLayoutManagerExtended.h>
+#include <react/renderer/graphics/Color.h>
 
 #if __has_include(<cxxreact/ReactNativeVersion.h>)
 #include <cxxreact/ReactNativeVersion.h>
@@ -21,6 +24,15 @@ namespace margelo::nitro::nitrotext::views {
 
 namespace {
 
+react::SharedColor colorFromARGB(uint32_t argb)
+{
+  return react::colorFromRGBA(
+      static_cast<uint8_t>(argb >> 16),
+      static_cast<uint8_t>(argb >> 8),
+      static_cast<uint8_t>(argb),
+      static_cast<uint8_t>(argb >> 24));
+}
+
 struct NitroTextLayoutInputs {
   react::AttributedString attributedString;
   react::ParagraphAttributes paragraphAttributes;
@@ -33,8 +45,10 @@ std::optional<NitroTextLayoutInputs> prepareTextLayoutInputs(
 {
   const auto &props = node.getConcreteProps();
 
+  const TextStyle &base = node.getBaseStyle();
+
   auto makeTextAttributes =
-      [&](const std::optional<margelo::nitro::nitrotext::Fragment> &fragOpt) {
+      [&](const TextStyle &style) {
         auto a = react::TextAttributes::defaultTextAttributes();
 
         if (props.allowFontScaling.value.has_value()) {
@@ -86,10 +100,8 @@ std::optional<NitroTextLayoutInputs> prepareTextLayoutInputs(
           }
         }
 
-        if (fragOpt.has_value() && fragOpt->fontSize.has_value()) {
-          a.fontSize = fragOpt->fontSize.value();
-        } else if (props.fontSize.value.has_value()) {
-          a.fontSize = props.fontSize.value.value();
+        if (style.fontSize.has_value()) {
+          a.fontSize = style.fontSize.value();
         }
 
         auto applyFontStyle =
@@ -109,16 +121,61 @@ std::optional<NitroTextLayoutInputs> prepareTextLayoutInputs(
               }
             };
 
-        if (fragOpt.has_value() && fragOpt->fontStyle.has_value()) {
-          applyFontStyle(fragOpt->fontStyle.value());
-        } else if (props.fontStyle.value.has_value()) {
-          applyFontStyle(props.fontStyle.value.value());
+        if (style.fontStyle.has_value()) {
+          applyFontStyle(style.fontStyle.value());
+        }
+
+        if (style.fontFamily) {
+          a.fontFamily = style.fontFamily.str();
+        }
+
+        if (auto argb = style.fontColor.color()) {
+          a.foregroundColor = colorFromARGB(*argb);
+        }
+        if (auto argb = style.fragmentBackgroundColor.color()) {
+          a.backgroundColor = colorFromARGB(*argb);
+        }
+        if (auto argb = style.textDecorationColor.color()) {
+          a.textDecorationColor = colorFromARGB(*argb);
+        }
+
+        if (style.textDecorationLine.has_value()) {
+          using RNLine = facebook::react::TextDecorationLineType;
+          using NitroLine = margelo::nitro::nitrotext::TextDecorationLine;
+          switch (style.textDecorationLine.value()) {
+          case NitroLine::NONE:
+            a.textDecorationLineType = RNLine::None;
+            break;
+          case NitroLine::UNDERLINE:
+            a.textDecorationLineType = RNLine::Underline;
+            break;
+          case NitroLine::LINE_THROUGH:
+            a.textDecorationLineType = RNLine::Strikethrough;
+            break;
+          case NitroLine::UNDERLINE_LINE_THROUGH:
+            a.textDecorationLineType = RNLine::UnderlineStrikethrough;
+            break;
+          }
         }
 
-        if (fragOpt.has_value() && fragOpt->fontFamily.has_value()) {
-          a.fontFamily = fragOpt->fontFamily.value();
-        } else if (props.fontFamily.value.has_value()) {
-          a.fontFamily = props.fontFamily.value.value();
+        if (style.textDecorationStyle.has_value()) {
+          using RNDecorationStyle = facebook::react::TextDecorationStyle;
+          using NitroDecorationStyle =
+              margelo::nitro::nitrotext::TextDecorationStyle;
+          switch (style.textDecorationStyle.value()) {
+          case NitroDecorationStyle::SOLID:
+            a.textDecorationStyle = RNDecorationStyle::Solid;
+            break;
+          case NitroDecorationStyle::DOUBLE:
+            a.textDecorationStyle = RNDecorationStyle::Double;
+            break;
+          case NitroDecorationStyle::DOTTED:
+            a.textDecorationStyle = RNDecorationStyle::Dotted;
+            break;
+          case NitroDecorationStyle::DASHED:
+            a.textDecorationStyle = RNDecorationStyle::Dashed;
+            break;
+          }
         }
 
         auto applyFontWeight =
@@ -159,22 +216,16 @@ std::optional<NitroTextLayoutInputs> prepareTextLayoutInputs(
               }
             };
 
-        if (fragOpt.has_value() && fragOpt->fontWeight.has_value()) {
-          applyFontWeight(fragOpt->fontWeight.value());
-        } else if (props.fontWeight.value.has_value()) {
-          applyFontWeight(props.fontWeight.value.value());
+        if (style.fontWeight.has_value()) {
+          applyFontWeight(style.fontWeight.value());
         }
 
-        if (fragOpt.has_value() && fragOpt->lineHeight.has_value()) {
-          a.lineHeight = fragOpt->lineHeight.value();
-        } else if (props.lineHeight.value.has_value()) {
-          a.lineHeight = props.lineHeight.value.value();
+        if (style.lineHeight.has_value()) {
+          a.lineHeight = style.lineHeight.value();
         }
 
-        if (fragOpt.has_value() && fragOpt->letterSpacing.has_value()) {
-          a.letterSpacing = fragOpt->letterSpacing.value();
-        } else if (props.letterSpacing.value.has_value()) {
-          a.letterSpacing = props.letterSpacing.value.value();
+        if (style.letterSpacing.has_value()) {
+          a.letterSpacing = style.letterSpacing.value();
         }
 
         auto applyAlign = [&](margelo::nitro::nitrotext::TextAlign al) {
@@ -202,10 +253,8 @@ std::optional<NitroTextLayoutInputs> prepareTextLayoutInputs(
           }
         };
 
-        if (fragOpt.has_value() && fragOpt->textAlign.has_value()) {
-          applyAlign(fragOpt->textAlign.value());
-        } else if (props.textAlign.value.has_value()) {
-          applyAlign(props.textAlign.value.value());
+        if (style.textAlign.has_value()) {
+          applyAlign(style.textAlign.value());
         }
 
         auto applyTransform =
@@ -231,10 +280,8 @@ std::optional<NitroTextLayoutInputs> prepareTextLayoutInputs(
               }
             };
 
-        if (fragOpt.has_value() && fragOpt->textTransform.has_value()) {
-          applyTransform(fragOpt->textTransform.value());
-        } else if (props.textTransform.value.has_value()) {
-          applyTransform(props.textTransform.value.value());
+        if (style.textTransform.has_value()) {
+          applyTransform(style.textTransform.value());
         }
 
         if (props.lineBreakStrategyIOS.value.has_value()) {
@@ -270,46 +317,12 @@ std::optional<NitroTextLayoutInputs> prepareTextLayoutInputs(
   react::AttributedString attributedString;
 
   if (props.fragments.value.has_value()) {
-    const auto &frags = props.fragments.value.value();
-    size_t lastNonEmptyIndex = SIZE_MAX;
-
-    for (size_t i = frags.size(); i > 0; i--) {
-      const std::string fragmentText =
-          frags[i - 1].text.has_value() ? frags[i - 1].text.value()
-                                        : std::string("");
-      if (!fragmentText.empty()) {
-        lastNonEmptyIndex = i - 1;
-        break;
-      }
-    }
-
     const react::ShadowView shadowView(node);
 
-    for (size_t i = 0; i < frags.size(); i++) {
-      const auto &f = frags[i];
-      std::string fragmentText =
-          f.text.has_value() ? f.text.value() : std::string("");
-      if (fragmentText.empty()) {
-        continue;
-      }
-
-      if (i == lastNonEmptyIndex) {
-        if (!fragmentText.empty() &&
-            (fragmentText.back() == ' ' || fragmentText.back() == '\t' ||
-             fragmentText.back() == '\n' || fragmentText.back() == '\r')) {
-          size_t lastNonWhitespace =
-              fragmentText.find_last_not_of(" \t\n\r\f\v");
-          if (lastNonWhitespace != std::string::npos) {
-            fragmentText = fragmentText.substr(0, lastNonWhitespace + 1);
-          } else {
-            continue;
-          }
-        }
-      }
-
-      auto attrs = makeTextAttributes(f);
+    for (const auto &run : node.getRuns()) {
+      auto attrs = makeTextAttributes(run.style.withFallback(base));
       attributedString.appendFragment(react::AttributedString::Fragment{
-          .string = fragmentText,
+          .string = run.text,
           .textAttributes = attrs,
           .parentShadowView = shadowView});
     }
@@ -346,7 +359,7 @@ std::optional<NitroTextLayoutInputs> prepareTextLayoutInputs(
           .textAttributes = attrs,
           .parentShadowView = shadowView});
     } else {
-      auto attrs = makeTextAttributes(std::nullopt);
+      auto attrs = makeTextAttributes(base);
       attributedString.appendFragment(react::AttributedString::Fragment{
           .string = textToMeasure,
           .textAttributes = attrs,
@@ -424,16 +437,109 @@ react::ShadowNodeTraits NitroTextShadowNode::BaseTraits()
   return traits;
 }
 
-void NitroTextShadowNode::setTextLayoutManager(
-    std::shared_ptr<const react::TextLayoutManager> tlm)
+NitroTextShadowNode::NitroTextShadowNode(
+    const react::ShadowNode &sourceShadowNode,
+    const react::ShadowNodeFragment &fragment)
+    : ConcreteViewShadowNode(sourceShadowNode, fragment)
+{
+  // A state update may carry imperatively pushed content of a new size.
+  if (fragment.state) {
+    dirtyLayout();
+  }
+}
+
+void NitroTextShadowNode::setTextMeasurer(
+    std::shared_ptr<const TextMeasurer> textMeasurer)
+{
+  textMeasurer_ = std::move(textMeasurer);
+}
+
+const TextStyle &NitroTextShadowNode::getBaseStyle() const
 {
-  textLayoutManager_ = std::move(tlm);
+  std::call_once(baseStyleOnce_, [this] {
+    const auto &props = getConcreteProps();
+    auto base = std::make_shared<TextStyle>();
+    base->fontSize = props.fontSize.value;
+    base->lineHeight = props.lineHeight.value;
+    base->letterSpacing = props.letterSpacing.value;
+    base->fontWeight = props.fontWeight.value;
+    base->fontStyle = props.fontStyle.value;
+    base->textAlign = props.textAlign.value;
+    base->textTransform = props.textTransform.value;
+    base->textDecorationLine = props.textDecorationLine.value;
+    base->textDecorationStyle = props.textDecorationStyle.value;
+    base->fontFamily = Atom::intern(props.fontFamily.value);
+    base->fontColor = Atom::intern(props.fontColor.value);
+    base->fragmentBackgroundColor =
+        Atom::intern(props.fragmentBackgroundColor.value);
+    base->textDecorationColor = Atom::intern(props.textDecorationColor.value);
+    base->selectionColor = Atom::intern(props.selectionColor.value);
+    baseStyle_ = std::move(base);
+  });
+  return *baseStyle_;
+}
+
+const std::vector<NitroTextRun> &NitroTextShadowNode::getRuns() const
+{
+  std::call_once(runsOnce_, [this] {
+    auto runs = std::make_shared<std::vector<NitroTextRun>>();
+    const auto &props = getConcreteProps();
+
+    if (props.fragments.value.has_value()) {
+      const auto &frags = props.fragments.value.value();
+      size_t lastNonEmptyIndex = SIZE_MAX;
+
+      for (size_t i = frags.size(); i > 0; i--) {
+        if (frags[i - 1].text.has_value() && !frags[i - 1].text->empty()) {
+          lastNonEmptyIndex = i - 1;
+          break;
+        }
+      }
+
+      runs->reserve(frags.size());
+      for (size_t i = 0; i < frags.size(); i++) {
+        const auto &f = frags[i];
+        if (!f.text.has_value() || f.text->empty()) {
+          continue;
+        }
+
+        std::string_view fragmentText = *f.text;
+        if (i == lastNonEmptyIndex) {
+          const char last = fragmentText.back();
+          if (last == ' ' || last == '\t' || last == '\n' || last == '\r') {
+            size_t lastNonWhitespace =
+                fragmentText.find_last_not_of(" \t\n\r\f\v");
+            if (lastNonWhitespace == std::string_view::npos) {
+              continue;
+            }
+            fragmentText = fragmentText.substr(0, lastNonWhitespace + 1);
+          }
+        }
+
+        auto style = TextStyle::fromFragment(f);
+        if (!runs->empty() && runs->back().style == style) {
+          runs->back().text.append(fragmentText);
+        } else {
+          runs->push_back(NitroTextRun{
+              .text = std::string(fragmentText), .style = style});
+        }
+      }
+    }
+
+    runs_ = std::move(runs);
+  });
+  return *runs_;
 }
 
 react::Size NitroTextShadowNode::measureContent(
     const react::LayoutContext &layoutContext,
     const react::LayoutConstraints &layoutConstraints) const
 {
+  if (const auto *measure =
+          getStateData().getImperativeMeasure(getConcreteProps())) {
+    return layoutConstraints.clamp((*measure)(layoutConstraints));
+  }
+
   const auto layoutInputs =
       prepareTextLayoutInputs(*this, layoutContext, layoutConstraints);
 
@@ -441,7 +547,7 @@ react::Size NitroTextShadowNode::measureContent(
     return layoutConstraints.clamp({0.f, 0.f});
   }
 
-  if (!textLayoutManager_) {
+  if (!textMeasurer_) {
     return layoutConstraints.clamp({0.f, 0.f});
   }
 
@@ -449,7 +555,7 @@ react::Size NitroTextShadowNode::measureContent(
       .pointScaleFactor = layoutContext.pointScaleFactor,
   };
 
-  const auto measurement = textLayoutManager_->measure(
+  const auto measurement = textMeasurer_->measure(
       react::AttributedStringBox{layoutInputs->attributedString},
       layoutInputs->paragraphAttributes,
       textLayoutContext,
@@ -461,7 +567,8 @@ react::Size NitroTextShadowNode::measureContent(
 react::Float NitroTextShadowNode::baseline(
     const react::LayoutContext &layoutContext, react::Size size) const
 {
-  if (!textLayoutManager_) {
+  if (!textMeasurer_ ||
+      getStateData().getImperativeMeasure(getConcreteProps()) != nullptr) {
     return size.height;
   }
 
@@ -478,20 +585,12 @@ react::Float NitroTextShadowNode::baseline(
     return size.height;
   }
 
-  const react::AttributedStringBox attributedStringBox{
-      layoutInputs->attributedString};
-
-  if constexpr (react::TextLayoutManagerExtended::supportsLineMeasurement()) {
-    const auto lines = react::TextLayoutManagerExtended(*textLayoutManager_)
-                           .measureLines(
-                               attributedStringBox,
-                               layoutInputs->paragraphAttributes,
-                               size);
-    if (!lines.empty()) {
-      return react::LineMeasurement::baseline(lines);
-    }
-  } else {
-    return size.height;
+  const auto lines = textMeasurer_->measureLines(
+      react::AttributedStringBox{layoutInputs->attributedString},
+      layoutInputs->paragraphAttributes,
+      size);
+  if (!lines.empty()) {
+    return react::LineMeasurement::baseline(lines);
   }
 
   return size.height;
@@ -6,6 +6,14 @@
 #pragma once
 
 #include "HybridNitroTextComponent.hpp"
+#include "NitroTextMeasurer.hpp"
+#include "NitroTextState.hpp"
+#include "NitroTextStyle.hpp"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
@@ -13,30 +21,51 @@
 #include <react/renderer/attributedstring/AttributedString.h>
 #include <react/renderer/attributedstring/TextAttributes.h>
 #include <react/renderer/components/view/ViewShadowNode.h>
-#include <react/renderer/textlayoutmanager/TextLayoutContext.h>
-#include <react/renderer/textlayoutmanager/TextLayoutManager.h>
 
 namespace margelo::nitro::nitrotext::views {
 
+/**
+ * A run of text sharing one interned style. Adjacent fragments with equal
+ * styles are coalesced into a single run.
+ */
+struct NitroTextRun {
+  std::string text;
+  TextStyle style;
+};
+
 /**
  * The Shadow Node for the "NitroText" View.
  * Mark as a Leaf + Measurable Yoga node so Fabric queries the ShadowNode for
- * size. (We measure cross-platform in C++ using TextLayoutManager, like
- * Paragraph.)
+ * size. (We measure cross-platform in C++ through a `TextMeasurer`, by
+ * default TextLayoutManager like Paragraph.)
  */
 class NitroTextShadowNode final
     : public react::ConcreteViewShadowNode<
           HybridNitroTextComponentName,
           HybridNitroTextProps,
           react::ViewEventEmitter,
-          HybridNitroTextState> {
+          NitroTextState> {
 public:
   using ConcreteViewShadowNode::ConcreteViewShadowNode;
 
+  NitroTextShadowNode(const react::ShadowNode &sourceShadowNode,
+                      const react::ShadowNodeFragment &fragment);
+
   static react::ShadowNodeTraits BaseTraits();
 
-  void setTextLayoutManager(
-      std::shared_ptr<const react::TextLayoutManager> tlm);
+  void setTextMeasurer(std::shared_ptr<const TextMeasurer> textMeasurer);
+
+  /**
+   * Resolves `fragments` into style runs once per props object; every later
+   * measure/baseline pass of this node reuses the result.
+   */
+  const std::vector<NitroTextRun> &getRuns() const;
+
+  /**
+   * The text style of the component's own props, which every run falls back
+   * to. Interned once per props object, like `getRuns()`.
+   */
+  const TextStyle &getBaseStyle() const;
 
 protected:
   react::Size measureContent(
@@ -47,7 +76,11 @@ protected:
                         react::Size size) const override;
 
 private:
-  std::shared_ptr<const react::TextLayoutManager> textLayoutManager_;
+  std::shared_ptr<const TextMeasurer> textMeasurer_;
+  mutable std::once_flag runsOnce_;
+  mutable std::shared_ptr<const std::vector<NitroTextRun>> runs_;
+  mutable std::once_flag baseStyleOnce_;
+  mutable std::shared_ptr<const TextStyle> baseStyle_;
 };
 
 } // namespace margelo::nitro::nitrotext::views
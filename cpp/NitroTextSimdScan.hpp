@@ -0,0 +1,263 @@
+//
+// NitroTextSimdScan.hpp
+// Vectorized byte scanning for the native HTML tokenizer and text segmenters
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// The vector backend is chosen at compile time: AVX2 or SSE2 on x86, NEON on
+// 64-bit ARM. Define NITRO_TEXT_SIMD_SCALAR to force the scalar fallback.
+#if !defined(NITRO_TEXT_SIMD_SCALAR) && defined(__AVX2__)
+#include <immintrin.h>
+#define NITRO_TEXT_SIMD_AVX2 1
+#elif !defined(NITRO_TEXT_SIMD_SCALAR) && defined(__SSE2__)
+#include <emmintrin.h>
+#define NITRO_TEXT_SIMD_SSE2 1
+#elif !defined(NITRO_TEXT_SIMD_SCALAR) && (defined(__ARM_NEON) && defined(__aarch64__))
+#include <arm_neon.h>
+#define NITRO_TEXT_SIMD_NEON 1
+#endif
+
+/**
+ * Scanning primitives of the HTML tokenizer, the line breaker and the
+ * grapheme segmenter. Each returns the index of the first matching byte at
+ * or after `from`, or `std::string_view::npos`.
+ *
+ * `scalar` is a byte-at-a-time loop and is always available; `vector`
+ * compares a whole register per step and exists when a backend is enabled.
+ * The unqualified functions pick the best of the two.
+ */
+namespace margelo::nitro::nitrotext::simd {
+
+/**
+ * @brief Whether a plain text run ends at `s[i]`: on `&`, on ASCII controls
+ * and whitespace other than a lone space, and on every non-ASCII byte (which
+ * may start U+00A0 and friends). A space only ends the run when another such
+ * byte follows it, so ordinary prose is copied in long strides. A cheap
+ * superset; callers check the byte they stop on.
+ */
+constexpr bool isTextSpecial(std::string_view s, size_t i) noexcept
+{
+  const auto atMostSpace = [](char c) { return static_cast<signed char>(c) <= 0x20; };
+  if (s[i] == ' ') return i + 1 < s.size() && atMostSpace(s[i + 1]);
+  return atMostSpace(s[i]) || s[i] == '&';
+}
+
+/**
+ * @brief Whether `c` is an ASCII letter or digit.
+ */
+constexpr bool isAlphanumeric(char c) noexcept
+{
+  const char folded = static_cast<char>(c | 0x20);
+  return (c >= '0' && c <= '9') || (folded >= 'a' && folded <= 'z');
+}
+
+/**
+ * @brief Whether `c` is an ASCII control below U+0020 or any non-ASCII byte:
+ * where a run of ASCII stops being one grapheme cluster per byte.
+ */
+constexpr bool isControlOrNonAscii(char c) noexcept { return static_cast<signed char>(c) < 0x20; }
+
+namespace scalar {
+
+inline size_t findByte(std::string_view s, size_t from, char c) noexcept
+{
+  for (size_t i = from; i < s.size(); i++) {
+    if (s[i] == c) return i;
+  }
+  return std::string_view::npos;
+}
+
+inline size_t findTextSpecial(std::string_view s, size_t from) noexcept
+{
+  for (size_t i = from; i < s.size(); i++) {
+    if (isTextSpecial(s, i)) return i;
+  }
+  return std::string_view::npos;
+}
+
+inline size_t findNotAlphanumeric(std::string_view s, size_t from) noexcept
+{
+  for (size_t i = from; i < s.size(); i++) {
+    if (!isAlphanumeric(s[i])) return i;
+  }
+  return std::string_view::npos;
+}
+
+inline size_t findControlOrNonAscii(std::string_view s, size_t from) noexcept
+{
+  for (size_t i = from; i < s.size(); i++) {
+    if (isControlOrNonAscii(s[i])) return i;
+  }
+  return std::string_view::npos;
+}
+
+} // namespace scalar
+
+#if defined(NITRO_TEXT_SIMD_AVX2) || defined(NITRO_TEXT_SIMD_SSE2) || defined(NITRO_TEXT_SIMD_NEON)
+#define NITRO_TEXT_SIMD_VECTOR 1
+
+namespace vector {
+
+#if defined(NITRO_TEXT_SIMD_AVX2)
+
+constexpr const char* kBackend = "AVX2";
+constexpr size_t kWidth = 32;
+using Vec = __m256i;
+
+inline Vec load(const char* p) noexcept { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+inline Vec splat(char c) noexcept { return _mm256_set1_epi8(c); }
+inline Vec equal(Vec v, char c) noexcept { return _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c)); }
+inline Vec either(Vec a, Vec b) noexcept { return _mm256_or_si256(a, b); }
+inline Vec both(Vec a, Vec b) noexcept { return _mm256_and_si256(a, b); }
+inline Vec without(Vec a, Vec b) noexcept { return _mm256_andnot_si256(b, a); }
+// Signed compare: bytes >= 0x80 are negative, so they match as well.
+inline Vec signedAtMost(Vec v, char c) noexcept { return _mm256_cmpgt_epi8(_mm256_set1_epi8(c + 1), v); }
+inline int firstMatch(Vec m) noexcept
+{
+  const auto bits = static_cast<uint32_t>(_mm256_movemask_epi8(m));
+  return bits == 0 ? -1 : __builtin_ctz(bits);
+}
+
+#elif defined(NITRO_TEXT_SIMD_SSE2)
+
+constexpr const char* kBackend = "SSE2";
+constexpr size_t kWidth = 16;
+using Vec = __m128i;
+
+inline Vec load(const char* p) noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+inline Vec splat(char c) noexcept { return _mm_set1_epi8(c); }
+inline Vec equal(Vec v, char c) noexcept { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); }
+inline Vec either(Vec a, Vec b) noexcept { return _mm_or_si128(a, b); }
+inline Vec both(Vec a, Vec b) noexcept { return _mm_and_si128(a, b); }
+inline Vec without(Vec a, Vec b) noexcept { return _mm_andnot_si128(b, a); }
+inline Vec signedAtMost(Vec v, char c) noexcept { return _mm_cmplt_epi8(v, _mm_set1_epi8(c + 1)); }
+inline int firstMatch(Vec m) noexcept
+{
+  const auto bits = static_cast<uint32_t>(_mm_movemask_epi8(m));
+  return bits == 0 ? -1 : __builtin_ctz(bits);
+}
+
+#else
+
+constexpr const char* kBackend = "NEON";
+constexpr size_t kWidth = 16;
+using Vec = uint8x16_t;
+
+inline Vec load(const char* p) noexcept { return vld1q_u8(reinterpret_cast<const uint8_t*>(p)); }
+inline Vec splat(char c) noexcept { return vdupq_n_u8(static_cast<uint8_t>(c)); }
+inline Vec equal(Vec v, char c) noexcept { return vceqq_u8(v, vdupq_n_u8(static_cast<uint8_t>(c))); }
+inline Vec either(Vec a, Vec b) noexcept { return vorrq_u8(a, b); }
+inline Vec both(Vec a, Vec b) noexcept { return vandq_u8(a, b); }
+inline Vec without(Vec a, Vec b) noexcept { return vbicq_u8(a, b); }
+inline Vec signedAtMost(Vec v, char c) noexcept
+{
+  return vcleq_s8(vreinterpretq_s8_u8(v), vdupq_n_s8(static_cast<int8_t>(c)));
+}
+inline int firstMatch(Vec m) noexcept
+{
+  // Narrow every byte of the mask to a nibble: NEON has no movemask.
+  const uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+  return bits == 0 ? -1 : __builtin_ctzll(bits) >> 2;
+}
+
+#endif
+
+/**
+ * Runs `match` over whole registers while `lookahead` more bytes are
+ * readable after each one, then finishes with `scalarMatch`.
+ */
+template <size_t lookahead, typename Match, typename ScalarMatch>
+inline size_t scan(std::string_view s, size_t from, Match match, ScalarMatch scalarMatch) noexcept
+{
+  const char* data = s.data();
+  size_t i = from;
+  for (; i + kWidth + lookahead <= s.size(); i += kWidth) {
+    const int index = firstMatch(match(data + i));
+    if (index >= 0) return i + static_cast<size_t>(index);
+  }
+  for (; i < s.size(); i++) {
+    if (scalarMatch(i)) return i;
+  }
+  return std::string_view::npos;
+}
+
+inline size_t findByte(std::string_view s, size_t from, char c) noexcept
+{
+  return scan<0>(
+      s, from, [c](const char* p) { return equal(load(p), c); }, [&](size_t i) { return s[i] == c; });
+}
+
+inline size_t findTextSpecial(std::string_view s, size_t from) noexcept
+{
+  return scan<1>(
+      s, from,
+      [](const char* p) {
+        const Vec v = load(p);
+        const Vec space = equal(v, ' ');
+        // A space only counts when another low or wide byte follows it.
+        const Vec doubled = both(space, signedAtMost(load(p + 1), 0x20));
+        return either(either(without(signedAtMost(v, 0x20), space), doubled), equal(v, '&'));
+      },
+      [&](size_t i) { return isTextSpecial(s, i); });
+}
+
+inline size_t findNotAlphanumeric(std::string_view s, size_t from) noexcept
+{
+  return scan<0>(
+      s, from,
+      [](const char* p) {
+        const Vec v = load(p);
+        // Bytes from 0x80 compare as negative: neither a digit nor a letter.
+        const Vec digit = without(signedAtMost(v, '9'), signedAtMost(v, '/'));
+        const Vec folded = either(v, splat(0x20));
+        const Vec letter = without(signedAtMost(folded, 'z'), signedAtMost(folded, '`'));
+        return without(splat(-1), either(digit, letter));
+      },
+      [&](size_t i) { return !isAlphanumeric(s[i]); });
+}
+
+inline size_t findControlOrNonAscii(std::string_view s, size_t from) noexcept
+{
+  return scan<0>(
+      s, from, [](const char* p) { return signedAtMost(load(p), 0x1F); },
+      [&](size_t i) { return isControlOrNonAscii(s[i]); });
+}
+
+} // namespace vector
+
+constexpr const char* kBackend = vector::kBackend;
+
+inline size_t findByte(std::string_view s, size_t from, char c) noexcept { return vector::findByte(s, from, c); }
+inline size_t findTextSpecial(std::string_view s, size_t from) noexcept { return vector::findTextSpecial(s, from); }
+inline size_t findNotAlphanumeric(std::string_view s, size_t from) noexcept
+{
+  return vector::findNotAlphanumeric(s, from);
+}
+inline size_t findControlOrNonAscii(std::string_view s, size_t from) noexcept
+{
+  return vector::findControlOrNonAscii(s, from);
+}
+
+#else
+
+constexpr const char* kBackend = "scalar";
+
+inline size_t findByte(std::string_view s, size_t from, char c) noexcept { return scalar::findByte(s, from, c); }
+inline size_t findTextSpecial(std::string_view s, size_t from) noexcept { return scalar::findTextSpecial(s, from); }
+inline size_t findNotAlphanumeric(std::string_view s, size_t from) noexcept
+{
+  return scalar::findNotAlphanumeric(s, from);
+}
+inline size_t findControlOrNonAscii(std::string_view s, size_t from) noexcept
+{
+  return scalar::findControlOrNonAscii(s, from);
+}
+
+#endif
+
+} // namespace margelo::nitro::nitrotext::simd
@@ -0,0 +1,69 @@
+//
+// NitroTextSpanTree.cpp
+// Resolves the hierarchical span transport into leaf fragments
+//
+
+#include "NitroTextSpanTree.hpp"
+#include "NitroTextStyle.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace margelo::nitro::nitrotext {
+
+std::vector<Fragment> resolveSpanTree(const std::vector<Fragment>& spans,
+                                      const std::vector<double>& parents)
+{
+  std::vector<Fragment> out;
+  std::vector<TextStyle> resolved(spans.size());
+  // The link of each span: its own `linkUrl` or the nearest ancestor's.
+  std::vector<const std::string*> links(spans.size());
+
+  const TextStyle* lastStyle = nullptr;
+  const std::string* lastLink = nullptr;
+
+  for (size_t i = 0; i < spans.size(); i++) {
+    const Fragment& span = spans[i];
+    const auto parent = i < parents.size() ? static_cast<int64_t>(parents[i]) : -1;
+    // Anything but an earlier span is treated as the root.
+    const bool hasParent = parent >= 0 && static_cast<size_t>(parent) < i;
+
+    const TextStyle own = TextStyle::fromFragment(span);
+    TextStyle& style = resolved[i];
+    style = hasParent ? own.withFallback(resolved[parent]) : own;
+    if (!own.fragmentBackgroundColor) {
+      const bool isText = span.text.has_value();
+      style.fragmentBackgroundColor = isText && hasParent
+                                          ? resolved[parent].fragmentBackgroundColor
+                                          : Atom();
+    }
+
+    const std::string* link = span.linkUrl ? &*span.linkUrl : hasParent ? links[parent] : nullptr;
+    links[i] = link;
+
+    if (!span.text.has_value() || span.text->empty()) {
+      continue;
+    }
+
+    const bool sameLink = lastLink == link || (lastLink != nullptr && link != nullptr && *lastLink == *link);
+    if (lastStyle != nullptr && *lastStyle == style && sameLink) {
+      out.back().text->append(*span.text);
+      continue;
+    }
+
+    Fragment fragment;
+    fragment.text = *span.text;
+    style.writeTo(fragment);
+    if (link != nullptr) {
+      fragment.linkUrl = *link;
+    }
+    out.push_back(std::move(fragment));
+    lastStyle = &style;
+    lastLink = link;
+  }
+
+  return out;
+}
+
+} // namespace margelo::nitro::nitrotext
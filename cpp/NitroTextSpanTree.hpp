@@ -0,0 +1,32 @@
+//
+// NitroTextSpanTree.hpp
+// Resolves the hierarchical span transport into leaf fragments
+//
+
+#pragma once
+
+#include "Fragment.hpp"
+
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * @brief Resolves a span tree into the flat fragment list the renderers use.
+ *
+ * `spans[i]` holds only the style fields its element sets itself (a delta)
+ * and, for text nodes, the text. `parents[i]` is the index of its parent
+ * span, or -1 for children of the root. Parents must precede their children,
+ * which lets the cascade resolve in one pass: every span's style is its delta
+ * over its parent's already resolved style. Precedence between style and
+ * props is settled in JS: a span's delta leaves out whatever an ancestor
+ * sets as a prop, so those cascade down unchanged.
+ *
+ * Like `flattenChildrenToFragments` did in JS, `fragmentBackgroundColor` does
+ * not cascade (an element's background only paints its own text) and adjacent
+ * text with identical resolved styles is merged into one fragment.
+ */
+std::vector<Fragment> resolveSpanTree(const std::vector<Fragment>& spans,
+                                      const std::vector<double>& parents);
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,76 @@
+//
+// NitroTextState.cpp
+// Custom, non-generated State for NitroText
+//
+
+#include "NitroTextState.hpp"
+#include <functional>
+#include <optional>
+#include <string>
+
+namespace margelo::nitro::nitrotext::views {
+
+namespace {
+
+void mix(size_t& h, size_t v)
+{
+  h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+}
+
+template <typename T>
+void mixOptional(size_t& h, const std::optional<T>& value)
+{
+  mix(h, value.has_value() ? std::hash<T>{}(*value) + 1 : 0);
+}
+
+// Hashes the fields as they are: this runs on every measure, where interning
+// them through `TextStyle` would take the atom table's lock per string.
+void mixFragment(size_t& h, const Fragment& fragment)
+{
+  mixOptional(h, fragment.text);
+  mixOptional(h, fragment.selectionColor);
+  mixOptional(h, fragment.fontSize);
+  mixOptional(h, fragment.fontWeight);
+  mixOptional(h, fragment.fontColor);
+  mixOptional(h, fragment.fragmentBackgroundColor);
+  mixOptional(h, fragment.fontStyle);
+  mixOptional(h, fragment.fontFamily);
+  mixOptional(h, fragment.lineHeight);
+  mixOptional(h, fragment.letterSpacing);
+  mixOptional(h, fragment.textAlign);
+  mixOptional(h, fragment.textTransform);
+  mixOptional(h, fragment.textDecorationLine);
+  mixOptional(h, fragment.textDecorationColor);
+  mixOptional(h, fragment.textDecorationStyle);
+  mixOptional(h, fragment.linkUrl);
+}
+
+} // namespace
+
+const NitroTextState::ImperativeMeasure* NitroTextState::getImperativeMeasure(
+    const HybridNitroTextProps& props) const
+{
+  if (!_imperativeMeasure) {
+    return nullptr;
+  }
+  return contentFingerprint(props) == _imperativePropsFingerprint
+             ? &_imperativeMeasure
+             : nullptr;
+}
+
+size_t contentFingerprint(const HybridNitroTextProps& props)
+{
+  size_t h = 0;
+  mixOptional(h, props.text.value);
+
+  const auto& fragments = props.fragments.value;
+  mix(h, fragments.has_value() ? fragments->size() + 1 : 0);
+  if (fragments.has_value()) {
+    for (const auto& fragment : *fragments) {
+      mixFragment(h, fragment);
+    }
+  }
+  return h;
+}
+
+} // namespace margelo::nitro::nitrotext::views
@@ -0,0 +1,74 @@
+//
+// NitroTextState.hpp
+// Custom, non-generated State for NitroText
+//
+
+#pragma once
+
+#include "HybridNitroTextComponent.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <utility>
+
+#include <react/renderer/core/LayoutConstraints.h>
+#include <react/renderer/graphics/Size.h>
+
+namespace margelo::nitro::nitrotext::views {
+
+/**
+ * State for the "NitroText" View.
+ *
+ * Mirrors `HybridNitroTextState` (the props snapshot Android round-trips
+ * through JNI) and additionally carries content pushed imperatively through
+ * the hybrid ref (`updateText` / `updateFragments`). That content never
+ * reaches the props, so the view hands the shadow node a measure function for
+ * it instead, valid only while the props content is the one it replaced.
+ */
+class NitroTextState final {
+public:
+  using ImperativeMeasure =
+      std::function<react::Size(const react::LayoutConstraints&)>;
+
+  NitroTextState() = default;
+
+public:
+  void setProps(const HybridNitroTextProps& props) { _props.emplace(props); }
+  const std::optional<HybridNitroTextProps>& getProps() const { return _props; }
+
+  void setImperativeContent(ImperativeMeasure measure, size_t propsFingerprint) {
+    _imperativeMeasure = std::move(measure);
+    _imperativePropsFingerprint = propsFingerprint;
+  }
+
+  /**
+   * @brief The measure function for imperatively pushed content, or `nullptr`
+   * when the node should measure its props as usual.
+   */
+  const ImperativeMeasure* getImperativeMeasure(const HybridNitroTextProps& props) const;
+
+public:
+#ifdef ANDROID
+  NitroTextState(const NitroTextState& /* previousState */, folly::dynamic /* data */) {}
+  folly::dynamic getDynamic() const {
+    throw std::runtime_error("NitroTextState does not support folly!");
+  }
+  react::MapBuffer getMapBuffer() const {
+    throw std::runtime_error("NitroTextState does not support MapBuffer!");
+  };
+#endif
+
+private:
+  std::optional<HybridNitroTextProps> _props;
+  ImperativeMeasure _imperativeMeasure;
+  size_t _imperativePropsFingerprint = 0;
+};
+
+/**
+ * @brief Hashes the content-carrying props (`text` and `fragments`), so
+ * imperative content can tell whether the props it replaced have since changed.
+ */
+size_t contentFingerprint(const HybridNitroTextProps& props);
+
+} // namespace margelo::nitro::nitrotext::views
@@ -0,0 +1,143 @@
+//
+// NitroTextStyle.hpp
+// Interned, comparable text style resolved from a Fragment
+//
+
+#pragma once
+
+#include "Fragment.hpp"
+#include "NitroTextAtom.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * The style part of a `Fragment` (everything but `text` and `linkUrl`), with
+ * string fields interned as atoms so two styles compare and hash without
+ * touching string contents.
+ */
+struct TextStyle {
+  std::optional<double> fontSize;
+  std::optional<double> lineHeight;
+  std::optional<double> letterSpacing;
+  std::optional<FontWeight> fontWeight;
+  std::optional<FontStyle> fontStyle;
+  std::optional<TextAlign> textAlign;
+  std::optional<TextTransform> textTransform;
+  std::optional<TextDecorationLine> textDecorationLine;
+  std::optional<TextDecorationStyle> textDecorationStyle;
+  Atom fontFamily;
+  Atom fontColor;
+  Atom fragmentBackgroundColor;
+  Atom textDecorationColor;
+  Atom selectionColor;
+
+  static TextStyle fromFragment(const Fragment& fragment)
+  {
+    TextStyle style;
+    style.fontSize = fragment.fontSize;
+    style.lineHeight = fragment.lineHeight;
+    style.letterSpacing = fragment.letterSpacing;
+    style.fontWeight = fragment.fontWeight;
+    style.fontStyle = fragment.fontStyle;
+    style.textAlign = fragment.textAlign;
+    style.textTransform = fragment.textTransform;
+    style.textDecorationLine = fragment.textDecorationLine;
+    style.textDecorationStyle = fragment.textDecorationStyle;
+    style.fontFamily = Atom::intern(fragment.fontFamily);
+    style.fontColor = Atom::intern(fragment.fontColor);
+    style.fragmentBackgroundColor = Atom::intern(fragment.fragmentBackgroundColor);
+    style.textDecorationColor = Atom::intern(fragment.textDecorationColor);
+    style.selectionColor = Atom::intern(fragment.selectionColor);
+    return style;
+  }
+
+  /**
+   * @brief Returns a copy where every field unset here falls back to `base`.
+   */
+  TextStyle withFallback(const TextStyle& base) const
+  {
+    TextStyle out = *this;
+    if (!out.fontSize) out.fontSize = base.fontSize;
+    if (!out.lineHeight) out.lineHeight = base.lineHeight;
+    if (!out.letterSpacing) out.letterSpacing = base.letterSpacing;
+    if (!out.fontWeight) out.fontWeight = base.fontWeight;
+    if (!out.fontStyle) out.fontStyle = base.fontStyle;
+    if (!out.textAlign) out.textAlign = base.textAlign;
+    if (!out.textTransform) out.textTransform = base.textTransform;
+    if (!out.textDecorationLine) out.textDecorationLine = base.textDecorationLine;
+    if (!out.textDecorationStyle) out.textDecorationStyle = base.textDecorationStyle;
+    if (!out.fontFamily) out.fontFamily = base.fontFamily;
+    if (!out.fontColor) out.fontColor = base.fontColor;
+    if (!out.fragmentBackgroundColor) out.fragmentBackgroundColor = base.fragmentBackgroundColor;
+    if (!out.textDecorationColor) out.textDecorationColor = base.textDecorationColor;
+    if (!out.selectionColor) out.selectionColor = base.selectionColor;
+    return out;
+  }
+
+  /**
+   * @brief Writes every style field into `fragment`, leaving `text` and
+   * `linkUrl` untouched.
+   */
+  void writeTo(Fragment& fragment) const
+  {
+    auto toString = [](const Atom& atom) -> std::optional<std::string> {
+      return atom ? std::optional<std::string>(atom.str()) : std::nullopt;
+    };
+    fragment.selectionColor = toString(selectionColor);
+    fragment.fontSize = fontSize;
+    fragment.fontWeight = fontWeight;
+    fragment.fontColor = toString(fontColor);
+    fragment.fragmentBackgroundColor = toString(fragmentBackgroundColor);
+    fragment.fontStyle = fontStyle;
+    fragment.fontFamily = toString(fontFamily);
+    fragment.lineHeight = lineHeight;
+    fragment.letterSpacing = letterSpacing;
+    fragment.textAlign = textAlign;
+    fragment.textTransform = textTransform;
+    fragment.textDecorationLine = textDecorationLine;
+    fragment.textDecorationColor = toString(textDecorationColor);
+    fragment.textDecorationStyle = textDecorationStyle;
+  }
+
+  bool operator==(const TextStyle& other) const = default;
+
+  size_t hash() const noexcept
+  {
+    size_t h = 0;
+    auto mix = [&h](size_t v) { h ^= v + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2); };
+    auto mixOptional = [&mix](const auto& opt) {
+      using T = typename std::decay_t<decltype(opt)>::value_type;
+      mix(opt.has_value() ? std::hash<T>{}(*opt) + 1 : 0);
+    };
+    mixOptional(fontSize);
+    mixOptional(lineHeight);
+    mixOptional(letterSpacing);
+    mixOptional(fontWeight);
+    mixOptional(fontStyle);
+    mixOptional(textAlign);
+    mixOptional(textTransform);
+    mixOptional(textDecorationLine);
+    mixOptional(textDecorationStyle);
+    mix(fontFamily.hash());
+    mix(fontColor.hash());
+    mix(fragmentBackgroundColor.hash());
+    mix(textDecorationColor.hash());
+    mix(selectionColor.hash());
+    return h;
+  }
+};
+
+} // namespace margelo::nitro::nitrotext
+
+template <>
+struct std::hash<margelo::nitro::nitrotext::TextStyle> {
+  size_t operator()(const margelo::nitro::nitrotext::TextStyle& style) const noexcept {
+    return style.hash();
+  }
+};
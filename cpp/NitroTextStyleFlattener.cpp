@@ -0,0 +1,347 @@
+//
+// NitroTextStyleFlattener.cpp
+// Native flattening of the raw React Native `style` prop
+//
+
+#include "NitroTextStyleFlattener.hpp"
+
+#include <NitroModules/NitroHash.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+enum StyleKey : size_t {
+  kColor,
+  kBackgroundColor,
+  kFontSize,
+  kFontWeight,
+  kFontStyle,
+  kFontFamily,
+  kLineHeight,
+  kLetterSpacing,
+  kTextAlign,
+  kTextTransform,
+  kTextDecorationLine,
+  kTextDecorationColor,
+  kTextDecorationStyle,
+  kStyleKeyCount,
+};
+
+// The last value seen for each text style key; `nullptr` = never set.
+using StyleSlots = std::array<const AnyValue*, kStyleKeyCount>;
+
+std::optional<StyleKey> styleKey(const std::string& key)
+{
+  switch (hashString(key.c_str(), key.size())) {
+  case hashString("color"): return kColor;
+  case hashString("backgroundColor"): return kBackgroundColor;
+  case hashString("fontSize"): return kFontSize;
+  case hashString("fontWeight"): return kFontWeight;
+  case hashString("fontStyle"): return kFontStyle;
+  case hashString("fontFamily"): return kFontFamily;
+  case hashString("lineHeight"): return kLineHeight;
+  case hashString("letterSpacing"): return kLetterSpacing;
+  case hashString("textAlign"): return kTextAlign;
+  case hashString("textTransform"): return kTextTransform;
+  case hashString("textDecorationLine"): return kTextDecorationLine;
+  case hashString("textDecorationColor"): return kTextDecorationColor;
+  case hashString("textDecorationStyle"): return kTextDecorationStyle;
+  default: return std::nullopt;
+  }
+}
+
+void collect(const AnyValue& value, StyleSlots& slots);
+
+void collectObject(const AnyObject& object, StyleSlots& slots)
+{
+  for (const auto& [key, value] : object) {
+    if (auto k = styleKey(key)) {
+      slots[*k] = &value;
+    }
+  }
+}
+
+void collect(const AnyValue& value, StyleSlots& slots)
+{
+  if (const auto* object = std::get_if<AnyObject>(&value)) {
+    collectObject(*object, slots);
+  } else if (const auto* array = std::get_if<AnyArray>(&value)) {
+    for (const auto& entry : *array) {
+      collect(entry, slots);
+    }
+  }
+  // false, null and numbers are no-ops in StyleSheet.flatten
+}
+
+/**
+ * A JS array crosses JSI as a map keyed by its indices. Returns the element
+ * count if every key is an index, otherwise `std::nullopt`.
+ */
+std::optional<size_t> arrayLength(const AnyObject& object)
+{
+  if (object.empty()) {
+    return std::nullopt;
+  }
+  for (const auto& [key, value] : object) {
+    if (key.empty() || key.find_first_not_of("0123456789") != std::string::npos) {
+      return std::nullopt;
+    }
+  }
+  return object.size();
+}
+
+bool isNull(const AnyValue* value)
+{
+  return value == nullptr || std::holds_alternative<NullType>(*value);
+}
+
+std::optional<double> numberValue(const AnyValue* value)
+{
+  if (isNull(value)) return std::nullopt;
+  if (const auto* d = std::get_if<double>(value)) return *d;
+  if (const auto* i = std::get_if<int64_t>(value)) return static_cast<double>(*i);
+  return std::nullopt;
+}
+
+std::optional<std::string> stringValue(const AnyValue* value)
+{
+  if (isNull(value)) return std::nullopt;
+  if (const auto* s = std::get_if<std::string>(value)) return *s;
+  return std::nullopt;
+}
+
+// Colors may be strings or `processColor` output; the native parsers accept
+// both as strings.
+std::optional<std::string> colorValue(const AnyValue* value)
+{
+  if (auto s = stringValue(value)) return s;
+  if (auto n = numberValue(value)) {
+    return std::to_string(static_cast<uint32_t>(static_cast<int64_t>(*n)));
+  }
+  return std::nullopt;
+}
+
+std::optional<std::string> nonEmpty(std::optional<std::string> value)
+{
+  if (value.has_value() && value->empty()) return std::nullopt;
+  return value;
+}
+
+// `Number(s)` for the string forms a font weight can take.
+std::optional<double> jsNumber(std::string_view s)
+{
+  const size_t begin = s.find_first_not_of(" \t\n\r\f\v");
+  if (begin == std::string_view::npos) return 0.0;
+  const size_t end = s.find_last_not_of(" \t\n\r\f\v") + 1;
+  const size_t length = end - begin;
+  // strtod needs a terminator; short values are copied to the stack.
+  char buffer[64];
+  std::string copy;
+  const char* terminated = buffer;
+  if (length < sizeof(buffer)) {
+    std::memcpy(buffer, s.data() + begin, length);
+    buffer[length] = '\0';
+  } else {
+    copy.assign(s.substr(begin, length));
+    terminated = copy.c_str();
+  }
+  char* parsedEnd = nullptr;
+  const double n = std::strtod(terminated, &parsedEnd);
+  if (parsedEnd != terminated + length || std::isnan(n)) {
+    return std::nullopt;
+  }
+  return n;
+}
+
+std::optional<FontWeight> fontWeightFromName(std::string_view name)
+{
+  switch (hashString(name.data(), name.size())) {
+  case hashString("normal"): return FontWeight::NORMAL;
+  case hashString("bold"): return FontWeight::BOLD;
+  case hashString("ultralight"): return FontWeight::ULTRALIGHT;
+  case hashString("thin"): return FontWeight::THIN;
+  case hashString("light"): return FontWeight::LIGHT;
+  case hashString("medium"): return FontWeight::MEDIUM;
+  case hashString("regular"): return FontWeight::REGULAR;
+  case hashString("semibold"): return FontWeight::SEMIBOLD;
+  case hashString("condensedBold"): return FontWeight::CONDENSEDBOLD;
+  case hashString("condensed"): return FontWeight::CONDENSED;
+  case hashString("heavy"): return FontWeight::HEAVY;
+  case hashString("black"): return FontWeight::BLACK;
+  default: return std::nullopt;
+  }
+}
+
+// The numeric table of `normalizeWeight` in src/utils.ts.
+FontWeight fontWeightFromNumber(double n)
+{
+  switch (static_cast<int>(n == std::floor(n) ? n : -1)) {
+  case 100: return FontWeight::ULTRALIGHT;
+  case 200: return FontWeight::LIGHT;
+  case 300: return FontWeight::THIN;
+  case 400: return FontWeight::REGULAR;
+  case 500: return FontWeight::MEDIUM;
+  case 600: return FontWeight::SEMIBOLD;
+  case 700: return FontWeight::BOLD;
+  case 800: return FontWeight::HEAVY;
+  case 900: return FontWeight::BLACK;
+  default: return FontWeight::REGULAR;
+  }
+}
+
+// Mirrors `normalizeWeight` in src/utils.ts.
+std::optional<FontWeight> fontWeightValue(const AnyValue* value)
+{
+  if (isNull(value)) return std::nullopt;
+
+  if (const auto* s = std::get_if<std::string>(value)) {
+    return fontWeightFromString(*s);
+  }
+  if (const auto* b = std::get_if<bool>(value)) {
+    return *b ? std::optional<FontWeight>(fontWeightFromNumber(1)) : std::nullopt;
+  }
+  auto n = numberValue(value);
+  if (!n.has_value() || *n == 0 || std::isnan(*n)) return std::nullopt;
+  return fontWeightFromNumber(*n);
+}
+
+std::optional<FontStyle> fontStyleValue(const AnyValue* value)
+{
+  auto s = stringValue(value);
+  return s ? fontStyleFromString(*s) : std::nullopt;
+}
+
+std::optional<TextAlign> textAlignValue(const AnyValue* value)
+{
+  auto s = stringValue(value);
+  return s ? textAlignFromString(*s) : std::nullopt;
+}
+
+std::optional<TextTransform> textTransformValue(const AnyValue* value)
+{
+  auto s = stringValue(value);
+  return s ? textTransformFromString(*s) : std::nullopt;
+}
+
+std::optional<TextDecorationLine> textDecorationLineValue(const AnyValue* value)
+{
+  auto s = stringValue(value);
+  return s ? textDecorationLineFromString(*s) : std::nullopt;
+}
+
+std::optional<TextDecorationStyle> textDecorationStyleValue(const AnyValue* value)
+{
+  auto s = stringValue(value);
+  return s ? textDecorationStyleFromString(*s) : std::nullopt;
+}
+
+} // namespace
+
+std::optional<FontWeight> fontWeightFromString(std::string_view value)
+{
+  if (value.empty()) return std::nullopt;
+  auto n = jsNumber(value);
+  if (!n.has_value()) return fontWeightFromName(value);
+  return fontWeightFromNumber(*n);
+}
+
+std::optional<FontStyle> fontStyleFromString(std::string_view value)
+{
+  switch (hashString(value.data(), value.size())) {
+  case hashString("normal"): return FontStyle::NORMAL;
+  case hashString("italic"): return FontStyle::ITALIC;
+  case hashString("oblique"): return FontStyle::OBLIQUE;
+  default: return std::nullopt;
+  }
+}
+
+std::optional<TextAlign> textAlignFromString(std::string_view value)
+{
+  switch (hashString(value.data(), value.size())) {
+  case hashString("auto"): return TextAlign::AUTO;
+  case hashString("left"): return TextAlign::LEFT;
+  case hashString("right"): return TextAlign::RIGHT;
+  case hashString("center"): return TextAlign::CENTER;
+  case hashString("justify"): return TextAlign::JUSTIFY;
+  default: return std::nullopt;
+  }
+}
+
+std::optional<TextTransform> textTransformFromString(std::string_view value)
+{
+  switch (hashString(value.data(), value.size())) {
+  case hashString("none"): return TextTransform::NONE;
+  case hashString("uppercase"): return TextTransform::UPPERCASE;
+  case hashString("lowercase"): return TextTransform::LOWERCASE;
+  case hashString("capitalize"): return TextTransform::CAPITALIZE;
+  default: return std::nullopt;
+  }
+}
+
+std::optional<TextDecorationLine> textDecorationLineFromString(std::string_view value)
+{
+  switch (hashString(value.data(), value.size())) {
+  case hashString("none"): return TextDecorationLine::NONE;
+  case hashString("underline"): return TextDecorationLine::UNDERLINE;
+  case hashString("line-through"): return TextDecorationLine::LINE_THROUGH;
+  case hashString("underline line-through"): return TextDecorationLine::UNDERLINE_LINE_THROUGH;
+  default: return std::nullopt;
+  }
+}
+
+std::optional<TextDecorationStyle> textDecorationStyleFromString(std::string_view value)
+{
+  switch (hashString(value.data(), value.size())) {
+  case hashString("solid"): return TextDecorationStyle::SOLID;
+  case hashString("double"): return TextDecorationStyle::DOUBLE;
+  case hashString("dotted"): return TextDecorationStyle::DOTTED;
+  case hashString("dashed"): return TextDecorationStyle::DASHED;
+  default: return std::nullopt;
+  }
+}
+
+FlattenedTextStyle flattenTextStyle(const std::shared_ptr<AnyMap>& style)
+{
+  FlattenedTextStyle out;
+  if (style == nullptr) {
+    return out;
+  }
+
+  StyleSlots slots{};
+  const auto& map = style->getMap();
+  if (auto length = arrayLength(map)) {
+    for (size_t i = 0; i < *length; i++) {
+      auto it = map.find(std::to_string(i));
+      if (it != map.end()) {
+        collect(it->second, slots);
+      }
+    }
+  } else {
+    collectObject(map, slots);
+  }
+
+  out.fontColor = nonEmpty(colorValue(slots[kColor]));
+  out.fragmentBackgroundColor = colorValue(slots[kBackgroundColor]);
+  out.fontSize = numberValue(slots[kFontSize]);
+  out.fontWeight = fontWeightValue(slots[kFontWeight]);
+  out.fontStyle = fontStyleValue(slots[kFontStyle]);
+  out.fontFamily = nonEmpty(stringValue(slots[kFontFamily]));
+  out.lineHeight = numberValue(slots[kLineHeight]);
+  out.letterSpacing = numberValue(slots[kLetterSpacing]);
+  out.textAlign = textAlignValue(slots[kTextAlign]);
+  out.textTransform = textTransformValue(slots[kTextTransform]);
+  out.textDecorationLine = textDecorationLineValue(slots[kTextDecorationLine]);
+  out.textDecorationColor = nonEmpty(colorValue(slots[kTextDecorationColor]));
+  out.textDecorationStyle = textDecorationStyleValue(slots[kTextDecorationStyle]);
+  return out;
+}
+
+} // namespace margelo::nitro::nitrotext
@@ -0,0 +1,71 @@
+//
+// NitroTextStyleFlattener.hpp
+// Native flattening of the raw React Native `style` prop
+//
+
+#pragma once
+
+#include "FontStyle.hpp"
+#include "FontWeight.hpp"
+#include "TextAlign.hpp"
+#include "TextDecorationLine.hpp"
+#include "TextDecorationStyle.hpp"
+#include "TextTransform.hpp"
+
+#include <NitroModules/AnyMap.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * The text part of a flattened React Native style, keyed by NitroText's
+ * top-level prop names (`color` -> `fontColor`, `backgroundColor` ->
+ * `fragmentBackgroundColor`).
+ */
+struct FlattenedTextStyle {
+  std::optional<std::string> fontColor;
+  std::optional<std::string> fragmentBackgroundColor;
+  std::optional<double> fontSize;
+  std::optional<FontWeight> fontWeight;
+  std::optional<FontStyle> fontStyle;
+  std::optional<std::string> fontFamily;
+  std::optional<double> lineHeight;
+  std::optional<double> letterSpacing;
+  std::optional<TextAlign> textAlign;
+  std::optional<TextTransform> textTransform;
+  std::optional<TextDecorationLine> textDecorationLine;
+  std::optional<std::string> textDecorationColor;
+  std::optional<TextDecorationStyle> textDecorationStyle;
+};
+
+/**
+ * @brief Flattens a raw `style` value the way `StyleSheet.flatten` followed by
+ * `styleToFragment`/`getStyleProps` does in JS.
+ *
+ * `style` may be a single style object or a (nested) array of them; a
+ * top-level array arrives as a map keyed "0", "1", ... Falsy entries are
+ * skipped, later entries win, and `null`/`undefined` values unset a key.
+ * Values that do not map to a NitroText enum are ignored instead of failing
+ * the whole props update.
+ */
+FlattenedTextStyle flattenTextStyle(const std::shared_ptr<AnyMap>& style);
+
+/**
+ * @brief `normalizeWeight` for a string: numeric weights ("700") map through
+ * the CSS table, anything else must name a `FontWeight` member.
+ */
+std::optional<FontWeight> fontWeightFromString(std::string_view value);
+
+// String -> enum for the remaining text style unions; `std::nullopt` if
+// `value` is not a member.
+std::optional<FontStyle> fontStyleFromString(std::string_view value);
+std::optional<TextAlign> textAlignFromString(std::string_view value);
+std::optional<TextTransform> textTransformFromString(std::string_view value);
+std::optional<TextDecorationLine> textDecorationLineFromString(std::string_view value);
+std::optional<TextDecorationStyle> textDecorationStyleFromString(std::string_view value);
+
+} // namespace margelo::nitro::nitrotext
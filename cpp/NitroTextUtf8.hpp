@@ -0,0 +1,87 @@
+//
+// NitroTextUtf8.hpp
+// Decoding UTF-8 text one codepoint at a time, forwards or backwards
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace margelo::nitro::nitrotext {
+
+constexpr char32_t kReplacementCharacter = 0xFFFD;
+
+/**
+ * @brief Decodes the codepoint starting at `s[i]` and moves `i` past it.
+ * Malformed, overlong or surrogate sequences read as U+FFFD and consume one
+ * byte, so decoding always makes progress. Requires `i < s.size()`.
+ */
+inline char32_t decodeUtf8(std::string_view s, size_t& i) noexcept
+{
+  const auto byte = [&](size_t at) { return static_cast<uint8_t>(s[at]); };
+  const uint8_t lead = byte(i);
+  if (lead < 0x80) {
+    i++;
+    return lead;
+  }
+  size_t length;
+  char32_t codepoint;
+  char32_t minimum;
+  if ((lead & 0xE0) == 0xC0) {
+    length = 2, codepoint = lead & 0x1F, minimum = 0x80;
+  } else if ((lead & 0xF0) == 0xE0) {
+    length = 3, codepoint = lead & 0x0F, minimum = 0x800;
+  } else if ((lead & 0xF8) == 0xF0) {
+    length = 4, codepoint = lead & 0x07, minimum = 0x10000;
+  } else {
+    i++;
+    return kReplacementCharacter;
+  }
+  if (i + length > s.size()) {
+    i++;
+    return kReplacementCharacter;
+  }
+  for (size_t k = 1; k < length; k++) {
+    const uint8_t next = byte(i + k);
+    if ((next & 0xC0) != 0x80) {
+      i++;
+      return kReplacementCharacter;
+    }
+    codepoint = codepoint << 6 | (next & 0x3F);
+  }
+  if (codepoint < minimum || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+    i++;
+    return kReplacementCharacter;
+  }
+  i += length;
+  return codepoint;
+}
+
+/**
+ * @brief Decodes the codepoint ending at `s[i - 1]` and moves `i` to its
+ * start. Reads malformed text exactly as `decodeUtf8` does from the start,
+ * one U+FFFD per byte that is not part of a well-formed sequence, so walking
+ * backwards meets the same codepoints. Requires `i > 0`.
+ */
+inline char32_t decodeUtf8Before(std::string_view s, size_t& i) noexcept
+{
+  if (static_cast<uint8_t>(s[i - 1]) >= 0x80) {
+    // The nearest lead byte that starts a sequence ending right here. A
+    // well-formed sequence is always read as one going forwards too, since
+    // no other sequence can swallow its lead byte.
+    for (size_t length = 2; length <= 4 && length <= i; length++) {
+      size_t start = i - length;
+      if ((static_cast<uint8_t>(s[start]) & 0xC0) == 0x80) continue;
+      const char32_t codepoint = decodeUtf8(s, start);
+      if (start != i) break;
+      i -= length;
+      return codepoint;
+    }
+  }
+  i--;
+  return static_cast<uint8_t>(s[i]) < 0x80 ? static_cast<char32_t>(s[i]) : kReplacementCharacter;
+}
+
+} // namespace margelo::nitro::nitrotext
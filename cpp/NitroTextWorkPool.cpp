@@ -0,0 +1,141 @@
+//
+// NitroTextWorkPool.cpp
+// Work-stealing thread pool for rendering many documents at once
+//
+
+#include "NitroTextWorkPool.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace margelo::nitro::nitrotext {
+
+struct WorkStealingPool::Job {
+  const std::function<void(size_t)>& task;
+  std::mutex mutex;
+  std::condition_variable done;
+  size_t remaining;
+  std::exception_ptr error;
+};
+
+WorkStealingPool::WorkStealingPool(size_t threadCount)
+{
+  threadCount = std::max<size_t>(threadCount, 1);
+  queues_.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; i++) queues_.push_back(std::make_unique<Queue>());
+  workers_.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; i++) workers_.emplace_back([this, i] { workerLoop(i); });
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& worker : workers_) worker.join();
+}
+
+WorkStealingPool& WorkStealingPool::shared()
+{
+  // Intentionally leaked, like the caches: workers may still be running
+  // when static destructors do.
+  static auto* instance = new WorkStealingPool(std::max(1u, std::thread::hardware_concurrency()));
+  return *instance;
+}
+
+void WorkStealingPool::forEach(size_t count, const std::function<void(size_t)>& task)
+{
+  if (count == 0) return;
+  Job job{task, {}, {}, count, nullptr};
+  for (size_t i = 0; i < count; i++) {
+    Queue& queue = *queues_[i % queues_.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.items.push_back(Item{&job, i});
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queued_ += count;
+  }
+  wake_.notify_all();
+
+  // Help out instead of blocking a thread that could render.
+  Item item{};
+  for (size_t from = 0; from < queues_.size();) {
+    if (steal(from, item)) {
+      run(item);
+    } else {
+      from++;
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(job.mutex);
+  job.done.wait(lock, [&] { return job.remaining == 0; });
+  if (job.error) std::rethrow_exception(job.error);
+}
+
+bool WorkStealingPool::takeOwn(size_t worker, Item& item)
+{
+  Queue& queue = *queues_[worker];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.items.empty()) return false;
+  item = queue.items.back();
+  queue.items.pop_back();
+  std::lock_guard<std::mutex> counter(mutex_);
+  queued_--;
+  return true;
+}
+
+bool WorkStealingPool::steal(size_t from, Item& item)
+{
+  Queue& queue = *queues_[from];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.items.empty()) return false;
+  item = queue.items.front();
+  queue.items.pop_front();
+  std::lock_guard<std::mutex> counter(mutex_);
+  queued_--;
+  return true;
+}
+
+void WorkStealingPool::run(const Item& item)
+{
+  Job& job = *item.job;
+  std::exception_ptr error;
+  try {
+    job.task(item.index);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  // The job lives on the stack of the thread waiting in `forEach`; it may
+  // return as soon as `remaining` reaches zero, so nothing touches the job
+  // after the lock is released.
+  std::lock_guard<std::mutex> lock(job.mutex);
+  if (error && !job.error) job.error = error;
+  if (--job.remaining == 0) job.done.notify_all();
+}
+
+void WorkStealingPool::workerLoop(size_t worker)
+{
+  Item item{};
+  while (true) {
+    if (takeOwn(worker, item)) {
+      run(item);
+      continue;
+    }
+    bool stolen = false;
+    for (size_t offset = 1; offset < queues_.size() && !stolen; offset++) {
+      stolen = steal((worker + offset) % queues_.size(), item);
+    }
+    if (stolen) {
+      run(item);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait(lock, [this] { return stopping_ || queued_ > 0; });
+    if (stopping_ && queued_ == 0) return;
+  }
+}
+
+} // namespace margelo::nitro::nitrotext
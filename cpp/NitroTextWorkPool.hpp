@@ -0,0 +1,76 @@
+//
+// NitroTextWorkPool.hpp
+// Work-stealing thread pool for rendering many documents at once
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+/**
+ * A fixed set of worker threads, each with its own queue.
+ *
+ * `forEach` deals the indices of a job round-robin over the queues. A worker
+ * takes from the back of its own queue and, once that is empty, steals from
+ * the front of the others, so one slow document does not hold up the ones
+ * queued behind it. The calling thread steals too while it waits.
+ *
+ * Tasks must not call `forEach` on the same pool. Thread-safe.
+ */
+class WorkStealingPool final {
+public:
+  explicit WorkStealingPool(size_t threadCount);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+  /**
+   * @brief The process-wide pool, one worker per core.
+   */
+  static WorkStealingPool& shared();
+
+  size_t threadCount() const noexcept { return workers_.size(); }
+
+  /**
+   * @brief Calls `task(i)` for every `i` in `[0, count)` across the workers
+   * and returns once all calls have. Rethrows the first exception a call threw.
+   */
+  void forEach(size_t count, const std::function<void(size_t)>& task);
+
+private:
+  struct Job;
+  struct Item {
+    Job* job;
+    size_t index;
+  };
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Item> items;
+  };
+
+  bool takeOwn(size_t worker, Item& item);
+  bool steal(size_t from, Item& item);
+  static void run(const Item& item);
+  void workerLoop(size_t worker);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> workers_;
+
+  // Guards `queued_` and `stopping_`; idle workers sleep on `wake_`.
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  size_t queued_ = 0;
+  bool stopping_ = false;
+};
+
+} // namespace margelo::nitro::nitrotext
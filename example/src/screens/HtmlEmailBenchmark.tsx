@@ -0,0 +1,111 @@
+import React, { useCallback, useRef, useState } from 'react';
+import { ActivityIndicator, Text, TouchableOpacity, View } from 'react-native';
+import { NitroText } from 'react-native-nitro-text';
+import { styles } from './styles';
+import { formatDuration } from '../utils/performance';
+import { makeHtmlEmail } from '../utils/htmlEmail';
+
+const EMAIL_SIZES = [8, 80] as const;
+
+type EmailSize = (typeof EMAIL_SIZES)[number];
+
+interface EmailResult {
+  kib: number;
+  duration: number;
+}
+
+/**
+ * Mounts a `renderer="html"` NitroText with a generated newsletter and
+ * times it until the first `onTextLayout`. Parsing happens natively when
+ * the props are cloned, so this covers parse, style cascade and layout.
+ */
+export function HtmlEmailBenchmark() {
+  const [running, setRunning] = useState<EmailSize | null>(null);
+  const [html, setHtml] = useState<string | null>(null);
+  const [results, setResults] = useState<
+    Partial<Record<EmailSize, EmailResult>>
+  >({});
+  const startedAt = useRef(0);
+
+  const run = useCallback((size: EmailSize) => {
+    const email = makeHtmlEmail(size);
+    setRunning(size);
+    setHtml(null);
+    requestAnimationFrame(() => {
+      startedAt.current = performance.now();
+      setHtml(email);
+    });
+  }, []);
+
+  const onTextLayout = useCallback(() => {
+    if (running === null || startedAt.current === 0 || html === null) return;
+    const duration = performance.now() - startedAt.current;
+    startedAt.current = 0;
+    setResults((prev) => ({
+      ...prev,
+      [running]: { kib: html.length / 1024, duration },
+    }));
+    setRunning(null);
+  }, [running, html]);
+
+  return (
+    <View style={styles.section}>
+      <NitroText style={styles.sectionTitle}>HTML Email Benchmark</NitroText>
+      <NitroText style={styles.description}>
+        Time from mount to first layout for a newsletter rendered with
+        renderer="html". Run benchmarks/NitroTextHtmlBenchmark.cpp for the
+        parser alone on the same input.
+      </NitroText>
+
+      {EMAIL_SIZES.map((size) => (
+        <TouchableOpacity
+          key={size}
+          style={styles.benchmarkButton}
+          onPress={() => run(size)}
+          disabled={running !== null}
+        >
+          {running === size ? (
+            <ActivityIndicator color="#fff" />
+          ) : (
+            <Text style={styles.benchmarkButtonText}>
+              Render {size} sections
+            </Text>
+          )}
+        </TouchableOpacity>
+      ))}
+
+      <View style={[styles.benchmarkPreview, { height: 160, overflow: 'hidden' }]}>
+        {html !== null && (
+          <NitroText renderer="html" onTextLayout={onTextLayout}>
+            {html}
+          </NitroText>
+        )}
+      </View>
+
+      <View style={styles.metricsContainer}>
+        {EMAIL_SIZES.map((size) => {
+          const result = results[size];
+          return (
+            <View key={size} style={styles.metricCard}>
+              <NitroText style={styles.metricLabel}>
+                {size} sections
+              </NitroText>
+              {result ? (
+                <>
+                  <NitroText style={styles.metricValue}>
+                    {formatDuration(result.duration)}
+                  </NitroText>
+                  <NitroText style={styles.metricSubValue}>
+                    {result.kib.toFixed(1)} KiB
+                  </NitroText>
+                </>
+              ) : (
+                <NitroText style={styles.metricSubValue}>Not run yet</NitroText>
+              )}
+            </View>
+          );
+        })}
+      </View>
+    </View>
+  );
+}
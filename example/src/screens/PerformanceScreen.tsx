@@ -17,6 +17,8 @@ import React, {
   } from 'react-native';
   import { NitroText } from 'react-native-nitro-text';
   import { styles } from './styles';
+  import { TickerBenchmark } from './TickerBenchmark';
+  import { HtmlEmailBenchmark } from './HtmlEmailBenchmark';
   import {
     BenchmarkResult,
     LayoutMeasurement,
@@ -664,6 +666,10 @@ import React, {
   
           {renderBenchmarkResults(listRichBenchmark, 'Rich List')}
         </View>
+
+        <TickerBenchmark />
+
+        <HtmlEmailBenchmark />
       </ScrollView>
     );
   }
@@ -0,0 +1,173 @@
+import React, { useCallback, useEffect, useMemo, useRef, useState } from 'react';
+import { ActivityIndicator, Text, TouchableOpacity, View } from 'react-native';
+import { callback } from 'react-native-nitro-modules';
+import { NitroText, type NitroTextRef } from 'react-native-nitro-text';
+import { styles } from './styles';
+import { formatDuration } from '../utils/performance';
+
+const TICKER_COUNT = 100;
+const TICK_HZ = 30;
+const RUN_DURATION_MS = 3000;
+
+type TickerMode = 'props' | 'imperative';
+
+interface TickerResult {
+  ticks: number;
+  averageUpdate: number;
+  maxUpdate: number;
+  achievedHz: number;
+}
+
+const formatTicker = (tick: number, index: number) =>
+  `#${index.toString().padStart(3, '0')}  ${((tick * (index + 1)) % 100000)
+    .toString()
+    .padStart(5, '0')}`;
+
+const tickerStyle = { width: '25%', fontSize: 10 } as const;
+
+const initialTicks = () => new Array<number>(TICKER_COUNT).fill(0);
+
+const summarize = (durations: number[], elapsed: number): TickerResult => {
+  const total = durations.reduce((sum, d) => sum + d, 0);
+  return {
+    ticks: durations.length,
+    averageUpdate: durations.length ? total / durations.length : 0,
+    maxUpdate: durations.length ? Math.max(...durations) : 0,
+    achievedHz: elapsed > 0 ? (durations.length * 1000) / elapsed : 0,
+  };
+};
+
+/**
+ * Updates 100 tickers at 30 Hz, once through props (React render + commit
+ * per tick) and once through `updateText` on the hybrid refs.
+ */
+export function TickerBenchmark() {
+  const [mode, setMode] = useState<TickerMode | null>(null);
+  const [ticks, setTicks] = useState(initialTicks);
+  const [results, setResults] = useState<
+    Partial<Record<TickerMode, TickerResult>>
+  >({});
+
+  const refs = useRef<(NitroTextRef | undefined)[]>([]);
+  // Stable callbacks, so the props run does not also re-send `hybridRef`.
+  const hybridRefs = useMemo(
+    () =>
+      Array.from({ length: TICKER_COUNT }, (_, i) =>
+        callback((ref: NitroTextRef) => {
+          refs.current[i] = ref;
+        })
+      ),
+    []
+  );
+  const tickStart = useRef(0);
+  const durations = useRef<number[]>([]);
+
+  // Props path: a tick is done once React committed it.
+  useEffect(() => {
+    if (mode !== 'props' || tickStart.current === 0) return;
+    durations.current.push(performance.now() - tickStart.current);
+    tickStart.current = 0;
+  }, [ticks, mode]);
+
+  const run = useCallback((next: TickerMode) => {
+    durations.current = [];
+    setTicks(initialTicks());
+    setMode(next);
+
+    const startedAt = performance.now();
+    let tick = 0;
+    const interval = setInterval(() => {
+      tick += 1;
+      if (next === 'props') {
+        tickStart.current = performance.now();
+        setTicks((prev) => prev.map(() => tick));
+      } else {
+        const start = performance.now();
+        for (let i = 0; i < TICKER_COUNT; i++) {
+          refs.current[i]?.updateText(formatTicker(tick, i));
+        }
+        durations.current.push(performance.now() - start);
+      }
+    }, 1000 / TICK_HZ);
+
+    setTimeout(() => {
+      clearInterval(interval);
+      const elapsed = performance.now() - startedAt;
+      setResults((prev) => ({
+        ...prev,
+        [next]: summarize(durations.current, elapsed),
+      }));
+      setMode(null);
+    }, RUN_DURATION_MS);
+  }, []);
+
+  const renderResult = (label: string, result?: TickerResult) => (
+    <View style={styles.metricCard}>
+      <NitroText style={styles.metricLabel}>{label}</NitroText>
+      {result ? (
+        <>
+          <NitroText style={styles.metricValue}>
+            Avg: {formatDuration(result.averageUpdate)}
+          </NitroText>
+          <NitroText style={styles.metricSubValue}>
+            Max: {formatDuration(result.maxUpdate)}
+          </NitroText>
+          <NitroText style={styles.metricSubValue}>
+            {result.ticks} ticks | {result.achievedHz.toFixed(1)} Hz
+          </NitroText>
+        </>
+      ) : (
+        <NitroText style={styles.metricSubValue}>Not run yet</NitroText>
+      )}
+    </View>
+  );
+
+  return (
+    <View style={styles.section}>
+      <NitroText style={styles.sectionTitle}>Ticker Benchmark</NitroText>
+      <NitroText style={styles.description}>
+        {TICKER_COUNT} tickers updated at {TICK_HZ} Hz through props (render +
+        commit per tick) vs imperatively through the hybrid ref.
+      </NitroText>
+
+      {(['props', 'imperative'] as const).map((m) => (
+        <TouchableOpacity
+          key={m}
+          style={styles.benchmarkButton}
+          onPress={() => run(m)}
+          disabled={mode !== null}
+        >
+          {mode === m ? (
+            <ActivityIndicator color="#fff" />
+          ) : (
+            <Text style={styles.benchmarkButtonText}>
+              {m === 'props' ? 'Run via props' : 'Run via updateText'}
+            </Text>
+          )}
+        </TouchableOpacity>
+      ))}
+
+      <View
+        style={[
+          styles.benchmarkPreview,
+          { height: 160, flexDirection: 'row', flexWrap: 'wrap' },
+        ]}
+      >
+        {ticks.map((tick, i) => (
+          <NitroText
+            key={i}
+            style={tickerStyle}
+            hybridRef={hybridRefs[i]}
+          >
+            {formatTicker(mode === 'imperative' ? 0 : tick, i)}
+          </NitroText>
+        ))}
+      </View>
+
+      <View style={styles.metricsContainer}>
+        {renderResult('Props', results.props)}
+        {renderResult('updateText', results.imperative)}
+      </View>
+    </View>
+  );
+}
@@ -0,0 +1,53 @@
+// Keep in sync with `makeHtmlEmail` in benchmarks/NitroTextHtmlEmail.hpp.
+const EMAIL_HEAD =
+  '<!DOCTYPE html><html><head><meta charset="utf-8"><title>Weekly digest</title>' +
+  '<style>\n' +
+  '/* client resets */\n' +
+  'body { margin: 0; color: #222; }\n' +
+  '* { letter-spacing: 0 }\n' +
+  '.title, h2 { color: #111; font-size: 20px; }\n' +
+  '.muted { color: #888; font-size: 12px }\n' +
+  '#footer { text-align: center; margin: 0 }\n' +
+  'a { color: #1a73e8; text-decoration: underline }\n' +
+  '@media (max-width: 600px) { .content { font-size: 14px } }\n' +
+  '</style></head><body>\n' +
+  '<!--[if mso]><table><tr><td><![endif]-->\n' +
+  '<div class="header" style="background-color: #f4f4f4; margin: 0">' +
+  '<h1>The Weekly Digest</h1><p class="muted">Issue #42 &middot; ' +
+  'Read it in your browser</p></div>\n';
+
+const EMAIL_FOOT =
+  '<div id="footer"><p class="muted">&copy; 2025 Example Inc. &mdash; ' +
+  '<a href="https://example.com/unsubscribe">Unsubscribe</a></p></div>\n' +
+  '<!--[if mso]></td></tr></table><![endif]-->\n' +
+  '</body></html>\n';
+
+const emailSection = (n: number) =>
+  '<table class="section" width="100%" cellpadding="0"><tr><td class="content">\n' +
+  `<h2 class="title">Story ${n}: quarterly update &mdash; part ${n}</h2>\n` +
+  '<p style="color: #444; font-size: 15px; line-height: 22px">Lorem ipsum dolor sit ' +
+  'amet, <b>consectetur</b> adipiscing elit, sed do <em>eiusmod</em> tempor incididunt ' +
+  'ut labore et dolore magna aliqua. Ut enim ad minim veniam, quis nostrud exercitation ' +
+  'ullamco laboris nisi ut aliquip ex ea commodo consequat.&nbsp;<a href="https://' +
+  `example.com/story/${n}">Read more&nbsp;&rarr;</a></p>\n` +
+  `<ul><li><strong>Highlight</strong> one for story ${n}</li>` +
+  `<li><i>Highlight</i> two &amp; three</li><li>Price: &euro;${n}.99 ` +
+  `<span style="text-decoration: line-through; color: #999">&euro;${n}9.99</span>` +
+  '</li></ul>\n' +
+  `<img src="https://example.com/${n}.png" alt="Figure ${n}">\n` +
+  `<!-- tracking pixel ${n} -->\n` +
+  '<p class="muted" style="margin-bottom: 0">Posted in <u>News</u> &bull; ' +
+  `<span style="display: none">preheader text ${n}</span>3 min read</p>\n` +
+  '</td></tr></table>\n';
+
+/**
+ * A newsletter-style HTML email with `sections` stories: a `<style>` block,
+ * layout tables, inline styles, entities, lists, images and comments.
+ */
+export const makeHtmlEmail = (sections: number) => {
+  let html = EMAIL_HEAD;
+  for (let n = 1; n <= sections; n++) {
+    html += emailSection(n);
+  }
+  return html + EMAIL_FOOT;
+};
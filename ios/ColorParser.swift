@@ -8,186 +8,280 @@
 import UIKit
 
 enum ColorParser {
-    // Public entry
+    // Props from React arrive as decimal ARGB: the component descriptor
+    // resolves them with parseColor in cpp/NitroTextColor.cpp. Fragments from
+    // updateFragments/updateText skip the descriptor, so every other form is
+    // read here too, the same way as in C++. Keep the two in step.
     static func parse(_ input: String?) -> UIColor? {
-        guard var s = input?.trimmingCharacters(in: .whitespacesAndNewlines), !s.isEmpty else {
-            return nil
+        guard let input else { return nil }
+        if let argb = parseDecimalARGB(input) {
+            return color(fromARGB: argb)
         }
-        s = s.lowercased()
 
-        // 1) Try decimal ARGB (existing pipeline)
-        if let color = parseDecimalARGB(s) {
-            return color
+        let s = input.trimmingCharacters(in: .whitespacesAndNewlines).lowercased()
+        guard !s.isEmpty else { return nil }
+        if let argb = parseDecimalARGB(s) ?? namedColors[s] ?? parseHex(s) ?? parseRGBFunction(s) {
+            return color(fromARGB: argb)
         }
-
-        // 2) Try named colors
-        if let color = namedColors[s] {
-            return color
-        }
-
-        // 3) Try hex forms (#rgb, #rgba, #rrggbb, #rrggbbaa) or 0x...
-        if let color = parseHex(s) {
-            return color
-        }
-
-        // 4) Try rgb()/rgba()
-        if let color = parseRGBFunction(s) {
-            return color
-        }
-
         return nil
     }
 
     // MARK: - Decimal ARGB (e.g. "4278190080")
-    private static func parseDecimalARGB(_ s: String) -> UIColor? {
-        // Only digits? Try parse as Int32
-        guard s.range(of: "^[0-9]+$", options: .regularExpression) != nil else { return nil }
-        if let val = Int32(s) {
-            return Self.color(fromARGB: val)
+    // A zero alpha byte reads as opaque, as it always has.
+    private static func parseDecimalARGB(_ s: String) -> UInt32? {
+        var value: UInt64 = 0
+        var sawDigit = false
+        for byte in s.utf8 {
+            guard byte >= UInt8(ascii: "0"), byte <= UInt8(ascii: "9") else { return nil }
+            value = value * 10 + UInt64(byte - UInt8(ascii: "0"))
+            guard value <= UInt64(UInt32.max) else { return nil }
+            sawDigit = true
         }
-        // If it's bigger than Int32 but still decimal, clamp into UInt32 then reinterpret
-        if let u = UInt32(s) {
-            // reinterpret as Int32 bit pattern
-            let i = Int32(bitPattern: u)
-            return Self.color(fromARGB: i)
-        }
-        return nil
+        guard sawDigit else { return nil }
+        let argb = UInt32(value)
+        return argb >> 24 == 0 ? argb | 0xFF00_0000 : argb
     }
-    
-    private static func color(fromARGB number: Int32) -> UIColor? {
+
+    private static func color(fromARGB number: UInt32) -> UIColor {
         let a = CGFloat((number >> 24) & 0xFF) / 255.0
         let r = CGFloat((number >> 16) & 0xFF) / 255.0
         let g = CGFloat((number >> 8) & 0xFF) / 255.0
         let b = CGFloat(number & 0xFF) / 255.0
-        return UIColor(red: r, green: g, blue: b, alpha: a == 0 ? 1.0 : a)
+        return UIColor(red: r, green: g, blue: b, alpha: a)
     }
 
-    // MARK: - Named colors (extend as needed)
-    private static let namedColors: [String: UIColor] = [
-        "black": .black,
-        "white": .white,
-        "red": .red,
-        "green": .green,
-        "blue": .blue,
-        "yellow": .yellow,
-        "cyan": .cyan,
-        "magenta": .magenta,
-        "gray": .gray,
-        "grey": .gray,
-        "lightgray": .lightGray,
-        "lightgrey": .lightGray,
-        "darkgray": .darkGray,
-        "darkgrey": .darkGray,
-        "orange": .orange,
-        "purple": .purple,
-        "brown": .brown,
-        "clear": .clear
+    // MARK: - Named colors
+    // The table in cpp/NitroTextColor.cpp.
+    private static let namedColors: [String: UInt32] = [
+        "aliceblue": 0xFFF0_F8FF,
+        "antiquewhite": 0xFFFA_EBD7,
+        "aqua": 0xFF00_FFFF,
+        "aquamarine": 0xFF7F_FFD4,
+        "azure": 0xFFF0_FFFF,
+        "beige": 0xFFF5_F5DC,
+        "bisque": 0xFFFF_E4C4,
+        "black": 0xFF00_0000,
+        "blanchedalmond": 0xFFFF_EBCD,
+        "blue": 0xFF00_00FF,
+        "blueviolet": 0xFF8A_2BE2,
+        "brown": 0xFF99_6633,
+        "burlywood": 0xFFDE_B887,
+        "cadetblue": 0xFF5F_9EA0,
+        "chartreuse": 0xFF7F_FF00,
+        "chocolate": 0xFFD2_691E,
+        "clear": 0x0000_0000,
+        "coral": 0xFFFF_7F50,
+        "cornflowerblue": 0xFF64_95ED,
+        "cornsilk": 0xFFFF_F8DC,
+        "crimson": 0xFFDC_143C,
+        "cyan": 0xFF00_FFFF,
+        "darkblue": 0xFF00_008B,
+        "darkcyan": 0xFF00_8B8B,
+        "darkgoldenrod": 0xFFB8_860B,
+        "darkgray": 0xFF55_5555,
+        "darkgreen": 0xFF00_6400,
+        "darkgrey": 0xFF55_5555,
+        "darkkhaki": 0xFFBD_B76B,
+        "darkmagenta": 0xFF8B_008B,
+        "darkolivegreen": 0xFF55_6B2F,
+        "darkorange": 0xFFFF_8C00,
+        "darkorchid": 0xFF99_32CC,
+        "darkred": 0xFF8B_0000,
+        "darksalmon": 0xFFE9_967A,
+        "darkseagreen": 0xFF8F_BC8F,
+        "darkslateblue": 0xFF48_3D8B,
+        "darkslategray": 0xFF2F_4F4F,
+        "darkslategrey": 0xFF2F_4F4F,
+        "darkturquoise": 0xFF00_CED1,
+        "darkviolet": 0xFF94_00D3,
+        "deeppink": 0xFFFF_1493,
+        "deepskyblue": 0xFF00_BFFF,
+        "dimgray": 0xFF69_6969,
+        "dimgrey": 0xFF69_6969,
+        "dodgerblue": 0xFF1E_90FF,
+        "firebrick": 0xFFB2_2222,
+        "floralwhite": 0xFFFF_FAF0,
+        "forestgreen": 0xFF22_8B22,
+        "fuchsia": 0xFFFF_00FF,
+        "gainsboro": 0xFFDC_DCDC,
+        "ghostwhite": 0xFFF8_F8FF,
+        "gold": 0xFFFF_D700,
+        "goldenrod": 0xFFDA_A520,
+        "gray": 0xFF80_8080,
+        "green": 0xFF00_FF00,
+        "greenyellow": 0xFFAD_FF2F,
+        "grey": 0xFF80_8080,
+        "honeydew": 0xFFF0_FFF0,
+        "hotpink": 0xFFFF_69B4,
+        "indianred": 0xFFCD_5C5C,
+        "indigo": 0xFF4B_0082,
+        "ivory": 0xFFFF_FFF0,
+        "khaki": 0xFFF0_E68C,
+        "lavender": 0xFFE6_E6FA,
+        "lavenderblush": 0xFFFF_F0F5,
+        "lawngreen": 0xFF7C_FC00,
+        "lemonchiffon": 0xFFFF_FACD,
+        "lightblue": 0xFFAD_D8E6,
+        "lightcoral": 0xFFF0_8080,
+        "lightcyan": 0xFFE0_FFFF,
+        "lightgoldenrodyellow": 0xFFFA_FAD2,
+        "lightgray": 0xFFAA_AAAA,
+        "lightgreen": 0xFF90_EE90,
+        "lightgrey": 0xFFAA_AAAA,
+        "lightpink": 0xFFFF_B6C1,
+        "lightsalmon": 0xFFFF_A07A,
+        "lightseagreen": 0xFF20_B2AA,
+        "lightskyblue": 0xFF87_CEFA,
+        "lightslategray": 0xFF77_8899,
+        "lightslategrey": 0xFF77_8899,
+        "lightsteelblue": 0xFFB0_C4DE,
+        "lightyellow": 0xFFFF_FFE0,
+        "lime": 0xFF00_FF00,
+        "limegreen": 0xFF32_CD32,
+        "linen": 0xFFFA_F0E6,
+        "magenta": 0xFFFF_00FF,
+        "maroon": 0xFF80_0000,
+        "mediumaquamarine": 0xFF66_CDAA,
+        "mediumblue": 0xFF00_00CD,
+        "mediumorchid": 0xFFBA_55D3,
+        "mediumpurple": 0xFF93_70DB,
+        "mediumseagreen": 0xFF3C_B371,
+        "mediumslateblue": 0xFF7B_68EE,
+        "mediumspringgreen": 0xFF00_FA9A,
+        "mediumturquoise": 0xFF48_D1CC,
+        "mediumvioletred": 0xFFC7_1585,
+        "midnightblue": 0xFF19_1970,
+        "mintcream": 0xFFF5_FFFA,
+        "mistyrose": 0xFFFF_E4E1,
+        "moccasin": 0xFFFF_E4B5,
+        "navajowhite": 0xFFFF_DEAD,
+        "navy": 0xFF00_0080,
+        "oldlace": 0xFFFD_F5E6,
+        "olive": 0xFF80_8000,
+        "olivedrab": 0xFF6B_8E23,
+        "orange": 0xFFFF_8000,
+        "orangered": 0xFFFF_4500,
+        "orchid": 0xFFDA_70D6,
+        "palegoldenrod": 0xFFEE_E8AA,
+        "palegreen": 0xFF98_FB98,
+        "paleturquoise": 0xFFAF_EEEE,
+        "palevioletred": 0xFFDB_7093,
+        "papayawhip": 0xFFFF_EFD5,
+        "peachpuff": 0xFFFF_DAB9,
+        "peru": 0xFFCD_853F,
+        "pink": 0xFFFF_C0CB,
+        "plum": 0xFFDD_A0DD,
+        "powderblue": 0xFFB0_E0E6,
+        "purple": 0xFF80_0080,
+        "rebeccapurple": 0xFF66_3399,
+        "red": 0xFFFF_0000,
+        "rosybrown": 0xFFBC_8F8F,
+        "royalblue": 0xFF41_69E1,
+        "saddlebrown": 0xFF8B_4513,
+        "salmon": 0xFFFA_8072,
+        "sandybrown": 0xFFF4_A460,
+        "seagreen": 0xFF2E_8B57,
+        "seashell": 0xFFFF_F5EE,
+        "sienna": 0xFFA0_522D,
+        "silver": 0xFFC0_C0C0,
+        "skyblue": 0xFF87_CEEB,
+        "slateblue": 0xFF6A_5ACD,
+        "slategray": 0xFF70_8090,
+        "slategrey": 0xFF70_8090,
+        "snow": 0xFFFF_FAFA,
+        "springgreen": 0xFF00_FF7F,
+        "steelblue": 0xFF46_82B4,
+        "tan": 0xFFD2_B48C,
+        "teal": 0xFF00_8080,
+        "thistle": 0xFFD8_BFD8,
+        "tomato": 0xFFFF_6347,
+        "transparent": 0x0000_0000,
+        "turquoise": 0xFF40_E0D0,
+        "violet": 0xFFEE_82EE,
+        "wheat": 0xFFF5_DEB3,
+        "white": 0xFFFF_FFFF,
+        "whitesmoke": 0xFFF5_F5F5,
+        "yellow": 0xFFFF_FF00,
+        "yellowgreen": 0xFF9A_CD32,
     ]
 
-    // MARK: - Hex parsing
-    private static func parseHex(_ s: String) -> UIColor? {
-        var hex = s
+    // MARK: - Hex (#rgb, #rgba, #rrggbb, #rrggbbaa or #aarrggbb, or 0x...)
+    private static func parseHex(_ s: String) -> UInt32? {
+        var hex = Substring(s)
         if hex.hasPrefix("#") {
-            hex.removeFirst()
+            hex = hex.dropFirst()
         } else if hex.hasPrefix("0x") {
-            hex.removeFirst(2)
+            hex = hex.dropFirst(2)
         }
 
-        // Expand #RGB or #RGBA into full length
-        if hex.count == 3 {
-            // rgb -> rrggbb
-            hex = hex.map { "\($0)\($0)" }.joined()
-        } else if hex.count == 4 {
-            // rgba -> rrggbbaa
-            hex = hex.map { "\($0)\($0)" }.joined()
-        }
+        let length = hex.utf8.count
+        guard length == 3 || length == 4 || length == 6 || length == 8 else { return nil }
 
-        switch hex.count {
-        case 6:
-            // rrggbb
-            guard let rgb = UInt32(hex, radix: 16) else { return nil }
-            let r = CGFloat((rgb >> 16) & 0xFF) / 255.0
-            let g = CGFloat((rgb >> 8) & 0xFF) / 255.0
-            let b = CGFloat(rgb & 0xFF) / 255.0
-            return UIColor(red: r, green: g, blue: b, alpha: 1.0)
-        case 8:
-            // rrggbbaa (CSS common) OR aarrggbb (occasionally used)
-            guard let rgba = UInt32(hex, radix: 16) else { return nil }
-
-            // Heuristic: If the highest byte is alpha for aarrggbb, then a is often 0xFF for opaque.
-            // Try to detect format by assuming if alpha byte is 0x00..0xFF either way; we prefer rrggbbaa first (web common).
-            // rrggbbaa:
-            let r1 = CGFloat((rgba >> 24) & 0xFF) / 255.0
-            let g1 = CGFloat((rgba >> 16) & 0xFF) / 255.0
-            let b1 = CGFloat((rgba >> 8) & 0xFF) / 255.0
-            let a1 = CGFloat(rgba & 0xFF) / 255.0
-
-            // aarrggbb:
-            let a2 = CGFloat((rgba >> 24) & 0xFF) / 255.0
-            let r2 = CGFloat((rgba >> 16) & 0xFF) / 255.0
-            let g2 = CGFloat((rgba >> 8) & 0xFF) / 255.0
-            let b2 = CGFloat(rgba & 0xFF) / 255.0
-
-            if a1 == 0.0, a2 != 0.0 {
-                return UIColor(red: r2, green: g2, blue: b2, alpha: a2)
-            } else {
-                return UIColor(red: r1, green: g1, blue: b1, alpha: a1)
+        var value: UInt32 = 0
+        for byte in hex.utf8 {
+            guard let digit = hexValue(byte) else { return nil }
+            value = (value << 4) | digit
+            if length <= 4 {
+                // #rgb / #rgba: every digit is doubled
+                value = (value << 4) | digit
             }
-        default:
-            return nil
         }
-    }
 
-    // MARK: - rgb()/rgba()
-    private static func parseRGBFunction(_ s: String) -> UIColor? {
-        // Supports:
-        // rgb(r, g, b)
-        // rgba(r, g, b, a)
-        // r,g,b can be 0-255 or percentages (e.g., 50%)
-        // a can be 0-1 or 0%-100%
-        guard s.hasPrefix("rgb") else { return nil }
-
-        // Extract content inside parentheses
-        guard let open = s.firstIndex(of: "("), let close = s.lastIndex(of: ")"), open < close else { return nil }
-        let inside = s[s.index(after: open)..<close]
-        let parts = inside.split(separator: ",").map { $0.trimmingCharacters(in: .whitespaces) }
-        guard parts.count == 3 || parts.count == 4 else { return nil }
-
-        func parseComponent(_ comp: String) -> CGFloat? {
-            if comp.hasSuffix("%") {
-                let numString = String(comp.dropLast())
-                guard let percent = Double(numString) else { return nil }
-                return CGFloat(max(0.0, min(100.0, percent)) / 100.0)
-            } else {
-                guard let val = Double(comp) else { return nil }
-                return CGFloat(max(0.0, min(255.0, val)) / 255.0)
-            }
+        if length == 3 || length == 6 {
+            return 0xFF00_0000 | value
+        }
+        // rrggbbaa (CSS) unless that reads as fully transparent while the
+        // aarrggbb reading does not.
+        if value & 0xFF == 0, value >> 24 != 0 {
+            return value
         }
+        return (value << 24) | (value >> 8)
+    }
 
-        func parseAlpha(_ comp: String) -> CGFloat? {
-            if comp.hasSuffix("%") {
-                let numString = String(comp.dropLast())
-                guard let percent = Double(numString) else { return nil }
-                return CGFloat(max(0.0, min(100.0, percent)) / 100.0)
-            } else {
-                guard let val = Double(comp) else { return nil }
-                return CGFloat(max(0.0, min(1.0, val)))
-            }
+    private static func hexValue(_ byte: UInt8) -> UInt32? {
+        switch byte {
+        case UInt8(ascii: "0")...UInt8(ascii: "9"): return UInt32(byte - UInt8(ascii: "0"))
+        case UInt8(ascii: "a")...UInt8(ascii: "f"): return UInt32(byte - UInt8(ascii: "a") + 10)
+        default: return nil
         }
+    }
+
+    // MARK: - rgb()/rgba()
+    // r, g and b are 0-255 or percentages, a is 0-1 or a percentage.
+    private static func parseRGBFunction(_ s: String) -> UInt32? {
+        guard s.hasPrefix("rgb"),
+              let open = s.firstIndex(of: "("),
+              let close = s.lastIndex(of: ")"),
+              open < close else { return nil }
 
-        guard let r = parseComponent(parts[0]),
-              let g = parseComponent(parts[1]),
-              let b = parseComponent(parts[2]) else { return nil }
+        let parts = s[s.index(after: open)..<close].split(separator: ",")
+        guard parts.count == 3 || parts.count == 4,
+              let r = parseComponent(parts[0], max: 255),
+              let g = parseComponent(parts[1], max: 255),
+              let b = parseComponent(parts[2], max: 255) else { return nil }
 
-        let a: CGFloat
+        var a = 1.0
         if parts.count == 4 {
-            guard let alpha = parseAlpha(parts[3]) else { return nil }
+            guard let alpha = parseComponent(parts[3], max: 1) else { return nil }
             a = alpha
-        } else {
-            a = 1.0
         }
 
-        return UIColor(red: r, green: g, blue: b, alpha: a)
+        return (toChannel(a) << 24) | (toChannel(r) << 16) | (toChannel(g) << 8) | toChannel(b)
     }
-}
 
+    private static func parseComponent(_ part: Substring, max: Double) -> Double? {
+        let comp = part.trimmingCharacters(in: .whitespaces)
+        // Plain decimal numbers only, like the C++ parser: no "inf" or "0x".
+        guard comp.allSatisfy({ "0123456789+-.e%".contains($0) }) else { return nil }
+        if comp.hasSuffix("%") {
+            guard let percent = Double(comp.dropLast()) else { return nil }
+            return Swift.max(0, Swift.min(100, percent)) / 100
+        }
+        guard let value = Double(comp) else { return nil }
+        return Swift.max(0, Swift.min(max, value)) / max
+    }
+
+    private static func toChannel(_ unit: Double) -> UInt32 {
+        UInt32(unit * 255 + 0.5)
+    }
+}
@@ -50,6 +50,14 @@ class HybridNitroText: HybridNitroTextSpec, NitroTextViewDelegate {
     var onPressIn: (() -> Void)? = nil
     var onPressOut: (() -> Void)? = nil
 
+    // Flattened into the top-level style props in C++ (cloneProps); never
+    // forwarded to the view.
+    var textStyle: AnyMap? = nil
+
+    // Resolved into `fragments` in C++ (cloneProps); never forwarded to the view.
+    var spans: [Fragment]? = nil
+    var spanParents: [Double]? = nil
+
     var fontSize: Double? {
         didSet {
             nitroTextImpl.setFontSize(fontSize)
@@ -182,6 +190,34 @@ class HybridNitroText: HybridNitroTextSpec, NitroTextViewDelegate {
         }
     }
     
+    // Methods
+
+    func updateText(text: String) throws {
+        DispatchQueue.main.async { [weak self] in
+            self?.applyImperativeContent(fragments: nil, text: text)
+        }
+    }
+
+    func updateFragments(fragments: [Fragment]) throws {
+        DispatchQueue.main.async { [weak self] in
+            self?.applyImperativeContent(fragments: fragments, text: nil)
+        }
+    }
+
+    // Content from the hybrid ref skips React entirely: render it right away,
+    // then let the component view (HybridNitroTextComponentOverride.mm) decide
+    // whether the new size needs a layout pass.
+    private func applyImperativeContent(fragments: [Fragment]?, text: String?) {
+        self.fragments = fragments
+        self.text = text
+        afterUpdate()
+
+        let selector = NSSelectorFromString("nitroTextContentDidChange")
+        if let host = textView.superview, host.responds(to: selector) {
+            host.perform(selector)
+        }
+    }
+
     func onNitroTextLayout(_ layout: TextLayoutEvent) { onTextLayout?(layout) }
     func onNitroTextPressIn() { onPressIn?() }
     func onNitroTextPressOut() { onPressOut?() }
@@ -204,7 +240,9 @@ class HybridNitroText: HybridNitroTextSpec, NitroTextViewDelegate {
             textDecorationStyle: textDecorationStyle,
             selectionColor: selectionColor
         )
-        nitroTextImpl.apply(fragments: fragments, text: text, top: top)
+        // With renderer="html", `text` holds the markup C++ rendered into `fragments`.
+        let plainText = renderer == .html && fragments != nil ? nil : text
+        nitroTextImpl.apply(fragments: fragments, text: plainText, top: top)
     }
 
     func afterUpdate() {
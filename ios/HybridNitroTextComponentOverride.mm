@@ -5,10 +5,16 @@
 //
 
 #import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
 #import <React/RCTComponentViewFactory.h>
 #import <React/RCTViewComponentView.h>
+#import <objc/runtime.h>
 #import <react/renderer/componentregistry/ComponentDescriptorProvider.h>
 
+#import <cmath>
+#import <memory>
+#import <mutex>
+
 #import "NitroTextComponentDescriptor.hpp"
 
 // Forward-declare the generated view class; we don't import generated headers here.
@@ -18,6 +24,63 @@
 using namespace facebook;
 using namespace margelo::nitro::nitrotext::views;
 
+namespace {
+
+  /**
+   * Content pushed through `updateText` / `updateFragments`, shared between the
+   * main thread (which swaps it) and the layout thread (which measures it).
+   */
+  struct ImperativeContent {
+    std::mutex mutex;
+    NSAttributedString* text = nil;
+    NSUInteger maximumNumberOfLines = 0;
+    NSLineBreakMode lineBreakMode = NSLineBreakByWordWrapping;
+    // Inputs and result of the last layout pass, to skip size-neutral updates.
+    react::Size lastMaximumSize;
+    react::Size lastSize;
+    bool measured = false;
+  };
+
+  // TextKit 1 objects are safe to use off the main thread as long as they are
+  // confined to it, which holds for these locals.
+  react::Size measureAttributedText(NSAttributedString* text,
+                                    NSUInteger maximumNumberOfLines,
+                                    NSLineBreakMode lineBreakMode,
+                                    react::Size maximumSize) {
+    if (text.length == 0) {
+      return {0, 0};
+    }
+    NSTextStorage* storage = [[NSTextStorage alloc] initWithAttributedString:text];
+    NSLayoutManager* layoutManager = [NSLayoutManager new];
+    NSTextContainer* container = [[NSTextContainer alloc]
+        initWithSize:CGSizeMake(std::isfinite(maximumSize.width) ? maximumSize.width : CGFLOAT_MAX,
+                                std::isfinite(maximumSize.height) ? maximumSize.height : CGFLOAT_MAX)];
+    container.lineFragmentPadding = 0;
+    container.maximumNumberOfLines = maximumNumberOfLines;
+    container.lineBreakMode = lineBreakMode;
+    [layoutManager addTextContainer:container];
+    [storage addLayoutManager:layoutManager];
+    [layoutManager ensureLayoutForTextContainer:container];
+    const CGRect used = [layoutManager usedRectForTextContainer:container];
+    return {static_cast<react::Float>(std::ceil(used.size.width)),
+            static_cast<react::Float>(std::ceil(used.size.height))};
+  }
+
+} // namespace
+
+/**
+ * Per-view storage the category cannot keep in ivars.
+ */
+@interface NitroTextImperativeHost : NSObject
+@end
+
+@implementation NitroTextImperativeHost {
+@public
+  std::shared_ptr<const NitroTextShadowNode::ConcreteState> _state;
+  std::shared_ptr<ImperativeContent> _content;
+}
+@end
+
 @interface HybridNitroTextComponent (ComponentDescriptorOverride)
 @end
 
@@ -51,6 +114,101 @@ using namespace margelo::nitro::nitrotext::views;
   return NO;
 }
 
+- (NitroTextImperativeHost *)nitroTextImperativeHost
+{
+  NitroTextImperativeHost *host = objc_getAssociatedObject(self, @selector(nitroTextImperativeHost));
+  if (host == nil) {
+    host = [NitroTextImperativeHost new];
+    objc_setAssociatedObject(self, @selector(nitroTextImperativeHost), host, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+  }
+  return host;
+}
+
+- (void)updateState:(const react::State::Shared &)state oldState:(const react::State::Shared &)oldState
+{
+  [super updateState:state oldState:oldState];
+  self.nitroTextImperativeHost->_state =
+      std::static_pointer_cast<const NitroTextShadowNode::ConcreteState>(state);
+}
+
+/**
+ * Called by the Swift view (via the responder chain) after it applied content
+ * from `updateText` / `updateFragments`. That content bypasses props, so the
+ * shadow node would keep measuring the old text: hand it a measure function
+ * for the new content, but only commit a state update (and with it a layout
+ * pass) when the content's size actually changed.
+ */
+- (void)nitroTextContentDidChange
+{
+  NitroTextImperativeHost *host = self.nitroTextImperativeHost;
+  if (!host->_state || !_props) {
+    return;
+  }
+  auto *textView = (UITextView *)self.contentView;
+  if (![textView isKindOfClass:[UITextView class]]) {
+    return;
+  }
+
+  const auto &props = static_cast<const HybridNitroTextProps &>(*_props);
+  const size_t fingerprint = contentFingerprint(props);
+  const bool installed = host->_state->getData().getImperativeMeasure(props) != nullptr;
+
+  if (!host->_content) {
+    host->_content = std::make_shared<ImperativeContent>();
+  }
+  auto content = host->_content;
+  // TextKit layout can take a while for long text, so measure outside the
+  // lock: the layout thread must not wait on it, nor the main thread on a
+  // layout pass. The lock only guards swapping inputs and results.
+  NSAttributedString *text = [textView.attributedText copy];
+  const NSUInteger maximumNumberOfLines = textView.textContainer.maximumNumberOfLines;
+  const NSLineBreakMode lineBreakMode = textView.textContainer.lineBreakMode;
+  bool measured;
+  react::Size lastMaximumSize;
+  react::Size lastSize;
+  {
+    std::lock_guard<std::mutex> lock(content->mutex);
+    content->text = text;
+    content->maximumNumberOfLines = maximumNumberOfLines;
+    content->lineBreakMode = lineBreakMode;
+    measured = content->measured;
+    lastMaximumSize = content->lastMaximumSize;
+    lastSize = content->lastSize;
+  }
+  if (installed && measured &&
+      measureAttributedText(text, maximumNumberOfLines, lineBreakMode, lastMaximumSize) == lastSize) {
+    // Same size: the view already shows the new content, and the next
+    // layout pass measures it through the installed function.
+    return;
+  }
+
+  auto data = host->_state->getData();
+  data.setImperativeContent(
+      [content](const react::LayoutConstraints &layoutConstraints) {
+        NSAttributedString *text;
+        NSUInteger maximumNumberOfLines;
+        NSLineBreakMode lineBreakMode;
+        {
+          std::lock_guard<std::mutex> lock(content->mutex);
+          text = content->text;
+          maximumNumberOfLines = content->maximumNumberOfLines;
+          lineBreakMode = content->lineBreakMode;
+        }
+        const auto size =
+            measureAttributedText(text, maximumNumberOfLines, lineBreakMode, layoutConstraints.maximumSize);
+        std::lock_guard<std::mutex> lock(content->mutex);
+        // Content swapped in meanwhile is measured by the pass it schedules.
+        if (content->text == text) {
+          content->lastMaximumSize = layoutConstraints.maximumSize;
+          content->lastSize = size;
+          content->measured = true;
+        }
+        return size;
+      },
+      fingerprint);
+  host->_state->updateState(std::move(data));
+}
+
 
 @end
 
@@ -55,6 +55,7 @@ namespace margelo::nitro::nitrotext { enum class TextTransform; }
 #include "TextLayout.hpp"
 #include "TextLayoutEvent.hpp"
 #include "TextTransform.hpp"
+#include <NitroModules/AnyMap.hpp>
 #include <functional>
 #include <memory>
 #include <optional>
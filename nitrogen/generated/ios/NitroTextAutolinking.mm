@@ -11,6 +11,7 @@
 #import <type_traits>
 
 #include "HybridNitroTextSpecSwift.hpp"
+#include "HybridNitroTextRenderer.hpp"
 
 @interface NitroTextAutolinking : NSObject
 @end
@@ -28,6 +29,15 @@
       return hybridObject;
     }
   );
+  HybridObjectRegistry::registerHybridObjectConstructor(
+    "NitroTextRenderer",
+    []() -> std::shared_ptr<HybridObject> {
+      static_assert(std::is_default_constructible_v<HybridNitroTextRenderer>,
+                    "The HybridObject \"HybridNitroTextRenderer\" is not default-constructible! "
+                    "Create a public constructor that takes zero arguments to be able to autolink this HybridObject.");
+      return std::make_shared<HybridNitroTextRenderer>();
+    }
+  );
 }
 
 @end
@@ -58,6 +58,7 @@ namespace margelo::nitro::nitrotext { struct TextLayout; }
 #include "MenuItem.hpp"
 #include <functional>
 #include "TextLayoutEvent.hpp"
+#include <NitroModules/AnyMap.hpp>
 #include "TextLayout.hpp"
 
 #include "NitroText-Swift-Cxx-Umbrella.hpp"
@@ -212,6 +213,27 @@ namespace margelo::nitro::nitrotext {
     inline void setOnPressOut(const std::optional<std::function<void()>>& onPressOut) noexcept override {
       _swiftPart.setOnPressOut(onPressOut);
     }
+    inline std::optional<std::shared_ptr<AnyMap>> getTextStyle() noexcept override {
+      auto __result = _swiftPart.getTextStyle();
+      return __result;
+    }
+    inline void setTextStyle(const std::optional<std::shared_ptr<AnyMap>>& textStyle) noexcept override {
+      _swiftPart.setTextStyle(textStyle);
+    }
+    inline std::optional<std::vector<Fragment>> getSpans() noexcept override {
+      auto __result = _swiftPart.getSpans();
+      return __result;
+    }
+    inline void setSpans(const std::optional<std::vector<Fragment>>& spans) noexcept override {
+      _swiftPart.setSpans(spans);
+    }
+    inline std::optional<std::vector<double>> getSpanParents() noexcept override {
+      auto __result = _swiftPart.getSpanParents();
+      return __result;
+    }
+    inline void setSpanParents(const std::optional<std::vector<double>>& spanParents) noexcept override {
+      _swiftPart.setSpanParents(spanParents);
+    }
     inline std::optional<std::string> getText() noexcept override {
       auto __result = _swiftPart.getText();
       return __result;
@@ -320,7 +342,18 @@ namespace margelo::nitro::nitrotext {
 
   public:
     // Methods
-    
+    inline void updateText(const std::string& text) override {
+      auto __result = _swiftPart.updateText(text);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+    }
+    inline void updateFragments(const std::vector<Fragment>& fragments) override {
+      auto __result = _swiftPart.updateFragments(fragments);
+      if (__result.hasError()) [[unlikely]] {
+        std::rethrow_exception(__result.error());
+      }
+    }
 
   private:
     NitroText::HybridNitroTextSpec_cxx _swiftPart;
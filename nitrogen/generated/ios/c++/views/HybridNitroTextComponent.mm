@@ -151,6 +151,21 @@ using namespace margelo::nitro::nitrotext::views;
     swiftPart.setOnPressOut(newViewProps.onPressOut.value);
     newViewProps.onPressOut.isDirty = false;
   }
+  // textStyle: optional
+  if (newViewProps.textStyle.isDirty) {
+    swiftPart.setTextStyle(newViewProps.textStyle.value);
+    newViewProps.textStyle.isDirty = false;
+  }
+  // spans: optional
+  if (newViewProps.spans.isDirty) {
+    swiftPart.setSpans(newViewProps.spans.value);
+    newViewProps.spans.isDirty = false;
+  }
+  // spanParents: optional
+  if (newViewProps.spanParents.isDirty) {
+    swiftPart.setSpanParents(newViewProps.spanParents.value);
+    newViewProps.spanParents.isDirty = false;
+  }
   // text: optional
   if (newViewProps.text.isDirty) {
     swiftPart.setText(newViewProps.text.value);
@@ -27,6 +27,9 @@ public protocol HybridNitroTextSpec_protocol: HybridObject, HybridView {
   var onPress: (() -> Void)? { get set }
   var onPressIn: (() -> Void)? { get set }
   var onPressOut: (() -> Void)? { get set }
+  var textStyle: AnyMap? { get set }
+  var spans: [Fragment]? { get set }
+  var spanParents: [Double]? { get set }
   var text: String? { get set }
   var selectionColor: String? { get set }
   var fontSize: Double? { get set }
@@ -44,7 +47,8 @@ public protocol HybridNitroTextSpec_protocol: HybridObject, HybridView {
   var textDecorationStyle: TextDecorationStyle? { get set }
 
   // Methods
-  
+  func updateText(text: String) throws -> Void
+  func updateFragments(fragments: [Fragment]) throws -> Void
 }
 
 public extension HybridNitroTextSpec_protocol {
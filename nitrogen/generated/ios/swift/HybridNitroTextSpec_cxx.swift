@@ -493,6 +493,90 @@ open class HybridNitroTextSpec_cxx {
     }
   }
   
+  public final var textStyle: bridge.std__optional_std__shared_ptr_AnyMap__ {
+    @inline(__always)
+    get {
+      return { () -> bridge.std__optional_std__shared_ptr_AnyMap__ in
+        if let __unwrappedValue = self.__implementation.textStyle {
+          return bridge.create_std__optional_std__shared_ptr_AnyMap__(__unwrappedValue.cppPart)
+        } else {
+          return .init()
+        }
+      }()
+    }
+    @inline(__always)
+    set {
+      self.__implementation.textStyle = { () -> AnyMap? in
+        if bridge.has_value_std__optional_std__shared_ptr_AnyMap__(newValue) {
+          let __unwrapped = bridge.get_std__optional_std__shared_ptr_AnyMap__(newValue)
+          return AnyMap(withCppPart: __unwrapped)
+        } else {
+          return nil
+        }
+      }()
+    }
+  }
+  
+  public final var spans: bridge.std__optional_std__vector_Fragment__ {
+    @inline(__always)
+    get {
+      return { () -> bridge.std__optional_std__vector_Fragment__ in
+        if let __unwrappedValue = self.__implementation.spans {
+          return bridge.create_std__optional_std__vector_Fragment__({ () -> bridge.std__vector_Fragment_ in
+            var __vector = bridge.create_std__vector_Fragment_(__unwrappedValue.count)
+            for __item in __unwrappedValue {
+              __vector.push_back(__item)
+            }
+            return __vector
+          }())
+        } else {
+          return .init()
+        }
+      }()
+    }
+    @inline(__always)
+    set {
+      self.__implementation.spans = { () -> [Fragment]? in
+        if bridge.has_value_std__optional_std__vector_Fragment__(newValue) {
+          let __unwrapped = bridge.get_std__optional_std__vector_Fragment__(newValue)
+          return __unwrapped.map({ __item in __item })
+        } else {
+          return nil
+        }
+      }()
+    }
+  }
+  
+  public final var spanParents: bridge.std__optional_std__vector_double__ {
+    @inline(__always)
+    get {
+      return { () -> bridge.std__optional_std__vector_double__ in
+        if let __unwrappedValue = self.__implementation.spanParents {
+          return bridge.create_std__optional_std__vector_double__({ () -> bridge.std__vector_double_ in
+            var __vector = bridge.create_std__vector_double_(__unwrappedValue.count)
+            for __item in __unwrappedValue {
+              __vector.push_back(__item)
+            }
+            return __vector
+          }())
+        } else {
+          return .init()
+        }
+      }()
+    }
+    @inline(__always)
+    set {
+      self.__implementation.spanParents = { () -> [Double]? in
+        if bridge.has_value_std__optional_std__vector_double__(newValue) {
+          let __unwrapped = bridge.get_std__optional_std__vector_double__(newValue)
+          return __unwrapped.map({ __item in __item })
+        } else {
+          return nil
+        }
+      }()
+    }
+  }
+  
   public final var text: bridge.std__optional_std__string_ {
     @inline(__always)
     get {
@@ -791,6 +875,28 @@ open class HybridNitroTextSpec_cxx {
   }
 
   // Methods
+  @inline(__always)
+  public final func updateText(text: std.string) -> bridge.Result_void_ {
+    do {
+      try self.__implementation.updateText(text: String(text))
+      return bridge.create_Result_void_()
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_void_(__exceptionPtr)
+    }
+  }
+  
+  @inline(__always)
+  public final func updateFragments(fragments: bridge.std__vector_Fragment_) -> bridge.Result_void_ {
+    do {
+      try self.__implementation.updateFragments(fragments: fragments.map({ __item in __item }))
+      return bridge.create_Result_void_()
+    } catch (let __error) {
+      let __exceptionPtr = __error.toCpp()
+      return bridge.create_Result_void_(__exceptionPtr)
+    }
+  }
+  
   public final func getView() -> UnsafeMutableRawPointer {
     return Unmanaged.passRetained(__implementation.view).toOpaque()
   }
@@ -0,0 +1,22 @@
+///
+/// HybridNitroTextRendererSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#include "HybridNitroTextRendererSpec.hpp"
+
+namespace margelo::nitro::nitrotext {
+
+  void HybridNitroTextRendererSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridMethod("renderHtml", &HybridNitroTextRendererSpec::renderHtml);
+      prototype.registerHybridMethod("renderHtmlBatch", &HybridNitroTextRendererSpec::renderHtmlBatch);
+    });
+  }
+
+} // namespace margelo::nitro::nitrotext
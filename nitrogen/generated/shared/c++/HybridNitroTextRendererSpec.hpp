@@ -0,0 +1,71 @@
+///
+/// HybridNitroTextRendererSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `RenderResult` to properly resolve imports.
+namespace margelo::nitro::nitrotext { struct RenderResult; }
+// Forward declaration of `Fragment` to properly resolve imports.
+namespace margelo::nitro::nitrotext { struct Fragment; }
+
+#include <NitroModules/Promise.hpp>
+#include "RenderResult.hpp"
+#include <string>
+#include "Fragment.hpp"
+#include <optional>
+#include <vector>
+
+namespace margelo::nitro::nitrotext {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `NitroTextRenderer`
+   * Inherit this class to create instances of `HybridNitroTextRendererSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridNitroTextRenderer: public HybridNitroTextRendererSpec {
+   * public:
+   *   HybridNitroTextRenderer(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridNitroTextRendererSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridNitroTextRendererSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridNitroTextRendererSpec() override = default;
+
+    public:
+      // Properties
+      
+
+    public:
+      // Methods
+      virtual std::shared_ptr<Promise<RenderResult>> renderHtml(const std::string& html, const std::optional<Fragment>& baseStyle) = 0;
+      virtual std::shared_ptr<Promise<std::vector<RenderResult>>> renderHtmlBatch(const std::vector<std::string>& htmls, const std::optional<Fragment>& baseStyle) = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "NitroTextRenderer";
+  };
+
+} // namespace margelo::nitro::nitrotext
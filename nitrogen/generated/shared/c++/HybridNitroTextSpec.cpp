@@ -46,6 +46,12 @@ namespace margelo::nitro::nitrotext {
       prototype.registerHybridSetter("onPressIn", &HybridNitroTextSpec::setOnPressIn);
       prototype.registerHybridGetter("onPressOut", &HybridNitroTextSpec::getOnPressOut);
       prototype.registerHybridSetter("onPressOut", &HybridNitroTextSpec::setOnPressOut);
+      prototype.registerHybridGetter("textStyle", &HybridNitroTextSpec::getTextStyle);
+      prototype.registerHybridSetter("textStyle", &HybridNitroTextSpec::setTextStyle);
+      prototype.registerHybridGetter("spans", &HybridNitroTextSpec::getSpans);
+      prototype.registerHybridSetter("spans", &HybridNitroTextSpec::setSpans);
+      prototype.registerHybridGetter("spanParents", &HybridNitroTextSpec::getSpanParents);
+      prototype.registerHybridSetter("spanParents", &HybridNitroTextSpec::setSpanParents);
       prototype.registerHybridGetter("text", &HybridNitroTextSpec::getText);
       prototype.registerHybridSetter("text", &HybridNitroTextSpec::setText);
       prototype.registerHybridGetter("selectionColor", &HybridNitroTextSpec::getSelectionColor);
@@ -76,6 +82,8 @@ namespace margelo::nitro::nitrotext {
       prototype.registerHybridSetter("textDecorationColor", &HybridNitroTextSpec::setTextDecorationColor);
       prototype.registerHybridGetter("textDecorationStyle", &HybridNitroTextSpec::getTextDecorationStyle);
       prototype.registerHybridSetter("textDecorationStyle", &HybridNitroTextSpec::setTextDecorationStyle);
+      prototype.registerHybridMethod("updateText", &HybridNitroTextSpec::updateText);
+      prototype.registerHybridMethod("updateFragments", &HybridNitroTextSpec::updateFragments);
     });
   }
 
@@ -50,6 +50,7 @@ namespace margelo::nitro::nitrotext { enum class TextDecorationStyle; }
 #include "MenuItem.hpp"
 #include "TextLayoutEvent.hpp"
 #include <functional>
+#include <NitroModules/AnyMap.hpp>
 #include <string>
 #include "FontWeight.hpp"
 #include "FontStyle.hpp"
@@ -117,6 +118,12 @@ namespace margelo::nitro::nitrotext {
       virtual void setOnPressIn(const std::optional<std::function<void()>>& onPressIn) = 0;
       virtual std::optional<std::function<void()>> getOnPressOut() = 0;
       virtual void setOnPressOut(const std::optional<std::function<void()>>& onPressOut) = 0;
+      virtual std::optional<std::shared_ptr<AnyMap>> getTextStyle() = 0;
+      virtual void setTextStyle(const std::optional<std::shared_ptr<AnyMap>>& textStyle) = 0;
+      virtual std::optional<std::vector<Fragment>> getSpans() = 0;
+      virtual void setSpans(const std::optional<std::vector<Fragment>>& spans) = 0;
+      virtual std::optional<std::vector<double>> getSpanParents() = 0;
+      virtual void setSpanParents(const std::optional<std::vector<double>>& spanParents) = 0;
       virtual std::optional<std::string> getText() = 0;
       virtual void setText(const std::optional<std::string>& text) = 0;
       virtual std::optional<std::string> getSelectionColor() = 0;
@@ -150,7 +157,8 @@ namespace margelo::nitro::nitrotext {
 
     public:
       // Methods
-      
+      virtual void updateText(const std::string& text) = 0;
+      virtual void updateFragments(const std::vector<Fragment>& fragments) = 0;
 
     protected:
       // Hybrid Setup
@@ -0,0 +1,82 @@
+///
+/// RenderResult.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © 2025 Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `Fragment` to properly resolve imports.
+namespace margelo::nitro::nitrotext { struct Fragment; }
+
+#include "Fragment.hpp"
+#include <vector>
+#include <string>
+
+namespace margelo::nitro::nitrotext {
+
+  /**
+   * A struct which can be represented as a JavaScript object (RenderResult).
+   */
+  struct RenderResult {
+  public:
+    std::vector<Fragment> fragments     SWIFT_PRIVATE;
+    std::string text     SWIFT_PRIVATE;
+
+  public:
+    RenderResult() = default;
+    explicit RenderResult(std::vector<Fragment> fragments, std::string text): fragments(fragments), text(text) {}
+  };
+
+} // namespace margelo::nitro::nitrotext
+
+namespace margelo::nitro {
+
+  // C++ RenderResult <> JS RenderResult (object)
+  template <>
+  struct JSIConverter<margelo::nitro::nitrotext::RenderResult> final {
+    static inline margelo::nitro::nitrotext::RenderResult fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::nitrotext::RenderResult(
+        JSIConverter<std::vector<margelo::nitro::nitrotext::Fragment>>::fromJSI(runtime, obj.getProperty(runtime, "fragments")),
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, "text"))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::nitrotext::RenderResult& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, "fragments", JSIConverter<std::vector<margelo::nitro::nitrotext::Fragment>>::toJSI(runtime, arg.fragments));
+      obj.setProperty(runtime, "text", JSIConverter<std::string>::toJSI(runtime, arg.text));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::vector<margelo::nitro::nitrotext::Fragment>>::canConvert(runtime, obj.getProperty(runtime, "fragments"))) return false;
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, "text"))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
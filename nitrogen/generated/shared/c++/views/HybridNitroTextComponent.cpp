@@ -185,6 +185,36 @@ namespace margelo::nitro::nitrotext::views {
         throw std::runtime_error(std::string("NitroText.onPressOut: ") + exc.what());
       }
     }()),
+    textStyle([&]() -> CachedProp<std::optional<std::shared_ptr<AnyMap>>> {
+      try {
+        const react::RawValue* rawValue = rawProps.at("textStyle", nullptr, nullptr);
+        if (rawValue == nullptr) return sourceProps.textStyle;
+        const auto& [runtime, value] = (std::pair<jsi::Runtime*, jsi::Value>)*rawValue;
+        return CachedProp<std::optional<std::shared_ptr<AnyMap>>>::fromRawValue(*runtime, value, sourceProps.textStyle);
+      } catch (const std::exception& exc) {
+        throw std::runtime_error(std::string("NitroText.textStyle: ") + exc.what());
+      }
+    }()),
+    spans([&]() -> CachedProp<std::optional<std::vector<Fragment>>> {
+      try {
+        const react::RawValue* rawValue = rawProps.at("spans", nullptr, nullptr);
+        if (rawValue == nullptr) return sourceProps.spans;
+        const auto& [runtime, value] = (std::pair<jsi::Runtime*, jsi::Value>)*rawValue;
+        return CachedProp<std::optional<std::vector<Fragment>>>::fromRawValue(*runtime, value, sourceProps.spans);
+      } catch (const std::exception& exc) {
+        throw std::runtime_error(std::string("NitroText.spans: ") + exc.what());
+      }
+    }()),
+    spanParents([&]() -> CachedProp<std::optional<std::vector<double>>> {
+      try {
+        const react::RawValue* rawValue = rawProps.at("spanParents", nullptr, nullptr);
+        if (rawValue == nullptr) return sourceProps.spanParents;
+        const auto& [runtime, value] = (std::pair<jsi::Runtime*, jsi::Value>)*rawValue;
+        return CachedProp<std::optional<std::vector<double>>>::fromRawValue(*runtime, value, sourceProps.spanParents);
+      } catch (const std::exception& exc) {
+        throw std::runtime_error(std::string("NitroText.spanParents: ") + exc.what());
+      }
+    }()),
     text([&]() -> CachedProp<std::optional<std::string>> {
       try {
         const react::RawValue* rawValue = rawProps.at("text", nullptr, nullptr);
@@ -364,6 +394,9 @@ namespace margelo::nitro::nitrotext::views {
     onPress(other.onPress),
     onPressIn(other.onPressIn),
     onPressOut(other.onPressOut),
+    textStyle(other.textStyle),
+    spans(other.spans),
+    spanParents(other.spanParents),
     text(other.text),
     selectionColor(other.selectionColor),
     fontSize(other.fontSize),
@@ -399,6 +432,9 @@ namespace margelo::nitro::nitrotext::views {
       case hashString("onPress"): return true;
       case hashString("onPressIn"): return true;
       case hashString("onPressOut"): return true;
+      case hashString("textStyle"): return true;
+      case hashString("spans"): return true;
+      case hashString("spanParents"): return true;
       case hashString("text"): return true;
       case hashString("selectionColor"): return true;
       case hashString("fontSize"): return true;
@@ -26,6 +26,7 @@
 #include "MenuItem.hpp"
 #include "TextLayoutEvent.hpp"
 #include <functional>
+#include <NitroModules/AnyMap.hpp>
 #include <string>
 #include "FontWeight.hpp"
 #include "FontStyle.hpp"
@@ -73,6 +74,9 @@ namespace margelo::nitro::nitrotext::views {
     CachedProp<std::optional<std::function<void()>>> onPress;
     CachedProp<std::optional<std::function<void()>>> onPressIn;
     CachedProp<std::optional<std::function<void()>>> onPressOut;
+    CachedProp<std::optional<std::shared_ptr<AnyMap>>> textStyle;
+    CachedProp<std::optional<std::vector<Fragment>>> spans;
+    CachedProp<std::optional<std::vector<double>>> spanParents;
     CachedProp<std::optional<std::string>> text;
     CachedProp<std::optional<std::string>> selectionColor;
     CachedProp<std::optional<double>> fontSize;
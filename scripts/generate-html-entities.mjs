@@ -0,0 +1,247 @@
+// Generates cpp/NitroTextHtmlEntities.cpp: the HTML5 named character
+// references with a perfect hash table over their names.
+//
+//   node scripts/generate-html-entities.mjs [entities.json]
+//
+// Reads the WHATWG list (https://html.spec.whatwg.org/entities.json) from the
+// given file, or downloads it. Only names terminated by `;` are kept: the
+// renderers never decode legacy references without one.
+
+import { readFileSync, writeFileSync } from 'node:fs'
+import { dirname, join } from 'node:path'
+import { fileURLToPath } from 'node:url'
+
+const ENTITIES_URL = 'https://html.spec.whatwg.org/entities.json'
+const OUTPUT = join(
+   dirname(fileURLToPath(import.meta.url)),
+   '..',
+   'cpp',
+   'NitroTextHtmlEntities.cpp'
+)
+
+// Names the renderers have always decoded that HTML5 does not define.
+const EXTENSIONS = {
+   lira: '₤',
+   naira: '₦',
+   rlArr: '⇌',
+   rouble: '₽',
+   rupee: '₹',
+   won: '₩',
+   xArr: '⇗',
+   xarr: '↗',
+}
+
+const BUCKET_COUNT = 1024
+const SLOT_COUNT = 4096
+const EMPTY_SLOT = 0xffff
+
+// Must match `hashEntityName` in the generated C++.
+function hashEntityName(name, seed) {
+   let h = (2166136261 ^ seed) >>> 0
+   for (const byte of Buffer.from(name, 'latin1')) {
+      h = Math.imul(h ^ byte, 16777619) >>> 0
+   }
+   h = (h ^ (h >>> 16)) >>> 0
+   h = Math.imul(h, 0x7feb352d) >>> 0
+   return (h ^ (h >>> 15)) >>> 0
+}
+
+async function loadEntities() {
+   const path = process.argv[2]
+   const json = path
+      ? readFileSync(path, 'utf8')
+      : await (await fetch(ENTITIES_URL)).text()
+   const entities = new Map()
+   for (const [reference, { characters }] of Object.entries(JSON.parse(json))) {
+      if (reference.endsWith(';')) {
+         entities.set(reference.slice(1, -1), characters)
+      }
+   }
+   for (const [name, characters] of Object.entries(EXTENSIONS)) {
+      if (!entities.has(name)) entities.set(name, characters)
+   }
+   return [...entities.entries()].sort(([a], [b]) => (a < b ? -1 : a > b ? 1 : 0))
+}
+
+// Hash and displace: every bucket gets the smallest seed that sends all of
+// its names to free slots.
+function buildPerfectHash(names) {
+   const buckets = Array.from({ length: BUCKET_COUNT }, () => [])
+   names.forEach((name, index) => {
+      buckets[hashEntityName(name, 0) % BUCKET_COUNT].push(index)
+   })
+   const order = buckets
+      .map((members, bucket) => ({ members, bucket }))
+      .sort((a, b) => b.members.length - a.members.length)
+
+   const seeds = new Array(BUCKET_COUNT).fill(0)
+   const slots = new Array(SLOT_COUNT).fill(EMPTY_SLOT)
+   for (const { members, bucket } of order) {
+      if (!members.length) continue
+      let placed = false
+      for (let seed = 1; seed < 0x10000 && !placed; seed++) {
+         const taken = members.map(
+            (index) => hashEntityName(names[index], seed) % SLOT_COUNT
+         )
+         if (
+            new Set(taken).size === taken.length &&
+            taken.every((slot) => slots[slot] === EMPTY_SLOT)
+         ) {
+            taken.forEach((slot, i) => (slots[slot] = members[i]))
+            seeds[bucket] = seed
+            placed = true
+         }
+      }
+      if (!placed) throw new Error(`No seed for bucket ${bucket}`)
+   }
+   return { seeds, slots }
+}
+
+// Escapes everything but printable ASCII. A hex digit right after an escape
+// is escaped too, or the escape would swallow it.
+function cString(bytes) {
+   let out = ''
+   let escaped = false
+   for (const byte of bytes) {
+      const char = String.fromCharCode(byte)
+      const printable =
+         byte >= 0x20 && byte < 0x7f && char !== '"' && char !== '\\' && char !== '?'
+      if (printable && !(escaped && /[0-9a-fA-F]/.test(char))) {
+         out += char
+         escaped = false
+      } else {
+         out += `\\x${byte.toString(16).padStart(2, '0')}`
+         escaped = true
+      }
+   }
+   return out
+}
+
+// Splits a blob into string literals of at most about 80 columns.
+function blobLiteral(bytes) {
+   const lines = []
+   let begin = 0
+   for (let end = 1; end <= bytes.length; end++) {
+      const next = cString(bytes.subarray(begin, end + 1))
+      if (end === bytes.length || next.length > 80) {
+         lines.push(`    "${cString(bytes.subarray(begin, end))}"`)
+         begin = end
+      }
+   }
+   return lines.join('\n')
+}
+
+function numberRows(values, perRow) {
+   const rows = []
+   for (let i = 0; i < values.length; i += perRow) {
+      rows.push('    ' + values.slice(i, i + perRow).join(', ') + ',')
+   }
+   return rows.join('\n')
+}
+
+const entities = await loadEntities()
+const names = entities.map(([name]) => name)
+const { seeds, slots } = buildPerfectHash(names)
+
+const nameBytes = []
+const valueBytes = []
+const records = []
+let maxNameLength = 0
+for (const [name, characters] of entities) {
+   const value = Buffer.from(characters, 'utf8')
+   records.push(
+      `{${nameBytes.length}, ${valueBytes.length}, ${name.length}, ${value.length}}`
+   )
+   nameBytes.push(...Buffer.from(name, 'latin1'))
+   valueBytes.push(...value)
+   maxNameLength = Math.max(maxNameLength, name.length)
+}
+
+const source = `//
+// NitroTextHtmlEntities.cpp
+// Named character references understood by the native HTML renderer
+//
+// Generated by scripts/generate-html-entities.mjs from the WHATWG entity
+// list; do not edit by hand.
+//
+
+#include "NitroTextHtmlEntities.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+struct EntityRecord {
+  uint16_t nameOffset;
+  uint16_t valueOffset;
+  uint8_t nameLength;
+  uint8_t valueLength;
+};
+
+constexpr size_t kEntityCount = ${entities.length};
+constexpr size_t kBucketCount = ${BUCKET_COUNT};
+constexpr size_t kSlotCount = ${SLOT_COUNT};
+constexpr uint16_t kEmptySlot = 0x${EMPTY_SLOT.toString(16)};
+
+static_assert(kMaxHtmlEntityNameLength == ${maxNameLength}, "regenerate NitroTextHtmlEntities.cpp");
+
+// Every name, sorted, back to back.
+constexpr char kNames[] =
+${blobLiteral(Buffer.from(nameBytes))};
+
+// The UTF-8 replacement of every name, in the same order.
+constexpr char kValues[] =
+${blobLiteral(Buffer.from(valueBytes))};
+
+constexpr std::array<EntityRecord, kEntityCount> kEntities = {{
+${numberRows(records, 4)}
+}};
+
+// Seed per bucket of \`hashEntityName(name, 0)\`.
+constexpr std::array<uint16_t, kBucketCount> kSeeds = {{
+${numberRows(seeds, 12)}
+}};
+
+// Index into kEntities per slot of \`hashEntityName(name, seed)\`.
+constexpr std::array<uint16_t, kSlotCount> kSlots = {{
+${numberRows(slots, 12)}
+}};
+
+constexpr uint32_t hashEntityName(std::string_view name, uint32_t seed)
+{
+  uint32_t h = 2166136261u ^ seed;
+  for (const char c : name) {
+    h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+  }
+  h ^= h >> 16;
+  h *= 0x7feb352du;
+  return h ^ (h >> 15);
+}
+
+} // namespace
+
+std::optional<std::string_view> lookupHtmlEntity(std::string_view name)
+{
+  if (name.empty() || name.size() > kMaxHtmlEntityNameLength) {
+    return std::nullopt;
+  }
+  const uint16_t seed = kSeeds[hashEntityName(name, 0) % kBucketCount];
+  const uint16_t index = kSlots[hashEntityName(name, seed) % kSlotCount];
+  if (index == kEmptySlot) {
+    return std::nullopt;
+  }
+  const EntityRecord& entity = kEntities[index];
+  if (std::string_view(kNames + entity.nameOffset, entity.nameLength) != name) {
+    return std::nullopt;
+  }
+  return std::string_view(kValues + entity.valueOffset, entity.valueLength);
+}
+
+} // namespace margelo::nitro::nitrotext
+`
+
+writeFileSync(OUTPUT, source)
+console.log(`Wrote ${entities.length} entities to ${OUTPUT}`)
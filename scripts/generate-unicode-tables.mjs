@@ -0,0 +1,278 @@
+// Generates the Unicode property tables of the native text engine, each a
+// two-stage lookup over every codepoint:
+//
+// - cpp/NitroTextLineBreakTables.cpp: line breaking classes (UAX #14)
+// - cpp/NitroTextGraphemeTables.cpp: grapheme cluster break classes (UAX #29)
+//
+//   node scripts/generate-unicode-tables.mjs [ucd-directory]
+//
+// Reads LineBreak.txt, EastAsianWidth.txt,
+// extracted/DerivedGeneralCategory.txt, auxiliary/GraphemeBreakProperty.txt
+// and emoji/emoji-data.txt from the given copy of the Unicode Character
+// Database, or downloads them. The line breaking classes are stored resolved
+// by rule LB1, so the C++ never sees AI, SG, XX, SA or CJ.
+
+import { readFileSync, writeFileSync } from 'node:fs'
+import { dirname, join } from 'node:path'
+import { fileURLToPath } from 'node:url'
+
+const UNICODE_VERSION = '15.0.0'
+const UCD_URL = `https://www.unicode.org/Public/${UNICODE_VERSION}/ucd`
+const CPP = join(dirname(fileURLToPath(import.meta.url)), '..', 'cpp')
+
+const CODEPOINT_COUNT = 0x110000
+
+// Must match the order of `LineBreakClass` in cpp/NitroTextLineBreak.hpp.
+const LINE_BREAK_CLASSES = [
+   'BK', 'CR', 'LF', 'CM', 'NL', 'WJ', 'ZW', 'GL', 'SP', 'ZWJ',
+   'B2', 'BA', 'BB', 'HY', 'CB', 'CL', 'CP', 'EX', 'IN', 'NS',
+   'OP', 'QU', 'IS', 'NU', 'PO', 'PR', 'SY', 'AL', 'EB', 'EM',
+   'H2', 'H3', 'HL', 'ID', 'JL', 'JV', 'JT', 'RI',
+]
+
+// Must match the order of `GraphemeBreakClass` in cpp/NitroTextGrapheme.hpp.
+// Extended_Pictographic is a class of its own: no codepoint has both it and
+// a Grapheme_Cluster_Break value.
+const GRAPHEME_BREAK_CLASSES = [
+   'Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator',
+   'Prepend', 'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT',
+   'Extended_Pictographic',
+]
+
+// Must match the flags in cpp/NitroTextLineBreak.hpp.
+const EAST_ASIAN_WIDE = 0x40
+const PICTOGRAPHIC_RESERVED = 0x80
+
+async function readUcdFile(name) {
+   const directory = process.argv[2]
+   if (directory) return readFileSync(join(directory, name), 'utf8')
+   const response = await fetch(`${UCD_URL}/${name}`)
+   if (!response.ok) throw new Error(`Cannot download ${name}`)
+   return response.text()
+}
+
+// Parses `XXXX..YYYY ; Value # comment` lines into an array indexed by
+// codepoint. `@missing` lines set the defaults before the explicit ranges.
+async function readProperty(name, fallback, select = (fields) => fields[1]) {
+   const values = new Array(CODEPOINT_COUNT).fill(fallback)
+   const defaults = []
+   const ranges = []
+   for (const line of (await readUcdFile(name)).split('\n')) {
+      const missing = line.match(/^#\s*@missing:\s*(.*)$/)
+      const data = missing ? missing[1] : line.replace(/#.*/, '')
+      if (!data.trim()) continue
+      const fields = data.split(';').map((field) => field.trim())
+      const value = select(fields)
+      if (value === undefined) continue
+      const [first, last = first] = fields[0].split('..')
+      const range = [parseInt(first, 16), parseInt(last, 16), value]
+      if (missing) defaults.push(range)
+      else ranges.push(range)
+   }
+   for (const [first, last, value] of [...defaults, ...ranges]) {
+      values.fill(value, first, last + 1)
+   }
+   return values
+}
+
+// LB1, plus the East Asian Width of OP and CP (LB30) and the unassigned
+// Extended_Pictographic codepoints (LB30b) as flag bits.
+function resolveLineBreak(lineBreak, eastAsianWidth, category, pictographic) {
+   const values = new Uint8Array(CODEPOINT_COUNT)
+   for (let codepoint = 0; codepoint < CODEPOINT_COUNT; codepoint++) {
+      let name = lineBreak[codepoint]
+      if (name === 'AI' || name === 'SG' || name === 'XX') name = 'AL'
+      else if (name === 'SA') {
+         name = ['Mn', 'Mc'].includes(category[codepoint]) ? 'CM' : 'AL'
+      } else if (name === 'CJ') name = 'NS'
+      const value = LINE_BREAK_CLASSES.indexOf(name)
+      if (value < 0) throw new Error(`Unknown line break class ${name}`)
+      let flags = 0
+      if (
+         (name === 'OP' || name === 'CP') &&
+         ['F', 'W', 'H'].includes(eastAsianWidth[codepoint])
+      ) {
+         flags |= EAST_ASIAN_WIDE
+      }
+      if (pictographic[codepoint] && category[codepoint] === 'Cn') {
+         flags |= PICTOGRAPHIC_RESERVED
+      }
+      values[codepoint] = value | flags
+   }
+   return values
+}
+
+function resolveGraphemeBreak(graphemeBreak, pictographic) {
+   const values = new Uint8Array(CODEPOINT_COUNT)
+   for (let codepoint = 0; codepoint < CODEPOINT_COUNT; codepoint++) {
+      let name = graphemeBreak[codepoint]
+      if (pictographic[codepoint]) {
+         if (name !== 'Other') {
+            const at = codepoint.toString(16).toUpperCase()
+            throw new Error(`U+${at} is ${name} and Extended_Pictographic`)
+         }
+         name = 'Extended_Pictographic'
+      }
+      const value = GRAPHEME_BREAK_CLASSES.indexOf(name)
+      if (value < 0) throw new Error(`Unknown grapheme break class ${name}`)
+      values[codepoint] = value
+   }
+   return values
+}
+
+// Splits `values` into blocks of `1 << shift` codepoints and shares the
+// identical ones. Everything from `limit` on has the value `fallback`.
+function buildTwoStage(values, shift) {
+   const fallback = values[CODEPOINT_COUNT - 1]
+   let limit = CODEPOINT_COUNT
+   while (limit > 0 && values[limit - 1] === fallback) limit--
+   const blockSize = 1 << shift
+   limit = Math.ceil(limit / blockSize) * blockSize
+
+   const blocks = []
+   const blockIndex = new Map()
+   const index = []
+   for (let start = 0; start < limit; start += blockSize) {
+      const block = values.subarray(start, start + blockSize)
+      const key = block.join(',')
+      if (!blockIndex.has(key)) {
+         blockIndex.set(key, blocks.length)
+         blocks.push(block)
+      }
+      index.push(blockIndex.get(key))
+   }
+   const indexBytes = blocks.length <= 0x100 ? 1 : 2
+   return {
+      shift,
+      limit,
+      fallback,
+      index,
+      indexBytes,
+      data: blocks.flatMap((block) => [...block]),
+      size: index.length * indexBytes + blocks.length * blockSize,
+   }
+}
+
+// The smallest split over the usual block sizes.
+function smallestTwoStage(values) {
+   return [5, 6, 7, 8, 9]
+      .map((shift) => buildTwoStage(values, shift))
+      .reduce((best, table) => (table.size < best.size ? table : best))
+}
+
+function numberRows(values, perRow) {
+   const rows = []
+   for (let i = 0; i < values.length; i += perRow) {
+      rows.push('    ' + values.slice(i, i + perRow).join(', ') + ',')
+   }
+   return rows.join('\n')
+}
+
+function hex(value) {
+   return `0x${value.toString(16).toUpperCase()}`
+}
+
+// The source of `file`: `signature` looks codepoints up in `table`, and
+// `convert` turns the stored byte into its return value.
+function tableSource({
+   file,
+   title,
+   header,
+   asserts,
+   table,
+   signature,
+   convert,
+}) {
+   const indexType = table.indexBytes === 1 ? 'uint8_t' : 'uint16_t'
+   return `//
+// ${file}
+// ${title}, Unicode ${UNICODE_VERSION}
+//
+// Generated by scripts/generate-unicode-tables.mjs from the Unicode
+// Character Database; do not edit by hand.
+//
+
+#include "${header}"
+
+#include <array>
+#include <cstdint>
+
+namespace margelo::nitro::nitrotext {
+
+namespace {
+
+${asserts}
+
+constexpr unsigned kBlockShift = ${table.shift};
+constexpr char32_t kLimit = ${hex(table.limit)};
+// The value of every codepoint from kLimit on.
+constexpr uint8_t kFallback = ${table.fallback};
+
+// Block of kBlockData per ${1 << table.shift} codepoints below kLimit.
+constexpr std::array<${indexType}, ${table.index.length}> kBlockIndex = {{
+${numberRows(table.index, 16)}
+}};
+
+// The distinct blocks, back to back.
+constexpr std::array<uint8_t, ${table.data.length}> kBlockData = {{
+${numberRows(table.data, 16)}
+}};
+
+} // namespace
+
+${signature}
+{
+  if (codepoint >= kLimit) {
+    return ${convert('kFallback')};
+  }
+  const size_t block = kBlockIndex[codepoint >> kBlockShift];
+  return ${convert('kBlockData[(block << kBlockShift) | (codepoint & ((1u << kBlockShift) - 1))]')};
+}
+
+} // namespace margelo::nitro::nitrotext
+`
+}
+
+function writeTable(description, options) {
+   const output = join(CPP, options.file)
+   writeFileSync(output, tableSource(options))
+   console.log(
+      `Wrote ${options.table.size} bytes of ${description} tables to ${output}`
+   )
+}
+
+const [lineBreak, eastAsianWidth, category, graphemeBreak, pictographic] =
+   await Promise.all([
+      readProperty('LineBreak.txt', 'XX'),
+      readProperty('EastAsianWidth.txt', 'N'),
+      readProperty('extracted/DerivedGeneralCategory.txt', 'Cn'),
+      readProperty('auxiliary/GraphemeBreakProperty.txt', 'Other'),
+      readProperty('emoji/emoji-data.txt', false, (fields) =>
+         fields[1] === 'Extended_Pictographic' ? true : undefined
+      ),
+   ])
+
+writeTable('line break', {
+   file: 'NitroTextLineBreakTables.cpp',
+   title: 'Line breaking classes of every codepoint',
+   header: 'NitroTextLineBreak.hpp',
+   asserts: `static_assert(static_cast<int>(LineBreakClass::RI) == ${LINE_BREAK_CLASSES.indexOf('RI')}, "regenerate NitroTextLineBreakTables.cpp");
+static_assert(kLineBreakEastAsianWide == ${hex(EAST_ASIAN_WIDE)} && kLineBreakPictographicReserved == ${hex(PICTOGRAPHIC_RESERVED)},
+              "regenerate NitroTextLineBreakTables.cpp");`,
+   table: smallestTwoStage(
+      resolveLineBreak(lineBreak, eastAsianWidth, category, pictographic)
+   ),
+   signature: 'uint8_t lineBreakProperty(char32_t codepoint) noexcept',
+   convert: (value) => value,
+})
+
+writeTable('grapheme break', {
+   file: 'NitroTextGraphemeTables.cpp',
+   title: 'Grapheme cluster break classes of every codepoint',
+   header: 'NitroTextGrapheme.hpp',
+   asserts: `static_assert(static_cast<int>(GraphemeBreakClass::ExtendedPictographic) == ${GRAPHEME_BREAK_CLASSES.indexOf('Extended_Pictographic')},
+              "regenerate NitroTextGraphemeTables.cpp");`,
+   table: smallestTwoStage(resolveGraphemeBreak(graphemeBreak, pictographic)),
+   signature: 'GraphemeBreakClass graphemeBreakClass(char32_t codepoint) noexcept',
+   convert: (value) => `static_cast<GraphemeBreakClass>(${value})`,
+})
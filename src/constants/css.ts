@@ -17,3 +17,28 @@ export const FRAGMENT_STYLE_KEYS: (keyof Fragment)[] = [
    'textDecorationStyle',
    'linkUrl',
 ]
+
+// RN style keys that share a name with a NitroText prop. They are resolved
+// natively from `textStyle`; in `style` they are cleared (see
+// CLEARED_TEXT_STYLE), so a raw `fontWeight: '700'` is never sent as the
+// `fontWeight` prop.
+export const NATIVE_TEXT_STYLE_KEYS = [
+   'fontSize',
+   'fontWeight',
+   'fontStyle',
+   'fontFamily',
+   'lineHeight',
+   'letterSpacing',
+   'textAlign',
+   'textTransform',
+   'textDecorationLine',
+   'textDecorationColor',
+   'textDecorationStyle',
+] as const
+
+// Appended to the host component's `style`: RN flattens style arrays into
+// the props payload with later entries winning, so these nulls replace any
+// text key the user's style sets, without flattening it in JS.
+export const CLEARED_TEXT_STYLE = Object.freeze(
+   Object.fromEntries(NATIVE_TEXT_STYLE_KEYS.map((key) => [key, null]))
+)
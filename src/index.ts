@@ -1,2 +1,4 @@
 export * from './nitro-text'
 export * from './types'
+export { renderHtml, renderHtmlBatch } from './render-html'
+export type { RenderResult } from './renderers/types'
@@ -14,12 +14,9 @@ import {
 } from 'react-native-nitro-modules'
 import NitroTextConfig from '../nitrogen/generated/shared/json/NitroTextConfig.json'
 import type { NitroTextMethods, NitroTextProps } from './specs/nitro-text.nitro'
-import {
-   flattenChildrenToFragments,
-   getStyleProps,
-   styleToFragment,
-} from './utils'
+import { flattenChildrenToSpans, styleToFragment } from './utils'
 import { renderStringChildren } from './renderers'
+import { CLEARED_TEXT_STYLE } from './constants'
 
 export type NitroTextRef = HybridRef<NitroTextProps, NitroTextMethods>
 
@@ -37,6 +34,7 @@ type NitroTextPropsWithEvents = Pick<
    | 'menus'
    | 'renderer'
    | 'maxFontSizeMultiplier'
+   | 'hybridRef'
 > &
    Omit<TextProps, 'onTextLayout'>
 
@@ -67,24 +65,29 @@ export const NitroText = (props: NitroTextPropsWithEvents) => {
    const isStringChildren = typeof children === 'string'
    const isSimpleText = isStringChildren || typeof children === 'number'
 
+   // HTML markup is sent as `text` and rendered natively
+   // (cpp/NitroTextHtmlRenderer), off the JS thread.
+   const isNativeHtml = renderer === 'html' && isStringChildren
+
+   // Only the JS renderers need the flattened style; everything else sends
+   // the raw `style` as `textStyle` and lets native flatten it.
    const topStyles = useMemo(() => {
-      if (!style) return {}
+      if (!style || !renderer || renderer === 'html') return {}
       return styleToFragment(style)
-   }, [style])
+   }, [style, renderer])
 
    const parsedFragments = useMemo(() => {
-      if (!renderer || !isStringChildren) return undefined
+      if (!renderer || renderer === 'html' || !isStringChildren) return undefined
       const result = renderStringChildren(children, renderer, topStyles)
       return result.fragments
    }, [renderer, children, isStringChildren, topStyles])
 
-   const fragments = useMemo(() => {
-      if (parsedFragments !== undefined) return parsedFragments
-      if (isSimpleText) return []
-      return flattenChildrenToFragments(children, style)
-   }, [parsedFragments, children, style, isSimpleText])
-
-   const styleProps = useMemo(() => getStyleProps(topStyles), [topStyles])
+   // Nested children go to native as a span tree; the root style reaches
+   // every span through the top-level props.
+   const spanTree = useMemo(() => {
+      if (parsedFragments !== undefined || isSimpleText) return undefined
+      return flattenChildrenToSpans(children)
+   }, [parsedFragments, children, isSimpleText])
 
    const onRNTextLayout = useCallback(
       (e: TextLayoutEvent) => {
@@ -103,14 +106,15 @@ export const NitroText = (props: NitroTextPropsWithEvents) => {
          onPress: callback(onPress) || undefined,
          onPressIn: callback(onPressIn) || undefined,
          onPressOut: callback(onPressOut) || undefined,
-         style,
-         ...styleProps,
+         // Text keys reach native through `textStyle` only.
+         style: [style, CLEARED_TEXT_STYLE] as TextProps['style'],
+         textStyle: style as NitroTextProps['textStyle'],
          onTextLayout: callback(onTextLayout) || undefined,
       }
       // eslint-disable-next-line react-hooks/exhaustive-deps
    }, [
       rest,
-      styleProps,
+      style,
       selectable,
       maxFontSizeMultiplier,
       parsedFragments,
@@ -139,6 +143,10 @@ export const NitroText = (props: NitroTextPropsWithEvents) => {
       )
    }
 
+   if (isNativeHtml) {
+      return <NitroTextView {...textProps} renderer={renderer} text={children} />
+   }
+
    if (renderer && isStringChildren) {
       return <NitroTextView {...textProps} />
    }
@@ -147,7 +155,13 @@ export const NitroText = (props: NitroTextPropsWithEvents) => {
       return <NitroTextView {...textProps} text={String(children)} />
    }
 
-   return <NitroTextView {...textProps} fragments={fragments} />
+   return (
+      <NitroTextView
+         {...textProps}
+         spans={spanTree?.spans}
+         spanParents={spanTree?.parents}
+      />
+   )
 }
 
 NitroText.displayName = 'NitroText'
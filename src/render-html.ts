@@ -0,0 +1,41 @@
+import type { StyleProp, TextStyle } from 'react-native'
+import { NitroModules } from 'react-native-nitro-modules'
+import type { NitroTextRenderer } from './specs/nitro-text-renderer.nitro'
+import type { RenderResult } from './renderers/types'
+import { styleToFragment } from './utils'
+
+let renderer: NitroTextRenderer | undefined
+
+function getRenderer(): NitroTextRenderer {
+   if (!renderer) {
+      renderer =
+         NitroModules.createHybridObject<NitroTextRenderer>('NitroTextRenderer')
+   }
+   return renderer
+}
+
+/**
+ * Renders HTML markup to fragments on a native background thread.
+ *
+ * The result is cached natively, so rendering the rows of a list ahead of
+ * time makes a later `<NitroText renderer="html" style={style}>` with the
+ * same markup mount without parsing it again.
+ */
+export function renderHtml(
+   html: string,
+   style?: StyleProp<TextStyle>
+): Promise<RenderResult> {
+   return getRenderer().renderHtml(html, styleToFragment(style))
+}
+
+/**
+ * Renders many documents at once, e.g. the message bodies of a mail sync,
+ * spread over one native worker thread per core. The results come back in
+ * the order of `htmls` and are cached like `renderHtml`'s.
+ */
+export function renderHtmlBatch(
+   htmls: string[],
+   style?: StyleProp<TextStyle>
+): Promise<RenderResult[]> {
+   return getRenderer().renderHtmlBatch(htmls, styleToFragment(style))
+}
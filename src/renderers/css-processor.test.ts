@@ -1,19 +1,18 @@
 import { CSSProcessor } from './css-processor'
+import { CSS_FIXTURES as css } from './test-fixtures'
 import type { ElementNode, Stylesheet } from './types'
 
 describe('CSSProcessor', () => {
    describe('buildStylesheet', () => {
       it('should build an empty stylesheet from empty blocks', () => {
-         const sheet = CSSProcessor.buildStylesheet([])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.empty)
          expect(sheet.tag.size).toBe(0)
          expect(sheet.className.size).toBe(0)
          expect(sheet.id.size).toBe(0)
       })
 
       it('should parse tag selectors', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            'p { color: red; font-size: 16px; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.tag)
          const pStyles = sheet.tag.get('p')
          expect(pStyles).toBeDefined()
          expect(pStyles?.[0]).toEqual({
@@ -23,27 +22,21 @@ describe('CSSProcessor', () => {
       })
 
       it('should parse class selectors', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            '.my-class { color: blue; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.className)
          const classStyles = sheet.className.get('my-class')
          expect(classStyles).toBeDefined()
          expect(classStyles?.[0]).toEqual({ color: 'blue' })
       })
 
       it('should parse ID selectors', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            '#my-id { color: green; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.id)
          const idStyles = sheet.id.get('my-id')
          expect(idStyles).toBeDefined()
          expect(idStyles?.[0]).toEqual({ color: 'green' })
       })
 
       it('should parse universal selector (*)', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            '* { color: blue; font-size: 14px; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.universal)
          const universalStyles = sheet.tag.get('*')
          expect(universalStyles).toBeDefined()
          expect(universalStyles?.[0]).toEqual({
@@ -53,36 +46,33 @@ describe('CSSProcessor', () => {
       })
 
       it('should handle multiple selectors (comma-separated)', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            'h1, h2, h3 { font-weight: bold; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(
+            css.stylesheets.selectorList
+         )
          expect(sheet.tag.get('h1')?.[0]).toEqual({ 'font-weight': 'bold' })
          expect(sheet.tag.get('h2')?.[0]).toEqual({ 'font-weight': 'bold' })
          expect(sheet.tag.get('h3')?.[0]).toEqual({ 'font-weight': 'bold' })
       })
 
       it('should handle universal selector in comma-separated selectors', () => {
-         const sheet = CSSProcessor.buildStylesheet(['*, p { color: red; }'])
+         const sheet = CSSProcessor.buildStylesheet(
+            css.stylesheets.universalInList
+         )
          expect(sheet.tag.get('*')?.[0]).toEqual({ color: 'red' })
          expect(sheet.tag.get('p')?.[0]).toEqual({ color: 'red' })
       })
 
       it('should handle multiple CSS blocks', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            'p { color: red; }',
-            '.class { color: blue; }',
-            '#id { color: green; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.blocks)
          expect(sheet.tag.get('p')?.[0]).toEqual({ color: 'red' })
          expect(sheet.className.get('class')?.[0]).toEqual({ color: 'blue' })
          expect(sheet.id.get('id')?.[0]).toEqual({ color: 'green' })
       })
 
       it('should merge multiple rules for the same selector', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            'p { color: red; }',
-            'p { font-size: 16px; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(
+            css.stylesheets.sameSelector
+         )
          const pStyles = sheet.tag.get('p')
          expect(pStyles).toBeDefined()
          expect(pStyles?.length).toBe(2)
@@ -91,52 +81,43 @@ describe('CSSProcessor', () => {
       })
 
       it('should remove CSS comments', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            '/* This is a comment */ p { color: red; }',
-            '.class { /* inline comment */ color: blue; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.comments)
          expect(sheet.tag.get('p')?.[0]).toEqual({ color: 'red' })
          expect(sheet.className.get('class')?.[0]).toEqual({ color: 'blue' })
       })
 
       it('should handle multi-line comments', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            '/*\n * Multi-line\n * comment\n */ p { color: red; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(
+            css.stylesheets.multiLineComment
+         )
          expect(sheet.tag.get('p')?.[0]).toEqual({ color: 'red' })
       })
 
       it('should ignore @ rules', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            '@media screen { p { color: red; } }',
-            '@keyframes fade { from { opacity: 0; } }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.atRules)
          expect(sheet.tag.size).toBe(0)
          expect(sheet.className.size).toBe(0)
          expect(sheet.id.size).toBe(0)
       })
 
       it('should handle empty declarations', () => {
-         const sheet = CSSProcessor.buildStylesheet(['p { }'])
+         const sheet = CSSProcessor.buildStylesheet(css.stylesheets.emptyRule)
          expect(sheet.tag.size).toBe(0)
       })
 
       it('should handle whitespace in selectors', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            '  p  { color: red; }',
-            '  .class  { color: blue; }',
-            '  #id  { color: green; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(
+            css.stylesheets.paddedSelectors
+         )
          expect(sheet.tag.get('p')?.[0]).toEqual({ color: 'red' })
          expect(sheet.className.get('class')?.[0]).toEqual({ color: 'blue' })
          expect(sheet.id.get('id')?.[0]).toEqual({ color: 'green' })
       })
 
       it('should handle nested braces correctly', () => {
-         const sheet = CSSProcessor.buildStylesheet([
-            'div { color: red; }',
-            'span { color: blue; }',
-         ])
+         const sheet = CSSProcessor.buildStylesheet(
+            css.stylesheets.siblingRules
+         )
          expect(sheet.tag.get('div')?.[0]).toEqual({ color: 'red' })
          expect(sheet.tag.get('span')?.[0]).toEqual({ color: 'blue' })
       })
@@ -145,7 +126,7 @@ describe('CSSProcessor', () => {
    describe('parseCssDeclarations', () => {
       it('should parse simple declarations', () => {
          const decls = CSSProcessor.parseCssDeclarations(
-            'color: red; font-size: 16px;'
+            css.declarations.simple
          )
          expect(decls).toEqual({
             'color': 'red',
@@ -154,13 +135,15 @@ describe('CSSProcessor', () => {
       })
 
       it('should handle declarations without semicolon at end', () => {
-         const decls = CSSProcessor.parseCssDeclarations('color: red')
+         const decls = CSSProcessor.parseCssDeclarations(
+            css.declarations.unterminated
+         )
          expect(decls).toEqual({ color: 'red' })
       })
 
       it('should normalize property names to lowercase', () => {
          const decls = CSSProcessor.parseCssDeclarations(
-            'Color: red; Font-Size: 16px;'
+            css.declarations.uppercase
          )
          expect(decls).toEqual({
             'color': 'red',
@@ -170,7 +153,7 @@ describe('CSSProcessor', () => {
 
       it('should handle whitespace', () => {
          const decls = CSSProcessor.parseCssDeclarations(
-            '  color  :  red  ;  font-size  :  16px  ;  '
+            css.declarations.padded
          )
          expect(decls).toEqual({
             'color': 'red',
@@ -179,13 +162,13 @@ describe('CSSProcessor', () => {
       })
 
       it('should handle empty input', () => {
-         const decls = CSSProcessor.parseCssDeclarations('')
+         const decls = CSSProcessor.parseCssDeclarations(css.declarations.empty)
          expect(decls).toEqual({})
       })
 
       it('should handle multiple semicolons', () => {
          const decls = CSSProcessor.parseCssDeclarations(
-            'color: red;; font-size: 16px;'
+            css.declarations.doubleSemicolon
          )
          expect(decls).toEqual({
             'color': 'red',
@@ -195,7 +178,7 @@ describe('CSSProcessor', () => {
 
       it('should skip invalid declarations', () => {
          const decls = CSSProcessor.parseCssDeclarations(
-            'color: red; invalid; font-size: 16px;'
+            css.declarations.invalid
          )
          expect(decls).toEqual({
             'color': 'red',
@@ -205,7 +188,7 @@ describe('CSSProcessor', () => {
 
       it('should preserve value whitespace', () => {
          const decls = CSSProcessor.parseCssDeclarations(
-            'font-family: Arial, sans-serif;'
+            css.declarations.fontList
          )
          expect(decls).toEqual({
             'font-family': 'Arial, sans-serif',
@@ -217,20 +200,11 @@ describe('CSSProcessor', () => {
       let sheet: Stylesheet
 
       beforeEach(() => {
-         sheet = CSSProcessor.buildStylesheet([
-            'p { color: red; font-size: 16px; }',
-            '.highlight { background-color: yellow; }',
-            '#title { font-weight: bold; }',
-         ])
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.page)
       })
 
       it('should apply tag styles', () => {
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'p',
-            attrs: {},
-            children: [],
-         }
+         const node = css.elements.paragraph
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.fragment).toEqual({
             fontColor: 'red',
@@ -241,12 +215,7 @@ describe('CSSProcessor', () => {
       })
 
       it('should apply class styles', () => {
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'span',
-            attrs: { class: 'highlight' },
-            children: [],
-         }
+         const node = css.elements.highlighted
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.fragment).toEqual({
             fragmentBackgroundColor: 'yellow',
@@ -254,12 +223,7 @@ describe('CSSProcessor', () => {
       })
 
       it('should apply ID styles', () => {
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'h1',
-            attrs: { id: 'title' },
-            children: [],
-         }
+         const node = css.elements.title
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.fragment).toEqual({
             fontWeight: 'bold',
@@ -267,16 +231,8 @@ describe('CSSProcessor', () => {
       })
 
       it('should apply multiple class styles', () => {
-         sheet = CSSProcessor.buildStylesheet([
-            '.class1 { color: red; }',
-            '.class2 { font-size: 20px; }',
-         ])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'div',
-            attrs: { class: 'class1 class2' },
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.twoClasses)
+         const node = css.elements.twoClasses
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.fragment).toEqual({
             fontColor: 'red',
@@ -285,12 +241,7 @@ describe('CSSProcessor', () => {
       })
 
       it('should handle classname attribute', () => {
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'span',
-            attrs: { classname: 'highlight' },
-            children: [],
-         }
+         const node = css.elements.classname
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.fragment).toEqual({
             fragmentBackgroundColor: 'yellow',
@@ -298,17 +249,8 @@ describe('CSSProcessor', () => {
       })
 
       it('should combine tag, class, and ID styles', () => {
-         sheet = CSSProcessor.buildStylesheet([
-            'div { color: blue; }',
-            '.container { font-size: 18px; }',
-            '#main { font-weight: bold; }',
-         ])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'div',
-            attrs: { class: 'container', id: 'main' },
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.tagClassId)
+         const node = css.elements.container
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.fragment).toEqual({
             fontColor: 'blue',
@@ -318,61 +260,36 @@ describe('CSSProcessor', () => {
       })
 
       it('should handle display: none', () => {
-         sheet = CSSProcessor.buildStylesheet(['.hidden { display: none; }'])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'div',
-            attrs: { class: 'hidden' },
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.hidden)
+         const node = css.elements.hidden
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.hidden).toBe(true)
          expect(result.fragment).toBeUndefined()
       })
 
       it('should handle zero margin', () => {
-         sheet = CSSProcessor.buildStylesheet(['p { margin: 0; }'])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'p',
-            attrs: {},
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.zeroMargin)
+         const node = css.elements.paragraph
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.suppressNewlines).toBe(true)
       })
 
       it('should handle margin-top: 0', () => {
-         sheet = CSSProcessor.buildStylesheet(['p { margin-top: 0; }'])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'p',
-            attrs: {},
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.zeroMarginTop)
+         const node = css.elements.paragraph
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.suppressNewlines).toBe(true)
       })
 
       it('should handle margin-bottom: 0', () => {
-         sheet = CSSProcessor.buildStylesheet(['p { margin-bottom: 0; }'])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'p',
-            attrs: {},
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.zeroMarginBottom)
+         const node = css.elements.paragraph
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.suppressNewlines).toBe(true)
       })
 
       it('should return empty result when no styles match', () => {
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'span',
-            attrs: {},
-            children: [],
-         }
+         const node = css.elements.span
          const emptySheet: Stylesheet = {
             tag: new Map(),
             className: new Map(),
@@ -385,51 +302,32 @@ describe('CSSProcessor', () => {
       })
 
       it('should apply universal selector styles to all elements', () => {
-         sheet = CSSProcessor.buildStylesheet(['* { color: gray; }'])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'div',
-            attrs: {},
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.universalGray)
+         const node = css.elements.div
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          expect(result.fragment).toEqual({ fontColor: 'gray' })
       })
 
       it('should apply universal selector before tag-specific styles', () => {
-         sheet = CSSProcessor.buildStylesheet([
-            '* { color: gray; }',
-            'p { color: red; }',
-         ])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'p',
-            attrs: {},
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.universalThenTag)
+         const node = css.elements.paragraph
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          // Tag-specific style should override universal selector
          expect(result.fragment).toEqual({ fontColor: 'red' })
       })
 
       it('should apply universal selector before class styles', () => {
-         sheet = CSSProcessor.buildStylesheet([
-            '* { font-size: 12px; }',
-            '.highlight { font-size: 18px; }',
-         ])
-         const node: ElementNode = {
-            type: 'element',
-            tag: 'span',
-            attrs: { class: 'highlight' },
-            children: [],
-         }
+         sheet = CSSProcessor.buildStylesheet(
+            css.stylesheets.universalThenClass
+         )
+         const node = css.elements.highlighted
          const result = CSSProcessor.applyStylesFromSheet(node, sheet)
          // Class style should override universal selector
          expect(result.fragment).toEqual({ fontSize: 18 })
       })
 
       it('should apply universal selector to elements with any tag', () => {
-         sheet = CSSProcessor.buildStylesheet(['* { font-weight: bold; }'])
+         sheet = CSSProcessor.buildStylesheet(css.stylesheets.universalBold)
          const tags = ['div', 'span', 'p', 'h1', 'a']
          for (const tag of tags) {
             const node: ElementNode = {
@@ -446,9 +344,7 @@ describe('CSSProcessor', () => {
 
    describe('applyInlineStyles', () => {
       it('should parse and apply inline styles', () => {
-         const result = CSSProcessor.applyInlineStyles(
-            'color: red; font-size: 16px;'
-         )
+         const result = CSSProcessor.applyInlineStyles(css.declarations.simple)
          expect(result.fragment).toEqual({
             fontColor: 'red',
             fontSize: 16,
@@ -465,15 +361,15 @@ describe('CSSProcessor', () => {
       })
 
       it('should handle display: none', () => {
-         const result = CSSProcessor.applyInlineStyles(
-            'display: none; color: red;'
-         )
+         const result = CSSProcessor.applyInlineStyles(css.declarations.hidden)
          expect(result.hidden).toBe(true)
          expect(result.fragment).toBeUndefined()
       })
 
       it('should handle zero margin', () => {
-         const result = CSSProcessor.applyInlineStyles('margin: 0; color: red;')
+         const result = CSSProcessor.applyInlineStyles(
+            css.declarations.zeroMargin
+         )
          expect(result.suppressNewlines).toBe(true)
          expect(result.fragment).toEqual({
             fontColor: 'red',
@@ -481,177 +377,181 @@ describe('CSSProcessor', () => {
       })
 
       it('should handle margin-top: 0', () => {
-         const result = CSSProcessor.applyInlineStyles('margin-top: 0;')
+         const result = CSSProcessor.applyInlineStyles(
+            css.declarations.zeroMarginTop
+         )
          expect(result.suppressNewlines).toBe(true)
       })
 
       it('should handle margin-bottom: 0', () => {
-         const result = CSSProcessor.applyInlineStyles('margin-bottom: 0;')
+         const result = CSSProcessor.applyInlineStyles(
+            css.declarations.zeroMarginBottom
+         )
          expect(result.suppressNewlines).toBe(true)
       })
    })
 
    describe('cssDeclarationsToFragment', () => {
       it('should convert color to fontColor', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            color: 'red',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.color
+         )
          expect(fragment).toEqual({ fontColor: 'red' })
       })
 
       it('should convert background-color to fragmentBackgroundColor', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'background-color': 'yellow',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.backgroundColor
+         )
          expect(fragment).toEqual({ fragmentBackgroundColor: 'yellow' })
       })
 
       it('should convert background to fragmentBackgroundColor', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            background: 'blue',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.background
+         )
          expect(fragment).toEqual({ fragmentBackgroundColor: 'blue' })
       })
 
       it('should convert font-size to fontSize', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-size': '16px',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.fontSize
+         )
          expect(fragment).toEqual({ fontSize: 16 })
       })
 
       it('should handle font-size with different units', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-size': '1.5em',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.fontSizeEm
+         )
          expect(fragment).toEqual({ fontSize: 1.5 })
       })
 
       it('should convert line-height to lineHeight', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'line-height': '1.5',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.lineHeight
+         )
          expect(fragment).toEqual({ lineHeight: 1.5 })
       })
 
       it('should convert letter-spacing to letterSpacing', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'letter-spacing': '2px',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.letterSpacing
+         )
          expect(fragment).toEqual({ letterSpacing: 2 })
       })
 
       it('should convert font-weight to fontWeight', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-weight': 'bold',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.fontWeight
+         )
          expect(fragment).toEqual({ fontWeight: 'bold' })
       })
 
       it('should normalize numeric font-weight', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-weight': '700',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.numericFontWeight
+         )
          expect(fragment).toEqual({ fontWeight: 'bold' })
       })
 
       it('should convert font-style to fontStyle', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-style': 'italic',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.italic
+         )
          expect(fragment).toEqual({ fontStyle: 'italic' })
       })
 
       it('should handle font-style: normal', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-style': 'normal',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.normal
+         )
          expect(fragment).toEqual({ fontStyle: 'normal' })
       })
 
       it('should handle font-style: oblique', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-style': 'oblique',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.oblique
+         )
          expect(fragment).toEqual({ fontStyle: 'oblique' })
       })
 
       it('should convert font-family to fontFamily', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-family': 'Arial, sans-serif',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.fontFamily
+         )
          expect(fragment).toEqual({ fontFamily: 'Arial, sans-serif' })
       })
 
       it('should strip quotes from font-family', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-family': '"Arial", sans-serif',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.quotedFontFamily
+         )
          expect(fragment).toEqual({ fontFamily: 'Arial, sans-serif' })
       })
 
       it('should convert text-align to textAlign', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'text-align': 'center',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.textAlign
+         )
          expect(fragment).toEqual({ textAlign: 'center' })
       })
 
       it('should convert text-transform to textTransform', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'text-transform': 'uppercase',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.textTransform
+         )
          expect(fragment).toEqual({ textTransform: 'uppercase' })
       })
 
       it('should convert text-decoration-line to textDecorationLine', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'text-decoration-line': 'underline',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.textDecorationLine
+         )
          expect(fragment).toEqual({ textDecorationLine: 'underline' })
       })
 
       it('should convert text-decoration to textDecorationLine', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'text-decoration': 'underline',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.textDecoration
+         )
          expect(fragment).toEqual({ textDecorationLine: 'underline' })
       })
 
       it('should handle multiple text decorations', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'text-decoration': 'underline line-through',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.textDecorations
+         )
          expect(fragment).toEqual({
             textDecorationLine: 'underline line-through',
          })
       })
 
       it('should filter unsupported text decorations', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'text-decoration': 'overline',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.overline
+         )
          expect(fragment.textDecorationLine).toBeUndefined()
       })
 
       it('should convert text-decoration-color to textDecorationColor', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'text-decoration-color': 'red',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.textDecorationColor
+         )
          expect(fragment).toEqual({ textDecorationColor: 'red' })
       })
 
       it('should convert text-decoration-style to textDecorationStyle', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'text-decoration-style': 'dashed',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.textDecorationStyle
+         )
          expect(fragment).toEqual({ textDecorationStyle: 'dashed' })
       })
 
       it('should parse font shorthand', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            font: 'bold italic 16px/1.5 Arial',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.font
+         )
          expect(fragment).toEqual({
             fontWeight: 'bold',
             fontStyle: 'italic',
@@ -662,9 +562,9 @@ describe('CSSProcessor', () => {
       })
 
       it('should parse font shorthand without line-height', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            font: 'bold 16px Arial',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.fontWithoutLineHeight
+         )
          expect(fragment).toEqual({
             fontWeight: 'bold',
             fontSize: 16,
@@ -673,9 +573,9 @@ describe('CSSProcessor', () => {
       })
 
       it('should parse font shorthand with quoted family', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            font: '16px "Times New Roman"',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.fontQuotedFamily
+         )
          expect(fragment).toEqual({
             fontSize: 16,
             fontFamily: 'Times New Roman',
@@ -683,12 +583,9 @@ describe('CSSProcessor', () => {
       })
 
       it('should handle multiple declarations', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'color': 'red',
-            'font-size': '16px',
-            'font-weight': 'bold',
-            'text-align': 'center',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.several
+         )
          expect(fragment).toEqual({
             fontColor: 'red',
             fontSize: 16,
@@ -698,27 +595,23 @@ describe('CSSProcessor', () => {
       })
 
       it('should ignore empty values', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'color': '',
-            'font-size': '16px',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.emptyValue
+         )
          expect(fragment).toEqual({ fontSize: 16 })
       })
 
       it('should ignore unsupported properties', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'border-width': '1px',
-            'padding': '10px',
-            'color': 'red',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.unsupported
+         )
          expect(fragment).toEqual({ fontColor: 'red' })
       })
 
       it('should handle invalid numeric values', () => {
-         const fragment = CSSProcessor.cssDeclarationsToFragment({
-            'font-size': 'invalid',
-            'line-height': 'not-a-number',
-         })
+         const fragment = CSSProcessor.cssDeclarationsToFragment(
+            css.declarationMaps.invalidNumbers
+         )
          expect(fragment.fontSize).toBeUndefined()
          expect(fragment.lineHeight).toBeUndefined()
       })
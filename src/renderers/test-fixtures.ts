@@ -0,0 +1,310 @@
+import type { Fragment } from '../types'
+import type { ElementNode } from './types'
+
+/**
+ * The inputs of html.test.ts and css-processor.test.ts. They live here so
+ * benchmarks/html-engines.test.ts can render every one of them with both
+ * the TS and the native renderer; the expectations stay in the tests.
+ */
+
+export type HtmlFixture = string | { html: string; base: Partial<Fragment> }
+
+export const HTML_FIXTURES = {
+   text: {
+      plain: 'Hello World',
+      empty: '',
+      padded: '  Hello  ',
+      spaced: 'Hello    World',
+   },
+   semantic: {
+      strong: '<strong>Bold</strong>',
+      b: '<b>Bold</b>',
+      em: '<em>Italic</em>',
+      i: '<i>Italic</i>',
+      u: '<u>Underlined</u>',
+      s: '<s>Strikethrough</s>',
+      del: '<del>Deleted</del>',
+      strike: '<strike>Strike</strike>',
+      mark: '<mark>Highlighted</mark>',
+      strongEm: '<strong><em>Bold and Italic</em></strong>',
+   },
+   headings: {
+      h1: '<h1>Heading 1</h1>',
+      h2: '<h2>Heading 2</h2>',
+      h3: '<h3>Heading 3</h3>',
+      h4: '<h4>Heading 4</h4>',
+      h5: '<h5>Heading 5</h5>',
+      h6: '<h6>Heading 6</h6>',
+   },
+   blocks: {
+      paragraphs: '<p>First</p><p>Second</p>',
+      divs: '<div>First</div><div>Second</div>',
+      nested: '<div><p>Nested</p></div>',
+      afterText: 'Text<p>Paragraph</p>',
+   },
+   inline: {
+      span: '<span>Inline</span>',
+      spans: '<span>First</span> <span>Second</span>',
+      afterBlock: '<p>Block</p><span>Inline</span>',
+   },
+   lineBreaks: {
+      br: 'Line 1<br>Line 2',
+      brs: 'Line 1<br><br>Line 2',
+      selfClosingBr: 'Line 1<br />Line 2',
+   },
+   lists: {
+      unordered: '<ul><li>Item 1</li><li>Item 2</li></ul>',
+      ordered: '<ol><li>First</li><li>Second</li></ol>',
+      nested: '<ul><li>Item 1<ul><li>Sub 1</li></ul></li></ul>',
+      mixed: '<ol><li>First<ul><li>Bullet</li></ul></li></ol>',
+      afterText: 'Text<ul><li>Item</li></ul>',
+   },
+   images: {
+      alt: '<img alt="Image description" />',
+      noAlt: '<img src="test.jpg" />',
+      afterText: 'Text<img alt="Image" />',
+      inBlock: '<p><img alt="Image" /></p>',
+   },
+   entities: {
+      tags: '&lt;div&gt;',
+      ampersand: 'Tom &amp; Jerry',
+      quotes: '&quot;Hello&quot;',
+      nbsp: 'Word&nbsp;Word',
+      numeric: '&#65; &#x41;',
+      greek: '&alpha; &beta; &gamma;',
+      symbols: '&copy; &reg; &trade;',
+   },
+   css: {
+      inline: '<span style="color: red; font-size: 20px;">Styled</span>',
+      classSelector: `
+         <style>
+            .red { color: red; }
+         </style>
+         <span class="red">Red Text</span>
+      `,
+      tagSelector: `
+         <style>
+            p { color: blue; }
+         </style>
+         <p>Blue paragraph</p>
+      `,
+      idSelector: `
+         <style>
+            #special { color: green; }
+         </style>
+         <span id="special">Special</span>
+      `,
+      inlineOverSheet: `
+         <style>
+            .text { color: blue; }
+         </style>
+         <span class="text" style="color: red;">Text</span>
+      `,
+      displayNone: '<span style="display: none;">Hidden</span>Visible',
+   },
+   baseFragment: {
+      plain: { html: 'Text', base: { fontSize: 14, fontColor: 'blue' } },
+      overridden: {
+         html: '<span style="font-size: 20px;">Text</span>',
+         base: { fontSize: 14 },
+      },
+      semantic: { html: '<strong>Bold</strong>', base: { fontColor: 'blue' } },
+   },
+   whitespace: {
+      pre: '<pre>Line 1\n  Line 2\n    Line 3</pre>',
+      spaces: 'Text   with    spaces',
+      newlines: 'Line 1\n\n\nLine 2',
+      trailingNewlines: '<p>Text</p>\n\n',
+   },
+   edgeCases: {
+      malformed: '<div><p>Unclosed',
+      doctype: '<!DOCTYPE html><html><body>Content</body></html>',
+      script: '<script>alert("test")</script>Text',
+      style: '<style>p { color: red; }</style>Text',
+      head: '<head><title>Title</title></head><body>Body</body>',
+      comment: 'Text<!-- Comment -->More',
+      cdata: 'Text<![CDATA[data]]>More',
+      emptyElement: '<p></p>',
+      voidTags: '<hr /><br /><img />',
+      selfClosing: '<div>Text<br/>More</div>',
+      mixed: `
+         <div>
+            <h1>Title</h1>
+            <p>Paragraph with <strong>bold</strong> and <em>italic</em>.</p>
+            <ul>
+               <li>Item 1</li>
+               <li>Item 2</li>
+            </ul>
+         </div>
+      `,
+   },
+   backgrounds: {
+      inline: '<span style="background-color: yellow;">Highlighted</span>',
+      block: '<div style="background-color: yellow;">Text</div>',
+      parent: '<div style="background-color: yellow;"><span>Text</span></div>',
+   },
+   structures: {
+      deeplyNested:
+         '<div><p><span><strong><em>Nested</em></strong></span></p></div>',
+      siblings: '<p><strong>Bold</strong> <em>Italic</em> Normal</p>',
+      article: `
+         <article>
+            <header>
+               <h1>Article Title</h1>
+            </header>
+            <section>
+               <p>First paragraph.</p>
+               <p>Second paragraph.</p>
+            </section>
+            <footer>Footer text</footer>
+         </article>
+      `,
+   },
+   links: {
+      href: '<a href="https://example.com">Click</a>',
+      target: '<a href="https://example.com" target="_blank">New Tab</a>',
+      styled: '<a href="#" style="color: red; font-weight: bold;">Link</a>',
+      semantic:
+         '<a href="/path"><strong>Bold</strong> and <em>Italic</em></a>',
+      noHref: '<a>No Link</a>',
+      empty: '<a href="x"></a>',
+      surrounded: 'Hello <a href="/link">there</a> friend',
+      inParagraph:
+         '<p>Visit <a href="https://google.com">Google</a> for search.</p>',
+   },
+} satisfies Record<string, Record<string, HtmlFixture>>
+
+function element(
+   tag: string,
+   attrs: Record<string, string> = {}
+): ElementNode {
+   return { type: 'element', tag, attrs, children: [] }
+}
+
+export const CSS_FIXTURES = {
+   // `<style>` blocks, for buildStylesheet and applyStylesFromSheet.
+   stylesheets: {
+      empty: [],
+      tag: ['p { color: red; font-size: 16px; }'],
+      className: ['.my-class { color: blue; }'],
+      id: ['#my-id { color: green; }'],
+      universal: ['* { color: blue; font-size: 14px; }'],
+      selectorList: ['h1, h2, h3 { font-weight: bold; }'],
+      universalInList: ['*, p { color: red; }'],
+      blocks: [
+         'p { color: red; }',
+         '.class { color: blue; }',
+         '#id { color: green; }',
+      ],
+      sameSelector: ['p { color: red; }', 'p { font-size: 16px; }'],
+      comments: [
+         '/* This is a comment */ p { color: red; }',
+         '.class { /* inline comment */ color: blue; }',
+      ],
+      multiLineComment: [
+         '/*\n * Multi-line\n * comment\n */ p { color: red; }',
+      ],
+      atRules: [
+         '@media screen { p { color: red; } }',
+         '@keyframes fade { from { opacity: 0; } }',
+      ],
+      emptyRule: ['p { }'],
+      paddedSelectors: [
+         '  p  { color: red; }',
+         '  .class  { color: blue; }',
+         '  #id  { color: green; }',
+      ],
+      siblingRules: ['div { color: red; }', 'span { color: blue; }'],
+      page: [
+         'p { color: red; font-size: 16px; }',
+         '.highlight { background-color: yellow; }',
+         '#title { font-weight: bold; }',
+      ],
+      twoClasses: ['.class1 { color: red; }', '.class2 { font-size: 20px; }'],
+      tagClassId: [
+         'div { color: blue; }',
+         '.container { font-size: 18px; }',
+         '#main { font-weight: bold; }',
+      ],
+      hidden: ['.hidden { display: none; }'],
+      zeroMargin: ['p { margin: 0; }'],
+      zeroMarginTop: ['p { margin-top: 0; }'],
+      zeroMarginBottom: ['p { margin-bottom: 0; }'],
+      universalGray: ['* { color: gray; }'],
+      universalThenTag: ['* { color: gray; }', 'p { color: red; }'],
+      universalThenClass: [
+         '* { font-size: 12px; }',
+         '.highlight { font-size: 18px; }',
+      ],
+      universalBold: ['* { font-weight: bold; }'],
+   },
+   // Elements the stylesheets are matched against.
+   elements: {
+      paragraph: element('p'),
+      highlighted: element('span', { class: 'highlight' }),
+      title: element('h1', { id: 'title' }),
+      twoClasses: element('div', { class: 'class1 class2' }),
+      classname: element('span', { classname: 'highlight' }),
+      container: element('div', { class: 'container', id: 'main' }),
+      hidden: element('div', { class: 'hidden' }),
+      span: element('span'),
+      div: element('div'),
+   },
+   // `style` attribute values, for parseCssDeclarations and applyInlineStyles.
+   declarations: {
+      simple: 'color: red; font-size: 16px;',
+      unterminated: 'color: red',
+      uppercase: 'Color: red; Font-Size: 16px;',
+      padded: '  color  :  red  ;  font-size  :  16px  ;  ',
+      empty: '',
+      doubleSemicolon: 'color: red;; font-size: 16px;',
+      invalid: 'color: red; invalid; font-size: 16px;',
+      fontList: 'font-family: Arial, sans-serif;',
+      hidden: 'display: none; color: red;',
+      zeroMargin: 'margin: 0; color: red;',
+      zeroMarginTop: 'margin-top: 0;',
+      zeroMarginBottom: 'margin-bottom: 0;',
+   },
+   // Parsed declarations, for cssDeclarationsToFragment.
+   declarationMaps: {
+      color: { color: 'red' },
+      backgroundColor: { 'background-color': 'yellow' },
+      background: { background: 'blue' },
+      fontSize: { 'font-size': '16px' },
+      fontSizeEm: { 'font-size': '1.5em' },
+      lineHeight: { 'line-height': '1.5' },
+      letterSpacing: { 'letter-spacing': '2px' },
+      fontWeight: { 'font-weight': 'bold' },
+      numericFontWeight: { 'font-weight': '700' },
+      italic: { 'font-style': 'italic' },
+      normal: { 'font-style': 'normal' },
+      oblique: { 'font-style': 'oblique' },
+      fontFamily: { 'font-family': 'Arial, sans-serif' },
+      quotedFontFamily: { 'font-family': '"Arial", sans-serif' },
+      textAlign: { 'text-align': 'center' },
+      textTransform: { 'text-transform': 'uppercase' },
+      textDecorationLine: { 'text-decoration-line': 'underline' },
+      textDecoration: { 'text-decoration': 'underline' },
+      textDecorations: { 'text-decoration': 'underline line-through' },
+      overline: { 'text-decoration': 'overline' },
+      textDecorationColor: { 'text-decoration-color': 'red' },
+      textDecorationStyle: { 'text-decoration-style': 'dashed' },
+      font: { font: 'bold italic 16px/1.5 Arial' },
+      fontWithoutLineHeight: { font: 'bold 16px Arial' },
+      fontQuotedFamily: { font: '16px "Times New Roman"' },
+      several: {
+         'color': 'red',
+         'font-size': '16px',
+         'font-weight': 'bold',
+         'text-align': 'center',
+      },
+      emptyValue: { 'color': '', 'font-size': '16px' },
+      unsupported: { 'border-width': '1px', 'padding': '10px', 'color': 'red' },
+      invalidNumbers: { 'font-size': 'invalid', 'line-height': 'not-a-number' },
+   },
+} satisfies {
+   stylesheets: Record<string, string[]>
+   elements: Record<string, ElementNode>
+   declarations: Record<string, string>
+   declarationMaps: Record<string, Record<string, string>>
+}
@@ -0,0 +1,27 @@
+import type { HybridObject } from 'react-native-nitro-modules'
+import type { RenderResult } from '../renderers/types'
+import type { Fragment } from '../types'
+
+/**
+ * Renders rich text off the JS thread.
+ */
+export interface NitroTextRenderer
+   extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
+   /**
+    * Renders HTML markup to fragments on a background thread, exactly like
+    * `<NitroText renderer="html">` does. `baseStyle` is the flat text style
+    * the markup cascades over (the component's `style`).
+    *
+    * Results are cached natively: a `<NitroText renderer="html">` mounted
+    * later with the same markup and text style reuses them without parsing.
+    */
+   renderHtml(html: string, baseStyle?: Fragment): Promise<RenderResult>
+   /**
+    * Renders many documents at once, spread over one worker thread per core.
+    * The results come back in the order of `htmls`.
+    */
+   renderHtmlBatch(
+      htmls: string[],
+      baseStyle?: Fragment
+   ): Promise<RenderResult[]>
+}
@@ -1,4 +1,5 @@
 import type {
+   AnyMap,
    HybridView,
    HybridViewMethods,
    HybridViewProps,
@@ -141,9 +142,42 @@ export interface NitroTextProps
     * Called when a press ends (touch up/cancel).
     */
    onPressOut?: () => void
+
+   /**
+    * The raw, unflattened `style` prop (object or nested array).
+    * Flattened natively into the top-level text style props, so the JS
+    * render path does no per-render style work.
+    */
+   textStyle?: AnyMap
+
+   /**
+    * Nested children as a span tree: each span carries only the style its own
+    * element sets (plus `text` for text nodes). Resolved natively into
+    * `fragments`, so the style cascade never runs in JS.
+    */
+   spans?: Fragment[]
+
+   /**
+    * Parent index of each entry in `spans` (-1 for the root).
+    * Parents always precede their children.
+    */
+   spanParents?: number[]
 }
 
-export interface NitroTextMethods extends HybridViewMethods {}
+export interface NitroTextMethods extends HybridViewMethods {
+   /**
+    * Replaces the displayed text without a React render or commit.
+    * Meant for high-frequency updates (tickers, timers, progress labels);
+    * layout only re-runs when the new text changes the view's size.
+    * The next change to the `text`/`fragments` props takes over again.
+    */
+   updateText(text: string): void
+
+   /**
+    * Like `updateText`, for styled fragments.
+    */
+   updateFragments(fragments: Fragment[]): void
+}
 
 export type NitroText = HybridView<
    NitroTextProps,
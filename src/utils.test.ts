@@ -0,0 +1,69 @@
+import React from 'react'
+import { flattenChildrenToSpans } from './utils'
+
+const span = (props: Record<string, unknown>, ...children: React.ReactNode[]) =>
+   React.createElement('Text', props, ...children)
+
+describe('flattenChildrenToSpans', () => {
+   it('should keep only the style each element sets itself', () => {
+      const tree = flattenChildrenToSpans([
+         span(
+            { style: { fontSize: 20 } },
+            'a',
+            span({ style: { color: 'red' } }, 'b')
+         ),
+         'c',
+      ])
+      expect(tree.spans).toEqual([
+         { fontSize: 20 },
+         { text: 'a' },
+         { fontColor: 'red' },
+         { text: 'b' },
+         { text: 'c' },
+      ])
+      expect(tree.parents).toEqual([-1, 0, 0, 2, -1])
+   })
+
+   it('should let props beat the element style', () => {
+      const tree = flattenChildrenToSpans(
+         span({ style: { color: 'red', fontSize: 12 }, fontColor: 'blue' }, 'a')
+      )
+      expect(tree.spans[0]).toEqual({ fontColor: 'blue', fontSize: 12 })
+   })
+
+   it('should let props beat the style of descendants', () => {
+      const tree = flattenChildrenToSpans(
+         span(
+            { fontSize: 20 },
+            span({ style: { fontSize: 10, color: 'red' } }, 'a'),
+            span({ fontSize: 30 }, 'b')
+         )
+      )
+      expect(tree.spans).toEqual([
+         { fontSize: 20 },
+         { fontColor: 'red' },
+         { text: 'a' },
+         { fontSize: 30 },
+         { text: 'b' },
+      ])
+   })
+
+   it('should paint only backgrounds set in the element style', () => {
+      const tree = flattenChildrenToSpans([
+         span({ fragmentBackgroundColor: 'green' }, 'a'),
+         span(
+            {
+               style: { backgroundColor: 'yellow' },
+               fragmentBackgroundColor: 'green',
+            },
+            'b'
+         ),
+         span({ style: { backgroundColor: 'yellow' } }, 'c'),
+      ])
+      expect(tree.spans.filter((s) => s.text === undefined)).toEqual([
+         {},
+         { fragmentBackgroundColor: 'green' },
+         { fragmentBackgroundColor: 'yellow' },
+      ])
+   })
+})
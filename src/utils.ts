@@ -120,21 +120,8 @@ export function styleToFragment(
    return result
 }
 
-function getFragmentConfig(style: StyleProp<TextStyle>): {
-   shouldApplyBackground: boolean
-   shouldApplyBorder: boolean
-} {
-   const flat = StyleSheet.flatten(style) || {}
-   const hasBackground = !!flat.backgroundColor
-   const hasBorder = !!flat.borderColor || !!flat.borderWidth
-   return {
-      shouldApplyBackground: hasBackground,
-      shouldApplyBorder: hasBorder,
-   }
-}
-
-// Keys used to determine whether two adjacent fragments can be merged
-const MERGE_KEYS: (keyof Fragment)[] = [
+// Fragment-like keys an element may also set as props (outside of style)
+const FRAGMENT_PROP_KEYS: (keyof Fragment)[] = [
    'selectionColor',
    'fontSize',
    'fontWeight',
@@ -157,48 +144,30 @@ function pickFragmentOverrides(
 ): Partial<Fragment> {
    if (!props || typeof props !== 'object') return {}
    const out: Partial<Fragment> = {}
-   for (const k of MERGE_KEYS) {
+   for (const k of FRAGMENT_PROP_KEYS) {
       if (props[k] !== undefined) (out as Record<string, unknown>)[k] = props[k]
    }
    return out
 }
 
-function canMerge(a: Partial<Fragment>, b: Partial<Fragment>): boolean {
-   for (const k of MERGE_KEYS) {
-      if (a[k] !== b[k]) return false
-   }
-   return true
-}
-
-function pushFragment(out: Fragment[], text: string, attrs: Partial<Fragment>) {
-   if (!text) return
-   const last = out[out.length - 1]
-   if (last && canMerge(last, attrs)) {
-      last.text = (last.text || '') + text
-      return
-   }
-   out.push({ text, ...attrs })
+export type SpanTree = {
+   spans: Fragment[]
+   parents: number[]
 }
 
-function flattenInto(
-   out: Fragment[],
+function collectSpans(
+   out: SpanTree,
    children: React.ReactNode,
-   parentStyle?: StyleProp<TextStyle>,
-   fragmentConfig?: ReturnType<typeof getFragmentConfig>,
-   inheritedOverrides: Partial<Fragment> = {}
+   parent: number,
+   inheritedOverrides: Partial<Fragment>
 ) {
    React.Children.forEach(children, (child) => {
       if (child == null || child === false) return
       if (typeof child === 'string' || typeof child === 'number') {
-         const base = styleToFragment(parentStyle)
-         const merged: Partial<Fragment> = { ...base, ...inheritedOverrides }
-         if (
-            !fragmentConfig?.shouldApplyBackground &&
-            merged.fragmentBackgroundColor
-         ) {
-            delete merged.fragmentBackgroundColor
-         }
-         pushFragment(out, String(child), merged)
+         const text = String(child)
+         if (!text) return
+         out.spans.push({ text })
+         out.parents.push(parent)
          return
       }
       if (React.isValidElement(child)) {
@@ -207,57 +176,44 @@ function flattenInto(
             style: childStyle,
             ...restProps
          } = child.props as TextProps
-         const mergedStyle = [parentStyle, childStyle]
+         const ownStyle = styleToFragment(childStyle)
          const ownOverrides = pickFragmentOverrides(restProps)
          const mergedOverrides = { ...inheritedOverrides, ...ownOverrides }
-         flattenInto(
-            out,
-            nested,
-            mergedStyle,
-            getFragmentConfig(childStyle),
-            mergedOverrides
-         )
+         // Props set outside of style beat the style of every descendant:
+         // keys an ancestor overrides are left to cascade from it.
+         const span: Fragment = {}
+         for (const k of Object.keys(ownStyle) as (keyof Fragment)[]) {
+            if (inheritedOverrides[k] === undefined) {
+               ;(span as Record<string, unknown>)[k] = ownStyle[k]
+            }
+         }
+         Object.assign(span, ownOverrides)
+         // Only an element's own style background paints its text, in the
+         // overriding color if there is one.
+         if (ownStyle.fragmentBackgroundColor) {
+            span.fragmentBackgroundColor =
+               mergedOverrides.fragmentBackgroundColor ??
+               ownStyle.fragmentBackgroundColor
+         } else {
+            delete span.fragmentBackgroundColor
+         }
+         const index = out.spans.length
+         out.spans.push(span)
+         out.parents.push(parent)
+         collectSpans(out, nested, index, mergedOverrides)
       }
    })
 }
 
-export function flattenChildrenToFragments(
-   children: React.ReactNode,
-   parentStyle?: StyleProp<TextStyle>,
-   fragmentConfig?: ReturnType<typeof getFragmentConfig>
-): Fragment[] {
-   const out: Fragment[] = []
-   flattenInto(out, children, parentStyle, fragmentConfig, {})
+/**
+ * Walks nested children into a span tree: one span per element (only the
+ * style it sets itself) and per text node, each pointing at its parent.
+ * As `flattenChildrenToFragments` did, fragment props set outside of style
+ * win over the style of the element and all its descendants. The cascade
+ * and fragment merging happen natively.
+ */
+export function flattenChildrenToSpans(children: React.ReactNode): SpanTree {
+   const out: SpanTree = { spans: [], parents: [] }
+   collectSpans(out, children, -1, {})
    return out
 }
-
-export function getStyleProps(styles: Partial<Fragment>) {
-   // Early return if no styles
-   const keys = Object.keys(styles)
-   if (keys.length === 0) return {}
-
-   const props: Partial<Fragment> = {}
-
-   // Optimized: only iterate through properties that exist
-   for (const key of keys) {
-      const value = styles[key as keyof Fragment]
-      if (value === undefined) continue
-
-      // Skip empty strings for string properties
-      if (
-         typeof value === 'string' &&
-         value === '' &&
-         (key === 'fontFamily' ||
-            key === 'fontColor' ||
-            key === 'textDecorationColor' ||
-            key === 'selectionColor')
-      ) {
-         continue
-      }
-
-      // Type-safe assignment using Record
-      ;(props as Record<string, unknown>)[key] = value
-   }
-
-   return props
-}
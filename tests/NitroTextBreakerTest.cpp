@@ -0,0 +1,78 @@
+//
+// NitroTextBreakerTest.cpp
+// Line breaks and grapheme boundaries on text the renderers commonly see
+//
+// Conformance with the Unicode test data is checked by
+// benchmarks/NitroTextBreakTest.cpp, which ctest runs as well.
+//
+
+#include "NitroTextGrapheme.hpp"
+#include "NitroTextLineBreak.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string_view>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+std::vector<size_t> breakOffsets(std::string_view text, LineBreakStrategyIOS strategy)
+{
+  std::vector<size_t> offsets;
+  LineBreaker breaker(text, strategy);
+  while (const auto lineBreak = breaker.next()) offsets.push_back(lineBreak->offset);
+  return offsets;
+}
+
+std::vector<size_t> graphemeBoundaries(std::string_view text)
+{
+  std::vector<size_t> offsets;
+  for (size_t at = 0; at < text.size();) {
+    at = nextGraphemeBoundary(text, at);
+    offsets.push_back(at);
+  }
+  return offsets;
+}
+
+} // namespace
+
+TEST(LineBreaker, BreaksAfterSpacesAndHardBreaks)
+{
+  EXPECT_EQ(breakOffsets("Hello big world", LineBreakStrategyIOS::NONE), (std::vector<size_t>{6, 10, 15}));
+  EXPECT_EQ(breakOffsets("a\nb", LineBreakStrategyIOS::NONE), (std::vector<size_t>{2, 3}));
+  EXPECT_EQ(breakOffsets("", LineBreakStrategyIOS::NONE), std::vector<size_t>{});
+
+  const auto breaks = findLineBreaks("one\r\ntwo");
+  ASSERT_EQ(breaks.size(), 2u);
+  EXPECT_EQ(breaks[0], (LineBreak{5, true}));
+  EXPECT_EQ(breaks[1], (LineBreak{8, true}));
+}
+
+TEST(LineBreaker, KeepsPunctuationAndNumbersTogether)
+{
+  EXPECT_EQ(breakOffsets("$12.50, (ok)", LineBreakStrategyIOS::NONE), (std::vector<size_t>{8, 12}));
+}
+
+TEST(LineBreaker, HangulWordPriority)
+{
+  // 한국어 문장
+  const std::string_view korean = "\xED\x95\x9C\xEA\xB5\xAD\xEC\x96\xB4 \xEB\xAC\xB8\xEC\x9E\xA5";
+  EXPECT_EQ(breakOffsets(korean, LineBreakStrategyIOS::STANDARD), (std::vector<size_t>{10, 16}));
+  EXPECT_EQ(breakOffsets(korean, LineBreakStrategyIOS::NONE), (std::vector<size_t>{3, 6, 10, 13, 16}));
+}
+
+TEST(Grapheme, KeepsClustersWhole)
+{
+  // e + combining acute, a flag, a family emoji, then CR LF.
+  const std::string_view text = "e\xCC\x81"
+                                "\xF0\x9F\x87\xAF\xF0\x9F\x87\xB5"
+                                "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"
+                                "\r\n";
+  EXPECT_EQ(graphemeBoundaries(text), (std::vector<size_t>{3, 11, 29, 31}));
+  EXPECT_EQ(previousGraphemeBoundary(text, 29), 11u);
+  EXPECT_TRUE(isGraphemeBoundary(text, 11));
+  EXPECT_FALSE(isGraphemeBoundary(text, 12));
+  EXPECT_EQ(floorGraphemeBoundary(text, 20), 11u);
+}
@@ -0,0 +1,121 @@
+//
+// NitroTextFontTest.cpp
+// Font files, glyph advances, ellipsizing and paragraph layout, on the
+// example app's monospaced font
+//
+
+#include "NitroTextEllipsize.hpp"
+#include "NitroTextFont.hpp"
+#include "NitroTextGlyphAdvances.hpp"
+#include "NitroTextParagraph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <string>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+const std::string kMonoFont = NITROTEXT_SOURCE_DIR "/example/assets/fonts/ChivoMono.ttf";
+
+class FontTest : public ::testing::Test {
+protected:
+  void SetUp() override
+  {
+    font_ = FontFile::open(kMonoFont);
+    ASSERT_NE(font_, nullptr) << kMonoFont;
+    advances_ = GlyphAdvanceCache::shared(font_, 10);
+    cell_ = advances_->lookup('a').advance;
+    ASSERT_GT(cell_, 0);
+  }
+
+  std::shared_ptr<const FontFile> font_;
+  std::shared_ptr<const GlyphAdvanceCache> advances_;
+  // The advance of every character of the font.
+  float cell_ = 0;
+};
+
+} // namespace
+
+TEST(FontFile, OpensOncePerPath)
+{
+  const auto font = FontFile::open(kMonoFont);
+  ASSERT_NE(font, nullptr);
+  EXPECT_EQ(FontFile::open(kMonoFont), font);
+  EXPECT_EQ(FontFile::open(NITROTEXT_SOURCE_DIR "/package.json"), nullptr);
+  EXPECT_EQ(FontFile::open(NITROTEXT_SOURCE_DIR "/no-such-font.ttf"), nullptr);
+}
+
+TEST_F(FontTest, ReadsMetricsAndGlyphs)
+{
+  const auto& metrics = font_->metrics();
+  EXPECT_GT(metrics.unitsPerEm, 0);
+  EXPECT_GT(metrics.ascender, 0);
+  EXPECT_LT(metrics.descender, 0);
+  EXPECT_NE(font_->glyphIndex('a'), 0);
+  EXPECT_NE(font_->glyphIndex('a'), font_->glyphIndex('b'));
+  EXPECT_EQ(font_->glyphIndex(0x10FFFD), 0);
+  EXPECT_FLOAT_EQ(advances_->scale(), 10.0f / metrics.unitsPerEm);
+}
+
+TEST_F(FontTest, SumsAdvances)
+{
+  EXPECT_FLOAT_EQ(advances_->lookup('W').advance, cell_);
+  EXPECT_FLOAT_EQ(advances_->width(""), 0);
+  if (!font_->hasKerning()) {
+    EXPECT_FLOAT_EQ(advances_->width("hello"), 5 * cell_);
+    EXPECT_FLOAT_EQ(advances_->width("hello", 2), 5 * (cell_ + 2));
+    // Non-ASCII goes through the other table: é and ü are one character each.
+    EXPECT_FLOAT_EQ(advances_->width("\xC3\xA9\xC3\xBC"), 2 * cell_);
+  }
+}
+
+TEST_F(FontTest, Ellipsizes)
+{
+  const std::string text = "abcdefghij";
+  const float ellipsis = advances_->width(kEllipsis);
+  EXPECT_EQ(ellipsize(text, 10 * cell_, EllipsizeMode::TAIL, *advances_), text);
+
+  const float width = 4 * cell_ + ellipsis + 0.01f;
+  EXPECT_EQ(ellipsize(text, width, EllipsizeMode::TAIL, *advances_), "abcd" + std::string(kEllipsis));
+  EXPECT_EQ(ellipsize(text, width, EllipsizeMode::HEAD, *advances_), std::string(kEllipsis) + "ghij");
+  EXPECT_EQ(ellipsize(text, width, EllipsizeMode::MIDDLE, *advances_), "ab" + std::string(kEllipsis) + "ij");
+  EXPECT_EQ(ellipsize(text, 4 * cell_ + 0.01f, EllipsizeMode::CLIP, *advances_), "abcd");
+}
+
+TEST_F(FontTest, LaysOutParagraphs)
+{
+  const std::string text = "aaa bbb ccc\nddd";
+  const std::vector<ParagraphRun> runs = {{text, advances_}};
+
+  const auto wide = layoutParagraph(runs, INFINITY);
+  ASSERT_EQ(wide.lines.size(), 2u);
+  EXPECT_EQ(wide.lines[0].text, "aaa bbb ccc");
+  EXPECT_EQ(wide.lines[1].text, "ddd");
+  EXPECT_FLOAT_EQ(wide.width, 11 * cell_);
+  EXPECT_FALSE(wide.truncated);
+
+  // Two words per line; the space hangs past the edge.
+  const auto narrow = layoutParagraph(runs, 7 * cell_ + 0.01f);
+  ASSERT_EQ(narrow.lines.size(), 3u);
+  EXPECT_EQ(narrow.lines[0].text, "aaa bbb ");
+  EXPECT_EQ(narrow.lines[1].text, "ccc");
+  EXPECT_FLOAT_EQ(narrow.lines[0].width, 7 * cell_);
+  EXPECT_FLOAT_EQ(narrow.lines[1].top, narrow.lines[0].height);
+  EXPECT_FLOAT_EQ(narrow.height, 3 * narrow.lines[0].height);
+
+  ParagraphStyle oneLine;
+  oneLine.maximumNumberOfLines = 1;
+  const auto truncated = layoutParagraph(runs, 7 * cell_ + 0.01f, oneLine);
+  ASSERT_EQ(truncated.lines.size(), 1u);
+  EXPECT_TRUE(truncated.truncated);
+  EXPECT_EQ(truncated.lines[0].text.substr(truncated.lines[0].text.size() - kEllipsis.size()), kEllipsis);
+  EXPECT_LE(truncated.lines[0].width, 7 * cell_ + 0.01f);
+
+  const auto trailingBreak = layoutParagraph({{std::string_view("x\n"), advances_}}, INFINITY);
+  ASSERT_EQ(trailingBreak.lines.size(), 2u);
+  EXPECT_EQ(trailingBreak.lines[1].text, "");
+}
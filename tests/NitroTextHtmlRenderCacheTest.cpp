@@ -0,0 +1,65 @@
+//
+// NitroTextHtmlRenderCacheTest.cpp
+// HtmlRenderCache hands out what HtmlRenderer renders, once per markup and style
+//
+
+#include "NitroTextHtmlRenderCache.hpp"
+#include "NitroTextHtmlRenderer.hpp"
+#include "NitroTextTestUtil.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::tests::describe;
+
+TEST(HtmlRenderCache, HitsOnEqualMarkupAndStyle)
+{
+  HtmlRenderCache::clear();
+  Fragment base;
+  base.fontSize = 14;
+  const std::string html = "<p>Hello <b>cache</b></p>";
+
+  const auto first = HtmlRenderCache::render(html, base);
+  const auto second = HtmlRenderCache::render(std::string(html), base);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(describe(*first), describe(HtmlRenderer::render(html, base).fragments));
+
+  const auto stats = HtmlRenderCache::stats();
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.entries, 1u);
+}
+
+TEST(HtmlRenderCache, MissesOnAnotherStyle)
+{
+  HtmlRenderCache::clear();
+  Fragment small;
+  small.fontSize = 12;
+  Fragment large;
+  large.fontSize = 20;
+
+  const auto a = HtmlRenderCache::render("<i>text</i>", small);
+  const auto b = HtmlRenderCache::render("<i>text</i>", large);
+  EXPECT_NE(a, b);
+  EXPECT_EQ(describe(*b), describe(HtmlRenderer::render("<i>text</i>", large).fragments));
+  EXPECT_EQ(HtmlRenderCache::stats().misses, 2u);
+}
+
+TEST(HtmlRenderCache, SkipsOversizedMarkup)
+{
+  HtmlRenderCache::clear();
+  const std::string html(HtmlRenderCache::kMaxEntryBytes + 1, 'x');
+  HtmlRenderCache::render(html, Fragment());
+  EXPECT_EQ(HtmlRenderCache::stats().entries, 0u);
+}
+
+TEST(HtmlRenderCache, EvictsPastCapacity)
+{
+  HtmlRenderCache::clear();
+  for (size_t i = 0; i <= HtmlRenderCache::kCapacity; i++) {
+    HtmlRenderCache::render("<b>" + std::to_string(i) + "</b>", Fragment());
+  }
+  EXPECT_EQ(HtmlRenderCache::stats().entries, HtmlRenderCache::kCapacity);
+}
@@ -0,0 +1,442 @@
+//
+// NitroTextHtmlRendererTest.cpp
+// HtmlRenderer against the cases of src/renderers/html.test.ts
+//
+
+#include "NitroTextHtmlRenderer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+HtmlRenderResult render(std::string_view html, const Fragment& base = Fragment())
+{
+  return HtmlRenderer::render(html, base);
+}
+
+std::string textOf(std::string_view html)
+{
+  return render(html).text;
+}
+
+const Fragment* find(const HtmlRenderResult& result, bool (*match)(const Fragment&))
+{
+  const auto it = std::find_if(result.fragments.begin(), result.fragments.end(), match);
+  return it != result.fragments.end() ? &*it : nullptr;
+}
+
+bool isBold(const Fragment& fragment)
+{
+  return fragment.fontWeight == FontWeight::BOLD;
+}
+
+bool isItalic(const Fragment& fragment)
+{
+  return fragment.fontStyle == FontStyle::ITALIC;
+}
+
+bool isLink(const Fragment& fragment)
+{
+  return fragment.linkUrl.has_value();
+}
+
+} // namespace
+
+TEST(HtmlRendererText, RendersPlainText)
+{
+  const auto result = render("Hello World");
+  EXPECT_EQ(result.text, "Hello World");
+  ASSERT_EQ(result.fragments.size(), 1u);
+  EXPECT_EQ(result.fragments[0].text, "Hello World");
+}
+
+TEST(HtmlRendererText, RendersEmptyString)
+{
+  const auto result = render("");
+  EXPECT_EQ(result.text, "");
+  EXPECT_TRUE(result.fragments.empty());
+}
+
+TEST(HtmlRendererText, TrimsAndCollapsesWhitespace)
+{
+  EXPECT_EQ(textOf("  Hello  "), "Hello");
+  EXPECT_EQ(textOf("Hello    World"), "Hello World");
+  EXPECT_EQ(textOf("Text   with    spaces"), "Text with spaces");
+  EXPECT_EQ(textOf("Line 1\n\n\nLine 2"), "Line 1 Line 2");
+  EXPECT_EQ(textOf("<p>Text</p>\n\n"), "Text");
+}
+
+TEST(HtmlRendererText, PreservesWhitespaceInPre)
+{
+  EXPECT_EQ(textOf("<pre>Line 1\n  Line 2\n    Line 3</pre>"), "Line 1\n  Line 2\n    Line 3");
+}
+
+TEST(HtmlRendererSemanticTags, Bold)
+{
+  for (const char* html : {"<strong>Bold</strong>", "<b>Bold</b>"}) {
+    const auto result = render(html);
+    EXPECT_EQ(result.text, "Bold");
+    ASSERT_FALSE(result.fragments.empty());
+    EXPECT_EQ(result.fragments[0].fontWeight, FontWeight::BOLD) << html;
+  }
+}
+
+TEST(HtmlRendererSemanticTags, Italic)
+{
+  for (const char* html : {"<em>Italic</em>", "<i>Italic</i>"}) {
+    const auto result = render(html);
+    EXPECT_EQ(result.text, "Italic");
+    ASSERT_FALSE(result.fragments.empty());
+    EXPECT_EQ(result.fragments[0].fontStyle, FontStyle::ITALIC) << html;
+  }
+}
+
+TEST(HtmlRendererSemanticTags, Decorations)
+{
+  const auto underlined = render("<u>Underlined</u>");
+  EXPECT_EQ(underlined.text, "Underlined");
+  ASSERT_FALSE(underlined.fragments.empty());
+  EXPECT_EQ(underlined.fragments[0].textDecorationLine, TextDecorationLine::UNDERLINE);
+
+  for (const char* html : {"<s>Struck</s>", "<del>Struck</del>", "<strike>Struck</strike>"}) {
+    const auto result = render(html);
+    EXPECT_EQ(result.text, "Struck");
+    ASSERT_FALSE(result.fragments.empty());
+    EXPECT_EQ(result.fragments[0].textDecorationLine, TextDecorationLine::LINE_THROUGH) << html;
+  }
+}
+
+TEST(HtmlRendererSemanticTags, Mark)
+{
+  const auto result = render("<mark>Highlighted</mark>");
+  EXPECT_EQ(result.text, "Highlighted");
+  EXPECT_FALSE(result.fragments.empty());
+}
+
+TEST(HtmlRendererSemanticTags, Combined)
+{
+  const auto result = render("<strong><em>Bold and Italic</em></strong>");
+  EXPECT_EQ(result.text, "Bold and Italic");
+  ASSERT_FALSE(result.fragments.empty());
+  EXPECT_EQ(result.fragments[0].fontWeight, FontWeight::BOLD);
+  EXPECT_EQ(result.fragments[0].fontStyle, FontStyle::ITALIC);
+}
+
+TEST(HtmlRendererHeadings, SizesAndWeight)
+{
+  const std::pair<const char*, double> headings[] = {
+      {"h1", 30}, {"h2", 26}, {"h3", 22}, {"h4", 20}, {"h5", 18}, {"h6", 16},
+  };
+  for (const auto& [tag, size] : headings) {
+    const std::string html = std::string("<") + tag + ">Heading</" + tag + ">";
+    const auto result = render(html);
+    EXPECT_EQ(result.text, "Heading");
+    ASSERT_FALSE(result.fragments.empty());
+    EXPECT_EQ(result.fragments[0].fontSize, size) << tag;
+    EXPECT_EQ(result.fragments[0].fontWeight, FontWeight::BOLD) << tag;
+  }
+}
+
+TEST(HtmlRendererBlocks, Spacing)
+{
+  EXPECT_EQ(textOf("<p>First</p><p>Second</p>"), "First\n\nSecond");
+  EXPECT_EQ(textOf("<div>First</div><div>Second</div>"), "First\n\nSecond");
+  EXPECT_EQ(textOf("<div><p>Nested</p></div>"), "Nested");
+  EXPECT_EQ(textOf("Text<p>Paragraph</p>"), "Text\n\nParagraph");
+}
+
+TEST(HtmlRendererInline, Spans)
+{
+  EXPECT_EQ(textOf("<span>Inline</span>"), "Inline");
+  EXPECT_EQ(textOf("<span>First</span> <span>Second</span>"), "First Second");
+  EXPECT_EQ(textOf("<p>Block</p><span>Inline</span>"), "Block\nInline");
+}
+
+TEST(HtmlRendererLineBreaks, Br)
+{
+  EXPECT_EQ(textOf("Line 1<br>Line 2"), "Line 1\nLine 2");
+  EXPECT_EQ(textOf("Line 1<br><br>Line 2"), "Line 1\n\nLine 2");
+  EXPECT_EQ(textOf("Line 1<br />Line 2"), "Line 1\nLine 2");
+  EXPECT_EQ(textOf("<div>Text<br/>More</div>"), "Text\nMore");
+}
+
+TEST(HtmlRendererLists, BulletsAndNumbers)
+{
+  EXPECT_EQ(textOf("<ul><li>Item 1</li><li>Item 2</li></ul>"), "\xE2\x80\xA2 Item 1\n\n\xE2\x80\xA2 Item 2");
+  EXPECT_EQ(textOf("<ol><li>First</li><li>Second</li></ol>"), "1. First\n\n2. Second");
+  EXPECT_EQ(textOf("Text<ul><li>Item</li></ul>"), "Text\n\n\xE2\x80\xA2 Item");
+}
+
+TEST(HtmlRendererLists, Nested)
+{
+  const auto nested = textOf("<ul><li>Item 1<ul><li>Sub 1</li></ul></li></ul>");
+  EXPECT_NE(nested.find("\xE2\x80\xA2 Item 1"), std::string::npos);
+  EXPECT_NE(nested.find("\xE2\x80\xA2 Sub 1"), std::string::npos);
+
+  const auto mixed = textOf("<ol><li>First<ul><li>Bullet</li></ul></li></ol>");
+  EXPECT_NE(mixed.find("1. First"), std::string::npos);
+  EXPECT_NE(mixed.find("\xE2\x80\xA2 Bullet"), std::string::npos);
+}
+
+TEST(HtmlRendererImages, AltText)
+{
+  EXPECT_EQ(textOf("<img alt=\"Image description\" />"), "Image description");
+  EXPECT_EQ(textOf("<img src=\"test.jpg\" />"), "");
+  EXPECT_EQ(textOf("Text<img alt=\"Image\" />"), "TextImage");
+  EXPECT_EQ(textOf("<p><img alt=\"Image\" /></p>"), "Image");
+}
+
+TEST(HtmlRendererEntities, Decodes)
+{
+  EXPECT_EQ(textOf("&lt;div&gt;"), "<div>");
+  EXPECT_EQ(textOf("Tom &amp; Jerry"), "Tom & Jerry");
+  EXPECT_EQ(textOf("&quot;Hello&quot;"), "\"Hello\"");
+  EXPECT_EQ(textOf("Word&nbsp;Word"), "Word Word");
+  EXPECT_EQ(textOf("&#65; &#x41;"), "A A");
+  EXPECT_EQ(textOf("&alpha; &beta; &gamma;"), "\xCE\xB1 \xCE\xB2 \xCE\xB3");
+  EXPECT_EQ(textOf("&copy; &reg; &trade;"), "\xC2\xA9 \xC2\xAE \xE2\x84\xA2");
+}
+
+TEST(HtmlRendererCss, InlineStyles)
+{
+  const auto result = render("<span style=\"color: red; font-size: 20px;\">Styled</span>");
+  EXPECT_EQ(result.text, "Styled");
+  ASSERT_FALSE(result.fragments.empty());
+  EXPECT_EQ(result.fragments[0].fontColor, "red");
+  EXPECT_EQ(result.fragments[0].fontSize, 20);
+}
+
+TEST(HtmlRendererCss, StyleTagSelectors)
+{
+  const std::pair<const char*, const char*> cases[] = {
+      {"<style>.red { color: red; }</style><span class=\"red\">Text</span>", "red"},
+      {"<style>p { color: blue; }</style><p>Text</p>", "blue"},
+      {"<style>#special { color: green; }</style><span id=\"special\">Text</span>", "green"},
+      {"<style>.text { color: blue; }</style><span class=\"text\" style=\"color: red;\">Text</span>", "red"},
+  };
+  for (const auto& [html, color] : cases) {
+    const auto result = render(std::string("\n  ") + html + "\n");
+    EXPECT_EQ(result.text, "Text") << html;
+    ASSERT_FALSE(result.fragments.empty());
+    EXPECT_EQ(result.fragments[0].fontColor, color) << html;
+  }
+}
+
+TEST(HtmlRendererCss, Combinators)
+{
+  const auto result = render("<style>div > b { color: red; } p b { color: blue; }</style>"
+                             "<div><b>A</b></div><p><span><b>B</b></span></p><b>C</b>");
+  ASSERT_EQ(result.fragments.size(), 3u);
+  EXPECT_EQ(result.fragments[0].fontColor, "red");
+  EXPECT_EQ(result.fragments[1].fontColor, "blue");
+  EXPECT_FALSE(result.fragments[2].fontColor.has_value());
+}
+
+TEST(HtmlRendererCss, DisplayNone)
+{
+  EXPECT_EQ(textOf("<span style=\"display: none;\">Hidden</span>Visible"), "Visible");
+}
+
+TEST(HtmlRendererBaseFragment, AppliesAndOverrides)
+{
+  Fragment base;
+  base.fontSize = 14;
+  base.fontColor = "blue";
+  const auto plain = render("Text", base);
+  ASSERT_FALSE(plain.fragments.empty());
+  EXPECT_EQ(plain.fragments[0].fontSize, 14);
+  EXPECT_EQ(plain.fragments[0].fontColor, "blue");
+
+  const auto overridden = render("<span style=\"font-size: 20px;\">Text</span>", base);
+  ASSERT_FALSE(overridden.fragments.empty());
+  EXPECT_EQ(overridden.fragments[0].fontSize, 20);
+
+  const auto bold = render("<strong>Bold</strong>", base);
+  ASSERT_FALSE(bold.fragments.empty());
+  EXPECT_EQ(bold.fragments[0].fontColor, "blue");
+  EXPECT_EQ(bold.fragments[0].fontWeight, FontWeight::BOLD);
+}
+
+TEST(HtmlRendererEdgeCases, Markup)
+{
+  EXPECT_EQ(textOf("<div><p>Unclosed"), "Unclosed");
+  EXPECT_EQ(textOf("<!DOCTYPE html><html><body>Content</body></html>"), "Content");
+  EXPECT_EQ(textOf("<script>alert(\"test\")</script>Text"), "Text");
+  EXPECT_EQ(textOf("<style>p { color: red; }</style>Text"), "Text");
+  EXPECT_EQ(textOf("<head><title>Title</title></head><body>Body</body>"), "Body");
+  EXPECT_EQ(textOf("Text<!-- Comment -->More"), "TextMore");
+  EXPECT_EQ(textOf("Text<![CDATA[data]]>More"), "TextMore");
+  EXPECT_EQ(textOf("<p></p>"), "");
+  EXPECT_EQ(textOf("<hr /><br /><img />"), "");
+}
+
+TEST(HtmlRendererEdgeCases, MixedContent)
+{
+  const auto text = textOf(R"(
+    <div>
+      <h1>Title</h1>
+      <p>Paragraph with <strong>bold</strong> and <em>italic</em>.</p>
+      <ul>
+        <li>Item 1</li>
+        <li>Item 2</li>
+      </ul>
+    </div>
+  )");
+  for (const char* part : {"Title", "Paragraph with bold and italic.", "\xE2\x80\xA2 Item 1", "\xE2\x80\xA2 Item 2"}) {
+    EXPECT_NE(text.find(part), std::string::npos) << part;
+  }
+}
+
+TEST(HtmlRendererBackground, NotOnNewlinesOrChildren)
+{
+  const auto inlineBackground = render("<span style=\"background-color: yellow;\">Highlighted</span>");
+  EXPECT_EQ(inlineBackground.text, "Highlighted");
+  EXPECT_FALSE(inlineBackground.fragments.empty());
+
+  const auto block = render("<div style=\"background-color: yellow;\">Text</div>");
+  EXPECT_EQ(block.text, "Text");
+  ASSERT_FALSE(block.fragments.empty());
+  EXPECT_EQ(block.fragments[0].text, "Text");
+
+  const auto child = render("<div style=\"background-color: yellow;\"><span>Text</span></div>");
+  EXPECT_EQ(child.text, "Text");
+  ASSERT_FALSE(child.fragments.empty());
+  EXPECT_EQ(child.fragments[0].text, "Text");
+}
+
+TEST(HtmlRendererStructures, DeeplyNested)
+{
+  const auto result = render("<div><p><span><strong><em>Nested</em></strong></span></p></div>");
+  EXPECT_EQ(result.text, "Nested");
+  ASSERT_FALSE(result.fragments.empty());
+  EXPECT_EQ(result.fragments[0].fontWeight, FontWeight::BOLD);
+  EXPECT_EQ(result.fragments[0].fontStyle, FontStyle::ITALIC);
+}
+
+TEST(HtmlRendererStructures, Siblings)
+{
+  const auto result = render("<p><strong>Bold</strong> <em>Italic</em> Normal</p>");
+  EXPECT_EQ(result.text, "Bold Italic Normal");
+  const auto* bold = find(result, isBold);
+  const auto* italic = find(result, isItalic);
+  ASSERT_NE(bold, nullptr);
+  ASSERT_NE(italic, nullptr);
+  EXPECT_EQ(bold->text, "Bold");
+  EXPECT_EQ(italic->text, "Italic");
+}
+
+TEST(HtmlRendererStructures, Article)
+{
+  const auto text = textOf(R"(
+    <article>
+      <header><h1>Article Title</h1></header>
+      <section>
+        <p>First paragraph.</p>
+        <p>Second paragraph.</p>
+      </section>
+      <footer>Footer text</footer>
+    </article>
+  )");
+  for (const char* part : {"Article Title", "First paragraph.", "Second paragraph.", "Footer text"}) {
+    EXPECT_NE(text.find(part), std::string::npos) << part;
+  }
+}
+
+TEST(HtmlRendererLinks, Href)
+{
+  const auto result = render("<a href=\"https://example.com\" target=\"_blank\">Click</a>");
+  EXPECT_EQ(result.text, "Click");
+  ASSERT_EQ(result.fragments.size(), 1u);
+  EXPECT_EQ(result.fragments[0].text, "Click");
+  EXPECT_EQ(result.fragments[0].linkUrl, "https://example.com");
+  EXPECT_FALSE(result.fragments[0].fontColor.has_value());
+}
+
+TEST(HtmlRendererLinks, InlineStyles)
+{
+  const auto result = render("<a href=\"#\" style=\"color: red; font-weight: bold;\">Link</a>");
+  EXPECT_EQ(result.text, "Link");
+  ASSERT_FALSE(result.fragments.empty());
+  EXPECT_EQ(result.fragments[0].linkUrl, "#");
+  EXPECT_EQ(result.fragments[0].fontColor, "red");
+  EXPECT_EQ(result.fragments[0].fontWeight, FontWeight::BOLD);
+}
+
+TEST(HtmlRendererLinks, InheritedByChildren)
+{
+  const auto result = render("<a href=\"/path\"><strong>Bold</strong> and <em>Italic</em></a>");
+  EXPECT_EQ(result.text, "Bold and Italic");
+  const auto* bold = find(result, isBold);
+  const auto* italic = find(result, isItalic);
+  ASSERT_NE(bold, nullptr);
+  ASSERT_NE(italic, nullptr);
+  EXPECT_EQ(bold->text, "Bold");
+  EXPECT_EQ(bold->linkUrl, "/path");
+  EXPECT_EQ(italic->text, "Italic");
+  EXPECT_EQ(italic->linkUrl, "/path");
+}
+
+TEST(HtmlRendererLinks, WithoutHrefOrText)
+{
+  const auto noHref = render("<a>No Link</a>");
+  EXPECT_EQ(noHref.text, "No Link");
+  ASSERT_FALSE(noHref.fragments.empty());
+  EXPECT_FALSE(noHref.fragments[0].linkUrl.has_value());
+
+  const auto empty = render("<a href=\"x\"></a>");
+  EXPECT_EQ(empty.text, "");
+  EXPECT_TRUE(empty.fragments.empty());
+}
+
+TEST(HtmlRendererLinks, InText)
+{
+  const auto result = render("Hello <a href=\"/link\">there</a> friend");
+  EXPECT_EQ(result.text, "Hello there friend");
+  const auto* link = find(result, isLink);
+  ASSERT_NE(link, nullptr);
+  EXPECT_EQ(link->text, "there");
+  EXPECT_EQ(link->linkUrl, "/link");
+
+  const auto paragraph = render("<p>Visit <a href=\"https://google.com\">Google</a> for search.</p>");
+  link = find(paragraph, isLink);
+  ASSERT_NE(link, nullptr);
+  EXPECT_EQ(link->text, "Google");
+  EXPECT_EQ(link->linkUrl, "https://google.com");
+  EXPECT_FALSE(link->fontColor.has_value());
+}
+
+TEST(HtmlRendererBudget, StopsAtEachLimit)
+{
+  HtmlRenderBudget depth;
+  depth.maxDepth = 4;
+  std::string nested;
+  for (int i = 0; i < 10; i++) nested += "<span>";
+  nested += "deep &amp; <b>plain</b>";
+  const auto deep = HtmlRenderer::render(nested, Fragment(), depth);
+  EXPECT_EQ(deep.exceeded, HtmlRenderLimit::Depth);
+  EXPECT_EQ(deep.text, "deep & plain");
+
+  HtmlRenderBudget nodes;
+  nodes.maxNodes = 8;
+  std::string many;
+  for (int i = 0; i < 20; i++) many += "<b>x</b>";
+  const auto manyNodes = HtmlRenderer::render(many, Fragment(), nodes);
+  EXPECT_EQ(manyNodes.exceeded, HtmlRenderLimit::Nodes);
+  EXPECT_EQ(manyNodes.text, std::string(20, 'x'));
+
+  HtmlRenderBudget output;
+  output.maxOutputBytes = 5;
+  const auto cut = HtmlRenderer::render("<p>Hello world</p>", Fragment(), output);
+  EXPECT_EQ(cut.exceeded, HtmlRenderLimit::Output);
+  EXPECT_LE(cut.text.size(), 5u);
+
+  const auto whole = HtmlRenderer::render("<p>Hello world</p>");
+  EXPECT_EQ(whole.exceeded, HtmlRenderLimit::None);
+  EXPECT_EQ(whole.text, "Hello world");
+}
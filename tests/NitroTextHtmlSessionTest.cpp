@@ -0,0 +1,122 @@
+//
+// NitroTextHtmlSessionTest.cpp
+// HtmlSession renders every prefix of streamed markup like HtmlRenderer
+//
+
+#include "NitroTextHtmlRenderer.hpp"
+#include "NitroTextTestUtil.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+using margelo::nitro::nitrotext::tests::describe;
+
+namespace {
+
+const char* const kDocuments[] = {
+    "Hello <b>bold</b> and <i>italic &amp; more</i> text",
+    "<p>First paragraph</p>\n<p>Second with <a href=\"https://example.com/a\">a link</a>.</p>",
+    "<ul><li>One</li><li>Two<ol><li>Nested</li><li>Again</li></ol></li></ul>Tail",
+    "<div style=\"color: red; font-size: 18px\">Styled <span style=\"font-weight: bold\">span</span></div>",
+    "<pre>  keep\n  spaces </pre>  collapsed   spaces  &nbsp;&copy;&#x41;&#65;",
+    "<style>.a { color: blue } p b { color: green }</style><p class=\"a\">Blue <b>green</b></p>",
+    "<p class=\"a\">Styled later</p><style>.a { color: blue }</style><p class=\"a\">too</p>",
+    "<!DOCTYPE html><html><head><title>T</title></head><body><h1>Title</h1><!-- c --><br/>x</body></html>",
+    "<table><tr><td>cell <img alt=\"image\"> text</td></tr></table><script>ignored()</script>done",
+};
+
+// Streams `html` in `chunkSize` byte chunks and checks every update against a
+// full render of the markup so far.
+void expectStreamsLikeRender(std::string_view html, size_t chunkSize, const Fragment& base = Fragment(),
+                             const HtmlRenderBudget& budget = HtmlRenderBudget())
+{
+  HtmlSession session(base, budget);
+  std::vector<Fragment> fragments;
+  for (size_t pos = 0; pos < html.size(); pos += chunkSize) {
+    const size_t end = std::min(html.size(), pos + chunkSize);
+    const HtmlSessionUpdate update = session.append(html.substr(pos, end - pos));
+    ASSERT_LE(update.stableCount, fragments.size());
+    fragments.resize(update.stableCount);
+    fragments.insert(fragments.end(), update.tail.begin(), update.tail.end());
+
+    const HtmlRenderResult expected = HtmlRenderer::render(html.substr(0, end), base, budget);
+    ASSERT_EQ(describe(fragments), describe(expected.fragments))
+        << "after " << end << " bytes in chunks of " << chunkSize << " of: " << html;
+    ASSERT_EQ(update.exceeded, expected.exceeded) << "after " << end << " bytes of: " << html;
+  }
+  EXPECT_EQ(session.source(), html);
+}
+
+} // namespace
+
+TEST(HtmlSession, ChunkSplitsRenderLikeTheWholeMarkup)
+{
+  Fragment base;
+  base.fontSize = 14;
+  base.fontColor = "#222";
+  for (const char* html : kDocuments) {
+    for (const size_t chunkSize : {1, 2, 3, 5, 7, 16, 64}) {
+      expectStreamsLikeRender(html, chunkSize);
+      expectStreamsLikeRender(html, chunkSize, base);
+    }
+  }
+}
+
+TEST(HtmlSession, UpdateAppendsOrStartsOver)
+{
+  HtmlSession session;
+  session.update("<b>Hello</b>");
+  const auto extended = session.update("<b>Hello</b> world");
+  EXPECT_GT(extended.stableCount, 0u);
+
+  const auto replaced = session.update("<i>Other</i>");
+  EXPECT_EQ(replaced.stableCount, 0u);
+  EXPECT_EQ(describe(replaced.tail), describe(HtmlRenderer::render("<i>Other</i>").fragments));
+  EXPECT_EQ(session.source(), "<i>Other</i>");
+
+  session.reset();
+  EXPECT_EQ(session.source(), "");
+}
+
+TEST(HtmlSession, BudgetTripsLikeRender)
+{
+  std::string many;
+  for (int i = 0; i < 40; i++) many += "<b>x</b> ";
+  std::string deep;
+  for (int i = 0; i < 20; i++) deep += "<span>";
+  deep += "deep <i>text</i> &amp; more";
+
+  HtmlRenderBudget nodes;
+  nodes.maxNodes = 30;
+  HtmlRenderBudget depth;
+  depth.maxDepth = 8;
+  HtmlRenderBudget output;
+  output.maxOutputBytes = 24;
+  for (const size_t chunkSize : {1, 4, 9}) {
+    expectStreamsLikeRender(many, chunkSize, Fragment(), nodes);
+    expectStreamsLikeRender(deep, chunkSize, Fragment(), depth);
+    expectStreamsLikeRender(many, chunkSize, Fragment(), output);
+  }
+
+  HtmlSession session(Fragment(), nodes);
+  const auto update = session.append(many);
+  EXPECT_EQ(update.exceeded, HtmlRenderLimit::Nodes);
+}
+
+TEST(HtmlSession, TimeBudgetAppliesToEachUpdate)
+{
+  HtmlRenderBudget budget;
+  budget.maxMilliseconds = 0;
+  // The clock is read every few dozen elements, so give it some.
+  std::string html;
+  for (int i = 0; i < 200; i++) html += "<p><b>x</b></p>";
+  HtmlSession session(Fragment(), budget);
+  EXPECT_EQ(session.append(html).exceeded, HtmlRenderLimit::Time);
+  EXPECT_EQ(session.append("<p>more</p>").exceeded, HtmlRenderLimit::Time);
+  EXPECT_EQ(HtmlRenderer::render(html, Fragment(), budget).exceeded, HtmlRenderLimit::Time);
+}
@@ -0,0 +1,96 @@
+//
+// NitroTextSpanTreeTest.cpp
+// resolveSpanTree cascades span deltas and merges equal neighbours
+//
+
+#include "NitroTextSpanTree.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+namespace {
+
+Fragment text(const std::string& value)
+{
+  Fragment fragment;
+  fragment.text = value;
+  return fragment;
+}
+
+} // namespace
+
+TEST(SpanTree, CascadesInOnePass)
+{
+  Fragment outer;
+  outer.fontSize = 20;
+  outer.fontWeight = FontWeight::BOLD;
+  Fragment inner;
+  inner.fontSize = 12;
+  // <outer>a<inner>b</inner>c</outer>d
+  const auto fragments = resolveSpanTree({outer, text("a"), inner, text("b"), text("c"), text("d")},
+                                         {-1, 0, 0, 2, 0, -1});
+  ASSERT_EQ(fragments.size(), 4u);
+  EXPECT_EQ(fragments[0].text, "a");
+  EXPECT_EQ(fragments[0].fontSize, 20);
+  EXPECT_EQ(fragments[1].text, "b");
+  EXPECT_EQ(fragments[1].fontSize, 12);
+  EXPECT_EQ(fragments[1].fontWeight, FontWeight::BOLD);
+  EXPECT_EQ(fragments[2].text, "c");
+  EXPECT_EQ(fragments[2].fontSize, 20);
+  EXPECT_EQ(fragments[3].text, "d");
+  EXPECT_FALSE(fragments[3].fontSize.has_value());
+  EXPECT_FALSE(fragments[3].fontWeight.has_value());
+}
+
+TEST(SpanTree, BackgroundPaintsOnlyItsOwnText)
+{
+  Fragment outer;
+  outer.fragmentBackgroundColor = "#ff0000";
+  Fragment inner;
+  inner.fontSize = 12;
+  // <outer>a<inner>b</inner></outer>
+  const auto fragments = resolveSpanTree({outer, text("a"), inner, text("b")}, {-1, 0, 0, 2});
+  ASSERT_EQ(fragments.size(), 2u);
+  EXPECT_TRUE(fragments[0].fragmentBackgroundColor.has_value());
+  EXPECT_FALSE(fragments[1].fragmentBackgroundColor.has_value());
+}
+
+TEST(SpanTree, InheritsLinks)
+{
+  Fragment link;
+  link.linkUrl = "https://example.com";
+  Fragment inner;
+  inner.fontWeight = FontWeight::BOLD;
+  // <link>a<inner>b</inner></link>c
+  const auto fragments = resolveSpanTree({link, text("a"), inner, text("b"), text("c")}, {-1, 0, 0, 2, -1});
+  ASSERT_EQ(fragments.size(), 3u);
+  EXPECT_EQ(fragments[0].linkUrl, "https://example.com");
+  EXPECT_EQ(fragments[1].linkUrl, "https://example.com");
+  EXPECT_FALSE(fragments[2].linkUrl.has_value());
+}
+
+TEST(SpanTree, MergesEqualNeighbours)
+{
+  Fragment plain;
+  Fragment link;
+  link.linkUrl = "https://example.com";
+  // a<plain>b</plain>c<link>d</link>
+  const auto fragments = resolveSpanTree({text("a"), plain, text("b"), text("c"), link, text("d")},
+                                         {-1, -1, 1, -1, -1, 4});
+  ASSERT_EQ(fragments.size(), 2u);
+  EXPECT_EQ(fragments[0].text, "abc");
+  EXPECT_EQ(fragments[1].text, "d");
+}
+
+TEST(SpanTree, TreatsBadParentsAsTheRoot)
+{
+  Fragment bold;
+  bold.fontWeight = FontWeight::BOLD;
+  const auto fragments = resolveSpanTree({text("a"), bold, text("b")}, {5, -1});
+  ASSERT_EQ(fragments.size(), 1u);
+  EXPECT_EQ(fragments[0].text, "ab");
+}
@@ -0,0 +1,59 @@
+//
+// NitroTextTestUtil.hpp
+// Helpers shared by the C++ tests
+//
+
+#pragma once
+
+#include "Fragment.hpp"
+
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace margelo::nitro::nitrotext::tests {
+
+template <typename T>
+void describeField(std::ostringstream& out, const char* name, const std::optional<T>& value)
+{
+  if (!value) return;
+  out << ' ' << name << '=';
+  if constexpr (std::is_enum_v<T>) {
+    out << static_cast<int>(*value);
+  } else {
+    out << *value;
+  }
+}
+
+/**
+ * Every set field of `fragments`, one fragment per line, so two lists compare
+ * as strings and a mismatch prints readably.
+ */
+inline std::string describe(const std::vector<Fragment>& fragments)
+{
+  std::ostringstream out;
+  for (const auto& fragment : fragments) {
+    out << '[' << fragment.text.value_or("") << ']';
+    describeField(out, "selectionColor", fragment.selectionColor);
+    describeField(out, "fontSize", fragment.fontSize);
+    describeField(out, "fontWeight", fragment.fontWeight);
+    describeField(out, "fontColor", fragment.fontColor);
+    describeField(out, "fragmentBackgroundColor", fragment.fragmentBackgroundColor);
+    describeField(out, "fontStyle", fragment.fontStyle);
+    describeField(out, "fontFamily", fragment.fontFamily);
+    describeField(out, "lineHeight", fragment.lineHeight);
+    describeField(out, "letterSpacing", fragment.letterSpacing);
+    describeField(out, "textAlign", fragment.textAlign);
+    describeField(out, "textTransform", fragment.textTransform);
+    describeField(out, "textDecorationLine", fragment.textDecorationLine);
+    describeField(out, "textDecorationColor", fragment.textDecorationColor);
+    describeField(out, "textDecorationStyle", fragment.textDecorationStyle);
+    describeField(out, "linkUrl", fragment.linkUrl);
+    out << '\n';
+  }
+  return out.str();
+}
+
+} // namespace margelo::nitro::nitrotext::tests
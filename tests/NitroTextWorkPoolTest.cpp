@@ -0,0 +1,41 @@
+//
+// NitroTextWorkPoolTest.cpp
+// WorkStealingPool runs every index once and surfaces failures
+//
+
+#include "NitroTextWorkPool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace margelo::nitro::nitrotext;
+
+TEST(WorkStealingPool, RunsEveryIndexOnce)
+{
+  WorkStealingPool pool(4);
+  EXPECT_EQ(pool.threadCount(), 4u);
+  for (const size_t count : {0, 1, 3, 1000}) {
+    std::vector<std::atomic<int>> calls(count);
+    pool.forEach(count, [&](size_t i) { calls[i]++; });
+    for (size_t i = 0; i < count; i++) {
+      EXPECT_EQ(calls[i].load(), 1) << i << " of " << count;
+    }
+  }
+}
+
+TEST(WorkStealingPool, RethrowsAndStaysUsable)
+{
+  WorkStealingPool pool(2);
+  EXPECT_THROW(pool.forEach(100,
+                            [](size_t i) {
+                              if (i == 42) throw std::runtime_error("failed");
+                            }),
+               std::runtime_error);
+
+  std::atomic<size_t> sum = 0;
+  pool.forEach(10, [&](size_t i) { sum += i; });
+  EXPECT_EQ(sum.load(), 45u);
+}